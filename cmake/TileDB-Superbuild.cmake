@@ -35,6 +35,7 @@ set(INHERITED_CMAKE_ARGS
   -DTILEDB_AZURE=${TILEDB_AZURE}
   -DTILEDB_GCS=${TILEDB_GCS}
   -DTILEDB_HDFS=${TILEDB_HDFS}
+  -DTILEDB_IO_URING=${TILEDB_IO_URING}
   -DTILEDB_WERROR=${TILEDB_WERROR}
   -DTILEDB_CPP_API=${TILEDB_CPP_API}
   -DTILEDB_FORCE_ALL_DEPS=${TILEDB_FORCE_ALL_DEPS}
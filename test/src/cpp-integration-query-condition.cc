@@ -38,6 +38,7 @@
 
 #include <test/support/tdb_catch.h>
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/cpp_api/tiledb_experimental"
 #include "tiledb/sm/misc/utils.h"
 
 using namespace tiledb;
@@ -2504,3 +2505,215 @@ TEST_CASE(
     vfs.remove_dir(array_name);
   }
 }
+
+TEST_CASE(
+    "Testing read query with set membership QC",
+    "[query][query-condition][set-membership]") {
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  auto array_type = GENERATE(TILEDB_SPARSE, TILEDB_DENSE);
+
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "d", {{1, 8}}, 4));
+  ArraySchema schema(ctx, array_type);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int>(ctx, "a"));
+  schema.add_attribute(Attribute::create<std::string>(ctx, "s"));
+  Array::create(array_name, schema);
+
+  // Write some initial data and close the array.
+  std::vector<int> d_data = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> a_data = {10, 11, 12, 13, 14, 15, 16, 17};
+  std::string s_data = "abcdefghiabjkl";
+  std::vector<uint64_t> s_offsets = {0, 2, 3, 5, 8, 9, 11, 12};
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_data_buffer("a", a_data)
+      .set_data_buffer("s", s_data)
+      .set_offsets_buffer("s", s_offsets);
+  if (array_type == TILEDB_SPARSE) {
+    query_w.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d_data);
+  } else {
+    query_w.set_layout(TILEDB_ROW_MAJOR)
+        .set_subarray(Subarray(ctx, array_w).add_range(0, 1, 8));
+  }
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Keep cells with `a` in the set and `s` not in the set.
+  std::vector<int> a_members = {11, 13, 14, 16, 100};
+  std::vector<std::string> s_members = {"ab", "fgh"};
+  auto qc_a = QueryConditionExperimental::create<int>(
+      ctx, "a", a_members, TILEDB_IN);
+  auto qc_s = QueryConditionExperimental::create(
+      ctx, "s", s_members, TILEDB_NOT_IN);
+  auto qc = qc_a.combine(qc_s, TILEDB_AND);
+
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+  std::vector<int> d_read(8);
+  std::vector<int> a_read(8);
+  query.set_layout(TILEDB_ROW_MAJOR)
+      .set_subarray(Subarray(ctx, array).add_range(0, 1, 8))
+      .set_data_buffer("d", d_read)
+      .set_data_buffer("a", a_read)
+      .set_condition(qc);
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  // Dense reads return all cells, with the filtered ones set to the fill
+  // value.
+  auto table = query.result_buffer_elements();
+  if (array_type == TILEDB_SPARSE) {
+    REQUIRE(table["a"].second == 3);
+    d_read.resize(3);
+    a_read.resize(3);
+    CHECK(d_read == std::vector<int>{2, 5, 7});
+    CHECK(a_read == std::vector<int>{11, 14, 16});
+  } else {
+    const int fill = std::numeric_limits<int>::min();
+    REQUIRE(table["a"].second == 8);
+    CHECK(a_read == std::vector<int>{fill, 11, fill, fill, 14, fill, 16, fill});
+  }
+
+  array.close();
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+}
+
+TEST_CASE(
+    "Testing read query skipping tiles with the tile min/max metadata",
+    "[query][query-condition][zone-map]") {
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  auto array_type = GENERATE(TILEDB_SPARSE, TILEDB_DENSE);
+  bool with_nan = GENERATE(true, false);
+
+  // Sparse arrays with duplicates are also read unordered, which goes through
+  // the unordered with duplicates reader.
+  bool allows_dups = false;
+  tiledb_layout_t read_layout = TILEDB_ROW_MAJOR;
+  if (array_type == TILEDB_SPARSE) {
+    allows_dups = GENERATE(true, false);
+    read_layout = TILEDB_GLOBAL_ORDER;
+    if (allows_dups) {
+      read_layout = GENERATE(TILEDB_GLOBAL_ORDER, TILEDB_UNORDERED);
+    }
+  }
+
+  // Two tiles of four cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int>(ctx, "d", {{1, 8}}, 4));
+  ArraySchema schema(ctx, array_type);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<float>(ctx, "a"));
+  if (array_type == TILEDB_SPARSE) {
+    schema.set_capacity(4);
+    schema.set_allows_dups(allows_dups);
+  }
+  Array::create(array_name, schema);
+
+  // A NaN value makes the min/max of the first tile unreliable, so the tile
+  // can't be skipped.
+  std::vector<int> d_data = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<float> a_data = {4, 3, 1, 2, 5, 6, 7, 8};
+  if (with_nan) {
+    a_data[0] = 9;
+    a_data[1] = std::numeric_limits<float>::quiet_NaN();
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_data_buffer("a", a_data);
+  if (array_type == TILEDB_SPARSE) {
+    query_w.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d_data);
+  } else {
+    query_w.set_layout(TILEDB_ROW_MAJOR)
+        .set_subarray(Subarray(ctx, array_w).add_range(0, 1, 8));
+  }
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  QueryCondition qc(ctx);
+  float value = 5.5f;
+  qc.init("a", &value, sizeof(float), TILEDB_GT);
+
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array);
+  std::vector<int> d_read(8);
+  std::vector<float> a_read(8);
+  query.set_layout(read_layout)
+      .set_subarray(Subarray(ctx, array).add_range(0, 1, 8))
+      .set_data_buffer("d", d_read)
+      .set_data_buffer("a", a_read)
+      .set_condition(qc);
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  auto table = query.result_buffer_elements();
+  if (array_type == TILEDB_SPARSE) {
+    std::vector<int> expected_d = {6, 7, 8};
+    std::vector<float> expected_a = {6, 7, 8};
+    if (with_nan) {
+      expected_d.insert(expected_d.begin(), 1);
+      expected_a.insert(expected_a.begin(), 9);
+    }
+    REQUIRE(table["a"].second == expected_a.size());
+    d_read.resize(expected_d.size());
+    a_read.resize(expected_a.size());
+    if (read_layout == TILEDB_UNORDERED) {
+      // Sort the cells by coordinate.
+      std::vector<std::pair<int, float>> cells;
+      for (uint64_t c = 0; c < d_read.size(); c++) {
+        cells.emplace_back(d_read[c], a_read[c]);
+      }
+      std::sort(cells.begin(), cells.end());
+      for (uint64_t c = 0; c < cells.size(); c++) {
+        d_read[c] = cells[c].first;
+        a_read[c] = cells[c].second;
+      }
+    }
+    CHECK(d_read == expected_d);
+    CHECK(a_read == expected_a);
+  } else {
+    // Dense reads return all cells, with the filtered ones set to the fill
+    // value.
+    const float fill = std::numeric_limits<float>::quiet_NaN();
+    REQUIRE(table["a"].second == 8);
+    for (uint64_t c = 0; c < 8; c++) {
+      if (a_data[c] > value) {
+        CHECK(a_read[c] == a_data[c]);
+      } else {
+        CHECK(std::memcmp(&a_read[c], &fill, sizeof(float)) == 0);
+      }
+    }
+  }
+
+  // The first tile is skipped without NaN values.
+  const std::string stats = query.stats();
+  const std::string counter = "tiles_skipped_by_condition\": ";
+  auto pos = stats.find(counter);
+  uint64_t skipped = pos == std::string::npos ?
+                         0 :
+                         std::stoull(stats.substr(pos + counter.size()));
+  CHECK(skipped == (with_nan ? 0 : 1));
+
+  array.close();
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+}
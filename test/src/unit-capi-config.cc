@@ -241,6 +241,9 @@ void check_save_to_file() {
   ss << "rest.use_refactored_array_open_and_query_submit false\n";
   ss << "sm.allow_separate_attribute_writes false\n";
   ss << "sm.allow_updates_experimental false\n";
+  ss << "sm.array_directory.incremental_reopen false\n";
+  ss << "sm.array_directory.incremental_reopen_window_ms 600000\n";
+  ss << "sm.array_schema_cache_size 0\n";
   ss << "sm.check_coord_dups true\n";
   ss << "sm.check_coord_oob true\n";
   ss << "sm.check_global_order true\n";
@@ -251,6 +254,8 @@ void check_save_to_file() {
   ss << "sm.consolidation.max_fragment_size " << std::to_string(UINT64_MAX)
      << "\n";
   ss << "sm.consolidation.mode fragments\n";
+  ss << "sm.consolidation.partition_commit_together true\n";
+  ss << "sm.consolidation.partition_num 1\n";
   ss << "sm.consolidation.purge_deleted_cells false\n";
   ss << "sm.consolidation.step_max_frags 4294967295\n";
   ss << "sm.consolidation.step_min_frags 4294967295\n";
@@ -261,12 +266,15 @@ void check_save_to_file() {
   ss << "sm.dedup_coords false\n";
   ss << "sm.enable_signal_handlers true\n";
   ss << "sm.encryption_type NO_ENCRYPTION\n";
+  ss << "sm.filter.fused_reverse_kernels true\n";
   ss << "sm.fragment_info.preload_mbrs false\n";
+  ss << "sm.fragment_metadata_cache_size 0\n";
   ss << "sm.group.timestamp_end 18446744073709551615\n";
   ss << "sm.group.timestamp_start 0\n";
   ss << "sm.io_concurrency_level " << std::thread::hardware_concurrency()
      << "\n";
   ss << "sm.max_tile_overlap_size 314572800\n";
+  ss << "sm.mem.context_budget 0\n";
   ss << "sm.mem.malloc_trim true\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_array_data 0.1\n";
   ss << "sm.mem.reader.sparse_global_order.ratio_coords 0.5\n";
@@ -285,11 +293,15 @@ void check_save_to_file() {
   ss << "sm.query.dense.qc_coords_mode false\n";
   ss << "sm.query.dense.reader refactored\n";
   ss << "sm.query.sparse_global_order.reader refactored\n";
+  ss << "sm.query.sparse_unordered.merge_runs false\n";
+  ss << "sm.query.sparse_unordered.writer batch\n";
   ss << "sm.query.sparse_unordered_with_dups.reader refactored\n";
   ss << "sm.read_range_oob warn\n";
+  ss << "sm.single_chunk_unfiltered_tiles false\n";
   ss << "sm.skip_checksum_validation false\n";
   ss << "sm.skip_est_size_partitioning false\n";
   ss << "sm.skip_unary_partitioning_budget_check false\n";
+  ss << "sm.tile_cache_size 0\n";
   ss << "sm.vacuum.mode fragments\n";
   ss << "sm.var_offsets.bitsize 64\n";
   ss << "sm.var_offsets.extra_element false\n";
@@ -302,6 +314,8 @@ void check_save_to_file() {
   ss << "vfs.file.max_parallel_ops 1\n";
   ss << "vfs.file.posix_directory_permissions 755\n";
   ss << "vfs.file.posix_file_permissions 644\n";
+  ss << "vfs.file.use_io_uring false\n";
+  ss << "vfs.file.use_mmap false\n";
   ss << "vfs.gcs.max_parallel_ops " << std::thread::hardware_concurrency()
      << "\n";
   ss << "vfs.gcs.multi_part_size 5242880\n";
@@ -602,6 +616,7 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.encryption_key"] = "";
   all_param_values["sm.encryption_type"] = "NO_ENCRYPTION";
   all_param_values["sm.dedup_coords"] = "false";
+  all_param_values["sm.single_chunk_unfiltered_tiles"] = "false";
   all_param_values["sm.partial_tile_offsets_loading"] = "false";
   all_param_values["sm.check_coord_dups"] = "true";
   all_param_values["sm.check_coord_oob"] = "true";
@@ -614,9 +629,18 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.query.dense.reader"] = "refactored";
   all_param_values["sm.query.sparse_global_order.reader"] = "refactored";
   all_param_values["sm.query.sparse_unordered_with_dups.reader"] = "refactored";
+  all_param_values["sm.query.sparse_unordered.writer"] = "batch";
+  all_param_values["sm.query.sparse_unordered.merge_runs"] = "false";
   all_param_values["sm.mem.malloc_trim"] = "true";
   all_param_values["sm.mem.tile_upper_memory_limit"] = "2147483648";
   all_param_values["sm.mem.total_budget"] = "10737418240";
+  all_param_values["sm.mem.context_budget"] = "0";
+  all_param_values["sm.tile_cache_size"] = "0";
+  all_param_values["sm.fragment_metadata_cache_size"] = "0";
+  all_param_values["sm.array_schema_cache_size"] = "0";
+  all_param_values["sm.array_directory.incremental_reopen"] = "false";
+  all_param_values["sm.array_directory.incremental_reopen_window_ms"] =
+      "600000";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_coords"] = "0.5";
   all_param_values["sm.mem.reader.sparse_global_order.ratio_query_condition"] =
       "0.25";
@@ -641,12 +665,15 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["sm.io_concurrency_level"] =
       std::to_string(std::thread::hardware_concurrency());
   all_param_values["sm.skip_checksum_validation"] = "false";
+  all_param_values["sm.filter.fused_reverse_kernels"] = "true";
   all_param_values["sm.consolidation.amplification"] = "1.0";
   all_param_values["sm.consolidation.steps"] = "4294967295";
   all_param_values["sm.consolidation.timestamp_start"] = "0";
   all_param_values["sm.consolidation.timestamp_end"] =
       std::to_string(UINT64_MAX);
   all_param_values["sm.consolidation.purge_deleted_cells"] = "false";
+  all_param_values["sm.consolidation.partition_num"] = "1";
+  all_param_values["sm.consolidation.partition_commit_together"] = "true";
   all_param_values["sm.consolidation.step_min_frags"] = "4294967295";
   all_param_values["sm.consolidation.step_max_frags"] = "4294967295";
   all_param_values["sm.consolidation.buffer_size"] = "50000000";
@@ -687,6 +714,8 @@ TEST_CASE("C API: Test config iter", "[capi][config]") {
   all_param_values["vfs.file.posix_file_permissions"] = "644";
   all_param_values["vfs.file.posix_directory_permissions"] = "755";
   all_param_values["vfs.file.max_parallel_ops"] = "1";
+  all_param_values["vfs.file.use_io_uring"] = "false";
+  all_param_values["vfs.file.use_mmap"] = "false";
   all_param_values["vfs.s3.scheme"] = "https";
   all_param_values["vfs.s3.region"] = "us-east-1";
   all_param_values["vfs.s3.aws_access_key_id"] = "";
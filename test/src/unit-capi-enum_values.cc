@@ -80,6 +80,8 @@ TEST_CASE("C API: Test enum values", "[capi][enums]") {
   REQUIRE(TILEDB_FILTER_XOR == 16);
   REQUIRE(TILEDB_FILTER_DEPRECATED == 17);
   REQUIRE(TILEDB_FILTER_WEBP == 18);
+  REQUIRE(TILEDB_FILTER_ADAPTIVE_COMPRESSION == 19);
+  REQUIRE(TILEDB_FILTER_PFOR == 20);
 
   /** Filter option */
   REQUIRE(TILEDB_COMPRESSION_LEVEL == 0);
@@ -243,6 +245,13 @@ TEST_CASE("C API: Test enum string conversion", "[capi][enums]") {
   REQUIRE(
       (tiledb_filter_type_from_str("WEBP", &filter_type) == TILEDB_OK &&
        filter_type == TILEDB_FILTER_WEBP));
+  REQUIRE(
+      (tiledb_filter_type_from_str("ADAPTIVE_COMPRESSION", &filter_type) ==
+           TILEDB_OK &&
+       filter_type == TILEDB_FILTER_ADAPTIVE_COMPRESSION));
+  REQUIRE(
+      (tiledb_filter_type_from_str("PFOR", &filter_type) == TILEDB_OK &&
+       filter_type == TILEDB_FILTER_PFOR));
 
   tiledb_filter_option_t filter_option;
   REQUIRE(
@@ -293,6 +302,10 @@ TEST_CASE("C API: Test enum string conversion", "[capi][enums]") {
       (tiledb_filter_option_from_str("WEBP_LOSSLESS", &filter_option) ==
            TILEDB_OK &&
        filter_option == TILEDB_WEBP_LOSSLESS));
+  REQUIRE(
+      (tiledb_filter_option_from_str(
+           "ADAPTIVE_DECODE_COST_WEIGHT", &filter_option) == TILEDB_OK &&
+       filter_option == TILEDB_ADAPTIVE_DECODE_COST_WEIGHT));
 
   tiledb_encryption_type_t encryption_type;
   REQUIRE(
@@ -38,6 +38,7 @@
 
 #include <ctime>
 #include <iostream>
+#include <vector>
 
 TEST_CASE(
     "Compression-DoubleDelta: Test 1-element case",
@@ -259,3 +260,37 @@ TEST_CASE(
   delete decomp_in_buff;
   delete decomp_out_buff;
 }
+
+TEST_CASE(
+    "Compression-DoubleDelta: Test n-element decreasing case",
+    "[compression][double-delta]") {
+  // Values decreasing through zero, so that the unsigned prefix sums of the
+  // decoder wrap around
+  uint64_t n = 10000;
+  std::vector<int16_t> data(n);
+  data[0] = 16000;
+  for (uint64_t i = 1; i < n; ++i)
+    data[i] = static_cast<int16_t>(data[i - 1] - 3 - i % 2);
+
+  // Compress
+  uint64_t nbytes = n * sizeof(int16_t);
+  tiledb::sm::ConstBuffer comp_in_buff(data.data(), nbytes);
+  tiledb::sm::Buffer comp_out_buff;
+  auto st = tiledb::sm::DoubleDelta::compress(
+      tiledb::sm::Datatype::INT16, &comp_in_buff, &comp_out_buff);
+  REQUIRE(st.ok());
+  CHECK(comp_out_buff.size() < nbytes / 4);
+
+  // Decompress
+  tiledb::sm::ConstBuffer decomp_in_buff(
+      comp_out_buff.data(), comp_out_buff.size());
+  std::vector<int16_t> decomp_data(n);
+  tiledb::sm::PreallocatedBuffer prealloc_buf(decomp_data.data(), nbytes);
+  st = tiledb::sm::DoubleDelta::decompress(
+      tiledb::sm::Datatype::INT16, &decomp_in_buff, &prealloc_buf);
+  REQUIRE(st.ok());
+  CHECK(prealloc_buf.offset() == nbytes);
+
+  // Check data
+  REQUIRE(decomp_data == data);
+}
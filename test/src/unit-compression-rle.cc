@@ -363,6 +363,26 @@ TEST_CASE(
       std::tuple(4, 2, 1, 5000));
 }
 
+TEST_CASE(
+    "Compression-RLE: Test reading string runs without decompressing",
+    "[compression][rle][rle-strings]") {
+  std::string str1 = "HG543232";
+  std::string str2 = "HG54";
+  std::string str3 = "A";
+  std::string_view uncompressed[] = {
+      str1, str1, str1, str1, str1, str2, str2, str3, str1};
+  const auto exp_size = 4 * 2 * sizeof(uint16_t) + 2 * str1.size() +
+                        str2.size() + str3.size();
+
+  std::vector<std::byte> compressed(exp_size);
+  tiledb::sm::RLE::compress<uint16_t, uint16_t>(uncompressed, compressed);
+
+  auto&& [run_strings, run_ends] = tiledb::sm::RLE::runs(
+      compressed, sizeof(uint16_t), sizeof(uint16_t));
+  CHECK(run_strings == std::vector<std::string_view>{str1, str2, str3, str1});
+  CHECK(run_ends == std::vector<uint64_t>{5, 7, 8, 9});
+}
+
 TEST_CASE(
     "Compression-RLE: Test compression of strings, small run lengths and "
     "string sizes",
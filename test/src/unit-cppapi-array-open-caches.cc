@@ -0,0 +1,237 @@
+/**
+ * @file unit-cppapi-array-open-caches.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the array schema cache and the incremental array directory listing
+ * used when reopening arrays.
+ */
+
+#include <string>
+#include <vector>
+
+#include "test/support/tdb_catch.h"
+#include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/cpp_api/tiledb_experimental"
+
+using namespace tiledb;
+
+namespace {
+
+/** Creates a sparse array with a single int32 attribute `a`. */
+void create_array(const Context& ctx, const std::string& array_name) {
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int32_t>(ctx, "d", {{1, 100}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+}
+
+/**
+ * Writes cells `[first, first + num)` with `a = d * 10`, at `timestamp` if
+ * it is not zero.
+ */
+void write_cells(
+    const Context& ctx,
+    const std::string& array_name,
+    int32_t first,
+    int32_t num,
+    uint64_t timestamp = 0) {
+  std::vector<int32_t> d;
+  std::vector<int32_t> a;
+  for (int32_t i = first; i < first + num; i++) {
+    d.push_back(i);
+    a.push_back(i * 10);
+  }
+
+  Array array(
+      ctx,
+      array_name,
+      TILEDB_WRITE,
+      timestamp == 0 ? TemporalPolicy() :
+                       TemporalPolicy(TimeTravel, timestamp));
+  Query query(ctx, array);
+  query.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a);
+  query.submit();
+  array.close();
+}
+
+/** Reads back all the cells of an open array and returns their `a` values. */
+std::vector<int32_t> read_cells(const Context& ctx, Array& array) {
+  std::vector<int32_t> a(100);
+  Query query(ctx, array);
+  query.set_layout(TILEDB_GLOBAL_ORDER).set_data_buffer("a", a);
+  REQUIRE(query.submit() == Query::Status::COMPLETE);
+  a.resize(query.result_buffer_elements()["a"].second);
+  return a;
+}
+
+/** Returns the expected `a` values of cells `[1, num]`. */
+std::vector<int32_t> expected_cells(int32_t num) {
+  std::vector<int32_t> a;
+  for (int32_t i = 1; i <= num; i++) {
+    a.push_back(i * 10);
+  }
+  return a;
+}
+
+}  // namespace
+
+TEST_CASE(
+    "C++ API: Array schema cache serves repeated opens",
+    "[cppapi][array-schema-cache]") {
+  const std::string array_name = "cpp_unit_array_schema_cache";
+  Config config;
+  config["sm.array_schema_cache_size"] = "10000000";
+  Context ctx(config);
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  create_array(ctx, array_name);
+  write_cells(ctx, array_name, 1, 10);
+
+  // The first open loads the schema, the second one hits the cache.
+  Array array1(ctx, array_name, TILEDB_READ);
+  array1.close();
+
+  Stats::reset();
+  Stats::enable();
+  Array array2(ctx, array_name, TILEDB_READ);
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  CHECK(stats.find("num_array_schema_cache_hits") != std::string::npos);
+
+  // Each array gets its own copy of the cached schema.
+  CHECK(array2.schema().attribute_num() == 1);
+  CHECK(array2.uri().find(array_name) != std::string::npos);
+  CHECK(read_cells(ctx, array2) == expected_cells(10));
+  array2.close();
+
+  // An evolved schema is a new schema file, so it is loaded from storage.
+  ArraySchemaEvolution evolution(ctx);
+  evolution.add_attribute(Attribute::create<int32_t>(ctx, "b"));
+  uint64_t now = tiledb_timestamp_now_ms() + 1;
+  evolution.set_timestamp_range({now, now});
+  evolution.array_evolve(array_name);
+
+  auto schema = Array::load_schema(ctx, array_name);
+  CHECK(schema.attribute_num() == 2);
+
+  vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Incremental array directory listing on reopen",
+    "[cppapi][array-directory][reopen]") {
+  const std::string array_name = "cpp_unit_array_incremental_reopen";
+  Config config;
+  config["sm.array_directory.incremental_reopen"] = "true";
+  Context ctx(config);
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  create_array(ctx, array_name);
+  write_cells(ctx, array_name, 1, 10);
+
+  Array array(ctx, array_name, TILEDB_READ);
+  CHECK(read_cells(ctx, array) == expected_cells(10));
+
+  // Reopening with nothing new sees the same data.
+  Stats::reset();
+  Stats::enable();
+  array.reopen();
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  CHECK(stats.find("incremental_list_num") != std::string::npos);
+  CHECK(read_cells(ctx, array) == expected_cells(10));
+
+  // New fragments are picked up by the incremental listing.
+  for (int32_t i = 1; i < 4; i++) {
+    write_cells(ctx, array_name, i * 10 + 1, 10);
+    array.reopen();
+    CHECK(read_cells(ctx, array) == expected_cells((i + 1) * 10));
+  }
+
+  // So are new schemas.
+  ArraySchemaEvolution evolution(ctx);
+  evolution.add_attribute(Attribute::create<int32_t>(ctx, "b"));
+  uint64_t now = tiledb_timestamp_now_ms() + 1;
+  evolution.set_timestamp_range({now, now});
+  evolution.array_evolve(array_name);
+  array.set_open_timestamp_end(now);
+  array.reopen();
+  CHECK(array.schema().attribute_num() == 2);
+  CHECK(read_cells(ctx, array) == expected_cells(40));
+
+  array.close();
+  vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Incremental reopen sees out of order timestamps",
+    "[cppapi][array-directory][reopen]") {
+  const std::string array_name = "cpp_unit_array_incremental_reopen_order";
+  Config config;
+  config["sm.array_directory.incremental_reopen"] = "true";
+  config["sm.array_directory.incremental_reopen_window_ms"] = "100";
+  Context ctx(config);
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  create_array(ctx, array_name);
+  write_cells(ctx, array_name, 1, 10, 100);
+  write_cells(ctx, array_name, 21, 10, 300);
+
+  Array array(ctx, array_name, TILEDB_READ);
+  CHECK(read_cells(ctx, array).size() == 20);
+
+  // A write committed after the one at 300 but at an earlier timestamp
+  // within the window is listed again by the reopen.
+  write_cells(ctx, array_name, 11, 10, 250);
+  Stats::reset();
+  Stats::enable();
+  array.reopen();
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  CHECK(stats.find("incremental_list_num") != std::string::npos);
+  CHECK(read_cells(ctx, array) == expected_cells(30));
+
+  array.close();
+  vfs.remove_dir(array_name);
+}
@@ -1937,3 +1937,80 @@ TEST_CASE(
   vfs.remove_dir(get_commit_dir(array_read.uri()));
   vfs.remove_dir(array_read.uri() + "/__schema");
 }
+
+TEST_CASE(
+    "C++ API: Read with memory-mapped fragment files",
+    "[cppapi][array][mmap]") {
+  const std::string array_name = "cpp_unit_array_mmap";
+  Config config;
+  config["vfs.file.use_mmap"] = "true";
+  config["sm.single_chunk_unfiltered_tiles"] = "true";
+  Context ctx(config);
+  VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  // Tiles of 'a' are larger than a filter chunk and stored without filters
+  // as a single chunk, tiles of 'b' are compressed and must still be
+  // unfiltered.
+  const int32_t num_cells = 100000;
+  const int32_t tile_extent = 30000;
+  auto array_type = GENERATE(TILEDB_DENSE, TILEDB_SPARSE);
+  Domain domain(ctx);
+  domain.add_dimension(
+      Dimension::create<int32_t>(ctx, "d", {{1, num_cells}}, tile_extent));
+  ArraySchema schema(ctx, array_type);
+  schema.set_domain(domain);
+  schema.set_capacity(tile_extent);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  FilterList filters(ctx);
+  filters.add_filter({ctx, TILEDB_FILTER_ZSTD});
+  schema.add_attribute(
+      Attribute::create<int64_t>(ctx, "b").set_filter_list(filters));
+  Array::create(array_name, schema);
+
+  std::vector<int32_t> d(num_cells);
+  std::vector<int32_t> a(num_cells);
+  std::vector<int64_t> b(num_cells);
+  for (int32_t i = 0; i < num_cells; i++) {
+    d[i] = i + 1;
+    a[i] = i * 7;
+    b[i] = -i;
+  }
+
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_data_buffer("a", a).set_data_buffer("b", b);
+  if (array_type == TILEDB_SPARSE) {
+    query_w.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d);
+  } else {
+    query_w.set_layout(TILEDB_ROW_MAJOR)
+        .set_subarray(Subarray(ctx, array_w).add_range(0, 1, num_cells));
+  }
+  query_w.submit();
+  array_w.close();
+
+  Stats::enable();
+  Stats::reset();
+  std::vector<int32_t> a_read(num_cells);
+  std::vector<int64_t> b_read(num_cells);
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r);
+  query_r.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_subarray(Subarray(ctx, array_r).add_range(0, 1, num_cells))
+      .set_data_buffer("a", a_read)
+      .set_data_buffer("b", b_read);
+  REQUIRE(query_r.submit() == Query::Status::COMPLETE);
+  CHECK(a_read == a);
+  CHECK(b_read == b);
+  array_r.close();
+
+  // The tiles of 'a' were used in place.
+  std::string stats;
+  Stats::dump(&stats);
+  Stats::disable();
+  CHECK(stats.find("num_tiles_mapped") != std::string::npos);
+
+  vfs.remove_dir(array_name);
+}
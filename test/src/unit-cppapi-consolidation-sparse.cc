@@ -34,6 +34,9 @@
 #include "test/support/src/helpers.h"
 #include "tiledb/sm/cpp_api/tiledb"
 
+#include <array>
+#include <tuple>
+
 using namespace tiledb;
 
 namespace sparse_consolidate {
@@ -149,4 +152,273 @@ TEST_CASE(
 
   remove_array(array_name);
 }
+
+void create_array_with_capacity(
+    const std::string& array_name,
+    uint64_t capacity,
+    bool allows_dups = false) {
+  Context ctx;
+  Domain domain(ctx);
+  auto d = Dimension::create<int>(ctx, "d", {{1, 100}}, 10);
+  domain.add_dimensions(d);
+  auto a = Attribute::create<int>(ctx, "a");
+  auto s = Attribute::create<std::string>(ctx, "s");
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attributes(a, s);
+  schema.set_capacity(capacity);
+  schema.set_allows_dups(allows_dups);
+  Array::create(array_name, schema);
+}
+
+void write_cells(const std::string& array_name, std::vector<int> d) {
+  Context ctx;
+  Array array(ctx, array_name, TILEDB_WRITE);
+  Query query(ctx, array, TILEDB_WRITE);
+  std::vector<int> values;
+  std::string chars;
+  std::vector<uint64_t> offsets;
+  for (auto c : d) {
+    values.emplace_back(c * 10);
+    offsets.emplace_back(chars.size());
+    chars += std::string(c % 3 + 1, 'a' + c % 26);
+  }
+  query.set_layout(TILEDB_UNORDERED);
+  query.set_data_buffer("d", d);
+  query.set_data_buffer("a", values);
+  query.set_data_buffer("s", chars).set_offsets_buffer("s", offsets);
+  query.submit();
+  array.close();
+}
+
+std::tuple<std::vector<int>, std::vector<int>, std::string> read_cells(
+    const std::string& array_name) {
+  Context ctx;
+  Array array(ctx, array_name, TILEDB_READ);
+  Query query(ctx, array, TILEDB_READ);
+  std::vector<int> d(100);
+  std::vector<int> values(100);
+  std::string chars(1000, 0);
+  std::vector<uint64_t> offsets(100);
+  query.set_layout(TILEDB_GLOBAL_ORDER);
+  query.set_data_buffer("d", d);
+  query.set_data_buffer("a", values);
+  query.set_data_buffer("s", chars).set_offsets_buffer("s", offsets);
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+  auto result = query.result_buffer_elements();
+  d.resize(result["d"].second);
+  values.resize(result["a"].second);
+  chars.resize(result["s"].second);
+  array.close();
+  return {d, values, chars};
+}
+
+/** Consolidates the array and returns the number of tiles copied. */
+uint64_t consolidate_and_count_tile_copies(
+    const std::string& array_name, const Config& config = Config()) {
+  Context ctx(config);
+  Stats::reset();
+  Stats::enable();
+  Array::consolidate(ctx, array_name);
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  const std::string counter = "consolidate_copy_tiles_num\": ";
+  auto pos = stats.find(counter);
+  if (pos == std::string::npos) {
+    return 0;
+  }
+  return std::stoull(stats.substr(pos + counter.size()));
+}
+
+TEST_CASE(
+    "C++ API: Test sparse consolidation copying tiles",
+    "[cppapi][consolidation][sparse][copy-tiles]") {
+  std::string array_name = "cppapi_consolidation_sparse_copy_tiles";
+  remove_array(array_name);
+  create_array_with_capacity(array_name, 2);
+
+  // Fragments that follow each other in the global order and end with full
+  // tiles have their tiles copied as they are.
+  write_cells(array_name, {1, 2, 3, 4});
+  write_cells(array_name, {5, 6});
+  write_cells(array_name, {11, 12, 25});
+  auto expected = read_cells(array_name);
+  CHECK(
+      std::get<0>(expected) ==
+      std::vector<int>{1, 2, 3, 4, 5, 6, 11, 12, 25});
+
+  CHECK(consolidate_and_count_tile_copies(array_name) == 5);
+  Context ctx;
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 1);
+  CHECK(read_cells(array_name) == expected);
+
+  // A new write between existing cells falls back to merging the cells.
+  write_cells(array_name, {7, 8});
+  CHECK(consolidate_and_count_tile_copies(array_name) == 0);
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 1);
+  CHECK(
+      std::get<0>(read_cells(array_name)) ==
+      std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 11, 12, 25});
+
+  // So do fragments that all end with a partial tile, as copying their tiles
+  // would not reduce the number of fragments.
+  write_cells(array_name, {30});
+  write_cells(array_name, {40, 41});
+  CHECK(consolidate_and_count_tile_copies(array_name) == 0);
+
+  remove_array(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test sparse consolidation copying runs of tiles",
+    "[cppapi][consolidation][sparse][copy-tiles]") {
+  std::string array_name = "cppapi_consolidation_sparse_copy_tile_runs";
+  remove_array(array_name);
+  create_array_with_capacity(array_name, 2);
+
+  // The first fragment ends with a partial tile, so it is kept as it is, the
+  // next two are copied and the last two, which overlap, are merged.
+  write_cells(array_name, {1, 2, 3});
+  write_cells(array_name, {5, 6});
+  write_cells(array_name, {11, 12, 13});
+  write_cells(array_name, {20, 40});
+  write_cells(array_name, {30, 35});
+  auto expected = read_cells(array_name);
+  CHECK(
+      std::get<0>(expected) ==
+      std::vector<int>{1, 2, 3, 5, 6, 11, 12, 13, 20, 30, 35, 40});
+
+  Config config;
+  config["sm.consolidation.steps"] = "1";
+  CHECK(consolidate_and_count_tile_copies(array_name, config) == 3);
+  Context ctx;
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 3);
+  CHECK(read_cells(array_name) == expected);
+
+  // The resulting fragments all end with a partial tile, so the next step
+  // merges their cells.
+  CHECK(consolidate_and_count_tile_copies(array_name, config) == 0);
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 1);
+  CHECK(read_cells(array_name) == expected);
+
+  remove_array(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test sparse consolidation merging a run between copied runs",
+    "[cppapi][consolidation][sparse][copy-tiles]") {
+  std::string array_name = "cppapi_consolidation_sparse_merge_run";
+  remove_array(array_name);
+  create_array_with_capacity(array_name, 2);
+
+  // Two disjoint runs of full tiles are copied, and the overlapping
+  // fragments written between them are merged on their own.
+  write_cells(array_name, {1, 2});
+  write_cells(array_name, {3, 4});
+  write_cells(array_name, {20, 40});
+  write_cells(array_name, {30, 35});
+  write_cells(array_name, {50, 51});
+  write_cells(array_name, {52, 53});
+  auto expected = read_cells(array_name);
+  CHECK(
+      std::get<0>(expected) ==
+      std::vector<int>{1, 2, 3, 4, 20, 30, 35, 40, 50, 51, 52, 53});
+
+  Config config;
+  config["sm.consolidation.steps"] = "1";
+  CHECK(consolidate_and_count_tile_copies(array_name, config) == 4);
+  Context ctx;
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 3);
+  CHECK(read_cells(array_name) == expected);
+
+  // The merged fragment only covers the cells of its run.
+  FragmentInfo fragment_info(ctx, array_name);
+  fragment_info.load();
+  REQUIRE(fragment_info.fragment_num() == 3);
+  std::vector<std::array<int, 2>> non_empty_domains(3);
+  for (uint32_t f = 0; f < 3; f++) {
+    fragment_info.get_non_empty_domain(f, 0, non_empty_domains[f].data());
+  }
+  CHECK(non_empty_domains[0] == std::array<int, 2>{1, 4});
+  CHECK(non_empty_domains[1] == std::array<int, 2>{20, 40});
+  CHECK(non_empty_domains[2] == std::array<int, 2>{50, 53});
+
+  remove_array(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test sparse consolidation in partitions",
+    "[cppapi][consolidation][sparse][partitions]") {
+  std::string array_name = "cppapi_consolidation_sparse_partitions";
+  remove_array(array_name);
+  create_array_with_capacity(array_name, 2);
+
+  write_cells(array_name, {1, 2, 3});
+  write_cells(array_name, {15, 25, 35, 45});
+  write_cells(array_name, {50, 99});
+  auto expected = read_cells(array_name);
+
+  // The domain [1, 99] spans tiles 0 to 9, split in 3 partitions of tiles
+  // [0, 2], [3, 5] and [6, 9], each consolidated into its own fragment.
+  Context ctx;
+  Config config;
+  config["sm.consolidation.partition_num"] = "3";
+  config["sm.consolidation.partition_commit_together"] =
+      GENERATE("true", "false");
+  Stats::reset();
+  Stats::enable();
+  Array::consolidate(ctx, array_name, &config);
+  Stats::disable();
+  std::string stats;
+  Stats::dump(&stats);
+  CHECK(stats.find("consolidate_partitions_num") != std::string::npos);
+  CHECK(stats.find("Partition2") != std::string::npos);
+
+  CHECK(tiledb::test::num_fragments(array_name) == 6);
+  CHECK(read_cells(array_name) == expected);
+  Array::vacuum(ctx, array_name);
+  CHECK(tiledb::test::num_fragments(array_name) == 3);
+  CHECK(read_cells(array_name) == expected);
+
+  remove_array(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test sparse consolidation in partitions over several steps",
+    "[cppapi][consolidation][sparse][partitions]") {
+  std::string array_name = "cppapi_consolidation_sparse_partitions_steps";
+  remove_array(array_name);
+  const bool allows_dups = GENERATE(true, false);
+  create_array_with_capacity(array_name, 2, allows_dups);
+
+  // Every step consolidates two fragments in partitions, so the second step
+  // works on the fragments created by the first one. The second fragment
+  // duplicates a cell of the first one on arrays allowing duplicates.
+  write_cells(array_name, {1, 2, 3});
+  write_cells(array_name, {2, 15, 25, 45});
+  write_cells(array_name, {50, 99});
+  auto expected = read_cells(array_name);
+
+  Context ctx;
+  Config config;
+  config["sm.consolidation.partition_num"] = "3";
+  config["sm.consolidation.partition_commit_together"] = "false";
+  config["sm.consolidation.steps"] = "2";
+  config["sm.consolidation.step_min_frags"] = "2";
+  config["sm.consolidation.step_max_frags"] = "2";
+  config["sm.consolidation.step_size_ratio"] = "0";
+  Array::consolidate(ctx, array_name, &config);
+  CHECK(read_cells(array_name) == expected);
+  Array::vacuum(ctx, array_name);
+  CHECK(read_cells(array_name) == expected);
+
+  remove_array(array_name);
+}
 }  // namespace sparse_consolidate
@@ -0,0 +1,317 @@
+/**
+ * @file   unit-cppapi-query-aggregates.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the C++ API for query aggregates.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/cpp_api/tiledb_experimental"
+
+#include <limits>
+
+using namespace tiledb;
+
+struct CppAggregatesFx {
+  // Constants.
+  const char* ARRAY_NAME = "test_aggregates_array";
+
+  // TileDB context.
+  Context ctx_;
+  VFS vfs_;
+
+  // Constructors/destructors.
+  CppAggregatesFx();
+  ~CppAggregatesFx();
+
+  // Functions.
+  void create_array(tiledb_array_type_t type, bool allows_dups);
+  void write_fragments(tiledb_array_type_t type);
+  void check_aggregates(
+      tiledb_layout_t layout,
+      std::optional<std::pair<uint64_t, uint64_t>> range,
+      uint64_t count,
+      int64_t sum_a,
+      int32_t min_a,
+      int32_t max_a,
+      int64_t sum_b,
+      uint64_t null_count_b,
+      uint64_t metadata_tiles);
+  void remove_array();
+};
+
+CppAggregatesFx::CppAggregatesFx()
+    : vfs_(ctx_) {
+  remove_array();
+}
+
+CppAggregatesFx::~CppAggregatesFx() {
+  remove_array();
+}
+
+void CppAggregatesFx::create_array(
+    tiledb_array_type_t type, bool allows_dups) {
+  // Two tiles of four cells.
+  Domain domain(ctx_);
+  domain.add_dimension(Dimension::create<uint64_t>(ctx_, "d", {{1, 8}}, 4));
+
+  auto b = Attribute::create<int32_t>(ctx_, "b");
+  b.set_nullable(true);
+
+  ArraySchema schema(ctx_, type);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int32_t>(ctx_, "a"));
+  schema.add_attribute(b);
+  if (type == TILEDB_SPARSE) {
+    schema.set_capacity(4);
+    schema.set_allows_dups(allows_dups);
+  }
+
+  Array::create(ARRAY_NAME, schema);
+}
+
+void CppAggregatesFx::write_fragments(tiledb_array_type_t type) {
+  // First fragment writes a = d and b = d, b being null for even cells. The
+  // second fragment writes a = b = 100 for cell 3.
+  std::vector<std::vector<uint64_t>> d = {{1, 2, 3, 4, 5, 6, 7, 8}, {3}};
+  std::vector<std::vector<int32_t>> a = {{1, 2, 3, 4, 5, 6, 7, 8}, {100}};
+  std::vector<std::vector<uint8_t>> b_validity = {
+      {1, 0, 1, 0, 1, 0, 1, 0}, {1}};
+
+  Array array(ctx_, ARRAY_NAME, TILEDB_WRITE);
+  for (uint64_t f = 0; f < d.size(); f++) {
+    Query query(ctx_, array, TILEDB_WRITE);
+    auto b = a[f];
+    query.set_data_buffer("a", a[f])
+        .set_data_buffer("b", b)
+        .set_validity_buffer("b", b_validity[f]);
+    if (type == TILEDB_SPARSE) {
+      query.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d[f]);
+    } else {
+      Subarray subarray(ctx_, array);
+      subarray.add_range<uint64_t>(0, d[f].front(), d[f].back());
+      query.set_layout(TILEDB_ROW_MAJOR).set_subarray(subarray);
+    }
+    query.submit();
+    CHECK(query.query_status() == Query::Status::COMPLETE);
+  }
+  array.close();
+}
+
+void CppAggregatesFx::check_aggregates(
+    tiledb_layout_t layout,
+    std::optional<std::pair<uint64_t, uint64_t>> range,
+    uint64_t count,
+    int64_t sum_a,
+    int32_t min_a,
+    int32_t max_a,
+    int64_t sum_b,
+    uint64_t null_count_b,
+    uint64_t metadata_tiles) {
+  Array array(ctx_, ARRAY_NAME, TILEDB_READ);
+  Query query(ctx_, array, TILEDB_READ);
+  query.set_layout(layout);
+  if (range.has_value()) {
+    Subarray subarray(ctx_, array);
+    subarray.add_range<uint64_t>(0, range->first, range->second);
+    query.set_subarray(subarray);
+  }
+
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_COUNT);
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_SUM);
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_MIN);
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_MAX);
+  QueryExperimental::add_aggregate(ctx_, query, "b", TILEDB_AGGREGATE_SUM);
+  QueryExperimental::add_aggregate(
+      ctx_, query, "b", TILEDB_AGGREGATE_NULL_COUNT);
+  Stats::enable();
+  query.submit();
+  Stats::disable();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  // Check the number of tiles aggregated from their tile metadata.
+  const std::string counter = "aggregate_tile_metadata_num\": ";
+  auto stats = query.stats();
+  auto pos = stats.find(counter);
+  CHECK(
+      (pos == std::string::npos ?
+           0 :
+           std::stoull(stats.substr(pos + counter.size()))) ==
+      metadata_tiles);
+
+  auto&& [count_ret, count_valid] = QueryExperimental::get_aggregate<uint64_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_COUNT);
+  CHECK(count_valid);
+  CHECK(count_ret == count);
+
+  auto&& [sum_a_ret, sum_a_valid] = QueryExperimental::get_aggregate<int64_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_SUM);
+  CHECK(sum_a_valid);
+  CHECK(sum_a_ret == sum_a);
+
+  auto&& [min_a_ret, min_a_valid] = QueryExperimental::get_aggregate<int32_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_MIN);
+  CHECK(min_a_valid);
+  CHECK(min_a_ret == min_a);
+
+  auto&& [max_a_ret, max_a_valid] = QueryExperimental::get_aggregate<int32_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_MAX);
+  CHECK(max_a_valid);
+  CHECK(max_a_ret == max_a);
+
+  auto&& [sum_b_ret, sum_b_valid] = QueryExperimental::get_aggregate<int64_t>(
+      ctx_, query, "b", TILEDB_AGGREGATE_SUM);
+  CHECK(sum_b_valid);
+  CHECK(sum_b_ret == sum_b);
+
+  auto&& [null_count_ret, null_count_valid] =
+      QueryExperimental::get_aggregate<uint64_t>(
+          ctx_, query, "b", TILEDB_AGGREGATE_NULL_COUNT);
+  CHECK(null_count_valid);
+  CHECK(null_count_ret == null_count_b);
+
+  array.close();
+}
+
+void CppAggregatesFx::remove_array() {
+  if (vfs_.is_dir(ARRAY_NAME)) {
+    vfs_.remove_dir(ARRAY_NAME);
+  }
+}
+
+TEST_CASE_METHOD(
+    CppAggregatesFx,
+    "C++ API: Query aggregates, sparse",
+    "[cppapi][query-aggregates][sparse]") {
+  bool allows_dups = GENERATE(true, false);
+  create_array(TILEDB_SPARSE, allows_dups);
+  write_fragments(TILEDB_SPARSE);
+
+  auto layout = allows_dups ? TILEDB_UNORDERED : TILEDB_GLOBAL_ORDER;
+  if (allows_dups) {
+    // Both values of cell 3 are aggregated. All the tiles covered by the
+    // subarray are aggregated from their tile metadata.
+    check_aggregates(layout, std::nullopt, 9, 136, 1, 100, 116, 4, 3);
+    check_aggregates(layout, std::make_pair(2, 6), 6, 120, 2, 100, 108, 3, 1);
+  } else {
+    // The second fragment overwrites cell 3, so only the second tile of the
+    // first fragment is aggregated from its tile metadata.
+    check_aggregates(layout, std::nullopt, 8, 133, 1, 100, 113, 4, 1);
+    check_aggregates(layout, std::make_pair(2, 6), 5, 117, 2, 100, 105, 3, 0);
+  }
+}
+
+TEST_CASE_METHOD(
+    CppAggregatesFx,
+    "C++ API: Query aggregates, dense",
+    "[cppapi][query-aggregates][dense]") {
+  create_array(TILEDB_DENSE, false);
+  write_fragments(TILEDB_DENSE);
+
+  // The second tile is aggregated from the tile metadata when the whole
+  // domain is read.
+  auto layout = GENERATE(TILEDB_ROW_MAJOR, TILEDB_GLOBAL_ORDER);
+  check_aggregates(layout, std::make_pair(1, 8), 8, 133, 1, 100, 113, 4, 1);
+  check_aggregates(layout, std::make_pair(2, 6), 5, 117, 2, 100, 105, 3, 0);
+}
+
+TEST_CASE_METHOD(
+    CppAggregatesFx,
+    "C++ API: Query aggregates, sum overflow",
+    "[cppapi][query-aggregates][overflow]") {
+  Domain domain(ctx_);
+  domain.add_dimension(Dimension::create<uint64_t>(ctx_, "d", {{1, 8}}, 4));
+  ArraySchema schema(ctx_, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int64_t>(ctx_, "a"));
+  schema.set_capacity(4);
+  schema.set_allows_dups(true);
+  Array::create(ARRAY_NAME, schema);
+
+  // The sum of the first two cells overflows, so does the tile sum.
+  std::vector<uint64_t> d = {1, 2, 3};
+  std::vector<int64_t> a = {std::numeric_limits<int64_t>::max(), 1, -1};
+  Array array(ctx_, ARRAY_NAME, TILEDB_WRITE);
+  Query write(ctx_, array, TILEDB_WRITE);
+  write.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a);
+  write.submit();
+  array.close();
+
+  array.open(TILEDB_READ);
+  Query query(ctx_, array, TILEDB_READ);
+  query.set_layout(TILEDB_UNORDERED);
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_SUM);
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_MAX);
+  query.submit();
+  CHECK(query.query_status() == Query::Status::COMPLETE);
+
+  // The overflowed sum is an error, the other aggregates are not affected.
+  CHECK_THROWS(QueryExperimental::get_aggregate<int64_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_SUM));
+  auto&& [max, max_valid] = QueryExperimental::get_aggregate<int64_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_MAX);
+  CHECK(max_valid);
+  CHECK(max == std::numeric_limits<int64_t>::max());
+
+  array.close();
+}
+
+TEST_CASE_METHOD(
+    CppAggregatesFx,
+    "C++ API: Query aggregates, errors",
+    "[cppapi][query-aggregates][errors]") {
+  create_array(TILEDB_SPARSE, true);
+  write_fragments(TILEDB_SPARSE);
+
+  Array array(ctx_, ARRAY_NAME, TILEDB_READ);
+  Query query(ctx_, array, TILEDB_READ);
+  query.set_layout(TILEDB_UNORDERED);
+
+  // NULL_COUNT needs a nullable attribute.
+  CHECK_THROWS(QueryExperimental::add_aggregate(
+      ctx_, query, "a", TILEDB_AGGREGATE_NULL_COUNT));
+
+  // Aggregates can't be added twice.
+  QueryExperimental::add_aggregate(ctx_, query, "a", TILEDB_AGGREGATE_SUM);
+  CHECK_THROWS(QueryExperimental::add_aggregate(
+      ctx_, query, "a", TILEDB_AGGREGATE_SUM));
+
+  // Aggregates that were not added can't be read.
+  CHECK_THROWS(QueryExperimental::get_aggregate<int32_t>(
+      ctx_, query, "a", TILEDB_AGGREGATE_MIN));
+
+  // Aggregate queries don't return cells.
+  std::vector<int32_t> a(8);
+  query.set_data_buffer("a", a);
+  CHECK_THROWS(query.submit());
+
+  array.close();
+}
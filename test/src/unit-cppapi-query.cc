@@ -32,6 +32,7 @@
 
 #include <test/support/tdb_catch.h>
 #include "tiledb/sm/cpp_api/tiledb"
+#include "tiledb/sm/misc/hilbert.h"
 #include "tiledb/sm/misc/utils.h"
 
 using namespace tiledb;
@@ -292,6 +293,303 @@ TEST_CASE(
     vfs.remove_dir(array_name);
 }
 
+TEST_CASE(
+    "C++ API: Test unordered write sort order",
+    "[cppapi][query][unordered]") {
+  const std::string array_name = "cpp_unit_array_unordered_sort";
+
+  // Use enough compute threads and cells for the radix sort to split the
+  // cells in several chunks.
+  Config cfg;
+  cfg["sm.compute_concurrency_level"] = "4";
+  Context ctx(cfg);
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  tiledb_layout_t tile_order = GENERATE(TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR);
+  tiledb_layout_t cell_order =
+      GENERATE(TILEDB_ROW_MAJOR, TILEDB_COL_MAJOR, TILEDB_HILBERT);
+  const int32_t num_rows = 20;
+  const int32_t num_cols = 1000;
+  const int32_t num_cells = num_rows * num_cols;
+
+  // Create the array, with tile extents that do not divide the domains.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int32_t>(ctx, "rows", {{-10, 9}}, 3))
+      .add_dimension(
+          Dimension::create<int64_t>(ctx, "cols", {{0, num_cols - 1}}, 7));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_order({{tile_order, cell_order}});
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write all the cells in a scrambled order.
+  std::vector<int32_t> rows_w;
+  std::vector<int64_t> cols_w;
+  std::vector<int32_t> data_w;
+  for (int32_t i = 0; i < num_cells; ++i) {
+    int32_t cell = (i * 739) % num_cells;
+    rows_w.emplace_back(cell / num_cols - 10);
+    cols_w.emplace_back(cell % num_cols);
+    data_w.emplace_back(cell);
+  }
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("rows", rows_w)
+      .set_data_buffer("cols", cols_w)
+      .set_data_buffer("a", data_w);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Sort the cells in global order. The Hilbert values map the coordinates
+  // to buckets the same way the writer does, and are unique for this domain.
+  tiledb::sm::Hilbert h(2);
+  const uint64_t max_bucket_val = ((uint64_t)1 << h.bits()) - 1;
+  auto hilbert_value = [&](int64_t r, int64_t c) {
+    uint64_t coords[] = {
+        static_cast<uint64_t>(r / double(num_rows - 1) * max_bucket_val),
+        static_cast<uint64_t>(c / double(num_cols - 1) * max_bucket_val)};
+    return h.coords_to_hilbert(coords);
+  };
+  auto global_order_key = [&](int32_t cell) {
+    int64_t r = cell / num_cols;
+    int64_t c = cell % num_cols;
+    auto tile = tile_order == TILEDB_ROW_MAJOR ?
+                    std::make_pair(r / 3, c / 7) :
+                    std::make_pair(c / 7, r / 3);
+    auto in_tile = cell_order == TILEDB_ROW_MAJOR ? std::make_pair(r, c) :
+                                                    std::make_pair(c, r);
+    return std::make_pair(tile, in_tile);
+  };
+  std::vector<int32_t> expected(data_w);
+  if (cell_order == TILEDB_HILBERT) {
+    std::sort(expected.begin(), expected.end(), [&](int32_t a, int32_t b) {
+      return hilbert_value(a / num_cols, a % num_cols) <
+             hilbert_value(b / num_cols, b % num_cols);
+    });
+  } else {
+    std::sort(expected.begin(), expected.end(), [&](int32_t a, int32_t b) {
+      return global_order_key(a) < global_order_key(b);
+    });
+  }
+
+  // Read the array in global order.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r);
+  std::vector<int32_t> data_r(num_cells);
+  query_r.set_layout(TILEDB_GLOBAL_ORDER).set_data_buffer("a", data_r);
+  query_r.submit();
+  REQUIRE(query_r.query_status() == Query::Status::COMPLETE);
+  CHECK(data_r == expected);
+  query_r.finalize();
+  array_r.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test streaming unordered writes",
+    "[cppapi][query][unordered][streaming]") {
+  const std::string array_name = "cpp_unit_array_unordered_streaming";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  const bool merge_runs = GENERATE(false, true);
+
+  // Create the array.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{0, 3999}}, 100));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  schema.add_attribute(Attribute::create<std::string>(ctx, "s"));
+  Array::create(array_name, schema);
+
+  // Write the cells in four scrambled batches with a budget that fits a few
+  // hundred cells per run, then overwrite the first 500 cells.
+  Config config;
+  config["sm.query.sparse_unordered.writer"] = "streaming";
+  config["sm.query.sparse_unordered.merge_runs"] =
+      merge_runs ? "true" : "false";
+  config["sm.mem.total_budget"] = "32000";
+  Context ctx_w(config);
+  Array array_w(ctx_w, array_name, TILEDB_WRITE);
+  Query query_w(ctx_w, array_w);
+  query_w.set_layout(TILEDB_UNORDERED);
+  auto value = [](int64_t cell, int32_t version) {
+    return std::string(cell % 5, static_cast<char>('a' + version)) +
+           std::to_string(cell);
+  };
+  auto submit = [&](int64_t start, int64_t num, int32_t version) {
+    std::vector<int64_t> d_w;
+    std::vector<int32_t> a_w;
+    std::vector<uint64_t> s_offsets_w;
+    std::string s_w;
+    for (int64_t i = 0; i < num; ++i) {
+      int64_t cell = start + (i * 347) % num;
+      d_w.emplace_back(cell);
+      a_w.emplace_back(static_cast<int32_t>(cell) + version * 10000);
+      s_offsets_w.emplace_back(s_w.size());
+      s_w += value(cell, version);
+    }
+    query_w.set_data_buffer("d", d_w)
+        .set_data_buffer("a", a_w)
+        .set_data_buffer("s", s_w)
+        .set_offsets_buffer("s", s_offsets_w);
+    query_w.submit();
+    REQUIRE(query_w.query_status() == Query::Status::COMPLETE);
+  };
+  for (int64_t b = 0; b < 4; ++b) {
+    submit(b * 1000, 1000, 0);
+  }
+  submit(0, 500, 1);
+  query_w.finalize();
+  CHECK(query_w.fragment_num() > 4);
+  array_w.close();
+
+  FragmentInfo fragment_info(ctx, array_name);
+  fragment_info.load();
+  if (merge_runs) {
+    CHECK(fragment_info.fragment_num() == 1);
+  } else {
+    CHECK(fragment_info.fragment_num() > 4);
+  }
+
+  // Read the array back; the overwritten cells have the later values.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r);
+  std::vector<int64_t> d_r(4000);
+  std::vector<int32_t> a_r(4000);
+  std::vector<uint64_t> s_offsets_r(4000);
+  std::string s_r;
+  s_r.resize(64000);
+  query_r.set_layout(TILEDB_ROW_MAJOR)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r)
+      .set_data_buffer("s", s_r)
+      .set_offsets_buffer("s", s_offsets_r);
+  query_r.submit();
+  REQUIRE(query_r.query_status() == Query::Status::COMPLETE);
+  auto result_num = query_r.result_buffer_elements()["d"].second;
+  REQUIRE(result_num == 4000);
+  s_r.resize(query_r.result_buffer_elements()["s"].second);
+  s_offsets_r.emplace_back(s_r.size());
+  for (int64_t cell = 0; cell < 4000; ++cell) {
+    int32_t version = cell < 500 ? 1 : 0;
+    CHECK(d_r[cell] == cell);
+    CHECK(a_r[cell] == static_cast<int32_t>(cell) + version * 10000);
+    CHECK(
+        s_r.substr(
+            s_offsets_r[cell], s_offsets_r[cell + 1] - s_offsets_r[cell]) ==
+        value(cell, version));
+  }
+  query_r.finalize();
+  array_r.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "C++ API: Test filtering and writing tiles in batches",
+    "[cppapi][query][write][batches]") {
+  const std::string array_name = "cpp_unit_array_write_batches";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  tiledb_layout_t layout = GENERATE(TILEDB_UNORDERED, TILEDB_GLOBAL_ORDER);
+
+  // Create the array with small, compressed tiles.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int64_t>(ctx, "d", {{0, 999}}, 100));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(10);
+  FilterList filters(ctx);
+  filters.add_filter({ctx, TILEDB_FILTER_ZSTD});
+  auto a = Attribute::create<int32_t>(ctx, "a");
+  a.set_filter_list(filters).set_nullable(true);
+  auto s = Attribute::create<std::string>(ctx, "s");
+  s.set_filter_list(filters);
+  schema.add_attribute(a).add_attribute(s);
+  Array::create(array_name, schema);
+
+  // Write with a budget that fits a couple of tiles per batch.
+  std::vector<int64_t> d_w;
+  std::vector<int32_t> a_w;
+  std::vector<uint8_t> a_validity_w;
+  std::vector<uint64_t> s_offsets_w;
+  std::string s_w;
+  for (int64_t i = 0; i < 1000; ++i) {
+    int64_t cell = layout == TILEDB_UNORDERED ? (i * 347) % 1000 : i;
+    d_w.emplace_back(cell);
+    a_w.emplace_back(static_cast<int32_t>(cell));
+    a_validity_w.emplace_back(cell % 3 != 0);
+    s_offsets_w.emplace_back(s_w.size());
+    s_w += std::to_string(cell * cell);
+  }
+  Config config;
+  config["sm.mem.total_budget"] = "1000";
+  Context ctx_w(config);
+  Array array_w(ctx_w, array_name, TILEDB_WRITE);
+  Query query_w(ctx_w, array_w);
+  query_w.set_layout(layout)
+      .set_data_buffer("d", d_w)
+      .set_data_buffer("a", a_w)
+      .set_validity_buffer("a", a_validity_w)
+      .set_data_buffer("s", s_w)
+      .set_offsets_buffer("s", s_offsets_w);
+  query_w.submit();
+  query_w.finalize();
+  array_w.close();
+
+  // Read the array back.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Query query_r(ctx, array_r);
+  std::vector<int64_t> d_r(1000);
+  std::vector<int32_t> a_r(1000);
+  std::vector<uint8_t> a_validity_r(1000);
+  std::vector<uint64_t> s_offsets_r(1000);
+  std::string s_r;
+  s_r.resize(s_w.size());
+  query_r.set_layout(TILEDB_ROW_MAJOR)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r)
+      .set_validity_buffer("a", a_validity_r)
+      .set_data_buffer("s", s_r)
+      .set_offsets_buffer("s", s_offsets_r);
+  query_r.submit();
+  REQUIRE(query_r.query_status() == Query::Status::COMPLETE);
+  REQUIRE(query_r.result_buffer_elements()["d"].second == 1000);
+  s_offsets_r.emplace_back(s_r.size());
+  for (int64_t cell = 0; cell < 1000; ++cell) {
+    CHECK(d_r[cell] == cell);
+    CHECK(a_validity_r[cell] == (cell % 3 != 0));
+    if (a_validity_r[cell]) {
+      CHECK(a_r[cell] == static_cast<int32_t>(cell));
+    }
+    CHECK(
+        s_r.substr(
+            s_offsets_r[cell], s_offsets_r[cell + 1] - s_offsets_r[cell]) ==
+        std::to_string(cell * cell));
+  }
+  query_r.finalize();
+  array_r.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
+
 /**
  * #TODO: Change data_w to be type std::vector<bool>.
  *
@@ -344,3 +642,90 @@ TEST_CASE(
   if (vfs.is_dir(array_name))
     vfs.remove_dir(array_name);
 }
+
+TEST_CASE(
+    "C++ API: Test batched reads of non-contiguous tiles",
+    "[cppapi][query][read-batch]") {
+  const std::string array_name = "cpp_unit_array_read_batch";
+  Context ctx;
+  VFS vfs(ctx);
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+
+  // Create an array with tiles of ten cells.
+  Domain domain(ctx);
+  domain.add_dimension(Dimension::create<int32_t>(ctx, "d", {{1, 1000}}, 10));
+  ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain).set_capacity(10);
+  schema.add_attribute(Attribute::create<int32_t>(ctx, "a"));
+  Array::create(array_name, schema);
+
+  // Write ten tiles.
+  std::vector<int32_t> d_w(100);
+  std::vector<int32_t> a_w(100);
+  for (int32_t i = 0; i < 100; ++i) {
+    d_w[i] = i + 1;
+    a_w[i] = 10 * (i + 1);
+  }
+  Array array_w(ctx, array_name, TILEDB_WRITE);
+  Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d_w)
+      .set_data_buffer("a", a_w);
+  query_w.submit_and_finalize();
+  array_w.close();
+
+  // Read from the first, fifth and ninth tiles. The reader issues a separate
+  // range for each of them, and the VFS reads the ranges of a file together.
+  Array array_r(ctx, array_name, TILEDB_READ);
+  Subarray subarray(ctx, array_r);
+  subarray.add_range<int32_t>(0, 1, 5)
+      .add_range<int32_t>(0, 41, 45)
+      .add_range<int32_t>(0, 81, 85);
+  std::vector<int32_t> d_r(15);
+  std::vector<int32_t> a_r(15);
+  Query query_r(ctx, array_r);
+  query_r.set_subarray(subarray)
+      .set_layout(TILEDB_GLOBAL_ORDER)
+      .set_data_buffer("d", d_r)
+      .set_data_buffer("a", a_r);
+  Stats::reset();
+  Stats::enable();
+  query_r.submit();
+  Stats::disable();
+  REQUIRE(query_r.query_status() == Query::Status::COMPLETE);
+
+  std::vector<int32_t> d_expected;
+  std::vector<int32_t> a_expected;
+  for (int32_t start : {1, 41, 81}) {
+    for (int32_t d = start; d < start + 5; ++d) {
+      d_expected.emplace_back(d);
+      a_expected.emplace_back(10 * d);
+    }
+  }
+  CHECK(d_r == d_expected);
+  CHECK(a_r == a_expected);
+
+  // Every batched read of the coordinate and attribute files is served by a
+  // single backend operation for the three tiles.
+  std::string stats;
+  Stats::dump(&stats);
+  auto counter = [&](const std::string& name) -> uint64_t {
+    const std::string key = name + "\": ";
+    auto pos = stats.find(key);
+    return pos == std::string::npos ?
+               0 :
+               std::stoull(stats.substr(pos + key.size()));
+  };
+  const uint64_t batch_num = counter("read_batch_num");
+  CHECK(batch_num >= 2);
+  CHECK(counter("read_batch_range_num") == 3 * batch_num);
+  CHECK(counter("read_batch_ops_num") == batch_num);
+
+  query_r.finalize();
+  array_r.close();
+
+  if (vfs.is_dir(array_name))
+    vfs.remove_dir(array_name);
+}
@@ -396,6 +396,80 @@ TEST_CASE("FilterBuffer: Test view reclaim", "[filter][filter-buffer]") {
   CHECK(storage.num_in_use() == 0);
 }
 
+TEST_CASE("FilterBuffer: Test prepend in place", "[filter][filter-buffer]") {
+  FilterStorage storage;
+  FilterBuffer input(&storage), output(&storage), other(&storage);
+
+  // Buffers not owned by the pool are never overwritten.
+  uint64_t data = 1;
+  CHECK(input.init(&data, sizeof(uint64_t)).ok());
+  CHECK(!output.prepend_in_place(&input));
+  CHECK(output.num_buffers() == 0);
+  CHECK(input.clear().ok());
+
+  // An unshared pool buffer is overwritten.
+  CHECK(input.prepend_buffer(sizeof(uint64_t)).ok());
+  uint64_t val = 100;
+  CHECK(input.write(&val, sizeof(uint64_t)).ok());
+  CHECK(output.prepend_in_place(&input));
+  CHECK(output.size() == sizeof(uint64_t));
+  CHECK(output.buffers()[0].data() == input.buffers()[0].data());
+  CHECK(storage.num_in_use() == 1);
+
+  // The buffer is now shared with `output`, so a second stage may not
+  // overwrite it through `input`.
+  CHECK(!other.prepend_in_place(&input));
+  CHECK(other.num_buffers() == 0);
+
+  // Once `input` is released, `output` holds the only reference.
+  CHECK(input.clear().ok());
+  CHECK(storage.num_in_use() == 1);
+  CHECK(other.prepend_in_place(&output));
+  CHECK(output.clear().ok());
+  CHECK(other.clear().ok());
+  CHECK(storage.num_available() == 1);
+  CHECK(storage.num_in_use() == 0);
+}
+
+TEST_CASE("FilterStorage: Test buffer recovery", "[filter][filter-buffer]") {
+  SECTION("- Released buffers are reused") {
+    FilterStorage storage;
+    Buffer* first = nullptr;
+    {
+      FilterBuffer fbuf(&storage);
+      CHECK(fbuf.prepend_buffer(sizeof(uint64_t)).ok());
+      first = fbuf.buffer_ptr(0);
+      CHECK(storage.num_in_use() == 1);
+    }
+
+    // The FilterBuffer went away without clearing; the next request picks
+    // the buffer up again instead of allocating a new one.
+    CHECK(storage.num_in_use() == 1);
+    auto buf = storage.get_buffer();
+    CHECK(buf.get() == first);
+    CHECK(storage.num_in_use() == 1);
+    CHECK(storage.num_available() == 0);
+  }
+
+  SECTION("- Pool limits") {
+    FilterStorage storage(16, 1);
+    FilterBuffer small(&storage), large(&storage);
+    CHECK(small.prepend_buffer(8).ok());
+    CHECK(large.prepend_buffer(32).ok());
+    Buffer* large_buf = large.buffer_ptr(0);
+
+    // The large buffer is kept but its allocation is released.
+    CHECK(large.clear().ok());
+    CHECK(storage.num_available() == 1);
+    CHECK(large_buf->alloced_size() == 0);
+
+    // The available list is full, so this buffer is freed.
+    CHECK(small.clear().ok());
+    CHECK(storage.num_available() == 1);
+    CHECK(storage.num_in_use() == 0);
+  }
+}
+
 TEST_CASE("FilterBuffer: Test fixed allocation", "[filter][filter-buffer]") {
   FilterStorage storage;
   FilterBuffer fbuf(&storage);
@@ -44,6 +44,7 @@
 #include "tiledb/sm/enums/encryption_type.h"
 #include "tiledb/sm/enums/filter_option.h"
 #include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/adaptive_compression_filter.h"
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
@@ -53,8 +54,10 @@
 #include "tiledb/sm/filter/encryption_aes256gcm_filter.h"
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/filter/float_scaling_filter.h"
+#include "tiledb/sm/filter/pfor_filter.h"
 #include "tiledb/sm/filter/positive_delta_filter.h"
 #include "tiledb/sm/filter/xor_filter.h"
+#include "tiledb/sm/tile/encoded_strings.h"
 #include "tiledb/sm/tile/tile.h"
 #include "tiledb/stdx/utility/to_underlying.h"
 
@@ -1630,6 +1633,85 @@ TEST_CASE("Filter: Test compression var", "[filter][compression][var]") {
   WriterTile::set_max_tile_chunk_size(constants::max_tile_chunk_size);
 }
 
+TEST_CASE(
+    "Filter: Test RLE and dictionary strings keep their encoded form",
+    "[filter][compression][encoded-strings]") {
+  tiledb::sm::Config config;
+  const auto compressor = GENERATE(
+      tiledb::sm::Compressor::RLE, tiledb::sm::Compressor::DICTIONARY_ENCODING);
+  const bool repeated = GENERATE(true, false);
+
+  // Runs of 4 cells of "aa", "bb", "c", "bb", or distinct values.
+  const uint64_t cells = 16;
+  const std::vector<std::string> run_values{"aa", "bb", "c", "bb"};
+  std::vector<std::string> cell_values;
+  for (uint64_t i = 0; i < cells; i++) {
+    cell_values.emplace_back(
+        repeated ? run_values[i / 4] : std::string(1, 'a' + i));
+  }
+  std::string values;
+  std::vector<uint64_t> offsets;
+  for (const auto& v : cell_values) {
+    offsets.emplace_back(values.size());
+    values += v;
+  }
+
+  WriterTile tile(
+      constants::format_version, Datatype::STRING_ASCII, 1, values.size());
+  CHECK(tile.write(values.data(), 0, values.size()).ok());
+  auto offsets_tile = make_offsets_tile(offsets);
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(CompressionFilter(compressor, -1));
+  CHECK(pipeline
+            .run_forward(
+                &test::g_helper_stats, &tile, &offsets_tile, &tp, false)
+            .ok());
+
+  // The offsets are reconstructed from the var-sized data.
+  auto unfiltered_tile = create_tile_for_unfiltering(values.size(), tile);
+  Tile unfiltered_offsets(
+      constants::format_version,
+      Datatype::UINT64,
+      constants::cell_var_offset_size,
+      0,
+      cells * constants::cell_var_offset_size,
+      nullptr,
+      0);
+  ChunkData chunk_data;
+  unfiltered_tile.load_chunk_data(chunk_data);
+  CHECK(pipeline
+            .run_reverse(
+                &test::g_helper_stats,
+                &unfiltered_tile,
+                &unfiltered_offsets,
+                chunk_data,
+                0,
+                chunk_data.filtered_chunks_.size(),
+                tp.concurrency_level(),
+                config)
+            .ok());
+
+  std::string values_read(values.size(), '\0');
+  CHECK(unfiltered_tile.read(values_read.data(), 0, values.size()).ok());
+  CHECK(values_read == values);
+
+  // The encoded form is attached only when values repeat enough.
+  const EncodedStrings* encoded = unfiltered_offsets.encoded_strings();
+  if (!repeated) {
+    CHECK(encoded == nullptr);
+    return;
+  }
+
+  REQUIRE(encoded != nullptr);
+  CHECK(encoded->cell_num() == cells);
+  uint64_t run = 0;
+  for (uint64_t i = 0; i < cells; i++) {
+    CHECK(encoded->values()[encoded->value_index(i, run)] == cell_values[i]);
+  }
+}
+
 TEST_CASE("Filter: Test pseudo-checksum", "[filter][pseudo-checksum]") {
   tiledb::sm::Config config;
 
@@ -2995,6 +3077,92 @@ TEST_CASE(
   WriterTile::set_max_tile_chunk_size(constants::max_tile_chunk_size);
 }
 
+/**
+ * Filters increasing values through positive delta, bit width reduction and
+ * LZ4, and checks that the fused and unfused reverse paths agree.
+ */
+template <class T>
+void check_fused_delta_bit_width(
+    Datatype type,
+    uint64_t nelts,
+    T large_step,
+    uint32_t delta_window,
+    uint32_t bit_width_window) {
+  std::vector<T> values(nelts);
+  T value = 0;
+  for (uint64_t i = 0; i < nelts; i++) {
+    values[i] = value;
+    value += i % 97 == 0 ? large_step : static_cast<T>(i % 3);
+  }
+
+  WriterTile tile(
+      constants::format_version, type, sizeof(T), nelts * sizeof(T));
+  CHECK(tile.write(values.data(), 0, nelts * sizeof(T)).ok());
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(PositiveDeltaFilter());
+  pipeline.add_filter(BitWidthReductionFilter());
+  pipeline.add_filter(CompressionFilter(tiledb::sm::Compressor::LZ4, 1));
+  pipeline.get_filter<PositiveDeltaFilter>()->set_max_window_size(
+      delta_window);
+  pipeline.get_filter<BitWidthReductionFilter>()->set_max_window_size(
+      bit_width_window);
+  CHECK(pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+
+  for (auto fused : {"true", "false"}) {
+    tiledb::sm::Config config;
+    REQUIRE(config.set("sm.filter.fused_reverse_kernels", fused).ok());
+    auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile);
+    run_reverse(config, tp, unfiltered_tile, pipeline);
+
+    std::vector<T> result(nelts);
+    CHECK(unfiltered_tile.read(result.data(), 0, nelts * sizeof(T)).ok());
+    CHECK(result == values);
+  }
+}
+
+TEST_CASE(
+    "Filter: Test fused positive-delta and bit width reduction reverse",
+    "[filter][positive-delta][bit-width-reduction][fused]") {
+  std::vector<std::pair<uint32_t, uint32_t>> window_sizes = {
+      {1024, 256}, {256, 1024}, {437, 64}, {64, 2000}, {100000, 100000}};
+  for (auto [delta_window, bit_width_window] : window_sizes) {
+    check_fused_delta_bit_width<int16_t>(
+        Datatype::INT16, 5000, 300, delta_window, bit_width_window);
+    check_fused_delta_bit_width<uint16_t>(
+        Datatype::UINT16, 5000, 300, delta_window, bit_width_window);
+    check_fused_delta_bit_width<int32_t>(
+        Datatype::INT32, 20000, 100000, delta_window, bit_width_window);
+    check_fused_delta_bit_width<uint32_t>(
+        Datatype::UINT32, 20000, 100000, delta_window, bit_width_window);
+    check_fused_delta_bit_width<int64_t>(
+        Datatype::INT64,
+        20000,
+        int64_t(1) << 40,
+        delta_window,
+        bit_width_window);
+    check_fused_delta_bit_width<uint64_t>(
+        Datatype::UINT64,
+        20000,
+        uint64_t(1) << 40,
+        delta_window,
+        bit_width_window);
+    check_fused_delta_bit_width<int64_t>(
+        Datatype::DATETIME_MS,
+        20000,
+        int64_t(1) << 40,
+        delta_window,
+        bit_width_window);
+    check_fused_delta_bit_width<int64_t>(
+        Datatype::TIME_NS,
+        20000,
+        int64_t(1) << 40,
+        delta_window,
+        bit_width_window);
+  }
+}
+
 TEST_CASE("Filter: Test bitshuffle", "[filter][bitshuffle]") {
   tiledb::sm::Config config;
 
@@ -3527,3 +3695,215 @@ TEST_CASE("Filter: Test XOR", "[filter][xor]") {
   testing_xor_filter<int64_t>(Datatype::DATETIME_FS);
   testing_xor_filter<int64_t>(Datatype::DATETIME_AS);
 }
+
+TEST_CASE(
+    "Filter: Test adaptive compression choice",
+    "[filter][adaptive-compression]") {
+  auto pool = make_shared<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>(
+      HERE(), 1);
+  const uint64_t nelts = 16384;
+  const uint64_t nbytes = nelts * sizeof(uint32_t);
+  std::mt19937 gen(0xADA97);
+  int level = -1;
+
+  // A single run is cheapest to decode with RLE once decode cost matters.
+  std::vector<uint32_t> run(nelts, 3);
+  ConstBuffer run_buffer(run.data(), nbytes);
+  CHECK(
+      AdaptiveCompressionFilter::choose(
+          sizeof(uint32_t), run_buffer, 0.5, pool, &level) ==
+      tiledb::sm::Compressor::RLE);
+
+  // Values from a small alphabet have no runs but little entropy.
+  std::vector<uint32_t> small_alphabet(nelts);
+  for (auto& v : small_alphabet)
+    v = gen() % 4;
+  ConstBuffer small_alphabet_buffer(small_alphabet.data(), nbytes);
+  CHECK(
+      AdaptiveCompressionFilter::choose(
+          sizeof(uint32_t), small_alphabet_buffer, 0.0, pool, &level) ==
+      tiledb::sm::Compressor::ZSTD);
+  CHECK(level > 0);
+
+  // Noise is not worth compressing, nor is anything once decode cost
+  // dominates.
+  std::vector<uint32_t> noise(nelts);
+  for (auto& v : noise)
+    v = gen();
+  ConstBuffer noise_buffer(noise.data(), nbytes);
+  CHECK(
+      AdaptiveCompressionFilter::choose(
+          sizeof(uint32_t), noise_buffer, 0.0, pool, &level) ==
+      tiledb::sm::Compressor::NO_COMPRESSION);
+  CHECK(
+      AdaptiveCompressionFilter::choose(
+          sizeof(uint32_t), small_alphabet_buffer, 100.0, pool, &level) ==
+      tiledb::sm::Compressor::NO_COMPRESSION);
+}
+
+TEST_CASE(
+    "Filter: Test adaptive compression", "[filter][adaptive-compression]") {
+  tiledb::sm::Config config;
+
+  // Half of the tile is a single run and half is noise, so the chunks of each
+  // half are best served by different compressors.
+  const uint64_t nelts = 64 * 1024;
+  const uint64_t tile_size = nelts * sizeof(uint32_t);
+  WriterTile tile(
+      constants::format_version, Datatype::UINT32, sizeof(uint32_t), tile_size);
+  std::mt19937 gen(0xADA97);
+  std::vector<uint32_t> values(nelts);
+  for (uint64_t i = 0; i < nelts; i++)
+    values[i] = i < nelts / 2 ? 7 : gen();
+  CHECK(tile.write(values.data(), 0, tile_size).ok());
+
+  double weight = 0.0;
+  bool expect_compressed = true;
+  SECTION("- Smallest size") {
+    weight = 0.0;
+  }
+  SECTION("- Default weight") {
+    weight = AdaptiveCompressionFilter::default_decode_cost_weight;
+  }
+  SECTION("- Decode cost dominates") {
+    weight = 100.0;
+    expect_compressed = false;
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(AdaptiveCompressionFilter(weight));
+  CHECK(pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+
+  // The run compresses to almost nothing while the noise is stored as is.
+  CHECK(tile.size() == 0);
+  if (expect_compressed) {
+    CHECK(tile.filtered_buffer().size() < tile_size / 2 + tile_size / 16);
+  } else {
+    CHECK(tile.filtered_buffer().size() > tile_size);
+  }
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    uint32_t elt = 0;
+    CHECK(unfiltered_tile.read(&elt, i * sizeof(uint32_t), sizeof(uint32_t))
+              .ok());
+    CHECK(elt == values[i]);
+  }
+}
+
+TEST_CASE("Filter: Test PFOR bit width choice", "[filter][pfor]") {
+  const uint32_t n = PFORFilter::block_nelts;
+  std::vector<uint32_t> values(n);
+
+  // Constant values need no bits at all.
+  std::fill(values.begin(), values.end(), 42);
+  CHECK(PFORFilter::choose_bit_width<uint32_t>(values.data(), n, 42) == 0);
+
+  // Offsets below 32 need 5 bits.
+  for (uint32_t i = 0; i < n; i++)
+    values[i] = 1000 + i % 32;
+  CHECK(PFORFilter::choose_bit_width<uint32_t>(values.data(), n, 1000) == 5);
+
+  // A few outliers are cheaper to patch than to widen every value for.
+  values[3] = 1u << 30;
+  values[77] = 1u << 31;
+  CHECK(PFORFilter::choose_bit_width<uint32_t>(values.data(), n, 1000) == 5);
+
+  // Noise is stored unmodified.
+  std::mt19937 gen(0x9F04);
+  for (auto& v : values)
+    v = gen();
+  uint32_t min = *std::min_element(values.begin(), values.end());
+  CHECK(PFORFilter::choose_bit_width<uint32_t>(values.data(), n, min) == 32);
+}
+
+template <typename T>
+void testing_pfor_filter(Datatype t) {
+  tiledb::sm::Config config;
+
+  // Small offsets from a base value, with a few outliers, and a length that
+  // does not divide into whole blocks.
+  const uint64_t nelts = 10 * PFORFilter::block_nelts + 17;
+  const uint64_t tile_size = nelts * sizeof(T);
+  const uint64_t cell_size = sizeof(T);
+  WriterTile tile(constants::format_version, t, cell_size, tile_size);
+
+  std::mt19937_64 gen(0x9F04);
+  std::vector<T> results;
+  for (uint64_t i = 0; i < nelts; i++) {
+    T val = static_cast<T>(std::numeric_limits<T>::min() / 2 + gen() % 8);
+    if (i % 97 == 5)
+      val = std::numeric_limits<T>::max();
+    CHECK(tile.write(&val, i * sizeof(T), sizeof(T)).ok());
+    results.push_back(val);
+  }
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(PFORFilter());
+  CHECK(pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+
+  // Three bits per value, plus the block headers and exceptions.
+  CHECK(tile.size() == 0);
+  CHECK(tile.filtered_buffer().size() < tile_size / 2);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    T elt = 0;
+    CHECK(unfiltered_tile.read(&elt, i * sizeof(T), sizeof(T)).ok());
+    CHECK(elt == results[i]);
+  }
+}
+
+TEST_CASE("Filter: Test PFOR", "[filter][pfor]") {
+  testing_pfor_filter<int8_t>(Datatype::INT8);
+  testing_pfor_filter<uint8_t>(Datatype::UINT8);
+  testing_pfor_filter<int16_t>(Datatype::INT16);
+  testing_pfor_filter<uint16_t>(Datatype::UINT16);
+  testing_pfor_filter<int32_t>(Datatype::INT32);
+  testing_pfor_filter<uint32_t>(Datatype::UINT32);
+  testing_pfor_filter<int64_t>(Datatype::INT64);
+  testing_pfor_filter<uint64_t>(Datatype::UINT64);
+  testing_pfor_filter<int64_t>(Datatype::DATETIME_MS);
+  testing_pfor_filter<int64_t>(Datatype::TIME_NS);
+}
+
+TEST_CASE("Filter: Test positive delta and PFOR", "[filter][pfor]") {
+  tiledb::sm::Config config;
+
+  // Increasing timestamps with small, irregular gaps.
+  const uint64_t nelts = 100000;
+  const uint64_t tile_size = nelts * sizeof(int64_t);
+  WriterTile tile(
+      constants::format_version, Datatype::INT64, sizeof(int64_t), tile_size);
+  std::mt19937_64 gen(0x9F04);
+  std::vector<int64_t> values(nelts);
+  int64_t timestamp = 1700000000000000000;
+  for (uint64_t i = 0; i < nelts; i++) {
+    timestamp += 1000 + gen() % 1000;
+    values[i] = timestamp;
+  }
+  CHECK(tile.write(values.data(), 0, tile_size).ok());
+
+  FilterPipeline pipeline;
+  ThreadPool tp(4);
+  pipeline.add_filter(PositiveDeltaFilter());
+  pipeline.add_filter(PFORFilter());
+  CHECK(pipeline.run_forward(&test::g_helper_stats, &tile, nullptr, &tp).ok());
+
+  // The deltas need 11 bits each.
+  CHECK(tile.size() == 0);
+  CHECK(tile.filtered_buffer().size() < tile_size / 4);
+
+  auto unfiltered_tile = create_tile_for_unfiltering(nelts, tile);
+  run_reverse(config, tp, unfiltered_tile, pipeline);
+  for (uint64_t i = 0; i < nelts; i++) {
+    int64_t elt = 0;
+    CHECK(unfiltered_tile.read(&elt, i * sizeof(int64_t), sizeof(int64_t))
+              .ok());
+    CHECK(elt == values[i]);
+  }
+}
@@ -0,0 +1,197 @@
+/**
+ * @file unit-fragment-metadata-cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `FragmentMetadataCache` class and its use when opening arrays.
+ */
+
+#include <string>
+#include <vector>
+
+#include "test/support/tdb_catch.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+#include "tiledb/sm/cpp_api/tiledb"
+
+using namespace tiledb::sm;
+
+namespace {
+
+CachedFragmentMetadataComponent make_component(uint64_t size, uint8_t value) {
+  CachedFragmentMetadataComponent component;
+  component.data_.assign(size, value);
+  return component;
+}
+
+}  // namespace
+
+TEST_CASE(
+    "FragmentMetadataCache: Disabled cache", "[fragment-metadata-cache]") {
+  FragmentMetadataCache cache(0);
+  CHECK(!cache.enabled());
+
+  FragmentMetadataCacheKey key{"frag", 20, 0};
+  cache.insert(key, make_component(10, 1));
+  CHECK(cache.read(key) == nullptr);
+}
+
+TEST_CASE(
+    "FragmentMetadataCache: Insert and read", "[fragment-metadata-cache]") {
+  FragmentMetadataCache cache(100);
+  CHECK(cache.enabled());
+
+  const uint64_t footer = FragmentMetadataCacheKey::footer_offset;
+  FragmentMetadataCacheKey key{"frag", 20, footer};
+  CHECK(cache.read(key) == nullptr);
+
+  auto component = make_component(10, 7);
+  component.footer_offset_ = 1000;
+  component.file_size_ = 1018;
+  cache.insert(key, std::move(component));
+
+  auto cached = cache.read(key);
+  REQUIRE(cached != nullptr);
+  CHECK(cached->size() == 10);
+  CHECK(cached->data_ == std::vector<uint8_t>(10, 7));
+  CHECK(cached->footer_offset_ == 1000);
+  CHECK(cached->file_size_ == 1018);
+
+  // Keys differing by fragment, format version or offset are distinct.
+  CHECK(cache.read({"frag2", 20, footer}) == nullptr);
+  CHECK(cache.read({"frag", 19, footer}) == nullptr);
+  CHECK(cache.read({"frag", 20, 0}) == nullptr);
+}
+
+TEST_CASE("FragmentMetadataCache: Eviction", "[fragment-metadata-cache]") {
+  FragmentMetadataCache cache(100);
+
+  cache.insert({"frag", 20, 0}, make_component(40, 0));
+  cache.insert({"frag", 20, 64}, make_component(40, 1));
+
+  // Touch the first component so that the second one is the least recently
+  // used.
+  auto held = cache.read({"frag", 20, 0});
+  REQUIRE(held != nullptr);
+
+  cache.insert({"frag", 20, 128}, make_component(40, 2));
+  CHECK(cache.read({"frag", 20, 64}) == nullptr);
+  CHECK(cache.read({"frag", 20, 128}) != nullptr);
+
+  // Evicting a component does not invalidate the copies being loaded.
+  cache.insert({"frag", 20, 192}, make_component(90, 3));
+  CHECK(cache.read({"frag", 20, 0}) == nullptr);
+  CHECK(held->data_ == std::vector<uint8_t>(40, 0));
+
+  // Components over the budget are not cached.
+  cache.insert({"frag", 20, 256}, make_component(101, 4));
+  CHECK(cache.read({"frag", 20, 256}) == nullptr);
+  CHECK(cache.read({"frag", 20, 192}) != nullptr);
+}
+
+TEST_CASE(
+    "FragmentMetadataCache: Reopening an array sees new fragments",
+    "[fragment-metadata-cache][cppapi]") {
+  const std::string array_name = "fragment_metadata_cache_array";
+  tiledb::Config config;
+  config["sm.fragment_metadata_cache_size"] = "10000000";
+  tiledb::Context ctx(config);
+  tiledb::VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  tiledb::Domain domain(ctx);
+  domain.add_dimension(
+      tiledb::Dimension::create<int32_t>(ctx, "d", {{1, 100}}, 10));
+  tiledb::ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(tiledb::Attribute::create<int32_t>(ctx, "a"));
+  schema.add_attribute(tiledb::Attribute::create<std::string>(ctx, "s"));
+  tiledb::Array::create(array_name, schema);
+
+  std::vector<int32_t> d_all;
+  std::vector<int32_t> a_all;
+  std::string s_all;
+  std::vector<uint64_t> s_offsets_all;
+
+  // Each iteration commits a fragment, then reads everything back. Every
+  // open but the first one loads the metadata of the previous fragments from
+  // the cache.
+  for (int32_t frag = 0; frag < 3; frag++) {
+    std::vector<int32_t> d;
+    std::vector<int32_t> a;
+    std::string s;
+    std::vector<uint64_t> s_offsets;
+    for (int32_t i = 0; i < 20; i++) {
+      d.push_back(frag * 20 + i + 1);
+      a.push_back(frag * 100 + i);
+      s_offsets.push_back(s.size());
+      s += std::string(i % 5 + 1, static_cast<char>('a' + frag));
+    }
+
+    tiledb::Array array_w(ctx, array_name, TILEDB_WRITE);
+    tiledb::Query query_w(ctx, array_w);
+    query_w.set_layout(TILEDB_UNORDERED)
+        .set_data_buffer("d", d)
+        .set_data_buffer("a", a)
+        .set_data_buffer("s", s)
+        .set_offsets_buffer("s", s_offsets);
+    query_w.submit();
+    array_w.close();
+
+    for (auto offset : s_offsets) {
+      s_offsets_all.push_back(s_all.size() + offset);
+    }
+    d_all.insert(d_all.end(), d.begin(), d.end());
+    a_all.insert(a_all.end(), a.begin(), a.end());
+    s_all += s;
+
+    std::vector<int32_t> d_read(d_all.size());
+    std::vector<int32_t> a_read(a_all.size());
+    std::string s_read(s_all.size(), '\0');
+    std::vector<uint64_t> s_offsets_read(s_offsets_all.size());
+    tiledb::Array array_r(ctx, array_name, TILEDB_READ);
+    tiledb::Query query_r(ctx, array_r);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_data_buffer("d", d_read)
+        .set_data_buffer("a", a_read)
+        .set_data_buffer("s", s_read)
+        .set_offsets_buffer("s", s_offsets_read);
+    REQUIRE(query_r.submit() == tiledb::Query::Status::COMPLETE);
+    CHECK(d_read == d_all);
+    CHECK(a_read == a_all);
+    CHECK(s_read == s_all);
+    CHECK(s_offsets_read == s_offsets_all);
+
+    auto non_empty_domain = array_r.non_empty_domain<int32_t>(0);
+    CHECK(non_empty_domain.first == 1);
+    CHECK(non_empty_domain.second == (frag + 1) * 20);
+    array_r.close();
+  }
+
+  vfs.remove_dir(array_name);
+}
@@ -0,0 +1,163 @@
+/**
+ * @file unit-memory-tracker.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `MemoryTracker` class.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test/support/tdb_catch.h"
+#include "tiledb/common/memory_tracker.h"
+#include "tiledb/sm/stats/stats.h"
+
+using namespace tiledb::sm;
+
+using MemoryType = MemoryTracker::MemoryType;
+
+TEST_CASE("MemoryTracker: Budget", "[memory-tracker]") {
+  MemoryTracker tracker;
+  CHECK(tracker.set_budget(100));
+
+  CHECK(tracker.take_memory(60, MemoryType::RTREE));
+  CHECK(tracker.take_memory(30, MemoryType::TILES));
+  CHECK(!tracker.take_memory(20, MemoryType::TILES));
+  CHECK(tracker.get_memory_usage() == 90);
+  CHECK(tracker.get_memory_usage(MemoryType::RTREE) == 60);
+  CHECK(tracker.get_memory_usage(MemoryType::TILES) == 30);
+  CHECK(tracker.get_memory_available() == 10);
+
+  // The budget cannot be set below the usage.
+  CHECK(!tracker.set_budget(50));
+  CHECK(tracker.get_memory_budget() == 100);
+
+  tracker.release_memory(60, MemoryType::RTREE);
+  CHECK(tracker.get_memory_usage() == 30);
+  CHECK(tracker.get_memory_usage(MemoryType::RTREE) == 0);
+  CHECK(tracker.set_budget(50));
+  CHECK(tracker.get_memory_available() == 20);
+}
+
+TEST_CASE("MemoryTracker: Hierarchical budgets", "[memory-tracker]") {
+  MemoryTracker context;
+  CHECK(context.set_budget(100));
+  MemoryTracker array(&context);
+  MemoryTracker reader(&context);
+  CHECK(array.parent() == &context);
+
+  // Memory taken from a child is taken from the parent as well.
+  CHECK(array.take_memory(70, MemoryType::TILE_OFFSETS));
+  CHECK(context.get_memory_usage() == 70);
+  CHECK(context.get_memory_usage(MemoryType::TILE_OFFSETS) == 70);
+
+  // A child cannot take more than its parent has left, and a failed take
+  // leaves no usage behind.
+  CHECK(!reader.take_memory(40, MemoryType::TILES));
+  CHECK(reader.get_memory_usage() == 0);
+  CHECK(context.get_memory_usage() == 70);
+  CHECK(reader.take_memory(30, MemoryType::TILES));
+  CHECK(context.get_memory_usage() == 100);
+
+  // A child budget is enforced independently of the parent's.
+  CHECK(array.set_budget(70));
+  array.release_memory(20, MemoryType::TILE_OFFSETS);
+  CHECK(!array.take_memory(30, MemoryType::TILE_OFFSETS));
+  CHECK(array.take_memory(20, MemoryType::TILE_OFFSETS));
+  CHECK(context.get_memory_usage() == 100);
+}
+
+TEST_CASE(
+    "MemoryTracker: Destroying a child returns its memory",
+    "[memory-tracker]") {
+  MemoryTracker context;
+  {
+    MemoryTracker array(&context);
+    CHECK(array.take_memory(10, MemoryType::RTREE));
+    CHECK(array.take_memory(20, MemoryType::FOOTER));
+    CHECK(context.get_memory_usage() == 30);
+  }
+  CHECK(context.get_memory_usage() == 0);
+  CHECK(context.get_memory_usage(MemoryType::RTREE) == 0);
+  CHECK(context.get_memory_usage(MemoryType::FOOTER) == 0);
+}
+
+TEST_CASE("MemoryTracker: High-water marks", "[memory-tracker]") {
+  MemoryTracker tracker;
+  CHECK(tracker.take_memory(10, MemoryType::TILES));
+  CHECK(tracker.take_memory(5, MemoryType::TILE_CACHE));
+  tracker.release_memory(10, MemoryType::TILES);
+  CHECK(tracker.take_memory(3, MemoryType::TILES));
+
+  CHECK(tracker.get_memory_usage() == 8);
+  CHECK(tracker.get_memory_high_water_mark() == 15);
+  CHECK(tracker.get_memory_high_water_mark(MemoryType::TILES) == 10);
+  CHECK(tracker.get_memory_high_water_mark(MemoryType::TILE_CACHE) == 5);
+  CHECK(tracker.get_memory_high_water_mark(MemoryType::RTREE) == 0);
+
+  stats::Stats stats("test");
+  tracker.export_stats(stats);
+  auto& counters = *stats.counters();
+  CHECK(counters["test.memory_high_water_mark"] == 15);
+  CHECK(counters["test.memory_high_water_mark.tiles"] == 10);
+  CHECK(counters["test.memory_high_water_mark.tile_cache"] == 5);
+  CHECK(counters.count("test.memory_high_water_mark.rtree") == 0);
+}
+
+TEST_CASE("MemoryTracker: Concurrent accounting", "[memory-tracker]") {
+  const uint64_t num_threads = 8;
+  const uint64_t num_iterations = 10000;
+
+  MemoryTracker context;
+  CHECK(context.set_budget(num_threads * 2));
+  MemoryTracker child(&context);
+
+  std::atomic<uint64_t> failures{0};
+  std::vector<std::thread> threads;
+  for (uint64_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&]() {
+      for (uint64_t j = 0; j < num_iterations; ++j) {
+        if (child.take_memory(2, MemoryType::TILES)) {
+          child.release_memory(2, MemoryType::TILES);
+        } else {
+          failures++;
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // The budget fits every thread, so no take can fail.
+  CHECK(failures == 0);
+  CHECK(child.get_memory_usage() == 0);
+  CHECK(context.get_memory_usage() == 0);
+  CHECK(context.get_memory_high_water_mark() <= num_threads * 2);
+}
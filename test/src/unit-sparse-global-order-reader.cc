@@ -63,6 +63,7 @@ struct CSparseGlobalOrderFx {
   std::string ratio_array_data_;
   std::string ratio_coords_;
   std::string ratio_query_condition_;
+  std::string compute_concurrency_level_;
 
   void create_default_array_1d(bool allow_dups = false);
   void write_1d_fragment(
@@ -109,6 +110,7 @@ void CSparseGlobalOrderFx::reset_config() {
   ratio_array_data_ = "0.1";
   ratio_coords_ = "0.5";
   ratio_query_condition_ = "0.25";
+  compute_concurrency_level_ = "";
   update_config();
 }
 
@@ -170,6 +172,16 @@ void CSparseGlobalOrderFx::update_config() {
           &error) == TILEDB_OK);
   REQUIRE(error == nullptr);
 
+  if (!compute_concurrency_level_.empty()) {
+    REQUIRE(
+        tiledb_config_set(
+            config,
+            "sm.compute_concurrency_level",
+            compute_concurrency_level_.c_str(),
+            &error) == TILEDB_OK);
+    REQUIRE(error == nullptr);
+  }
+
   REQUIRE(tiledb_ctx_alloc(config, &ctx_) == TILEDB_OK);
   REQUIRE(error == nullptr);
   REQUIRE(tiledb_vfs_alloc(ctx_, config, &vfs_) == TILEDB_OK);
@@ -1273,4 +1285,103 @@ TEST_CASE_METHOD(
   // Check completed query status.
   tiledb_query_get_status(ctx_, query, &status);
   CHECK(status == TILEDB_COMPLETED);
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(
+    CSparseGlobalOrderFx,
+    "Sparse global order reader: merge interleaved fragments",
+    "[sparse-global-order][merge]") {
+  bool dups = GENERATE(false, true);
+
+  // The parallel merge needs at least two compute threads.
+  compute_concurrency_level_ = "4";
+  update_config();
+  create_default_array_1d(dups);
+
+  // Write odd coordinates in one fragment and even ones in another.
+  for (int parity = 1; parity >= 0; parity--) {
+    std::vector<int> coords;
+    for (int c = 2 - parity; c <= 100; c += 2) {
+      coords.emplace_back(c);
+    }
+    std::vector<int> data(coords);
+    uint64_t coords_size = coords.size() * sizeof(int);
+    uint64_t data_size = data.size() * sizeof(int);
+    write_1d_fragment(coords.data(), &coords_size, data.data(), &data_size);
+  }
+
+  // Overwrite coordinates 10-19 in a third fragment.
+  int coords[] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+  uint64_t coords_size = sizeof(coords);
+  int data[] = {1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019};
+  uint64_t data_size = sizeof(data);
+  write_1d_fragment(coords, &coords_size, data, &data_size);
+
+  // Read everything at once.
+  std::vector<int> coords_r(128);
+  std::vector<int> data_r(128);
+  uint64_t coords_r_size = coords_r.size() * sizeof(int);
+  uint64_t data_r_size = data_r.size() * sizeof(int);
+  tiledb_array_t* array = nullptr;
+  tiledb_query_t* query = nullptr;
+  auto rc = read(
+      false,
+      false,
+      coords_r.data(),
+      &coords_r_size,
+      data_r.data(),
+      &data_r_size,
+      &query,
+      &array);
+  CHECK(rc == TILEDB_OK);
+
+  // Make sure the fragments were merged in parallel.
+  auto stats =
+      ((sm::SparseGlobalOrderReader<uint8_t>*)query->query_->strategy())
+          ->stats();
+  REQUIRE(stats != nullptr);
+  auto timers = stats->timers();
+  REQUIRE(timers != nullptr);
+  CHECK(
+      timers->count("Context.StorageManager.Query.Reader."
+                    "parallel_merge_result_cell_slabs.sum") == 1);
+
+  // Build the expected results.
+  std::vector<int> coords_expected;
+  std::vector<int> data_expected;
+  for (int c = 1; c <= 100; c++) {
+    bool overwritten = c >= 10 && c <= 19;
+    if (dups && overwritten) {
+      coords_expected.emplace_back(c);
+      data_expected.emplace_back(c);
+    }
+    coords_expected.emplace_back(c);
+    data_expected.emplace_back(overwritten ? c + 1000 : c);
+  }
+
+  uint64_t num = coords_r_size / sizeof(int);
+  CHECK(num == coords_expected.size());
+  CHECK(data_r_size == num * sizeof(int));
+  coords_r.resize(num);
+  data_r.resize(num);
+  CHECK(coords_r == coords_expected);
+
+  // With duplicates, the order of cells with the same coordinates is not
+  // defined, compare the sum of the data instead.
+  if (dups) {
+    for (uint64_t i = 0; i + 1 < num; i++) {
+      if (coords_r[i] == coords_r[i + 1]) {
+        CHECK(data_r[i] + data_r[i + 1] == 2 * coords_r[i] + 1000);
+        data_r[i] = data_expected[i];
+        data_r[i + 1] = data_expected[i + 1];
+      }
+    }
+  }
+  CHECK(data_r == data_expected);
+
+  // Clean up.
+  rc = tiledb_array_close(ctx_, array);
+  CHECK(rc == TILEDB_OK);
+  tiledb_array_free(&array);
+  tiledb_query_free(&query);
+}
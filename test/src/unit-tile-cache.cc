@@ -0,0 +1,271 @@
+/**
+ * @file unit-tile-cache.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `TileCache` class and its use by the readers.
+ */
+
+#include <string>
+#include <vector>
+
+#include "test/support/tdb_catch.h"
+#include "tiledb/sm/cache/tile_cache.h"
+#include "tiledb/sm/cpp_api/tiledb"
+
+using namespace tiledb::sm;
+
+namespace {
+
+CachedTile make_cached_tile(uint64_t size, char value) {
+  CachedTile tile;
+  tile.fixed_.assign(size, value);
+  return tile;
+}
+
+}  // namespace
+
+TEST_CASE("TileCache: Disabled cache", "[tile-cache]") {
+  TileCache cache(0);
+  CHECK(!cache.enabled());
+
+  TileCacheKey key{"frag", "a", 0};
+  cache.insert(key, make_cached_tile(10, 'a'));
+  CHECK(cache.read(key) == nullptr);
+}
+
+TEST_CASE("TileCache: Insert and read", "[tile-cache]") {
+  TileCache cache(100);
+  CHECK(cache.enabled());
+
+  TileCacheKey key{"frag", "a", 3};
+  CHECK(cache.read(key) == nullptr);
+
+  CachedTile tile = make_cached_tile(10, 'x');
+  tile.var_.assign(5, 'y');
+  tile.validity_.assign(2, 1);
+  cache.insert(key, std::move(tile));
+
+  auto cached = cache.read(key);
+  REQUIRE(cached != nullptr);
+  CHECK(cached->size() == 17);
+  CHECK(cached->fixed_ == std::vector<char>(10, 'x'));
+  CHECK(cached->var_ == std::vector<char>(5, 'y'));
+  CHECK(cached->validity_ == std::vector<char>(2, 1));
+
+  // Keys differing by fragment, name or tile index are distinct.
+  CHECK(cache.read({"frag2", "a", 3}) == nullptr);
+  CHECK(cache.read({"frag", "b", 3}) == nullptr);
+  CHECK(cache.read({"frag", "a", 4}) == nullptr);
+}
+
+TEST_CASE("TileCache: Eviction", "[tile-cache]") {
+  TileCache cache(100);
+
+  cache.insert({"frag", "a", 0}, make_cached_tile(40, '0'));
+  cache.insert({"frag", "a", 1}, make_cached_tile(40, '1'));
+
+  // Touch tile 0 so that tile 1 is the least recently used.
+  auto held = cache.read({"frag", "a", 0});
+  REQUIRE(held != nullptr);
+
+  cache.insert({"frag", "a", 2}, make_cached_tile(40, '2'));
+  CHECK(cache.read({"frag", "a", 1}) == nullptr);
+  CHECK(cache.read({"frag", "a", 2}) != nullptr);
+
+  // Evicting a tile does not invalidate the copies held by readers.
+  cache.insert({"frag", "a", 3}, make_cached_tile(90, '3'));
+  CHECK(cache.read({"frag", "a", 0}) == nullptr);
+  CHECK(held->fixed_ == std::vector<char>(40, '0'));
+
+  // Tiles over the budget are not cached.
+  cache.insert({"frag", "a", 4}, make_cached_tile(101, '4'));
+  CHECK(cache.read({"frag", "a", 4}) == nullptr);
+  CHECK(cache.read({"frag", "a", 3}) != nullptr);
+}
+
+TEST_CASE("TileCache: Memory tracking", "[tile-cache][memory-tracker]") {
+  using MemoryType = MemoryTracker::MemoryType;
+  MemoryTracker tracker;
+  tracker.set_budget(100);
+  {
+    TileCache cache(100, &tracker);
+    cache.insert({"frag", "a", 0}, make_cached_tile(40, '0'));
+    cache.insert({"frag", "a", 1}, make_cached_tile(40, '1'));
+    CHECK(tracker.get_memory_usage(MemoryType::TILE_CACHE) == 80);
+
+    // Evictions are released from the tracker.
+    cache.insert({"frag", "a", 2}, make_cached_tile(70, '2'));
+    CHECK(tracker.get_memory_usage(MemoryType::TILE_CACHE) == 70);
+
+    // A tile that does not fit in the tracker budget is not cached.
+    CHECK(tracker.take_memory(30, MemoryType::TILES));
+    cache.insert({"frag", "a", 3}, make_cached_tile(20, '3'));
+    CHECK(cache.read({"frag", "a", 3}) == nullptr);
+    CHECK(cache.read({"frag", "a", 2}) != nullptr);
+    CHECK(tracker.get_memory_usage(MemoryType::TILE_CACHE) == 70);
+    tracker.release_memory(30, MemoryType::TILES);
+  }
+  CHECK(tracker.get_memory_usage() == 0);
+}
+
+TEST_CASE(
+    "TileCache: Repeated reads return the same results",
+    "[tile-cache][cppapi]") {
+  const std::string array_name = "tile_cache_array";
+  tiledb::Config config;
+  config["sm.tile_cache_size"] = "10000000";
+  tiledb::Context ctx(config);
+  tiledb::VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  auto array_type = GENERATE(TILEDB_DENSE, TILEDB_SPARSE);
+
+  tiledb::Domain domain(ctx);
+  domain.add_dimension(
+      tiledb::Dimension::create<int32_t>(ctx, "d", {{1, 100}}, 10));
+  tiledb::ArraySchema schema(ctx, array_type);
+  schema.set_domain(domain);
+  schema.add_attribute(tiledb::Attribute::create<int32_t>(ctx, "a"));
+  schema.add_attribute(tiledb::Attribute::create<std::string>(ctx, "s"));
+  tiledb::Array::create(array_name, schema);
+
+  std::vector<int32_t> d(100);
+  std::vector<int32_t> a(100);
+  std::string s;
+  std::vector<uint64_t> s_offsets(100);
+  for (int32_t i = 0; i < 100; i++) {
+    d[i] = i + 1;
+    a[i] = i * 3;
+    s_offsets[i] = s.size();
+    s += std::string(i % 7 + 1, static_cast<char>('a' + i % 26));
+  }
+
+  tiledb::Array array_w(ctx, array_name, TILEDB_WRITE);
+  tiledb::Query query_w(ctx, array_w);
+  query_w.set_data_buffer("a", a).set_data_buffer("s", s).set_offsets_buffer(
+      "s", s_offsets);
+  if (array_type == TILEDB_SPARSE) {
+    query_w.set_layout(TILEDB_UNORDERED).set_data_buffer("d", d);
+  } else {
+    query_w.set_layout(TILEDB_ROW_MAJOR)
+        .set_subarray(tiledb::Subarray(ctx, array_w).add_range(0, 1, 100));
+  }
+  query_w.submit();
+  array_w.close();
+
+  // The second read is served from the cache populated by the first one.
+  for (int iter = 0; iter < 2; iter++) {
+    std::vector<int32_t> a_read(100);
+    std::string s_read(s.size(), '\0');
+    std::vector<uint64_t> s_offsets_read(100);
+    tiledb::Array array_r(ctx, array_name, TILEDB_READ);
+    tiledb::Query query_r(ctx, array_r);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_subarray(tiledb::Subarray(ctx, array_r).add_range(0, 1, 100))
+        .set_data_buffer("a", a_read)
+        .set_data_buffer("s", s_read)
+        .set_offsets_buffer("s", s_offsets_read);
+    REQUIRE(query_r.submit() == tiledb::Query::Status::COMPLETE);
+    CHECK(a_read == a);
+    CHECK(s_read == s);
+    CHECK(s_offsets_read == s_offsets);
+
+    // Only the second read hits the cache.
+    const std::string stats{query_r.stats()};
+    const std::string counter{"num_tile_cache_hits\": "};
+    auto pos = stats.find(counter);
+    REQUIRE(pos != std::string::npos);
+    uint64_t hits = std::stoull(stats.substr(pos + counter.size()));
+    if (iter == 0) {
+      CHECK(hits == 0);
+    } else {
+      CHECK(hits > 0);
+    }
+    array_r.close();
+  }
+
+  vfs.remove_dir(array_name);
+}
+
+TEST_CASE(
+    "TileCache: Encrypted arrays are not cached", "[tile-cache][cppapi]") {
+  const std::string array_name = "tile_cache_encrypted_array";
+  tiledb::Config config;
+  config["sm.tile_cache_size"] = "10000000";
+  config["sm.encryption_type"] = "AES_256_GCM";
+  config["sm.encryption_key"] = "0123456789abcdeF0123456789abcdeF";
+  tiledb::Context ctx(config);
+  tiledb::VFS vfs(ctx);
+  if (vfs.is_dir(array_name)) {
+    vfs.remove_dir(array_name);
+  }
+
+  tiledb::Domain domain(ctx);
+  domain.add_dimension(
+      tiledb::Dimension::create<int32_t>(ctx, "d", {{1, 100}}, 10));
+  tiledb::ArraySchema schema(ctx, TILEDB_SPARSE);
+  schema.set_domain(domain);
+  schema.add_attribute(tiledb::Attribute::create<int32_t>(ctx, "a"));
+  tiledb::Array::create(array_name, schema);
+
+  std::vector<int32_t> d(100);
+  std::vector<int32_t> a(100);
+  for (int32_t i = 0; i < 100; i++) {
+    d[i] = i + 1;
+    a[i] = i * 3;
+  }
+
+  tiledb::Array array_w(ctx, array_name, TILEDB_WRITE);
+  tiledb::Query query_w(ctx, array_w);
+  query_w.set_layout(TILEDB_UNORDERED)
+      .set_data_buffer("d", d)
+      .set_data_buffer("a", a);
+  query_w.submit();
+  array_w.close();
+
+  // Neither read uses the cache, and the data is read from storage.
+  for (int iter = 0; iter < 2; iter++) {
+    std::vector<int32_t> a_read(100);
+    tiledb::Array array_r(ctx, array_name, TILEDB_READ);
+    tiledb::Query query_r(ctx, array_r);
+    query_r.set_layout(TILEDB_GLOBAL_ORDER)
+        .set_subarray(tiledb::Subarray(ctx, array_r).add_range(0, 1, 100))
+        .set_data_buffer("a", a_read);
+    REQUIRE(query_r.submit() == tiledb::Query::Status::COMPLETE);
+    CHECK(a_read == a);
+
+    const std::string stats{query_r.stats()};
+    CHECK(stats.find("num_tile_cache_hits") == std::string::npos);
+    CHECK(stats.find("num_tiles_read") != std::string::npos);
+    array_r.close();
+  }
+
+  vfs.remove_dir(array_name);
+}
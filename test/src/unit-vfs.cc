@@ -351,3 +351,141 @@ TEST_CASE("VFS: test ls_with_sizes", "[vfs][ls-with-sizes]") {
   // Clean up
   REQUIRE(vfs_ls.remove_dir(URI(path)).ok());
 }
+
+TEST_CASE("VFS: test read_batch", "[vfs][read-batch]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  Config config;
+  REQUIRE(config.set("vfs.min_batch_gap", "8").ok());
+  REQUIRE(config.set("vfs.min_parallel_size", "16").ok());
+  // Without io_uring support, the VFS falls back to vectored reads.
+  std::string use_io_uring = GENERATE("false", "true");
+  REQUIRE(config.set("vfs.file.use_io_uring", use_io_uring).ok());
+  VFS vfs{&g_helper_stats, &compute_tp, &io_tp, config};
+
+#ifdef _WIN32
+  std::string local_path = tiledb::sm::Win::current_dir() + "\\vfs_test\\";
+#else
+  std::string local_path =
+      std::string("file://") + tiledb::sm::Posix::current_dir() + "/vfs_test/";
+#endif
+  std::string path = GENERATE_COPY(local_path, std::string("mem://vfs_test/"));
+
+  // Clean up
+  bool is_dir = false;
+  REQUIRE(vfs.is_dir(URI(path), &is_dir).ok());
+  if (is_dir)
+    REQUIRE(vfs.remove_dir(URI(path)).ok());
+  REQUIRE(vfs.create_dir(URI(path)).ok());
+
+  // Write a file where each byte holds its offset
+  URI file(path + "file");
+  std::vector<uint8_t> data(256);
+  for (uint64_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  REQUIRE(vfs.write(file, data.data(), data.size()).ok());
+  REQUIRE(vfs.close_file(file).ok());
+
+  // Unsorted ranges, some within the coalescing gap and some beyond it.
+  std::vector<std::pair<uint64_t, uint64_t>> offsets_sizes = {
+      {200, 56}, {3, 10}, {0, 2}, {20, 4}, {100, 50}, {150, 1}};
+  std::vector<std::vector<uint8_t>> buffers;
+  std::vector<ReadRange> ranges;
+  for (auto& [offset, size] : offsets_sizes) {
+    buffers.emplace_back(size);
+  }
+  for (uint64_t i = 0; i < offsets_sizes.size(); i++) {
+    ranges.push_back(
+        {offsets_sizes[i].first, buffers[i].data(), offsets_sizes[i].second});
+  }
+  REQUIRE(vfs.read_batch(file, ranges).ok());
+  for (uint64_t i = 0; i < offsets_sizes.size(); i++) {
+    auto& [offset, size] = offsets_sizes[i];
+    CHECK(
+        buffers[i] == std::vector<uint8_t>(
+                          data.begin() + offset, data.begin() + offset + size));
+  }
+
+  // Overlapping ranges are rejected
+  std::vector<uint8_t> overlap(10);
+  CHECK(!vfs.read_batch(file, {{0, overlap.data(), 5}, {4, overlap.data(), 5}})
+             .ok());
+
+  // Reading past the end of the file fails
+  CHECK(!vfs.read_batch(file, {{250, overlap.data(), 10}}).ok());
+
+  // Clean up
+  REQUIRE(vfs.remove_dir(URI(path)).ok());
+}
+
+#ifndef _WIN32
+TEST_CASE("VFS: test map", "[vfs][map]") {
+  ThreadPool compute_tp(4);
+  ThreadPool io_tp(4);
+  Config config;
+  REQUIRE(config.set("vfs.file.use_mmap", "true").ok());
+  VFS vfs{&g_helper_stats, &compute_tp, &io_tp, config};
+
+  std::string path =
+      std::string("file://") + tiledb::sm::Posix::current_dir() + "/vfs_test/";
+  bool is_dir = false;
+  REQUIRE(vfs.is_dir(URI(path), &is_dir).ok());
+  if (is_dir)
+    REQUIRE(vfs.remove_dir(URI(path)).ok());
+  REQUIRE(vfs.create_dir(URI(path)).ok());
+
+  URI file(path + "file");
+  CHECK(vfs.use_mmap(file));
+  CHECK(!vfs.use_mmap(URI("mem://vfs_test/file")));
+
+  // Write a file spanning a few pages, where each byte holds its offset
+  std::vector<uint8_t> data(3 * 4096 + 100);
+  for (uint64_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i);
+  }
+  REQUIRE(vfs.write(file, data.data(), data.size()).ok());
+  REQUIRE(vfs.close_file(file).ok());
+
+  // Ranges starting within a page are mapped from the page boundary
+  uint64_t offset = GENERATE(0, 1, 4095, 4096, 5000);
+  uint64_t nbytes = data.size() - offset;
+  shared_ptr<char> mapped;
+  REQUIRE(vfs.map(file, offset, nbytes, &mapped).ok());
+  REQUIRE(mapped != nullptr);
+  CHECK(std::memcmp(mapped.get(), data.data() + offset, nbytes) == 0);
+
+  // Writes through the mapping are not carried to the file
+  mapped.get()[0] = ~mapped.get()[0];
+  std::vector<uint8_t> read_back(1);
+  REQUIRE(vfs.read(file, offset, read_back.data(), 1).ok());
+  CHECK(read_back[0] == data[offset]);
+  mapped.reset();
+
+  // Mapping past the end of the file fails
+  CHECK(!vfs.map(file, data.size() - 10, 11, &mapped).ok());
+
+  // Multiple ranges share a single mapping
+  std::vector<std::pair<uint64_t, uint64_t>> ranges{
+      {5000, 100}, {offset, 10}, {2 * 4096 + 1, 4096}};
+  std::vector<shared_ptr<char>> views;
+  REQUIRE(vfs.map_batch(file, ranges, &views).ok());
+  REQUIRE(views.size() == ranges.size());
+  for (uint64_t r = 0; r < ranges.size(); r++) {
+    CHECK(
+        std::memcmp(
+            views[r].get(),
+            data.data() + ranges[r].first,
+            ranges[r].second) == 0);
+  }
+  views.resize(1);
+  CHECK(std::memcmp(views[0].get(), data.data() + 5000, 100) == 0);
+  views.clear();
+
+  // Any range past the end of the file fails the batch
+  ranges.emplace_back(data.size() - 10, 11);
+  CHECK(!vfs.map_batch(file, ranges, &views).ok());
+
+  REQUIRE(vfs.remove_dir(URI(path)).ok());
+}
+#endif
@@ -63,6 +63,10 @@ TILEDB_FILTER_TYPE_ENUM(FILTER_NONE) = 0,
     TILEDB_FILTER_TYPE_ENUM(FILTER_DEPRECATED) = 17,
     /** WEBP filter. */
     TILEDB_FILTER_TYPE_ENUM(FILTER_WEBP) = 18,
+    /** Adaptive compressor, choosing a compressor per tile chunk. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_ADAPTIVE_COMPRESSION) = 19,
+    /** Patched frame-of-reference integer bit packing. */
+    TILEDB_FILTER_TYPE_ENUM(FILTER_PFOR) = 20,
 #endif
 
 #ifdef TILEDB_FILTER_OPTION_ENUM
@@ -84,6 +88,11 @@ TILEDB_FILTER_TYPE_ENUM(FILTER_NONE) = 0,
     TILEDB_FILTER_OPTION_ENUM(WEBP_INPUT_FORMAT) = 7,
     /** Enable lossless WebP compression Type: uint8_t */
     TILEDB_FILTER_OPTION_ENUM(WEBP_LOSSLESS) = 8,
+    /**
+     * Weight of decode cost against storage size for the adaptive compression
+     * filter. Type: float64.
+     */
+    TILEDB_FILTER_OPTION_ENUM(ADAPTIVE_DECODE_COST_WEIGHT) = 9,
 #endif
 
 #ifdef TILEDB_FILTER_WEBP_FORMAT
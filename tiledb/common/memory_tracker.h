@@ -29,58 +29,155 @@
  * @section DESCRIPTION
  *
  * This file defines class MemoryTracker.
+ *
+ * A memory tracker accounts for memory taken by one component against a
+ * budget. Trackers form a tree (context -> array -> query -> reader
+ * component); memory taken from a tracker is also taken from all of its
+ * ancestors, so it succeeds only if every budget on the path to the root has
+ * room for it.
+ *
+ * Accounting is lock-free: the total usage is reserved with a compare-and-swap
+ * against the budget, and the per-type counters and high-water marks are
+ * updated with atomic operations, each on its own cache line.
  */
 
 #ifndef TILEDB_MEMORY_TRACKER_H
 #define TILEDB_MEMORY_TRACKER_H
 
+#include <array>
+#include <atomic>
+#include <limits>
+#include <string>
+
 #include "tiledb/common/status.h"
+#include "tiledb/sm/stats/stats.h"
 
 namespace tiledb {
 namespace sm {
 
 class MemoryTracker {
  public:
-  enum class MemoryType { RTREE, FOOTER, TILE_OFFSETS, MIN_MAX_SUM_NULL_COUNT };
+  enum class MemoryType : uint8_t {
+    RTREE,
+    FOOTER,
+    TILE_OFFSETS,
+    MIN_MAX_SUM_NULL_COUNT,
+    TILES,
+    TILE_CACHE
+  };
 
-  /** Constructor. */
-  MemoryTracker() {
-    memory_usage_ = 0;
-    memory_budget_ = std::numeric_limits<uint64_t>::max();
+  /** The number of values of `MemoryType`. */
+  static constexpr size_t num_memory_types = 6;
+
+  /**
+   * Constructor.
+   *
+   * @param parent The tracker memory taken from this tracker is also taken
+   *     from, or nullptr for a root tracker.
+   */
+  explicit MemoryTracker(MemoryTracker* parent = nullptr)
+      : parent_(parent)
+      , memory_usage_(0)
+      , memory_budget_(std::numeric_limits<uint64_t>::max())
+      , memory_high_water_mark_(0) {
+    for (auto& counters : counters_by_type_) {
+      counters.usage_ = 0;
+      counters.high_water_mark_ = 0;
+    }
   };
 
-  /** Destructor. */
-  ~MemoryTracker() = default;
+  /**
+   * Destructor. Memory still taken from this tracker is returned to the
+   * ancestors, as nothing can release it through this tracker anymore.
+   */
+  ~MemoryTracker() {
+    if (parent_ == nullptr) {
+      return;
+    }
+
+    for (size_t i = 0; i < num_memory_types; ++i) {
+      auto usage = counters_by_type_[i].usage_.load(std::memory_order_relaxed);
+      if (usage > 0) {
+        parent_->release_memory(usage, static_cast<MemoryType>(i));
+      }
+    }
+  }
 
   DISABLE_COPY_AND_COPY_ASSIGN(MemoryTracker);
   DISABLE_MOVE_AND_MOVE_ASSIGN(MemoryTracker);
 
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the name of a memory type, as used for stats. */
+  static std::string memory_type_str(MemoryType mem_type) {
+    switch (mem_type) {
+      case MemoryType::RTREE:
+        return "rtree";
+      case MemoryType::FOOTER:
+        return "footer";
+      case MemoryType::TILE_OFFSETS:
+        return "tile_offsets";
+      case MemoryType::MIN_MAX_SUM_NULL_COUNT:
+        return "min_max_sum_null_count";
+      case MemoryType::TILES:
+        return "tiles";
+      case MemoryType::TILE_CACHE:
+        return "tile_cache";
+    }
+    return "";
+  }
+
+  /** Returns the parent tracker, or nullptr for a root tracker. */
+  MemoryTracker* parent() const {
+    return parent_;
+  }
+
   /**
-   * Take memory from the budget.
+   * Take memory from the budget of this tracker and of all its ancestors.
    *
    * @param size The memory size.
-   * @return true if the memory is available, false otherwise.
+   * @param mem_type The memory type.
+   * @return true if the memory is available, false otherwise. Nothing is
+   *     taken from any tracker if false is returned.
    */
   bool take_memory(uint64_t size, MemoryType mem_type) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    if (memory_usage_ + size <= memory_budget_) {
-      memory_usage_ += size;
-      memory_usage_by_type_[mem_type] += size;
-      return true;
+    const uint64_t budget = memory_budget_.load(std::memory_order_relaxed);
+    uint64_t usage = memory_usage_.load(std::memory_order_relaxed);
+    do {
+      if (usage > budget || size > budget - usage) {
+        return false;
+      }
+    } while (!memory_usage_.compare_exchange_weak(
+        usage, usage + size, std::memory_order_relaxed));
+
+    if (parent_ != nullptr && !parent_->take_memory(size, mem_type)) {
+      memory_usage_.fetch_sub(size, std::memory_order_relaxed);
+      return false;
     }
 
-    return false;
+    update_max(memory_high_water_mark_, usage + size);
+    auto& counters = counters_by_type_[static_cast<size_t>(mem_type)];
+    update_max(
+        counters.high_water_mark_,
+        counters.usage_.fetch_add(size, std::memory_order_relaxed) + size);
+    return true;
   }
 
   /**
-   * Release memory from the budget.
+   * Release memory to the budget of this tracker and of all its ancestors.
    *
    * @param size The memory size.
+   * @param mem_type The memory type.
    */
   void release_memory(uint64_t size, MemoryType mem_type) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    memory_usage_ -= size;
-    memory_usage_by_type_[mem_type] -= size;
+    memory_usage_.fetch_sub(size, std::memory_order_relaxed);
+    counters_by_type_[static_cast<size_t>(mem_type)].usage_.fetch_sub(
+        size, std::memory_order_relaxed);
+    if (parent_ != nullptr) {
+      parent_->release_memory(size, mem_type);
+    }
   }
 
   /**
@@ -90,64 +187,130 @@ class MemoryTracker {
    * @return true if the budget can be set, false otherwise.
    */
   bool set_budget(uint64_t size) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    if (memory_usage_ > size) {
+    if (memory_usage_.load(std::memory_order_relaxed) > size) {
       return false;
     }
 
-    memory_budget_ = size;
+    memory_budget_.store(size, std::memory_order_relaxed);
     return true;
   }
 
   /**
-   * Get the memory usage.
+   * Get the memory usage, including the usage of descendant trackers.
    */
-  uint64_t get_memory_usage() {
-    std::lock_guard<std::mutex> lg(mutex_);
-    return memory_usage_;
+  uint64_t get_memory_usage() const {
+    return memory_usage_.load(std::memory_order_relaxed);
   }
 
   /**
    * Get the memory usage by type.
    */
-  uint64_t get_memory_usage(MemoryType mem_type) {
-    std::lock_guard<std::mutex> lg(mutex_);
-    return memory_usage_by_type_[mem_type];
+  uint64_t get_memory_usage(MemoryType mem_type) const {
+    return counters_by_type_[static_cast<size_t>(mem_type)].usage_.load(
+        std::memory_order_relaxed);
   }
 
   /**
-   * Get available room based on budget
+   * Get available room based on budget. This does not account for the
+   * budgets of ancestor trackers.
    * @return available amount left in budget
    */
-  uint64_t get_memory_available() {
-    std::lock_guard<std::mutex> lg(mutex_);
-    return memory_budget_ - memory_usage_;
+  uint64_t get_memory_available() const {
+    uint64_t budget = memory_budget_.load(std::memory_order_relaxed);
+    uint64_t usage = memory_usage_.load(std::memory_order_relaxed);
+    return usage > budget ? 0 : budget - usage;
   }
 
   /**
    * Get memory budget
    * @return budget
    */
-  uint64_t get_memory_budget() {
-    std::lock_guard<std::mutex> lg(mutex_);
-    return memory_budget_;
+  uint64_t get_memory_budget() const {
+    return memory_budget_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Get the highest memory usage seen since construction.
+   */
+  uint64_t get_memory_high_water_mark() const {
+    return memory_high_water_mark_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Get the highest memory usage by type seen since construction.
+   */
+  uint64_t get_memory_high_water_mark(MemoryType mem_type) const {
+    return counters_by_type_[static_cast<size_t>(mem_type)]
+        .high_water_mark_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Report the high-water marks as `memory_high_water_mark` and
+   * `memory_high_water_mark.<type>` counters of the given stats. Types that
+   * were never used are not reported.
+   *
+   * @param stats The stats to report to.
+   */
+  void export_stats(stats::Stats& stats) const {
+    stats.set_max_counter(
+        "memory_high_water_mark", get_memory_high_water_mark());
+    for (size_t i = 0; i < num_memory_types; ++i) {
+      auto mem_type = static_cast<MemoryType>(i);
+      auto hwm = get_memory_high_water_mark(mem_type);
+      if (hwm > 0) {
+        stats.set_max_counter(
+            "memory_high_water_mark." + memory_type_str(mem_type), hwm);
+      }
+    }
   }
 
  private:
-  /** Protects all member variables. */
-  std::mutex mutex_;
+  /* ********************************* */
+  /*          PRIVATE CLASSES          */
+  /* ********************************* */
+
+  /** Counters of one memory type, padded to avoid false sharing. */
+  struct alignas(64) TypeCounters {
+    /** Memory usage. */
+    std::atomic<uint64_t> usage_;
+
+    /** Highest memory usage seen. */
+    std::atomic<uint64_t> high_water_mark_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /** Raise `max` to `value` if it is lower. */
+  static void update_max(std::atomic<uint64_t>& max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(
+                                  current, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The parent tracker, or nullptr for a root tracker. */
+  MemoryTracker* const parent_;
 
   /** Memory usage for tracked structures. */
-  uint64_t memory_usage_;
+  alignas(64) std::atomic<uint64_t> memory_usage_;
 
   /** Memory budget. */
-  uint64_t memory_budget_;
+  std::atomic<uint64_t> memory_budget_;
+
+  /** Highest memory usage seen. */
+  std::atomic<uint64_t> memory_high_water_mark_;
 
   /** Memory usage by type. */
-  std::unordered_map<MemoryType, uint64_t> memory_usage_by_type_;
+  std::array<TypeCounters, num_memory_types> counters_by_type_;
 };
 
 }  // namespace sm
 }  // namespace tiledb
 
-#endif  // TILEDB_OPEN_ARRAY_MEMORY_TRACKER_H
\ No newline at end of file
+#endif  // TILEDB_MEMORY_TRACKER_H
@@ -0,0 +1,224 @@
+/**
+ * @file tiledb/common/thread_pool/test/bench_thread_pool.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Microbenchmarks comparing the work-stealing `ThreadPool` against a pool
+ * built on a single `ProducerConsumerQueue`, which is how `ThreadPool` was
+ * implemented before it used per-worker deques. Prints the best time of every
+ * workload in milliseconds.
+ *
+ * Usage: bench_thread_pool [iterations] [threads]
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "tiledb/common/thread_pool.h"
+#include "tiledb/common/thread_pool/producer_consumer_queue.h"
+
+using namespace tiledb::common;
+
+namespace {
+
+/**
+ * Reference pool: every task is a `shared_ptr<packaged_task>` kept in one
+ * mutex-protected queue shared by all submitters, workers and waiters.
+ */
+class SingleQueueThreadPool {
+ public:
+  using Task = std::future<Status>;
+
+  explicit SingleQueueThreadPool(size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      threads_.emplace_back([this]() {
+        while (auto task = queue_.pop()) {
+          (**task)();
+        }
+      });
+    }
+  }
+
+  ~SingleQueueThreadPool() {
+    queue_.drain();
+    for (auto& t : threads_) {
+      t.join();
+    }
+  }
+
+  template <class Fn>
+  Task async(Fn&& f) {
+    auto task = std::make_shared<std::packaged_task<Status()>>(
+        std::forward<Fn>(f));
+    auto future = task->get_future();
+    queue_.push(task);
+    return future;
+  }
+
+  Status wait_all(std::vector<Task>& tasks) {
+    Status ret = Status::Ok();
+    for (auto& task : tasks) {
+      while (task.wait_for(std::chrono::milliseconds(0)) !=
+             std::future_status::ready) {
+        if (auto val = queue_.try_pop()) {
+          (**val)();
+        } else {
+          std::this_thread::yield();
+        }
+      }
+      auto st = task.get();
+      if (ret.ok() && !st.ok()) {
+        ret = st;
+      }
+    }
+    return ret;
+  }
+
+ private:
+  ProducerConsumerQueue<
+      std::shared_ptr<std::packaged_task<Status()>>,
+      std::deque<std::shared_ptr<std::packaged_task<Status()>>>>
+      queue_;
+  std::vector<std::thread> threads_;
+};
+
+/** Submit many tiny tasks from one thread and wait, like `parallel_for`. */
+template <class Pool>
+uint64_t flat(Pool& pool, size_t num_tasks) {
+  std::atomic<uint64_t> sum{0};
+  std::vector<typename Pool::Task> tasks;
+  tasks.reserve(num_tasks);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    tasks.emplace_back(pool.async([&sum, i]() {
+      sum += i;
+      return Status::Ok();
+    }));
+  }
+  if (!pool.wait_all(tasks).ok()) {
+    return 0;
+  }
+  return sum;
+}
+
+/**
+ * Recursively split a range in two and wait on both halves, like
+ * `parallel_sort`.
+ */
+template <class Pool>
+uint64_t fork_join(Pool& pool, uint64_t begin, uint64_t end) {
+  if (end - begin <= 64) {
+    uint64_t sum = 0;
+    for (uint64_t i = begin; i < end; ++i) {
+      sum += i;
+    }
+    return sum;
+  }
+
+  uint64_t mid = begin + (end - begin) / 2;
+  uint64_t left = 0;
+  uint64_t right = 0;
+  std::vector<typename Pool::Task> tasks;
+  tasks.emplace_back(pool.async([&]() {
+    left = fork_join(pool, begin, mid);
+    return Status::Ok();
+  }));
+  tasks.emplace_back(pool.async([&]() {
+    right = fork_join(pool, mid, end);
+    return Status::Ok();
+  }));
+  if (!pool.wait_all(tasks).ok()) {
+    return 0;
+  }
+  return left + right;
+}
+
+/**
+ * Runs `f` `iterations` times and prints its best time. Exits if `f` does not
+ * return `expected`.
+ */
+template <class F>
+void run(
+    const char* workload,
+    const char* pool,
+    uint64_t iterations,
+    uint64_t expected,
+    F&& f) {
+  double best = 0;
+  for (uint64_t i = 0; i < iterations; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = f();
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    if (result != expected) {
+      std::fprintf(stderr, "%s %s: wrong result\n", workload, pool);
+      std::exit(EXIT_FAILURE);
+    }
+    best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  std::printf("%-10s %-14s %10.2f ms\n", workload, pool, best);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint64_t iterations =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10;
+  const size_t num_threads = argc > 2 ?
+                                 std::strtoull(argv[2], nullptr, 10) :
+                                 std::thread::hardware_concurrency();
+  std::printf("threads: %zu\n", num_threads);
+
+  ThreadPool pool{num_threads};
+  SingleQueueThreadPool reference_pool{num_threads};
+
+  const size_t num_tasks = 100000;
+  const uint64_t flat_expected = num_tasks * (num_tasks - 1) / 2;
+  run("flat", "work stealing", iterations, flat_expected, [&] {
+    return flat(pool, num_tasks);
+  });
+  run("flat", "single queue", iterations, flat_expected, [&] {
+    return flat(reference_pool, num_tasks);
+  });
+
+  const uint64_t n = 1 << 20;
+  const uint64_t fork_join_expected = n * (n - 1) / 2;
+  run("fork-join", "work stealing", iterations, fork_join_expected, [&] {
+    return fork_join(pool, 0, n);
+  });
+  run("fork-join", "single queue", iterations, fork_join_expected, [&] {
+    return fork_join(reference_pool, 0, n);
+  });
+
+  return 0;
+}
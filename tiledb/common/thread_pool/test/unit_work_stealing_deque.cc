@@ -0,0 +1,133 @@
+/**
+ * @file tiledb/common/thread_pool/test/unit_work_stealing_deque.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the `ThreadPool` class.
+ * @section DESCRIPTION
+ *
+ * Tests the `WorkStealingDeque` class.
+ */
+
+#include <test/support/tdb_catch.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "tiledb/common/thread_pool/work_stealing_deque.h"
+
+using tiledb::common::WorkStealingDeque;
+
+TEST_CASE("WorkStealingDeque: Owner is LIFO", "[work_stealing_deque]") {
+  WorkStealingDeque<int*> deque{2};
+  std::vector<int> items(100);
+
+  REQUIRE(deque.empty());
+  REQUIRE(deque.pop() == nullptr);
+  REQUIRE(deque.steal() == nullptr);
+
+  // Pushing more items than the initial capacity grows the buffer.
+  for (auto& item : items) {
+    deque.push(&item);
+  }
+  REQUIRE(!deque.empty());
+  for (size_t i = items.size(); i > 0; --i) {
+    REQUIRE(deque.pop() == &items[i - 1]);
+  }
+  REQUIRE(deque.empty());
+  REQUIRE(deque.pop() == nullptr);
+}
+
+TEST_CASE("WorkStealingDeque: Thieves are FIFO", "[work_stealing_deque]") {
+  WorkStealingDeque<int*> deque{2};
+  std::vector<int> items(100);
+
+  for (auto& item : items) {
+    deque.push(&item);
+  }
+  for (size_t i = 0; i < items.size(); ++i) {
+    REQUIRE(deque.steal() == &items[i]);
+  }
+  REQUIRE(deque.steal() == nullptr);
+  REQUIRE(deque.pop() == nullptr);
+}
+
+TEST_CASE(
+    "WorkStealingDeque: Concurrent pop and steal", "[work_stealing_deque]") {
+  const size_t num_items = 100000;
+  const size_t num_thieves = 4;
+
+  WorkStealingDeque<size_t*> deque{16};
+  std::vector<size_t> items(num_items);
+  std::vector<std::atomic<int>> taken(num_items);
+  std::atomic<size_t> num_taken{0};
+  std::atomic<bool> done{false};
+
+  auto take = [&](size_t* item) {
+    taken[*item]++;
+    num_taken++;
+  };
+
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < num_thieves; ++i) {
+    thieves.emplace_back([&]() {
+      while (!done) {
+        if (auto item = deque.steal()) {
+          take(item);
+        }
+      }
+    });
+  }
+
+  // The owner interleaves pushes and pops while the thieves steal.
+  for (size_t i = 0; i < num_items; ++i) {
+    items[i] = i;
+    deque.push(&items[i]);
+    if (i % 3 == 0) {
+      if (auto item = deque.pop()) {
+        take(item);
+      }
+    }
+  }
+  while (auto item = deque.pop()) {
+    take(item);
+  }
+
+  while (num_taken < num_items) {
+    std::this_thread::yield();
+  }
+  done = true;
+  for (auto& t : thieves) {
+    t.join();
+  }
+
+  // Every item is taken exactly once.
+  REQUIRE(num_taken == num_items);
+  for (auto& t : taken) {
+    REQUIRE(t == 1);
+  }
+}
@@ -40,14 +40,29 @@
 
 namespace tiledb::common {
 
+namespace {
+
+/** The pool the calling thread is a worker of, if any. */
+thread_local const ThreadPool* current_pool = nullptr;
+
+/** The index of the calling thread among the workers of `current_pool`. */
+thread_local size_t current_worker_index = 0;
+
+}  // namespace
+
 // Constructor.  May throw an exception on error.  No logging is done as the
 // logger may not yet be initialized.
 ThreadPool::ThreadPool(size_t n)
-    : concurrency_level_(n) {
+    : local_queues_(n)
+    , injection_queues_(n)
+    , next_injection_queue_(0)
+    , num_queued_(0)
+    , num_sleeping_(0)
+    , stopping_(n == 0)
+    , concurrency_level_(n) {
   // If concurrency_level_ is set to zero, construct the thread pool in shutdown
-  // state.  Explicitly shut down the task queue as well.
+  // state.
   if (concurrency_level_ == 0) {
-    task_queue_.drain();
     return;
   }
 
@@ -73,7 +88,7 @@ ThreadPool::ThreadPool(size_t n)
     size_t tries = 3;
     while (tries--) {
       try {
-        tmp = std::thread(&ThreadPool::worker, this);
+        tmp = std::thread(&ThreadPool::worker, this, i);
       } catch (const std::system_error& e) {
         if (e.code() != std::errc::resource_unavailable_try_again ||
             tries == 0) {
@@ -99,26 +114,134 @@ ThreadPool::ThreadPool(size_t n)
   }
 }
 
-void ThreadPool::worker() {
+void ThreadPool::worker(size_t index) {
+  current_pool = this;
+  current_worker_index = index;
+
   while (true) {
-    auto val = task_queue_.pop();
-    if (val) {
-      (*(*val))();
-    } else {
+    if (auto task = take_task(index)) {
+      run_task(task);
+      continue;
+    }
+
+    // A task has been queued but could not be taken yet, e.g. a steal lost a
+    // race or the submitter is still publishing it. Retry without sleeping.
+    if (num_queued_.load() > 0) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    std::unique_lock lock{sleep_mutex_};
+    num_sleeping_++;
+    sleep_cv_.wait(
+        lock, [this]() { return num_queued_.load() > 0 || stopping_.load(); });
+    num_sleeping_--;
+
+    // Keep running tasks on shutdown until all queues are empty.
+    if (stopping_.load() && num_queued_.load() <= 0) {
       break;
     }
   }
+
+  current_pool = nullptr;
+}
+
+size_t ThreadPool::worker_index() const {
+  return current_pool == this ? current_worker_index : local_queues_.size();
+}
+
+void ThreadPool::enqueue(TaskBase* task) {
+  size_t index = worker_index();
+  if (index < local_queues_.size()) {
+    local_queues_[index].push(task);
+  } else {
+    auto& queue = injection_queues_
+        [next_injection_queue_.fetch_add(1, std::memory_order_relaxed) %
+         injection_queues_.size()];
+    std::lock_guard lock{queue.mutex_};
+    queue.tasks_.push_back(task);
+  }
+
+  // Publishing the task before checking for sleepers pairs with a worker
+  // registering as a sleeper before checking for tasks, so that at least one
+  // side observes the other.
+  num_queued_++;
+  if (num_sleeping_.load() > 0) {
+    std::lock_guard lock{sleep_mutex_};
+    sleep_cv_.notify_one();
+  }
+}
+
+ThreadPool::TaskBase* ThreadPool::take_task(size_t index) {
+  if (num_queued_.load(std::memory_order_relaxed) <= 0) {
+    return nullptr;
+  }
+
+  const size_t n = local_queues_.size();
+  TaskBase* task = nullptr;
+
+  // Newest task of our own deque, for locality
+  if (index < n) {
+    task = local_queues_[index].pop();
+  }
+
+  // Tasks submitted from outside the pool, newest first. Workers start with
+  // their own shard, other threads with the most recently used one. Taking the
+  // newest task keeps the nesting of tasks run while waiting shallow.
+  size_t start = index;
+  if (index >= n) {
+    start = (next_injection_queue_.load(std::memory_order_relaxed) + n - 1) % n;
+  }
+  for (size_t i = 0; task == nullptr && i < n; ++i) {
+    auto& queue = injection_queues_[(start + i) % n];
+    std::lock_guard lock{queue.mutex_};
+    if (!queue.tasks_.empty()) {
+      task = queue.tasks_.back();
+      queue.tasks_.pop_back();
+    }
+  }
+
+  // Oldest task of another worker
+  for (size_t i = 1; task == nullptr && i <= n; ++i) {
+    size_t victim = (start + i) % n;
+    if (victim != index) {
+      task = local_queues_[victim].steal();
+    }
+  }
+
+  if (task != nullptr) {
+    num_queued_--;
+  }
+  return task;
 }
 
 // shutdown is private and only called by constructor and destructor (RAII), so
 // shutdown won't be called from multiple threads.
 void ThreadPool::shutdown() {
   concurrency_level_.store(0);
-  task_queue_.drain();
+  {
+    std::lock_guard lock{sleep_mutex_};
+    stopping_.store(true);
+    sleep_cv_.notify_all();
+  }
   for (auto&& t : threads_) {
     t.join();
   }
   threads_.clear();
+
+  // Destroy any task that was never run, e.g. when the constructor failed to
+  // launch every worker. Their futures report a broken promise.
+  for (auto& queue : injection_queues_) {
+    for (auto task : queue.tasks_) {
+      delete task;
+    }
+    queue.tasks_.clear();
+  }
+  for (auto& queue : local_queues_) {
+    while (auto task = queue.steal()) {
+      delete task;
+    }
+  }
 }
 
 Status ThreadPool::wait_all(std::vector<Task>& tasks) {
@@ -188,8 +311,8 @@ std::vector<Status> ThreadPool::wait_all_status(std::vector<Task>& tasks) {
 
       // In the meantime, try to do something useful to make progress (and avoid
       // deadlock)
-      if (auto val = task_queue_.try_pop()) {
-        (*(*val))();
+      if (auto val = take_task(worker_index())) {
+        run_task(val);
       } else {
         // If nothing useful to do, yield so we don't burn cycles
         // going through the task list over and over (thereby slowing down other
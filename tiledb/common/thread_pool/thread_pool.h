@@ -33,10 +33,13 @@
 #ifndef TILEDB_THREAD_POOL_H
 #define TILEDB_THREAD_POOL_H
 
-#include "producer_consumer_queue.h"
+#include "work_stealing_deque.h"
 
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <mutex>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/logger_public.h"
@@ -101,8 +104,9 @@ class ThreadPool {
 
     using R = std::invoke_result_t<std::decay_t<Fn>, std::decay_t<Args>...>;
 
-    auto task = make_shared<std::packaged_task<R()>>(
-        HERE(),
+    // Tasks are allocated with plain `new` rather than `tdb_new`, which would
+    // build a label string for every task.
+    auto task = new PackagedTask<R>(
         [f = std::forward<Fn>(f),
          args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
           return std::apply(std::move(f), std::move(args));
@@ -110,7 +114,7 @@ class ThreadPool {
 
     std::future<R> future = task->get_future();
 
-    task_queue_.push(task);
+    enqueue(task);
 
     return future;
   }
@@ -154,21 +158,130 @@ class ThreadPool {
   std::vector<Status> wait_all_status(std::vector<Task>& tasks);
 
   /* ********************************* */
-  /*         PRIVATE ATTRIBUTES        */
+  /*          PRIVATE CLASSES          */
   /* ********************************* */
 
  private:
+  /**
+   * Type-erased unit of work. Tasks are owned by whichever queue holds them
+   * and are deleted by the thread that runs them.
+   */
+  class TaskBase {
+   public:
+    virtual ~TaskBase() = default;
+
+    /** Run the task. */
+    virtual void run() = 0;
+  };
+
+  /**
+   * A task wrapping a `std::packaged_task` returning `R`. Like the
+   * `shared_ptr<packaged_task>` the pool used to queue, a task takes two
+   * allocations: this wrapper and the shared state of the packaged task,
+   * which holds the callable and its result for the returned future. The
+   * queues own the raw pointer, so moving a task between them does not touch
+   * any reference count.
+   */
+  template <class R>
+  class PackagedTask : public TaskBase {
+   public:
+    template <class F>
+    explicit PackagedTask(F&& f)
+        : task_(std::forward<F>(f)) {
+    }
+
+    std::future<R> get_future() {
+      return task_.get_future();
+    }
+
+    void run() override {
+      task_();
+    }
+
+   private:
+    std::packaged_task<R()> task_;
+  };
+
+  /**
+   * Queue receiving tasks submitted by threads that are not workers of this
+   * pool. There is one per worker; submitters spread their tasks round-robin
+   * across them so that no single lock is shared by every thread.
+   */
+  struct InjectionQueue {
+    std::mutex mutex_;
+    std::deque<TaskBase*> tasks_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
   /** The worker thread routine */
-  void worker();
+  void worker(size_t index);
 
   /** Terminate threads in the thread pool */
   void shutdown();
 
-  /** Producer-consumer queue where functions to be executed are kept */
-  ProducerConsumerQueue<
-      shared_ptr<std::packaged_task<Status()>>,
-      std::deque<shared_ptr<std::packaged_task<Status()>>>>
-      task_queue_;
+  /**
+   * Queue a task. Workers of this pool push onto their own deque; any other
+   * thread pushes onto one of the injection queues.
+   */
+  void enqueue(TaskBase* task);
+
+  /**
+   * Take a task to run, or return nullptr if none could be found.
+   *
+   * The lookup order is the calling worker's own deque (newest first), then
+   * the injection queues, then stealing the oldest task of another worker.
+   *
+   * @param index The index of the calling worker, or `concurrency_level_` if
+   * the caller is not a worker of this pool.
+   */
+  TaskBase* take_task(size_t index);
+
+  /**
+   * Returns the index of the calling thread among the workers of this pool,
+   * or the number of workers if the caller is not one of them.
+   */
+  size_t worker_index() const;
+
+  /** Run a task taken from one of the queues and destroy it. */
+  static void run_task(TaskBase* task) {
+    task->run();
+    delete task;
+  }
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Per-worker deques of tasks submitted from within the workers. */
+  std::vector<WorkStealingDeque<TaskBase*>> local_queues_;
+
+  /** Queues of tasks submitted from outside of the pool. */
+  std::vector<InjectionQueue> injection_queues_;
+
+  /** Round-robin cursor into `injection_queues_` for external submitters. */
+  std::atomic<size_t> next_injection_queue_;
+
+  /**
+   * Number of tasks that have been queued but not yet taken. This may be
+   * transiently negative as a task can be taken before its submitter has
+   * accounted for it.
+   */
+  std::atomic<int64_t> num_queued_;
+
+  /** Number of workers waiting on `sleep_cv_`. */
+  std::atomic<size_t> num_sleeping_;
+
+  /** Mutex protecting `sleep_cv_`. */
+  std::mutex sleep_mutex_;
+
+  /** Condition variable idle workers wait on for new tasks. */
+  std::condition_variable sleep_cv_;
+
+  /** Set when the pool is shutting down. */
+  std::atomic<bool> stopping_;
 
   /** The worker threads */
   std::vector<std::thread> threads_;
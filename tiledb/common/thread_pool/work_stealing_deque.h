@@ -0,0 +1,238 @@
+/**
+ * @file   work_stealing_deque.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares a lock-free, single-owner, multi-thief work-stealing
+ * deque of pointers.
+ *
+ * The algorithm is the Chase-Lev deque, using the memory orderings of
+ * Lê, Pop, Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing for
+ * Weak Memory Models" (PPoPP 2013). The owning thread pushes and pops items at
+ * the bottom of the deque; any other thread may steal items from the top.
+ *
+ * Buffers retired when the deque grows are kept alive until the deque is
+ * destroyed, since a concurrent thief may still be reading from them.
+ */
+
+#ifndef TILEDB_WORK_STEALING_DEQUE_H
+#define TILEDB_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace tiledb::common {
+
+template <class T>
+class WorkStealingDeque {
+  static_assert(
+      std::is_pointer_v<T>, "WorkStealingDeque items must be pointers");
+
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param capacity The initial capacity, rounded up to a power of two.
+   */
+  explicit WorkStealingDeque(size_t capacity = 1024)
+      : top_(0)
+      , bottom_(0) {
+    size_t c = 1;
+    while (c < capacity) {
+      c <<= 1;
+    }
+    buffers_.emplace_back(std::make_unique<Buffer>(c));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Push an item onto the bottom of the deque. May only be called by the
+   * owning thread.
+   *
+   * @param item The item to push.
+   */
+  void push(T item) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(buffer->capacity()) - 1) {
+      buffer = grow(buffer, t, b);
+    }
+    buffer->put(b, item);
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  /**
+   * Pop an item from the bottom of the deque. May only be called by the owning
+   * thread.
+   *
+   * @return The most recently pushed item, or nullptr if the deque is empty.
+   */
+  T pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      // Empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    T item = buffer->get(b);
+    if (t == b) {
+      // Last item; race against thieves for it
+      if (!top_.compare_exchange_strong(
+              t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  /**
+   * Steal an item from the top of the deque. May be called by any thread.
+   *
+   * @return The oldest item, or nullptr if the deque is empty or the steal
+   * lost a race with another thread.
+   */
+  T steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+
+    if (t >= b) {
+      return nullptr;
+    }
+
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    T item = buffer->get(t);
+    if (!top_.compare_exchange_strong(
+            t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  /**
+   * Returns whether the deque appears empty. The answer may be stale by the
+   * time it is returned if other threads are operating on the deque.
+   */
+  bool empty() const {
+    int64_t t = top_.load(std::memory_order_relaxed);
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    return t >= b;
+  }
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE CLASSES          */
+  /* ********************************* */
+
+  /** A circular array of atomic item slots. */
+  class Buffer {
+   public:
+    explicit Buffer(size_t capacity)
+        : mask_(capacity - 1)
+        , items_(capacity) {
+    }
+
+    size_t capacity() const {
+      return mask_ + 1;
+    }
+
+    T get(int64_t i) const {
+      return items_[static_cast<size_t>(i) & mask_].load(
+          std::memory_order_relaxed);
+    }
+
+    void put(int64_t i, T item) {
+      items_[static_cast<size_t>(i) & mask_].store(
+          item, std::memory_order_relaxed);
+    }
+
+   private:
+    size_t mask_;
+    std::vector<std::atomic<T>> items_;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE METHODS           */
+  /* ********************************* */
+
+  /**
+   * Replace the buffer with one of twice the capacity, copying the live range
+   * `[t, b)`. Owner only.
+   */
+  Buffer* grow(Buffer* old, int64_t t, int64_t b) {
+    buffers_.emplace_back(std::make_unique<Buffer>(old->capacity() * 2));
+    Buffer* buffer = buffers_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      buffer->put(i, old->get(i));
+    }
+    buffer_.store(buffer, std::memory_order_release);
+    return buffer;
+  }
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Index of the oldest item; advanced by thieves and the last pop. */
+  alignas(64) std::atomic<int64_t> top_;
+
+  /** Index one past the newest item; only written by the owner. */
+  alignas(64) std::atomic<int64_t> bottom_;
+
+  /** The current buffer. */
+  std::atomic<Buffer*> buffer_;
+
+  /** All buffers ever allocated, including retired ones. Owner only. */
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace tiledb::common
+
+#endif  // TILEDB_WORK_STEALING_DEQUE_H
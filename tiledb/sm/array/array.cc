@@ -100,6 +100,7 @@ Array::Array(
     , metadata_()
     , metadata_loaded_(false)
     , non_empty_domain_computed_(false)
+    , memory_tracker_(&resources_.memory_tracker())
     , consistency_controller_(cc)
     , consistency_sentry_(nullopt) {
 }
@@ -802,13 +803,22 @@ Status Array::reopen(uint64_t timestamp_start, uint64_t timestamp_end) {
     {
       auto timer_se =
           storage_manager_->stats()->start_timer("array_reopen_directory");
+
+      // Only relist the latest entries of the last open, if configured to.
+      auto incremental = config_.get<bool>(
+          "sm.array_directory.incremental_reopen", Config::must_find);
+      auto relist_window_ms = config_.get<uint64_t>(
+          "sm.array_directory.incremental_reopen_window_ms",
+          Config::must_find);
       array_dir_ = ArrayDirectory(
           resources_,
           array_uri_,
           timestamp_start_,
           timestamp_end_opened_at_,
           query_type_ == QueryType::READ ? ArrayDirectoryMode::READ :
-                                           ArrayDirectoryMode::SCHEMA_ONLY);
+                                           ArrayDirectoryMode::SCHEMA_ONLY,
+          incremental ? array_dir_.listing() : nullptr,
+          relist_window_ms);
     }
   } catch (const std::logic_error& le) {
     return LOG_STATUS(Status_ArrayDirectoryError(le.what()));
@@ -40,11 +40,39 @@
 #include "tiledb/sm/storage_manager/context_resources.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
+#include <cctype>
+
 using namespace tiledb::common;
 
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/**
+ * Parses the start timestamp leading the name of a fragment, commit,
+ * metadata or schema URI, e.g. `__<t1>_<t2>_<uuid>`.
+ *
+ * @return The timestamp and its number of digits, zero if the name does not
+ *     start with one.
+ */
+std::pair<uint64_t, size_t> name_timestamp(const URI& uri) {
+  const auto name = uri.remove_trailing_slash().last_path_part();
+  if (name.size() < 3 || name[0] != '_' || name[1] != '_') {
+    return {0, 0};
+  }
+
+  uint64_t timestamp = 0;
+  size_t digits = 0;
+  for (auto c = name.begin() + 2; c != name.end() && std::isdigit(*c); ++c) {
+    timestamp = timestamp * 10 + (*c - '0');
+    ++digits;
+  }
+  return {timestamp, digits};
+}
+
+}  // namespace
+
 /* ********************************* */
 /*     CONSTRUCTORS & DESTRUCTORS    */
 /* ********************************* */
@@ -59,14 +87,18 @@ ArrayDirectory::ArrayDirectory(
     const URI& uri,
     uint64_t timestamp_start,
     uint64_t timestamp_end,
-    ArrayDirectoryMode mode)
+    ArrayDirectoryMode mode,
+    shared_ptr<const Listing> previous_listing,
+    uint64_t relist_window_ms)
     : resources_(resources)
     , uri_(uri.add_trailing_slash())
     , stats_(resources_.get().vfs().stats()->create_child("ArrayDirectory"))
     , timestamp_start_(timestamp_start)
     , timestamp_end_(timestamp_end)
     , mode_(mode)
-    , loaded_(false) {
+    , loaded_(false)
+    , previous_listing_(std::move(previous_listing))
+    , relist_window_ms_(relist_window_ms) {
   auto st = load();
   if (!st.ok()) {
     throw std::logic_error(st.message());
@@ -81,6 +113,11 @@ const URI& ArrayDirectory::uri() const {
   return uri_;
 }
 
+const shared_ptr<const ArrayDirectory::Listing>& ArrayDirectory::listing()
+    const {
+  return listing_;
+}
+
 const std::vector<URI>& ArrayDirectory::array_schema_uris() const {
   return array_schema_uris_;
 }
@@ -198,6 +235,8 @@ Status ArrayDirectory::load() {
   std::vector<URI> root_dir_uris;
   std::vector<URI> commits_dir_uris;
   std::vector<URI> fragment_meta_uris_v12_or_higher;
+  std::vector<URI> array_meta_dir_uris;
+  std::vector<URI> array_schema_dir_uris;
 
   // Lists all directories in parallel. Skipping for schema only.
   // Some processing is also done here for things that don't depend on others.
@@ -238,7 +277,7 @@ Status ArrayDirectory::load() {
 
       // Load (in parallel) the array metadata URIs
       tasks.emplace_back(resources_.get().compute_tp().execute(
-          [&]() { return load_array_meta_uris(); }));
+          [&]() { return load_array_meta_uris(&array_meta_dir_uris); }));
     }
   }
 
@@ -247,7 +286,7 @@ Status ArrayDirectory::load() {
   if (mode_ != ArrayDirectoryMode::COMMITS) {
     // Load (in parallel) the array schema URIs
     tasks.emplace_back(resources_.get().compute_tp().execute(
-        [&]() { return load_array_schema_uris(); }));
+        [&]() { return load_array_schema_uris(&array_schema_dir_uris); }));
   }
 
   // Wait for all tasks to complete
@@ -327,6 +366,17 @@ Status ArrayDirectory::load() {
     }
   }
 
+  // Keep the listings so that a later load can refresh them incrementally.
+  auto listing = make_shared<Listing>(HERE());
+  listing->root_dir_uris_ = std::move(root_dir_uris);
+  listing->commits_dir_uris_ = std::move(commits_dir_uris);
+  listing->fragment_meta_dir_uris_ =
+      std::move(fragment_meta_uris_v12_or_higher);
+  listing->array_meta_dir_uris_ = std::move(array_meta_dir_uris);
+  listing->array_schema_dir_uris_ = std::move(array_schema_dir_uris);
+  listing_ = std::move(listing);
+  previous_listing_ = nullptr;
+
   // The URI manager has been loaded successfully
   loaded_ = true;
 
@@ -475,7 +525,11 @@ tuple<Status, optional<std::vector<URI>>> ArrayDirectory::list_root_dir_uris() {
 
   std::vector<URI> array_dir_uris;
   RETURN_NOT_OK_TUPLE(
-      resources_.get().vfs().ls(uri_, &array_dir_uris), nullopt);
+      list_dir_uris(
+          uri_,
+          previous_listing_ ? &previous_listing_->root_dir_uris_ : nullptr,
+          &array_dir_uris),
+      nullopt);
 
   return {Status::Ok(), array_dir_uris};
 }
@@ -500,7 +554,11 @@ ArrayDirectory::list_commits_dir_uris() {
   auto commits_uri = uri_.join_path(constants::array_commits_dir_name);
   std::vector<URI> commits_dir_uris;
   RETURN_NOT_OK_TUPLE(
-      resources_.get().vfs().ls(commits_uri, &commits_dir_uris), nullopt);
+      list_dir_uris(
+          commits_uri,
+          previous_listing_ ? &previous_listing_->commits_dir_uris_ : nullptr,
+          &commits_dir_uris),
+      nullopt);
 
   return {Status::Ok(), commits_dir_uris};
 }
@@ -575,7 +633,12 @@ ArrayDirectory::list_fragment_metadata_dir_uris_v12_or_higher() {
 
   std::vector<URI> ret;
   RETURN_NOT_OK_TUPLE(
-      resources_.get().vfs().ls(fragment_metadata_uri, &ret), nullopt);
+      list_dir_uris(
+          fragment_metadata_uri,
+          previous_listing_ ? &previous_listing_->fragment_meta_dir_uris_ :
+                              nullptr,
+          &ret),
+      nullopt);
 
   return {Status::Ok(), ret};
 }
@@ -700,19 +763,21 @@ ArrayDirectory::load_consolidated_commit_uris(
   return {Status::Ok(), uris, uris_set};
 }
 
-Status ArrayDirectory::load_array_meta_uris() {
+Status ArrayDirectory::load_array_meta_uris(
+    std::vector<URI>* array_meta_dir_uris) {
   // Load the URIs in the array metadata directory
-  std::vector<URI> array_meta_dir_uris;
   auto array_meta_uri = uri_.join_path(constants::array_metadata_dir_name);
   {
     auto timer_se = stats_->start_timer("list_array_meta_uris");
-    RETURN_NOT_OK(
-        resources_.get().vfs().ls(array_meta_uri, &array_meta_dir_uris));
+    RETURN_NOT_OK(list_dir_uris(
+        array_meta_uri,
+        previous_listing_ ? &previous_listing_->array_meta_dir_uris_ : nullptr,
+        array_meta_dir_uris));
   }
 
   // Compute array metadata URIs and vacuum URIs to vacuum. */
   auto&& [st1, array_meta_uris_to_vacuum, array_meta_vac_uris_to_vacuum] =
-      compute_uris_to_vacuum(true, array_meta_dir_uris);
+      compute_uris_to_vacuum(true, *array_meta_dir_uris);
   RETURN_NOT_OK(st1);
   array_meta_uris_to_vacuum_ = std::move(array_meta_uris_to_vacuum.value());
   array_meta_vac_uris_to_vacuum_ =
@@ -720,31 +785,79 @@ Status ArrayDirectory::load_array_meta_uris() {
 
   // Compute filtered array metadata URIs
   auto&& [st2, array_meta_filtered_uris] = compute_filtered_uris(
-      true, array_meta_dir_uris, array_meta_uris_to_vacuum_);
+      true, *array_meta_dir_uris, array_meta_uris_to_vacuum_);
   RETURN_NOT_OK(st2);
   array_meta_uris_ = std::move(array_meta_filtered_uris.value());
-  array_meta_dir_uris.clear();
 
   return Status::Ok();
 }
 
-Status ArrayDirectory::load_array_schema_uris() {
+Status ArrayDirectory::load_array_schema_uris(
+    std::vector<URI>* array_schema_dir_uris) {
   // Load the URIs from the array schema directory
-  std::vector<URI> array_schema_dir_uris;
   auto schema_dir_uri = uri_.join_path(constants::array_schema_dir_name);
   {
     auto timer_se = stats_->start_timer("list_array_schema_uris");
 
-    RETURN_NOT_OK(
-        resources_.get().vfs().ls(schema_dir_uri, &array_schema_dir_uris));
+    RETURN_NOT_OK(list_dir_uris(
+        schema_dir_uri,
+        previous_listing_ ? &previous_listing_->array_schema_dir_uris_ :
+                            nullptr,
+        array_schema_dir_uris));
   }
 
   // Compute all the array schema URIs plus the latest array schema URI
-  RETURN_NOT_OK(compute_array_schema_uris(array_schema_dir_uris));
+  RETURN_NOT_OK(compute_array_schema_uris(*array_schema_dir_uris));
 
   return Status::Ok();
 }
 
+Status ArrayDirectory::list_dir_uris(
+    const URI& dir_uri,
+    const std::vector<URI>* previous,
+    std::vector<URI>* uris) const {
+  if (previous == nullptr || previous->empty()) {
+    return resources_.get().vfs().ls(dir_uri, uris);
+  }
+
+  // Fragment, commit, metadata and schema names start with their start
+  // timestamp, so listings sort by timestamp as long as all timestamps have
+  // as many digits. Entries can be committed out of timestamp order, so only
+  // keep the previous entries older than the relist window before the latest
+  // timestamp and list the rest again, which also drops the entries removed
+  // within the window.
+  uint64_t last = 0;
+  size_t digits = 0;
+  for (const auto& uri : *previous) {
+    auto [timestamp, n] = name_timestamp(uri);
+    if (n == 0) {
+      continue;
+    }
+    if (digits != 0 && n != digits) {
+      return resources_.get().vfs().ls(dir_uri, uris);
+    }
+    digits = n;
+    last = std::max(last, timestamp);
+  }
+
+  const auto from = std::to_string(
+      last > relist_window_ms_ ? last - relist_window_ms_ : 0);
+  if (digits == 0 || from.size() != digits) {
+    return resources_.get().vfs().ls(dir_uri, uris);
+  }
+
+  stats_->add_counter("incremental_list_num", 1);
+  const auto marker = dir_uri.join_path("__" + from);
+  uris->clear();
+  for (const auto& uri : *previous) {
+    if (uri.to_string() >= marker.to_string()) {
+      break;
+    }
+    uris->push_back(uri);
+  }
+  return resources_.get().vfs().ls_after(dir_uri, marker, uris);
+}
+
 void ArrayDirectory::load_commits_uris_to_consolidate(
     const std::vector<URI>& array_dir_uris,
     const std::vector<URI>& commits_dir_uris,
@@ -280,6 +280,28 @@ class ArrayDirectory {
     uint64_t timestamp_;
   };
 
+  /**
+   * The sorted listings of the array subdirectories an array directory was
+   * loaded from. A later load of the same array can refresh them
+   * incrementally instead of listing everything again.
+   */
+  struct Listing {
+    /** The URIs in the array directory. */
+    std::vector<URI> root_dir_uris_;
+
+    /** The URIs in the commits directory. */
+    std::vector<URI> commits_dir_uris_;
+
+    /** The URIs in the fragment metadata directory. */
+    std::vector<URI> fragment_meta_dir_uris_;
+
+    /** The URIs in the array metadata directory. */
+    std::vector<URI> array_meta_dir_uris_;
+
+    /** The URIs in the array schema directory. */
+    std::vector<URI> array_schema_dir_uris_;
+  };
+
   /* ********************************* */
   /*     CONSTRUCTORS & DESTRUCTORS    */
   /* ********************************* */
@@ -306,13 +328,23 @@ class ArrayDirectory {
    *    [`timestamp_start`, `timestamp_end`] will be considered when
    *     fetching URIs.
    * @param mode The mode to load the array directory in.
+   * @param previous_listing The listing of a previous load of the same
+   *     array, or `nullptr`. When set, the previous entries older than
+   *     `relist_window_ms` before the latest timestamp of each subdirectory
+   *     listing are kept and only the others are listed again. Entries
+   *     added or removed before the window since then, e.g. by consolidating
+   *     or vacuuming old fragments, are not observed.
+   * @param relist_window_ms The window relisted when `previous_listing` is
+   *     set, in milliseconds.
    */
   ArrayDirectory(
       ContextResources& resources,
       const URI& uri,
       uint64_t timestamp_start,
       uint64_t timestamp_end,
-      ArrayDirectoryMode mode = ArrayDirectoryMode::READ);
+      ArrayDirectoryMode mode = ArrayDirectoryMode::READ,
+      shared_ptr<const Listing> previous_listing = nullptr,
+      uint64_t relist_window_ms = 0);
 
   /** Destructor. */
   ~ArrayDirectory() = default;
@@ -324,6 +356,12 @@ class ArrayDirectory {
   /** Returns the array URI. */
   const URI& uri() const;
 
+  /**
+   * Returns the subdirectory listings this directory was loaded from, or
+   * `nullptr` if it was not loaded from storage.
+   */
+  const shared_ptr<const Listing>& listing() const;
+
   /** Returns the URIs of the array schema files. */
   const std::vector<URI>& array_schema_uris() const;
 
@@ -564,6 +602,15 @@ class ArrayDirectory {
   /** True if `load` has been run. */
   bool loaded_;
 
+  /** The subdirectory listings this directory was loaded from. */
+  shared_ptr<const Listing> listing_;
+
+  /** The listings of a previous load, refreshed incrementally by `load`. */
+  shared_ptr<const Listing> previous_listing_;
+
+  /** The window before the latest previous timestamp listed again. */
+  uint64_t relist_window_ms_;
+
   /* ********************************* */
   /*          PRIVATE METHODS          */
   /* ********************************* */
@@ -631,11 +678,38 @@ class ArrayDirectory {
       optional<std::unordered_set<std::string>>>
   load_consolidated_commit_uris(const std::vector<URI>& commits_dir_uris);
 
-  /** Loads the array metadata URIs. */
-  Status load_array_meta_uris();
+  /**
+   * Lists a subdirectory of the array. If a non-empty previous listing is
+   * given, its entries older than `relist_window_ms_` before its latest
+   * timestamp are kept and only the entries sorting after them are listed.
+   * The whole subdirectory is listed when the names do not sort by
+   * timestamp.
+   *
+   * @param dir_uri The subdirectory to list.
+   * @param previous The previous listing of the subdirectory, or `nullptr`.
+   * @param uris The sorted URIs in the subdirectory.
+   * @return Status
+   */
+  Status list_dir_uris(
+      const URI& dir_uri,
+      const std::vector<URI>* previous,
+      std::vector<URI>* uris) const;
+
+  /**
+   * Loads the array metadata URIs.
+   *
+   * @param array_meta_dir_uris Set to the listing of the array metadata
+   *     directory.
+   */
+  Status load_array_meta_uris(std::vector<URI>* array_meta_dir_uris);
 
-  /** Loads the array schema URIs. */
-  Status load_array_schema_uris();
+  /**
+   * Loads the array schema URIs.
+   *
+   * @param array_schema_dir_uris Set to the listing of the array schema
+   *     directory.
+   */
+  Status load_array_schema_uris(std::vector<URI>* array_schema_dir_uris);
 
   /**
    * Computes the fragment URIs from the input array directory URIs, for
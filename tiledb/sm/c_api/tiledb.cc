@@ -60,6 +60,7 @@
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/mime_type.h"
 #include "tiledb/sm/enums/object_type.h"
+#include "tiledb/sm/enums/query_aggregate_op.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
 #include "tiledb/sm/enums/serialization_type.h"
@@ -2248,6 +2249,57 @@ int32_t tiledb_query_add_update_value(
   return TILEDB_OK;
 }
 
+int32_t tiledb_query_add_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op) noexcept {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+
+  // Add aggregate.
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          query->query_->add_aggregate(
+              field_name, static_cast<tiledb::sm::QueryAggregateOp>(op)))) {
+    return TILEDB_ERR;
+  }
+
+  // Success
+  return TILEDB_OK;
+}
+
+int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op,
+    void* value,
+    uint8_t* validity) noexcept {
+  // Sanity check
+  if (sanity_check(ctx) == TILEDB_ERR ||
+      sanity_check(ctx, query) == TILEDB_ERR) {
+    return TILEDB_ERR;
+  }
+
+  // Get aggregate.
+  if (SAVE_ERROR_CATCH(
+          ctx,
+          query->query_->get_aggregate(
+              field_name,
+              static_cast<tiledb::sm::QueryAggregateOp>(op),
+              value,
+              validity))) {
+    return TILEDB_ERR;
+  }
+
+  // Success
+  return TILEDB_OK;
+}
+
 /* ****************************** */
 /*         SUBARRAY               */
 /* ****************************** */
@@ -2693,6 +2745,39 @@ int32_t tiledb_query_condition_negate(
       ctx, cond, nullptr, TILEDB_NOT, negated_cond);
 }
 
+int32_t tiledb_query_condition_alloc_set_membership(
+    tiledb_ctx_t* const ctx,
+    const char* const field_name,
+    const void* const data,
+    const uint64_t data_size,
+    const void* const offsets,
+    const uint64_t offsets_size,
+    const tiledb_query_condition_op_t op,
+    tiledb_query_condition_t** const cond) {
+  auto rc = api::tiledb_query_condition_alloc(ctx, cond);
+  if (rc != TILEDB_OK) {
+    return rc;
+  }
+
+  // Initialize the QueryCondition object
+  auto st = (*cond)->query_condition_->init(
+      std::string(field_name),
+      data,
+      data_size,
+      offsets,
+      offsets_size,
+      static_cast<tiledb::sm::QueryConditionOp>(op));
+  if (!st.ok()) {
+    LOG_STATUS_NO_RETURN_VALUE(st);
+    save_error(ctx, st);
+    api::tiledb_query_condition_free(cond);
+    return TILEDB_ERR;
+  }
+
+  // Success
+  return TILEDB_OK;
+}
+
 /* ****************************** */
 /*              ARRAY             */
 /* ****************************** */
@@ -6879,6 +6964,19 @@ int32_t tiledb_query_condition_negate(
       ctx, cond, negated_cond);
 }
 
+int32_t tiledb_query_condition_alloc_set_membership(
+    tiledb_ctx_t* const ctx,
+    const char* const field_name,
+    const void* const data,
+    const uint64_t data_size,
+    const void* const offsets,
+    const uint64_t offsets_size,
+    const tiledb_query_condition_op_t op,
+    tiledb_query_condition_t** const cond) noexcept {
+  return api_entry<tiledb::api::tiledb_query_condition_alloc_set_membership>(
+      ctx, field_name, data, data_size, offsets, offsets_size, op, cond);
+}
+
 /* ****************************** */
 /*         UPDATE CONDITION       */
 /* ****************************** */
@@ -6893,6 +6991,26 @@ int32_t tiledb_query_add_update_value(
       ctx, query, field_name, update_value, update_value_size);
 }
 
+int32_t tiledb_query_add_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op) noexcept {
+  return api_entry<tiledb::api::tiledb_query_add_aggregate>(
+      ctx, query, field_name, op);
+}
+
+int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op,
+    void* value,
+    uint8_t* validity) noexcept {
+  return api_entry<tiledb::api::tiledb_query_get_aggregate>(
+      ctx, query, field_name, op, value, validity);
+}
+
 /* ****************************** */
 /*              ARRAY             */
 /* ****************************** */
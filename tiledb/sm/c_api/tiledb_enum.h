@@ -93,6 +93,10 @@
     TILEDB_QUERY_CONDITION_OP_ENUM(EQ) = 4,
     /** Not-equal operator */
     TILEDB_QUERY_CONDITION_OP_ENUM(NE) = 5,
+    /** Set membership operator */
+    TILEDB_QUERY_CONDITION_OP_ENUM(IN) = 6,
+    /** Set non-membership operator */
+    TILEDB_QUERY_CONDITION_OP_ENUM(NOT_IN) = 7,
 #endif
 
 #ifdef TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM
@@ -104,6 +108,19 @@
     TILEDB_QUERY_CONDITION_COMBINATION_OP_ENUM(NOT) = 2,
 #endif
 
+#ifdef TILEDB_QUERY_AGGREGATE_OP_ENUM
+    /** Number of cells */
+    TILEDB_QUERY_AGGREGATE_OP_ENUM(AGGREGATE_COUNT) = 0,
+    /** Sum of the non-null values */
+    TILEDB_QUERY_AGGREGATE_OP_ENUM(AGGREGATE_SUM) = 1,
+    /** Minimum of the non-null values */
+    TILEDB_QUERY_AGGREGATE_OP_ENUM(AGGREGATE_MIN) = 2,
+    /** Maximum of the non-null values */
+    TILEDB_QUERY_AGGREGATE_OP_ENUM(AGGREGATE_MAX) = 3,
+    /** Number of null cells */
+    TILEDB_QUERY_AGGREGATE_OP_ENUM(AGGREGATE_NULL_COUNT) = 4,
+#endif
+
 #ifdef TILEDB_SERIALIZATION_TYPE_ENUM
     /** Serialize to json */
     TILEDB_SERIALIZATION_TYPE_ENUM(JSON),
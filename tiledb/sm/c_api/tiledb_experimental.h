@@ -297,6 +297,65 @@ TILEDB_EXPORT int32_t tiledb_query_add_update_value(
     const void* update_value,
     uint64_t update_value_size) TILEDB_NOEXCEPT;
 
+/** Query aggregate operator. */
+typedef enum {
+/** Helper macro for defining query aggregate operator enums. */
+#define TILEDB_QUERY_AGGREGATE_OP_ENUM(id) TILEDB_##id
+#include "tiledb_enum.h"
+#undef TILEDB_QUERY_AGGREGATE_OP_ENUM
+} tiledb_query_aggregate_op_t;
+
+/**
+ * Adds an aggregate to compute for a read query. Aggregate queries don't
+ * return cells, so no data buffers can be set on the query. Tiles fully
+ * covered by the subarray are aggregated from the fragment tile metadata when
+ * possible, the other tiles are aggregated without copying cells.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * tiledb_query_add_aggregate(ctx, query, "a", TILEDB_AGGREGATE_SUM);
+ * tiledb_query_submit(ctx, query);
+ * int64_t sum;
+ * uint8_t validity;
+ * tiledb_query_get_aggregate(
+ *   ctx, query, "a", TILEDB_AGGREGATE_SUM, &sum, &validity);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param field_name The name of the aggregated field.
+ * @param op The aggregate operator.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_add_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op) TILEDB_NOEXCEPT;
+
+/**
+ * Gets the result of an aggregate after the query completed. `COUNT` and
+ * `NULL_COUNT` return an `uint64_t`, `SUM` returns an `int64_t`, `uint64_t`
+ * or `double` depending on the field type, `MIN` and `MAX` return a value of
+ * the field type. Getting a `SUM` that overflowed its type is an error.
+ *
+ * @param ctx The TileDB context.
+ * @param query The TileDB query.
+ * @param field_name The name of the aggregated field.
+ * @param op The aggregate operator.
+ * @param value Where to write the result.
+ * @param validity Set to 0 if no non-null value was aggregated, can be null.
+ * @return `TILEDB_OK` for success and `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_get_aggregate(
+    tiledb_ctx_t* ctx,
+    tiledb_query_t* query,
+    const char* field_name,
+    tiledb_query_aggregate_op_t op,
+    void* value,
+    uint8_t* validity) TILEDB_NOEXCEPT;
+
 /**
  * Adds point ranges to the given dimension index of the subarray
  * Effectively `add_range(x_i, x_i)` for `count` points in the
@@ -357,6 +416,56 @@ TILEDB_EXPORT int32_t tiledb_query_get_relevant_fragment_num(
     const tiledb_query_t* query,
     uint64_t* relevant_fragment_num) TILEDB_NOEXCEPT;
 
+/* ********************************* */
+/*          QUERY CONDITION          */
+/* ********************************* */
+
+/**
+ * Allocates a TileDB query condition object testing whether the value of a
+ * field is (`TILEDB_IN`) or is not (`TILEDB_NOT_IN`) one of a set of values.
+ * The set members are passed concatenated in `data`, with `offsets` holding
+ * the starting byte offset of each member, as for var-sized query buffers.
+ * Null cells never satisfy the condition.
+ *
+ * **Example:**
+ *
+ * @code{.c}
+ * int32_t values[] = {1, 7, 42};
+ * uint64_t offsets[] = {0, 4, 8};
+ * tiledb_query_condition_t* query_condition;
+ * tiledb_query_condition_alloc_set_membership(
+ *   ctx,
+ *   "sensor_id",
+ *   values,
+ *   sizeof(values),
+ *   offsets,
+ *   sizeof(offsets),
+ *   TILEDB_IN,
+ *   &query_condition);
+ * tiledb_query_set_condition(ctx, query, query_condition);
+ * tiledb_query_condition_free(&query_condition);
+ * @endcode
+ *
+ * @param ctx The TileDB context.
+ * @param field_name The field name.
+ * @param data The concatenated set member values.
+ * @param data_size The byte size of `data`.
+ * @param offsets The starting byte offset of each member in `data`.
+ * @param offsets_size The byte size of `offsets`.
+ * @param op The set membership operator (`TILEDB_IN` or `TILEDB_NOT_IN`).
+ * @param cond The allocated query condition object.
+ * @return `TILEDB_OK` for success and `TILEDB_OOM` or `TILEDB_ERR` for error.
+ */
+TILEDB_EXPORT int32_t tiledb_query_condition_alloc_set_membership(
+    tiledb_ctx_t* ctx,
+    const char* field_name,
+    const void* data,
+    uint64_t data_size,
+    const void* offsets,
+    uint64_t offsets_size,
+    tiledb_query_condition_op_t op,
+    tiledb_query_condition_t** cond) TILEDB_NOEXCEPT;
+
 /* ********************************* */
 /*        QUERY STATUS DETAILS       */
 /* ********************************* */
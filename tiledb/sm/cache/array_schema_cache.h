@@ -0,0 +1,162 @@
+/**
+ * @file   array_schema_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class ArraySchemaCache.
+ */
+
+#ifndef TILEDB_ARRAY_SCHEMA_CACHE_H
+#define TILEDB_ARRAY_SCHEMA_CACHE_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+#include <mutex>
+#include <string>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * An LRU cache of deserialized array schemas keyed by schema URI, shared by
+ * all the arrays of a context. Schema files are never modified once written
+ * (schema evolution writes a new file), so a cached schema never needs to be
+ * invalidated.
+ *
+ * The cached schemas are immutable. Since callers set per-array state on the
+ * schemas they load, they get their own copy of a cached schema.
+ *
+ * This class is thread-safe.
+ */
+class ArraySchemaCache
+    : public LRUCache<std::string, shared_ptr<const ArraySchema>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size The maximum number of serialized schema bytes to keep in
+   *     the cache. A value of zero disables the cache.
+   */
+  explicit ArraySchemaCache(const uint64_t max_size)
+      : LRUCache(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /** Destructor. */
+  ~ArraySchemaCache() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(ArraySchemaCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(ArraySchemaCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache has a non-zero budget. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a schema in the cache. On a hit, the schema becomes the most
+   * recently used one.
+   *
+   * @param schema_uri The schema URI.
+   * @return A copy of the cached schema or `nullptr` on a miss.
+   */
+  shared_ptr<ArraySchema> read(const std::string& schema_uri) {
+    if (!enabled_) {
+      return nullptr;
+    }
+
+    shared_ptr<const ArraySchema> cached;
+    {
+      // Protect access to the derived LRUCache routines.
+      std::lock_guard<std::mutex> lg(lru_mtx_);
+      if (!has_item(schema_uri)) {
+        return nullptr;
+      }
+
+      touch_item(schema_uri);
+      cached = *get_item(schema_uri);
+    }
+
+    return make_shared<ArraySchema>(HERE(), *cached);
+  }
+
+  /**
+   * Inserts a copy of a schema in the cache, evicting the least recently
+   * used schemas until it fits. Schemas larger than the cache budget are not
+   * inserted.
+   *
+   * @param schema_uri The schema URI.
+   * @param array_schema The schema.
+   * @param size The size of the serialized schema.
+   */
+  void insert(
+      const std::string& schema_uri,
+      const ArraySchema& array_schema,
+      uint64_t size) {
+    if (!enabled_) {
+      return;
+    }
+
+    shared_ptr<const ArraySchema> cached =
+        make_shared<ArraySchema>(HERE(), array_schema);
+
+    // Protect access to the derived LRUCache routines.
+    std::lock_guard<std::mutex> lg(lru_mtx_);
+    throw_if_not_ok(
+        LRUCache<std::string, shared_ptr<const ArraySchema>>::insert(
+            schema_uri, std::move(cached), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache has a non-zero budget. */
+  const bool enabled_;
+
+  /** Protects LRUCache routines. */
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ARRAY_SCHEMA_CACHE_H
@@ -0,0 +1,232 @@
+/**
+ * @file   fragment_metadata_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FragmentMetadataCache.
+ */
+
+#ifndef TILEDB_FRAGMENT_METADATA_CACHE_H
+#define TILEDB_FRAGMENT_METADATA_CACHE_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Identifies a component of the fragment metadata file: the fragment it
+ * belongs to, the fragment format version and the offset of the generic tile
+ * holding the component in the fragment metadata file.
+ */
+struct FragmentMetadataCacheKey {
+  /** Offset used to identify the footer of the fragment metadata file. */
+  static constexpr uint64_t footer_offset =
+      std::numeric_limits<uint64_t>::max();
+
+  /** The fragment URI. */
+  std::string fragment_uri_;
+
+  /** The fragment format version. */
+  uint32_t format_version_;
+
+  /** The generic tile offset, or `footer_offset` for the footer. */
+  uint64_t offset_;
+
+  /** Equality operator. */
+  bool operator==(const FragmentMetadataCacheKey& other) const {
+    return offset_ == other.offset_ &&
+           format_version_ == other.format_version_ &&
+           fragment_uri_ == other.fragment_uri_;
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+namespace std {
+
+/** Hash function for `FragmentMetadataCacheKey`, required by the LRU map. */
+template <>
+struct hash<tiledb::sm::FragmentMetadataCacheKey> {
+  size_t operator()(const tiledb::sm::FragmentMetadataCacheKey& key) const {
+    size_t h = std::hash<std::string>()(key.fragment_uri_);
+    h ^= std::hash<uint32_t>()(key.format_version_) + 0x9e3779b9 + (h << 6) +
+         (h >> 2);
+    h ^= std::hash<uint64_t>()(key.offset_) + 0x9e3779b9 + (h << 6) +
+         (h >> 2);
+    return h;
+  }
+};
+
+}  // namespace std
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The unfiltered contents of a fragment metadata component. For the footer,
+ * the location of the footer and the size of the fragment metadata file are
+ * kept as well, so that a cached footer can be deserialized without any I/O.
+ */
+struct CachedFragmentMetadataComponent {
+  /** The unfiltered component bytes. */
+  std::vector<uint8_t> data_;
+
+  /** The offset of the footer in the fragment metadata file (footer only). */
+  uint64_t footer_offset_{0};
+
+  /** The size of the fragment metadata file (footer only). */
+  uint64_t file_size_{0};
+
+  /** Returns the number of bytes held by this component. */
+  uint64_t size() const {
+    return data_.size();
+  }
+};
+
+/**
+ * An LRU cache of loaded fragment metadata components (footers, R-trees, tile
+ * offsets, tile metadata...), shared by all the arrays of a context.
+ * Fragments are immutable so a cached component never needs to be
+ * invalidated; components of removed fragments simply age out of the cache.
+ * Reopening an array therefore only issues I/O for newly committed fragments.
+ *
+ * This class is thread-safe.
+ */
+class FragmentMetadataCache
+    : public LRUCache<
+          FragmentMetadataCacheKey,
+          shared_ptr<const CachedFragmentMetadataComponent>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size The maximum number of bytes to keep in the cache. A
+   *     value of zero disables the cache.
+   */
+  explicit FragmentMetadataCache(const uint64_t max_size)
+      : LRUCache(max_size)
+      , enabled_(max_size > 0) {
+  }
+
+  /** Destructor. */
+  ~FragmentMetadataCache() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FragmentMetadataCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FragmentMetadataCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache has a non-zero budget. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a component in the cache. On a hit, the component becomes the
+   * most recently used one. The returned component stays valid even if it
+   * gets evicted while the caller is using it.
+   *
+   * @param key The component key.
+   * @return The cached component or `nullptr` on a miss.
+   */
+  shared_ptr<const CachedFragmentMetadataComponent> read(
+      const FragmentMetadataCacheKey& key) {
+    if (!enabled_) {
+      return nullptr;
+    }
+
+    // Protect access to the derived LRUCache routines.
+    std::lock_guard<std::mutex> lg(lru_mtx_);
+    if (!has_item(key)) {
+      return nullptr;
+    }
+
+    touch_item(key);
+    return *get_item(key);
+  }
+
+  /**
+   * Inserts a component in the cache, evicting the least recently used
+   * components until it fits. Components larger than the cache budget are
+   * not inserted.
+   *
+   * @param key The component key.
+   * @param component The unfiltered component contents.
+   */
+  void insert(
+      const FragmentMetadataCacheKey& key,
+      CachedFragmentMetadataComponent&& component) {
+    if (!enabled_) {
+      return;
+    }
+
+    const uint64_t size = component.size();
+    auto cached = make_shared<CachedFragmentMetadataComponent>(
+        HERE(), std::move(component));
+
+    // Protect access to the derived LRUCache routines.
+    std::lock_guard<std::mutex> lg(lru_mtx_);
+    throw_if_not_ok(LRUCache<
+                    FragmentMetadataCacheKey,
+                    shared_ptr<const CachedFragmentMetadataComponent>>::
+                        insert(key, std::move(cached), size));
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache has a non-zero budget. */
+  const bool enabled_;
+
+  /** Protects LRUCache routines. */
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FRAGMENT_METADATA_CACHE_H
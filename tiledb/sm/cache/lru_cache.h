@@ -130,6 +130,11 @@ class LRUCache {
   /*        PROTECTED ROUTINES         */
   /* ********************************* */
 
+  /** Returns the current logical cache size. */
+  uint64_t cache_size() const {
+    return size_;
+  }
+
   /** Clears the cache, deleting all cached items. */
   void clear() {
     item_ll_.clear();
@@ -0,0 +1,256 @@
+/**
+ * @file   tile_cache.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TileCache.
+ */
+
+#ifndef TILEDB_TILE_CACHE_H
+#define TILEDB_TILE_CACHE_H
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/common/memory_tracker.h"
+#include "tiledb/sm/cache/lru_cache.h"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Identifies an unfiltered tile: the fragment it belongs to, the attribute or
+ * dimension name and the tile index within the fragment.
+ */
+struct TileCacheKey {
+  /** The fragment URI. */
+  std::string fragment_uri_;
+
+  /** The attribute/dimension name. */
+  std::string name_;
+
+  /** The tile index in the fragment. */
+  uint64_t tile_idx_;
+
+  /** Equality operator. */
+  bool operator==(const TileCacheKey& other) const {
+    return tile_idx_ == other.tile_idx_ && name_ == other.name_ &&
+           fragment_uri_ == other.fragment_uri_;
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+namespace std {
+
+/** Hash function for `TileCacheKey`, required by the LRU item map. */
+template <>
+struct hash<tiledb::sm::TileCacheKey> {
+  size_t operator()(const tiledb::sm::TileCacheKey& key) const {
+    size_t h = std::hash<std::string>()(key.fragment_uri_);
+    h ^= std::hash<std::string>()(key.name_) + 0x9e3779b9 + (h << 6) +
+         (h >> 2);
+    h ^= std::hash<uint64_t>()(key.tile_idx_) + 0x9e3779b9 + (h << 6) +
+         (h >> 2);
+    return h;
+  }
+};
+
+}  // namespace std
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The unfiltered contents of a result tile for a single attribute/dimension.
+ * The var and validity buffers are empty when the field is fixed-sized or
+ * not nullable.
+ */
+struct CachedTile {
+  /** The unfiltered fixed data (or offsets for var-sized fields). */
+  std::vector<char> fixed_;
+
+  /** The unfiltered var data. */
+  std::vector<char> var_;
+
+  /** The unfiltered validity data. */
+  std::vector<char> validity_;
+
+  /** Returns the total number of bytes held by this tile. */
+  uint64_t size() const {
+    return fixed_.size() + var_.size() + validity_.size();
+  }
+};
+
+/**
+ * An LRU cache of unfiltered tiles, shared by all the readers of a context.
+ * Fragments are immutable so a cached tile never needs to be invalidated;
+ * tiles of removed fragments simply age out of the cache.
+ *
+ * The cached bytes are charged to the given memory tracker as
+ * `MemoryType::TILE_CACHE`. A tile that does not fit in the tracker budget is
+ * not kept in the cache.
+ *
+ * This class is thread-safe.
+ */
+class TileCache : public LRUCache<TileCacheKey, shared_ptr<const CachedTile>> {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param max_size The maximum number of bytes to keep in the cache. A
+   *     value of zero disables the cache.
+   * @param memory_tracker The tracker the cached bytes are charged to, or
+   *     nullptr to leave them untracked. It must outlive the cache.
+   */
+  explicit TileCache(
+      const uint64_t max_size, MemoryTracker* memory_tracker = nullptr)
+      : LRUCache(max_size)
+      , enabled_(max_size > 0)
+      , memory_tracker_(memory_tracker) {
+  }
+
+  /** Destructor. Returns the cached bytes to the memory tracker. */
+  ~TileCache() {
+    if (memory_tracker_ != nullptr && cache_size() > 0) {
+      memory_tracker_->release_memory(
+          cache_size(), MemoryTracker::MemoryType::TILE_CACHE);
+    }
+  }
+
+  DISABLE_COPY_AND_COPY_ASSIGN(TileCache);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(TileCache);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns `true` if the cache has a non-zero budget. */
+  inline bool enabled() const {
+    return enabled_;
+  }
+
+  /**
+   * Looks up a tile in the cache. On a hit, the tile becomes the most
+   * recently used one. The returned tile stays valid even if it gets evicted
+   * while the caller is using it.
+   *
+   * @param key The tile key.
+   * @return The cached tile or `nullptr` on a miss.
+   */
+  shared_ptr<const CachedTile> read(const TileCacheKey& key) {
+    if (!enabled_) {
+      return nullptr;
+    }
+
+    // Protect access to the derived LRUCache routines.
+    std::lock_guard<std::mutex> lg(lru_mtx_);
+    if (!has_item(key)) {
+      return nullptr;
+    }
+
+    touch_item(key);
+    return *get_item(key);
+  }
+
+  /**
+   * Inserts a tile in the cache, evicting the least recently used tiles
+   * until it fits. Tiles larger than the cache budget are not inserted.
+   *
+   * @param key The tile key.
+   * @param tile The unfiltered tile contents.
+   */
+  void insert(const TileCacheKey& key, CachedTile&& tile) {
+    if (!enabled_) {
+      return;
+    }
+
+    const uint64_t size = tile.size();
+    auto cached = make_shared<CachedTile>(HERE(), std::move(tile));
+
+    // Protect access to the derived LRUCache routines.
+    std::lock_guard<std::mutex> lg(lru_mtx_);
+    const uint64_t size_before = cache_size();
+    throw_if_not_ok(
+        LRUCache<TileCacheKey, shared_ptr<const CachedTile>>::insert(
+            key, std::move(cached), size));
+    if (memory_tracker_ == nullptr) {
+      return;
+    }
+
+    // Charge the net change of the cache size, which accounts for the tiles
+    // evicted to make room for the new one.
+    const uint64_t size_after = cache_size();
+    if (size_after < size_before) {
+      memory_tracker_->release_memory(
+          size_before - size_after, MemoryTracker::MemoryType::TILE_CACHE);
+    } else if (
+        size_after > size_before &&
+        !memory_tracker_->take_memory(
+            size_after - size_before, MemoryTracker::MemoryType::TILE_CACHE)) {
+      // Over the tracker budget: drop the new tile rather than failing the
+      // read, and return the memory of the evicted tiles.
+      bool success;
+      throw_if_not_ok(invalidate(key, &success));
+      const uint64_t size_now = cache_size();
+      if (size_now < size_before) {
+        memory_tracker_->release_memory(
+            size_before - size_now, MemoryTracker::MemoryType::TILE_CACHE);
+      }
+    }
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the cache has a non-zero budget. */
+  const bool enabled_;
+
+  /** The tracker the cached bytes are charged to (may be nullptr). */
+  MemoryTracker* memory_tracker_;
+
+  /** Protects LRUCache routines. */
+  std::mutex lru_mtx_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TILE_CACHE_H
@@ -34,6 +34,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/buffer/buffer.h"
 #include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/filter/filter_kernels.h"
 
 /* ****************************** */
 /*             MACROS             */
@@ -46,6 +47,34 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+namespace {
+
+/** The unsigned integer type of `Size` bytes. */
+template <uint64_t Size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1> {
+  using type = uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2> {
+  using type = uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4> {
+  using type = uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8> {
+  using type = uint64_t;
+};
+
+}  // namespace
+
 const uint64_t DoubleDelta::OVERHEAD = 17;
 
 /* ****************************** */
@@ -322,14 +351,28 @@ Status DoubleDelta::decompress(
   RETURN_NOT_OK(input_buffer->read(&chunk, sizeof(uint64_t)));
   int bit_in_chunk = 63;  // Leftmost bit (MSB)
 
-  // Decompress rest of the values
+  // Decode the double deltas into the output, then recover the deltas and
+  // the values with two prefix sums. Wrapping unsigned arithmetic gives the
+  // same result as the 64-bit arithmetic truncated to T.
+  using U = typename UnsignedOfSize<sizeof(T)>::type;
+  const uint64_t num_dd = num - 2;
+  if (num_dd * value_size > output_buffer->free_space()) {
+    return LOG_STATUS(Status_CompressionError(
+        "Cannot decompress tile with DoubleDelta; Output buffer too small"));
+  }
+  auto dd_out = reinterpret_cast<U*>(output_buffer->cur_data());
   int64_t dd;
-  for (uint64_t i = 2; i < num; ++i) {
+  for (uint64_t i = 0; i < num_dd; ++i) {
     RETURN_NOT_OK(
         read_double_delta(input_buffer, &dd, bitsize, &chunk, &bit_in_chunk));
-    value = (T)(dd + 2 * (int64_t)out[i - 1] - (int64_t)out[i - 2]);
-    RETURN_NOT_OK(output_buffer->write(&value, value_size));
+    dd_out[i] = static_cast<U>(dd);
   }
+  const auto first = static_cast<U>(out[0]);
+  const auto second = static_cast<U>(out[1]);
+  filter_kernels::delta_decode<U>(
+      dd_out, dd_out, num_dd, static_cast<U>(second - first));
+  filter_kernels::delta_decode<U>(dd_out, dd_out, num_dd, second);
+  output_buffer->advance_offset(num_dd * value_size);
 
   return Status::Ok();
 }
@@ -119,5 +119,18 @@ std::vector<std::string> DictEncoding::deserialize_dictionary(
   }
 }
 
+std::vector<uint32_t> DictEncoding::decode_ids(
+    const span<const std::byte> input, const uint8_t word_id_size) {
+  if (word_id_size <= 1) {
+    return decode_ids<uint8_t>(input);
+  } else if (word_id_size <= 2) {
+    return decode_ids<uint16_t>(input);
+  } else if (word_id_size <= 4) {
+    return decode_ids<uint32_t>(input);
+  } else {
+    return decode_ids<uint64_t>(input);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
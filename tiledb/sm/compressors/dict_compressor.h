@@ -114,6 +114,17 @@ class DictEncoding {
   static std::vector<std::string> deserialize_dictionary(
       const span<std::byte> serialized_dict, size_t strlen_bytesize);
 
+  /**
+   * Read the word ids of strings encoded in dictionary format, without
+   * decoding the strings
+   *
+   * @param input Input dictionary-encoded format of ids
+   * @param word_id_size Bytesize used to store word ids
+   * @return The word id of each string
+   */
+  static std::vector<uint32_t> decode_ids(
+      const span<const std::byte> input, const uint8_t word_id_size);
+
   /**
    * Compress variable sized strings into dictionary encoded format
    *
@@ -253,6 +264,17 @@ class DictEncoding {
 
     return dict;
   }
+
+  template <class T>
+  static std::vector<uint32_t> decode_ids(const span<const std::byte> input) {
+    std::vector<uint32_t> ids(input.size() / sizeof(T));
+    for (size_t i = 0; i < ids.size(); i++) {
+      ids[i] = static_cast<uint32_t>(
+          utils::endianness::decode_be<T>(&input[i * sizeof(T)]));
+    }
+
+    return ids;
+  }
 };
 }  // namespace sm
 }  // namespace tiledb
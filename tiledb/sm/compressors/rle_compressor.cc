@@ -311,5 +311,35 @@ Status RLE::decompress(
   return Status::Ok();
 }
 
+/** Reads the runs of RLE-encoded strings with a run length type `T`. */
+template <class T>
+static tuple<std::vector<std::string_view>, std::vector<uint64_t>>
+string_runs(const span<const std::byte> input, const uint8_t string_len_size) {
+  if (string_len_size <= 1) {
+    return RLE::runs<T, uint8_t>(input);
+  } else if (string_len_size <= 2) {
+    return RLE::runs<T, uint16_t>(input);
+  } else if (string_len_size <= 4) {
+    return RLE::runs<T, uint32_t>(input);
+  } else {
+    return RLE::runs<T, uint64_t>(input);
+  }
+}
+
+tuple<std::vector<std::string_view>, std::vector<uint64_t>> RLE::runs(
+    const span<const std::byte> input,
+    const uint8_t rle_len_size,
+    const uint8_t string_len_size) {
+  if (rle_len_size <= 1) {
+    return string_runs<uint8_t>(input, string_len_size);
+  } else if (rle_len_size <= 2) {
+    return string_runs<uint16_t>(input, string_len_size);
+  } else if (rle_len_size <= 4) {
+    return string_runs<uint32_t>(input, string_len_size);
+  } else {
+    return string_runs<uint64_t>(input, string_len_size);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
@@ -176,6 +176,38 @@ class RLE {
     }
   }
 
+  /**
+   * Read the runs of strings encoded in RLE format, without decoding them
+   *
+   * @tparam T Type of integer to store run legths, must be the same used for
+   * encoding
+   * @tparam P Type of integer to store string sizes, must be the same used for
+   * encoding
+   * @param input Input in [run length|string_size|string] RLE format
+   * @return {run strings, run ends}: the string of each run, pointing into
+   * input, and the number of strings up to and including each run
+   */
+  template <class T, class P>
+  static tuple<std::vector<std::string_view>, std::vector<uint64_t>> runs(
+      const span<const std::byte> input) {
+    std::vector<std::string_view> run_strings;
+    std::vector<uint64_t> run_ends;
+    uint64_t num_strings = 0;
+    uint64_t in_index = 0;
+    while (in_index + sizeof(T) + sizeof(P) <= input.size()) {
+      num_strings += utils::endianness::decode_be<T>(&input[in_index]);
+      in_index += sizeof(T);
+      P string_length = utils::endianness::decode_be<P>(&input[in_index]);
+      in_index += sizeof(P);
+      run_strings.emplace_back(
+          reinterpret_cast<const char*>(&input[in_index]), string_length);
+      run_ends.emplace_back(num_strings);
+      in_index += string_length;
+    }
+
+    return {std::move(run_strings), std::move(run_ends)};
+  }
+
   /**
    * Return the number of bytes required to store an integer
    *
@@ -227,6 +259,20 @@ class RLE {
       span<std::byte> output,
       span<uint64_t> output_offsets);
 
+  /**
+   * Read the runs of strings encoded in RLE format, without decoding them
+   *
+   * @param input Input in [run length|string_size|string] RLE format
+   * @param rle_len_size Bytesize used to store run legths
+   * @param string_len_size Bytesize used to store string sizes
+   * @return {run strings, run ends}: the string of each run, pointing into
+   * input, and the number of strings up to and including each run
+   */
+  static tuple<std::vector<std::string_view>, std::vector<uint64_t>> runs(
+      const span<const std::byte> input,
+      const uint8_t rle_len_size,
+      const uint8_t string_len_size);
+
   /**
    * Compress numbers in contiguous memory to RLE format
    *
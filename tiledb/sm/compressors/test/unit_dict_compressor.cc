@@ -113,6 +113,23 @@ TEST_CASE(
   }
 }
 
+TEST_CASE(
+    "Compression-Dictionary: Test reading word ids without decompressing",
+    "[compression][dict]") {
+  std::string str1 = "HG543232";
+  std::string str2 = "HG54";
+  std::string str3 = "A";
+  std::string_view uncompressed[] = {
+      str1, str1, str1, str2, str2, str3, str1, str2};
+
+  std::vector<std::byte> compressed(8 * sizeof(uint16_t));
+  tiledb::sm::DictEncoding::compress<uint16_t>(uncompressed, compressed);
+
+  CHECK(
+      tiledb::sm::DictEncoding::decode_ids(compressed, sizeof(uint16_t)) ==
+      std::vector<uint32_t>{0, 0, 0, 1, 1, 2, 0, 1});
+}
+
 typedef tuple<uint16_t, uint32_t, uint64_t> FixedTypesUnderTest;
 TEMPLATE_LIST_TEST_CASE(
     "Compression-Dictionary: Test compression of single string repeated many "
@@ -99,6 +99,7 @@ const std::string Config::SM_ALLOW_UPDATES_EXPERIMENTAL = "false";
 const std::string Config::SM_ENCRYPTION_KEY = "";
 const std::string Config::SM_ENCRYPTION_TYPE = "NO_ENCRYPTION";
 const std::string Config::SM_DEDUP_COORDS = "false";
+const std::string Config::SM_SINGLE_CHUNK_UNFILTERED_TILES = "false";
 const std::string Config::SM_CHECK_COORD_DUPS = "true";
 const std::string Config::SM_CHECK_COORD_OOB = "true";
 const std::string Config::SM_READ_RANGE_OOB = "warn";
@@ -112,9 +113,18 @@ const std::string Config::SM_QUERY_DENSE_READER = "refactored";
 const std::string Config::SM_QUERY_SPARSE_GLOBAL_ORDER_READER = "refactored";
 const std::string Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER =
     "refactored";
+const std::string Config::SM_QUERY_SPARSE_UNORDERED_WRITER = "batch";
+const std::string Config::SM_QUERY_SPARSE_UNORDERED_MERGE_RUNS = "false";
 const std::string Config::SM_MEM_MALLOC_TRIM = "true";
 const std::string Config::SM_UPPER_MEMORY_LIMIT = "2147483648";  // 2GB
 const std::string Config::SM_MEM_TOTAL_BUDGET = "10737418240";   // 10GB
+const std::string Config::SM_MEM_CONTEXT_BUDGET = "0";
+const std::string Config::SM_TILE_CACHE_SIZE = "0";
+const std::string Config::SM_FRAGMENT_METADATA_CACHE_SIZE = "0";
+const std::string Config::SM_ARRAY_SCHEMA_CACHE_SIZE = "0";
+const std::string Config::SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN = "false";
+const std::string Config::SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN_WINDOW_MS =
+    "600000";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS = "0.5";
 const std::string Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_QUERY_CONDITION =
     "0.25";
@@ -134,11 +144,14 @@ const std::string Config::SM_COMPUTE_CONCURRENCY_LEVEL =
 const std::string Config::SM_IO_CONCURRENCY_LEVEL =
     utils::parse::to_str(std::thread::hardware_concurrency());
 const std::string Config::SM_SKIP_CHECKSUM_VALIDATION = "false";
+const std::string Config::SM_FILTER_FUSED_REVERSE_KERNELS = "true";
 const std::string Config::SM_CONSOLIDATION_AMPLIFICATION = "1.0";
 const std::string Config::SM_CONSOLIDATION_BUFFER_SIZE = "50000000";
 const std::string Config::SM_CONSOLIDATION_MAX_FRAGMENT_SIZE =
     std::to_string(UINT64_MAX);
 const std::string Config::SM_CONSOLIDATION_PURGE_DELETED_CELLS = "false";
+const std::string Config::SM_CONSOLIDATION_PARTITION_NUM = "1";
+const std::string Config::SM_CONSOLIDATION_PARTITION_COMMIT_TOGETHER = "true";
 const std::string Config::SM_CONSOLIDATION_STEPS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MIN_FRAGS = "4294967295";
 const std::string Config::SM_CONSOLIDATION_STEP_MAX_FRAGS = "4294967295";
@@ -165,6 +178,8 @@ const std::string Config::VFS_MIN_BATCH_SIZE = "20971520";
 const std::string Config::VFS_FILE_POSIX_FILE_PERMISSIONS = "644";
 const std::string Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS = "755";
 const std::string Config::VFS_FILE_MAX_PARALLEL_OPS = "1";
+const std::string Config::VFS_FILE_USE_IO_URING = "false";
+const std::string Config::VFS_FILE_USE_MMAP = "false";
 const std::string Config::VFS_READ_AHEAD_SIZE = "102400";          // 100KiB
 const std::string Config::VFS_READ_AHEAD_CACHE_SIZE = "10485760";  // 10MiB;
 const std::string Config::VFS_AZURE_STORAGE_ACCOUNT_NAME = "";
@@ -260,6 +275,9 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("sm.encryption_key", Config::SM_ENCRYPTION_KEY),
     std::make_pair("sm.encryption_type", Config::SM_ENCRYPTION_TYPE),
     std::make_pair("sm.dedup_coords", Config::SM_DEDUP_COORDS),
+    std::make_pair(
+        "sm.single_chunk_unfiltered_tiles",
+        Config::SM_SINGLE_CHUNK_UNFILTERED_TILES),
     std::make_pair("sm.check_coord_dups", Config::SM_CHECK_COORD_DUPS),
     std::make_pair("sm.check_coord_oob", Config::SM_CHECK_COORD_OOB),
     std::make_pair("sm.read_range_oob", Config::SM_READ_RANGE_OOB),
@@ -280,10 +298,29 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.query.sparse_unordered_with_dups.reader",
         Config::SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER),
+    std::make_pair(
+        "sm.query.sparse_unordered.writer",
+        Config::SM_QUERY_SPARSE_UNORDERED_WRITER),
+    std::make_pair(
+        "sm.query.sparse_unordered.merge_runs",
+        Config::SM_QUERY_SPARSE_UNORDERED_MERGE_RUNS),
     std::make_pair("sm.mem.malloc_trim", Config::SM_MEM_MALLOC_TRIM),
     std::make_pair(
         "sm.mem.tile_upper_memory_limit", Config::SM_UPPER_MEMORY_LIMIT),
     std::make_pair("sm.mem.total_budget", Config::SM_MEM_TOTAL_BUDGET),
+    std::make_pair("sm.mem.context_budget", Config::SM_MEM_CONTEXT_BUDGET),
+    std::make_pair("sm.tile_cache_size", Config::SM_TILE_CACHE_SIZE),
+    std::make_pair(
+        "sm.fragment_metadata_cache_size",
+        Config::SM_FRAGMENT_METADATA_CACHE_SIZE),
+    std::make_pair(
+        "sm.array_schema_cache_size", Config::SM_ARRAY_SCHEMA_CACHE_SIZE),
+    std::make_pair(
+        "sm.array_directory.incremental_reopen",
+        Config::SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN),
+    std::make_pair(
+        "sm.array_directory.incremental_reopen_window_ms",
+        Config::SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN_WINDOW_MS),
     std::make_pair(
         "sm.mem.reader.sparse_global_order.ratio_coords",
         Config::SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS),
@@ -315,6 +352,9 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair("sm.io_concurrency_level", Config::SM_IO_CONCURRENCY_LEVEL),
     std::make_pair(
         "sm.skip_checksum_validation", Config::SM_SKIP_CHECKSUM_VALIDATION),
+    std::make_pair(
+        "sm.filter.fused_reverse_kernels",
+        Config::SM_FILTER_FUSED_REVERSE_KERNELS),
     std::make_pair(
         "sm.consolidation.amplification",
         Config::SM_CONSOLIDATION_AMPLIFICATION),
@@ -326,6 +366,12 @@ const std::map<std::string, std::string> default_config_values = {
     std::make_pair(
         "sm.consolidation.purge_deleted_cells",
         Config::SM_CONSOLIDATION_PURGE_DELETED_CELLS),
+    std::make_pair(
+        "sm.consolidation.partition_num",
+        Config::SM_CONSOLIDATION_PARTITION_NUM),
+    std::make_pair(
+        "sm.consolidation.partition_commit_together",
+        Config::SM_CONSOLIDATION_PARTITION_COMMIT_TOGETHER),
     std::make_pair(
         "sm.consolidation.step_min_frags",
         Config::SM_CONSOLIDATION_STEP_MIN_FRAGS),
@@ -373,6 +419,8 @@ const std::map<std::string, std::string> default_config_values = {
         Config::VFS_FILE_POSIX_DIRECTORY_PERMISSIONS),
     std::make_pair(
         "vfs.file.max_parallel_ops", Config::VFS_FILE_MAX_PARALLEL_OPS),
+    std::make_pair("vfs.file.use_io_uring", Config::VFS_FILE_USE_IO_URING),
+    std::make_pair("vfs.file.use_mmap", Config::VFS_FILE_USE_MMAP),
     std::make_pair(
         "vfs.azure.storage_account_name",
         Config::VFS_AZURE_STORAGE_ACCOUNT_NAME),
@@ -690,16 +738,36 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.dedup_coords") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.single_chunk_unfiltered_tiles") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.check_coord_dups") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.check_coord_oob") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.check_global_order") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.query.sparse_unordered.writer") {
+    if (value != "batch" && value != "streaming")
+      return LOG_STATUS(Status_ConfigError(
+          "Invalid sparse unordered writer parameter value"));
+  } else if (param == "sm.query.sparse_unordered.merge_runs") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.memory_budget") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.memory_budget_var") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.tile_cache_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.fragment_metadata_cache_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.array_schema_cache_size") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.array_directory.incremental_reopen") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.array_directory.incremental_reopen_window_ms") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "sm.mem.context_budget") {
+    RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.enable_signal_handlers") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.compute_concurrency_level") {
@@ -714,6 +782,10 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
   } else if (param == "sm.consolidation.purge_deleted_cells") {
     RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "sm.consolidation.partition_num") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v32));
+  } else if (param == "sm.consolidation.partition_commit_together") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "sm.consolidation.steps") {
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "sm.consolidation.step_min_frags") {
@@ -750,6 +822,10 @@ Status Config::sanity_check(
     RETURN_NOT_OK(utils::parse::convert(value, &v32));
   } else if (param == "vfs.file.max_parallel_ops") {
     RETURN_NOT_OK(utils::parse::convert(value, &vuint64));
+  } else if (param == "vfs.file.use_io_uring") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
+  } else if (param == "vfs.file.use_mmap") {
+    RETURN_NOT_OK(utils::parse::convert(value, &v));
   } else if (param == "vfs.s3.scheme") {
     if (value != "http" && value != "https")
       return LOG_STATUS(
@@ -143,6 +143,12 @@ class Config {
   /** If `true`, this will deduplicate coordinates upon sparse writes. */
   static const std::string SM_DEDUP_COORDS;
 
+  /**
+   * If `true`, fixed-size tiles without filters are written as a single
+   * chunk, so that they can be used in place by readers mapping the files.
+   */
+  static const std::string SM_SINGLE_CHUNK_UNFILTERED_TILES;
+
   /**
    * If `true`, this will check for coordinate duplicates upon sparse
    * writes.
@@ -198,6 +204,12 @@ class Config {
   /** Which reader to use for sparse unordered with dups queries. */
   static const std::string SM_QUERY_SPARSE_UNORDERED_WITH_DUPS_READER;
 
+  /** Which writer to use for sparse unordered writes. */
+  static const std::string SM_QUERY_SPARSE_UNORDERED_WRITER;
+
+  /** Whether the streaming writer merges its runs on finalize. */
+  static const std::string SM_QUERY_SPARSE_UNORDERED_MERGE_RUNS;
+
   /** Should malloc_trim be called on query/ctx destructors. */
   static const std::string SM_MEM_MALLOC_TRIM;
 
@@ -207,6 +219,27 @@ class Config {
   /** Maximum memory budget for readers and writers. */
   static const std::string SM_MEM_TOTAL_BUDGET;
 
+  /**
+   * Budget of the memory tracked across a context, e.g. array metadata loaded
+   * by all the arrays opened with it. Zero means unlimited.
+   */
+  static const std::string SM_MEM_CONTEXT_BUDGET;
+
+  /** Byte budget of the context-wide cache of unfiltered tiles. */
+  static const std::string SM_TILE_CACHE_SIZE;
+
+  /** Byte budget of the context-wide cache of fragment metadata. */
+  static const std::string SM_FRAGMENT_METADATA_CACHE_SIZE;
+
+  /** Byte budget of the context-wide cache of array schemas. */
+  static const std::string SM_ARRAY_SCHEMA_CACHE_SIZE;
+
+  /** If `true`, reopening an array only lists new directory entries. */
+  static const std::string SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN;
+
+  /** Milliseconds before the last timestamp relisted by incremental reopens. */
+  static const std::string SM_ARRAY_DIRECTORY_INCREMENTAL_REOPEN_WINDOW_MS;
+
   /** Ratio of the sparse global order reader budget used for coords. */
   static const std::string SM_MEM_SPARSE_GLOBAL_ORDER_RATIO_COORDS;
 
@@ -255,6 +288,9 @@ class Config {
   /** If `true`, checksum validation will be skipped on reads. */
   static const std::string SM_SKIP_CHECKSUM_VALIDATION;
 
+  /** If `true`, adjacent filters are reversed by fused kernels on reads. */
+  static const std::string SM_FILTER_FUSED_REVERSE_KERNELS;
+
   /**
    * The factor by which the size of the dense fragment resulting
    * from consolidating a set of fragments (containing at least one
@@ -275,6 +311,12 @@ class Config {
   /** Purge deleted cells or not. */
   static const std::string SM_CONSOLIDATION_PURGE_DELETED_CELLS;
 
+  /** The number of partitions consolidated concurrently in each step. */
+  static const std::string SM_CONSOLIDATION_PARTITION_NUM;
+
+  /** Whether the fragments of the partitions are committed together. */
+  static const std::string SM_CONSOLIDATION_PARTITION_COMMIT_TOGETHER;
+
   /** Number of steps in the consolidation algorithm. */
   static const std::string SM_CONSOLIDATION_STEPS;
 
@@ -397,6 +439,18 @@ class Config {
   /** The default maximum number of parallel file:/// operations. */
   static const std::string VFS_FILE_MAX_PARALLEL_OPS;
 
+  /**
+   * If `true`, batched file:/// reads are submitted through io_uring. Requires
+   * TileDB to be built with `TILEDB_IO_URING`.
+   */
+  static const std::string VFS_FILE_USE_IO_URING;
+
+  /**
+   * If `true`, tile data of file:/// arrays is read by memory-mapping the
+   * fragment files.
+   */
+  static const std::string VFS_FILE_USE_MMAP;
+
   /** The maximum size (in bytes) to read-ahead in the VFS. */
   static const std::string VFS_READ_AHEAD_SIZE;
 
@@ -32,17 +32,26 @@
 
 #include "tiledb/sm/consolidator/fragment_consolidator.h"
 #include "tiledb/common/logger.h"
+#include "tiledb/common/scoped_executor.h"
 #include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/query_status.h"
 #include "tiledb/sm/enums/query_type.h"
+#include "tiledb/sm/filter/filter_pipeline.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/misc/tdb_time.h"
 #include "tiledb/sm/query/query.h"
+#include "tiledb/sm/tile/tile.h"
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <sstream>
 
@@ -147,23 +156,23 @@ Status FragmentConsolidator::consolidate(
     }
 
     // Consolidate the selected fragments
-    URI new_fragment_uri;
+    std::vector<URI> new_fragment_uris;
     st = consolidate_internal(
         array_for_reads,
         array_for_writes,
         to_consolidate,
         union_non_empty_domains,
-        &new_fragment_uri);
+        &new_fragment_uris);
     if (!st.ok()) {
       throw_if_not_ok(array_for_reads->close());
       throw_if_not_ok(array_for_writes->close());
       return st;
     }
 
-    // Load info of the consolidated fragment and add it
-    // to the fragment info, replacing the fragments that it
+    // Load info of the consolidated fragments and add them
+    // to the fragment info, replacing the fragments that they
     // consolidated.
-    st = fragment_info.load_and_replace(new_fragment_uri, to_consolidate);
+    st = fragment_info.load_and_replace(new_fragment_uris, to_consolidate);
     if (!st.ok()) {
       throw_if_not_ok(array_for_reads->close());
       throw_if_not_ok(array_for_writes->close());
@@ -260,23 +269,23 @@ Status FragmentConsolidator::consolidate_fragments(
   }
 
   // Consolidate the selected fragments
-  URI new_fragment_uri;
+  std::vector<URI> new_fragment_uris;
   st = consolidate_internal(
       array_for_reads,
       array_for_writes,
       to_consolidate,
       union_non_empty_domains,
-      &new_fragment_uri);
+      &new_fragment_uris);
   if (!st.ok()) {
     throw_if_not_ok(array_for_reads->close());
     throw_if_not_ok(array_for_writes->close());
     return st;
   }
 
-  // Load info of the consolidated fragment and add it
-  // to the fragment info, replacing the fragments that it
+  // Load info of the consolidated fragments and add them
+  // to the fragment info, replacing the fragments that they
   // consolidated.
-  st = fragment_info.load_and_replace(new_fragment_uri, to_consolidate);
+  st = fragment_info.load_and_replace(new_fragment_uris, to_consolidate);
   if (!st.ok()) {
     throw_if_not_ok(array_for_reads->close());
     throw_if_not_ok(array_for_writes->close());
@@ -368,7 +377,7 @@ Status FragmentConsolidator::consolidate_internal(
     shared_ptr<Array> array_for_writes,
     const std::vector<TimestampedURI>& to_consolidate,
     const NDRange& union_non_empty_domains,
-    URI* new_fragment_uri) {
+    std::vector<URI>* new_fragment_uris) {
   auto timer_se = stats_->start_timer("consolidate_internal");
 
   RETURN_NOT_OK(array_for_reads->load_fragments(to_consolidate));
@@ -409,6 +418,43 @@ Status FragmentConsolidator::consolidate_internal(
     }
   }
 
+  // Runs of fragments that follow each other in the global order are merged
+  // by copying their filtered tiles, skipping the read and rewrite of the
+  // cells. Only the other runs have their cells merged.
+  auto runs = compute_fragment_runs(*array_for_reads);
+  if (!runs.empty()) {
+    return consolidate_runs(
+        array_for_reads, array_for_writes, runs, new_fragment_uris);
+  }
+
+  return merge_fragments(
+      array_for_reads,
+      array_for_writes,
+      to_consolidate,
+      union_non_empty_domains,
+      new_fragment_uris);
+}
+
+Status FragmentConsolidator::merge_fragments(
+    shared_ptr<Array> array_for_reads,
+    shared_ptr<Array> array_for_writes,
+    const std::vector<TimestampedURI>& to_consolidate,
+    const NDRange& union_non_empty_domains,
+    std::vector<URI>* new_fragment_uris) {
+  // Get schema
+  const auto& array_schema = array_for_reads->array_schema_latest();
+
+  // Split the step into partitions consolidated concurrently, if configured.
+  auto partitions = compute_partitions(array_schema, union_non_empty_domains);
+  if (partitions.size() > 1) {
+    return consolidate_partitions(
+        array_for_reads,
+        array_for_writes,
+        to_consolidate,
+        partitions,
+        new_fragment_uris);
+  }
+
   // Prepare buffers
   auto average_var_cell_sizes = array_for_reads->get_average_var_cell_sizes();
   auto&& [buffers, buffer_sizes] =
@@ -417,13 +463,14 @@ Status FragmentConsolidator::consolidate_internal(
   // Create queries
   auto query_r = (Query*)nullptr;
   auto query_w = (Query*)nullptr;
+  URI new_fragment_uri;
   auto st = create_queries(
       array_for_reads,
       array_for_writes,
       union_non_empty_domains,
       &query_r,
       &query_w,
-      new_fragment_uri);
+      &new_fragment_uri);
   if (!st.ok()) {
     tdb_delete(query_r);
     tdb_delete(query_w);
@@ -434,16 +481,16 @@ Status FragmentConsolidator::consolidate_internal(
   URI vac_uri;
   try {
     vac_uri =
-        array_for_reads->array_directory().get_vacuum_uri(*new_fragment_uri);
+        array_for_reads->array_directory().get_vacuum_uri(new_fragment_uri);
   } catch (std::exception& e) {
     tdb_delete(query_r);
     tdb_delete(query_w);
     std::throw_with_nested(
-        std::logic_error("[FragmentConsolidator::consolidate_internal] "));
+        std::logic_error("[FragmentConsolidator::merge_fragments] "));
   }
 
   // Read from one array and write to the other
-  st = copy_array(query_r, query_w, &buffers, &buffer_sizes);
+  st = copy_array(query_r, query_w, &buffers, &buffer_sizes, stats_);
   if (!st.ok()) {
     tdb_delete(query_r);
     tdb_delete(query_w);
@@ -456,10 +503,10 @@ Status FragmentConsolidator::consolidate_internal(
     tdb_delete(query_r);
     tdb_delete(query_w);
     bool is_dir = false;
-    auto st2 = storage_manager_->vfs()->is_dir(*new_fragment_uri, &is_dir);
+    auto st2 = storage_manager_->vfs()->is_dir(new_fragment_uri, &is_dir);
     (void)st2;  // Perhaps report this once we support an error stack
     if (is_dir)
-      throw_if_not_ok(storage_manager_->vfs()->remove_dir(*new_fragment_uri));
+      throw_if_not_ok(storage_manager_->vfs()->remove_dir(new_fragment_uri));
     return st;
   }
 
@@ -470,12 +517,17 @@ Status FragmentConsolidator::consolidate_internal(
     tdb_delete(query_w);
     bool is_dir = false;
     throw_if_not_ok(
-        storage_manager_->vfs()->is_dir(*new_fragment_uri, &is_dir));
+        storage_manager_->vfs()->is_dir(new_fragment_uri, &is_dir));
     if (is_dir)
-      throw_if_not_ok(storage_manager_->vfs()->remove_dir(*new_fragment_uri));
+      throw_if_not_ok(storage_manager_->vfs()->remove_dir(new_fragment_uri));
     return st;
   }
 
+  // The write may have been split in several fragments.
+  for (auto& info : query_w->get_written_fragment_info()) {
+    new_fragment_uris->emplace_back(info.uri_);
+  }
+
   // Clean up
   tdb_delete(query_r);
   tdb_delete(query_w);
@@ -483,12 +535,219 @@ Status FragmentConsolidator::consolidate_internal(
   return st;
 }
 
+Status FragmentConsolidator::consolidate_partitions(
+    shared_ptr<Array> array_for_reads,
+    shared_ptr<Array> array_for_writes,
+    const std::vector<TimestampedURI>& to_consolidate,
+    const std::vector<NDRange>& partitions,
+    std::vector<URI>* new_fragment_uris) {
+  auto timer_se = stats_->start_timer("consolidate_partitions");
+  stats_->add_counter("consolidate_partitions_num", partitions.size());
+
+  // For easy reference
+  auto vfs = storage_manager_->vfs();
+  const auto& array_schema = array_for_reads->array_schema_latest();
+  const auto& array_dir = array_for_reads->array_directory();
+  const auto average_var_cell_sizes =
+      array_for_reads->get_average_var_cell_sizes();
+  const auto commit_together = commit_partitions_together(array_schema);
+
+  // The partitions share the buffer budget of a single step.
+  auto partition_config = config_;
+  partition_config.buffer_size_ =
+      std::max<uint64_t>(config_.buffer_size_ / partitions.size(), 1);
+
+  // Each partition reports its progress in its own stats.
+  std::vector<stats::Stats*> partition_stats(partitions.size());
+  for (size_t p = 0; p < partitions.size(); ++p) {
+    partition_stats[p] = stats_->create_child("Partition" + std::to_string(p));
+  }
+
+  // Consolidate the partitions concurrently, each with its own buffers and
+  // queries. The fragments created by each writer are collected whether it
+  // succeeds or not, including the ones split off on the maximum fragment
+  // size, so that a failed step can remove them.
+  std::vector<std::vector<URI>> created_uris(partitions.size());
+  std::vector<std::vector<URI>> written_uris(partitions.size());
+  std::vector<uint8_t> failed(partitions.size(), 1);
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, partitions.size(), [&](uint64_t p) {
+        auto stats = partition_stats[p];
+        auto timer_partition = stats->start_timer("consolidate_partition");
+        auto avg_cell_sizes = average_var_cell_sizes;
+        auto&& [buffers, buffer_sizes] = create_buffers(
+            stats, partition_config, array_schema, avg_cell_sizes);
+
+        auto query_r = (Query*)nullptr;
+        auto query_w = (Query*)nullptr;
+        URI partition_uri;
+        ScopedExecutor clean_up([&]() {
+          if (query_w != nullptr) {
+            created_uris[p] = query_w->created_fragment_uris();
+          }
+          if (created_uris[p].empty() && !partition_uri.empty()) {
+            created_uris[p].emplace_back(partition_uri);
+          }
+          tdb_delete(query_r);
+          tdb_delete(query_w);
+        });
+
+        RETURN_NOT_OK(create_queries(
+            array_for_reads,
+            array_for_writes,
+            partitions[p],
+            &query_r,
+            &query_w,
+            &partition_uri,
+            true));
+        RETURN_NOT_OK(
+            copy_array(query_r, query_w, &buffers, &buffer_sizes, stats));
+        RETURN_NOT_OK(query_w->finalize());
+        for (auto& info : query_w->get_written_fragment_info()) {
+          written_uris[p].emplace_back(info.uri_);
+        }
+        stats->add_counter(
+            "consolidate_partition_fragment_num", written_uris[p].size());
+        failed[p] = 0;
+        return Status::Ok();
+      });
+
+  // On failure, remove the fragments that are not committed: those of every
+  // partition if they were to be committed together, otherwise those of the
+  // failed partitions. The committed partitions of an array without
+  // duplicates are left in place, reads merge them with the fragments they
+  // consolidate.
+  if (!status.ok()) {
+    for (size_t p = 0; p < partitions.size(); ++p) {
+      if (failed[p] || commit_together) {
+        for (auto& uri : created_uris[p]) {
+          bool is_dir = false;
+          throw_if_not_ok(vfs->is_dir(uri, &is_dir));
+          if (is_dir)
+            throw_if_not_ok(vfs->remove_dir(uri));
+        }
+      }
+    }
+    return status;
+  }
+
+  for (auto& uris : written_uris) {
+    new_fragment_uris->insert(
+        new_fragment_uris->end(), uris.begin(), uris.end());
+  }
+  if (new_fragment_uris->empty()) {
+    return Status::Ok();
+  }
+
+  // Make the fragments visible together.
+  if (commit_together) {
+    std::vector<URI> commit_uris;
+    commit_uris.reserve(new_fragment_uris->size());
+    for (auto& uri : *new_fragment_uris) {
+      commit_uris.emplace_back(array_dir.get_commit_uri(uri));
+    }
+    storage_manager_->write_consolidated_commits_file(
+        array_schema.write_version(), array_dir, commit_uris);
+  }
+
+  // Write vacuum file
+  return write_vacuum_file(
+      array_dir.get_vacuum_uri(new_fragment_uris->back()), to_consolidate);
+}
+
+bool FragmentConsolidator::commit_partitions_together(
+    const ArraySchema& array_schema) const {
+  return config_.partition_commit_together_ || array_schema.allows_dups();
+}
+
+std::vector<NDRange> FragmentConsolidator::compute_partitions(
+    const ArraySchema& array_schema,
+    const NDRange& union_non_empty_domains) const {
+  const auto& domain{array_schema.domain()};
+  if (config_.partition_num_ <= 1 || union_non_empty_domains.empty() ||
+      array_schema.cell_order() == Layout::HILBERT) {
+    return {union_non_empty_domains};
+  }
+
+  // The outermost dimension of the tile order.
+  auto d = domain.tile_order() == Layout::COL_MAJOR ? domain.dim_num() - 1 : 0;
+  auto dim = domain.dimension_ptr(d);
+  if (!dim->tile_extent()) {
+    return {union_non_empty_domains};
+  }
+
+  std::vector<Range> ranges;
+  switch (dim->type()) {
+    case Datatype::INT8:
+      ranges = split_on_tiles<int8_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::UINT8:
+      ranges = split_on_tiles<uint8_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::INT16:
+      ranges = split_on_tiles<int16_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::UINT16:
+      ranges = split_on_tiles<uint16_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::INT32:
+      ranges = split_on_tiles<int32_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::UINT32:
+      ranges = split_on_tiles<uint32_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::INT64:
+      ranges = split_on_tiles<int64_t>(*dim, union_non_empty_domains[d]);
+      break;
+    case Datatype::UINT64:
+      ranges = split_on_tiles<uint64_t>(*dim, union_non_empty_domains[d]);
+      break;
+    default:
+      return {union_non_empty_domains};
+  }
+
+  std::vector<NDRange> partitions(ranges.size(), union_non_empty_domains);
+  for (size_t p = 0; p < ranges.size(); ++p) {
+    partitions[p][d] = ranges[p];
+  }
+  return partitions;
+}
+
+template <class T>
+std::vector<Range> FragmentConsolidator::split_on_tiles(
+    const Dimension& dim, const Range& range) const {
+  const auto domain_low = *static_cast<const T*>(dim.domain().start_fixed());
+  const auto tile_extent = dim.tile_extent().rvalue_as<T>();
+  const auto start = *static_cast<const T*>(range.start_fixed());
+  const auto end = *static_cast<const T*>(range.end_fixed());
+
+  // Spread the space tiles overlapping the range evenly over the partitions.
+  auto first_tile = Dimension::tile_idx(start, domain_low, tile_extent);
+  auto tile_num =
+      Dimension::tile_idx(end, domain_low, tile_extent) - first_tile + 1;
+  auto partition_num = std::min<uint64_t>(config_.partition_num_, tile_num);
+  std::vector<Range> ranges;
+  ranges.reserve(partition_num);
+  for (uint64_t p = 0; p < partition_num; ++p) {
+    auto tile_start = first_tile + p * tile_num / partition_num;
+    auto tile_end = first_tile + (p + 1) * tile_num / partition_num - 1;
+    T partition_start = std::max(
+        start, Dimension::tile_coord_low(tile_start, domain_low, tile_extent));
+    T partition_end = std::min(
+        end, Dimension::tile_coord_high(tile_end, domain_low, tile_extent));
+    ranges.emplace_back(&partition_start, &partition_end, sizeof(T));
+  }
+
+  return ranges;
+}
+
 Status FragmentConsolidator::copy_array(
     Query* query_r,
     Query* query_w,
     std::vector<ByteVec>* buffers,
-    std::vector<uint64_t>* buffer_sizes) {
-  auto timer_se = stats_->start_timer("consolidate_copy_array");
+    std::vector<uint64_t>* buffer_sizes,
+    stats::Stats* stats) {
+  auto timer_se = stats->start_timer("consolidate_copy_array");
 
   // Set the read query buffers outside the repeated submissions.
   // The Reader will reset the query buffer sizes to the original
@@ -503,11 +762,20 @@ Status FragmentConsolidator::copy_array(
     // If Consolidation cannot make any progress, throw. The first buffer will
     // always contain fixed size data, wether it is tile offsets for var size
     // attribute/dimension or the actual fixed size data so we can use its size
-    // to know if any cells were written or not.
+    // to know if any cells were written or not. A completed read without any
+    // cell, e.g. of an empty partition, has nothing to copy.
     if (buffer_sizes->at(0) == 0) {
+      if (query_r->status() == QueryStatus::COMPLETED) {
+        break;
+      }
       throw FragmentConsolidatorStatusException(
           "Consolidation read 0 cells, no progress can be made");
     }
+    stats->add_counter("consolidate_copy_array_batches", 1);
+    stats->add_counter(
+        "consolidate_copy_array_bytes",
+        std::accumulate(
+            buffer_sizes->begin(), buffer_sizes->end(), uint64_t(0)));
 
     // Set explicitly the write query buffers, as the sizes may have
     // been altered by the read query.
@@ -520,6 +788,455 @@ Status FragmentConsolidator::copy_array(
   return Status::Ok();
 }
 
+std::vector<FragmentConsolidator::FragmentRun>
+FragmentConsolidator::compute_fragment_runs(Array& array_for_reads) const {
+  const auto& array_schema = array_for_reads.array_schema_latest();
+  const auto& domain{array_schema.domain()};
+  if (array_schema.dense() || !domain.all_dims_fixed() ||
+      array_schema.cell_order() == Layout::HILBERT ||
+      config_.with_delete_meta_) {
+    return {};
+  }
+
+  // No delete/update condition may apply to the cells being copied.
+  const auto& fragments = array_for_reads.fragment_metadata();
+  const auto first_timestamp = fragments.front()->first_timestamp();
+  for (auto& location : array_for_reads.array_directory()
+                            .delete_and_update_tiles_location()) {
+    if (location.timestamp() >= first_timestamp) {
+      return {};
+    }
+  }
+
+  // The tiles of a fragment can be copied if no other fragment of the step
+  // overlaps it in the global order, so that its cells are not merged with
+  // any other.
+  std::vector<uint8_t> copyable(fragments.size(), 0);
+  for (size_t f = 0; f < fragments.size(); ++f) {
+    auto& frag_md = fragments[f];
+    if (frag_md->dense() || frag_md->has_delete_meta() ||
+        frag_md->format_version() != array_schema.write_version() ||
+        frag_md->array_schema_name() != array_schema.name()) {
+      continue;
+    }
+
+    copyable[f] = 1;
+    for (size_t g = 0; g < fragments.size() && copyable[f]; ++g) {
+      if (g != f &&
+          !precedes_in_global_order(
+              domain,
+              frag_md->non_empty_domain(),
+              fragments[g]->non_empty_domain()) &&
+          !precedes_in_global_order(
+              domain,
+              fragments[g]->non_empty_domain(),
+              frag_md->non_empty_domain())) {
+        copyable[f] = 0;
+      }
+    }
+  }
+
+  // Split the fragments in runs of consecutive fragments that are either all
+  // copied or all merged. Tiles are placed one after the other, so a copied
+  // fragment must precede the next one of its run in the global order and,
+  // since sparse tile cell counts are implicit, end with a full tile. The
+  // cell-level copy splits the result in fragments of the maximum size, so
+  // copied runs do not exceed it either.
+  std::vector<FragmentRun> runs;
+  uint64_t run_size = 0;
+  for (size_t f = 0; f < fragments.size(); ++f) {
+    auto& frag_md = fragments[f];
+    bool extend = !runs.empty() && runs.back().copy_tiles_ == copyable[f];
+    if (extend && copyable[f]) {
+      auto& prev_md = runs.back().fragments_.back();
+      extend = prev_md->last_tile_cell_num() == array_schema.capacity() &&
+               precedes_in_global_order(
+                   domain,
+                   prev_md->non_empty_domain(),
+                   frag_md->non_empty_domain()) &&
+               run_size + frag_md->fragment_size() <=
+                   config_.max_fragment_size_;
+    }
+
+    if (!extend) {
+      runs.push_back({{}, copyable[f] == 1});
+      run_size = 0;
+    }
+    runs.back().fragments_.emplace_back(frag_md);
+    run_size += frag_md->fragment_size();
+  }
+
+  // Consolidating the runs must reduce the number of fragments, or the next
+  // steps would consolidate the same fragments again.
+  auto copy = std::any_of(runs.begin(), runs.end(), [](const FragmentRun& r) {
+    return r.copy_tiles_;
+  });
+  if (!copy || runs.size() == fragments.size()) {
+    return {};
+  }
+
+  return runs;
+}
+
+Status FragmentConsolidator::consolidate_runs(
+    shared_ptr<Array> array_for_reads,
+    shared_ptr<Array> array_for_writes,
+    const std::vector<FragmentRun>& runs,
+    std::vector<URI>* new_fragment_uris) {
+  // For easy reference
+  auto vfs = storage_manager_->vfs();
+  const auto& array_dir = array_for_reads->array_directory();
+  const auto& domain = array_for_reads->array_schema_latest().domain();
+  auto write_version = array_for_reads->array_schema_latest().write_version();
+
+  // Each run is consolidated on its own, in timestamp order. The runs do not
+  // overlap the copied runs, so their cells are never merged with each other.
+  for (const auto& run : runs) {
+    std::vector<TimestampedURI> run_uris;
+    for (auto& frag_md : run.fragments_) {
+      run_uris.emplace_back(
+          frag_md->fragment_uri(), frag_md->timestamp_range());
+    }
+
+    // A single fragment is kept as it is.
+    if (run_uris.size() == 1) {
+      new_fragment_uris->emplace_back(run_uris.front().uri_);
+      continue;
+    }
+
+    // The cells of a merged run are read from its own fragments, over the
+    // union of their non-empty domains only.
+    if (!run.copy_tiles_) {
+      NDRange run_non_empty_domains;
+      for (auto& frag_md : run.fragments_) {
+        domain.expand_ndrange(
+            frag_md->non_empty_domain(), &run_non_empty_domains);
+      }
+      array_for_reads->fragment_metadata() = run.fragments_;
+      RETURN_NOT_OK(merge_fragments(
+          array_for_reads,
+          array_for_writes,
+          run_uris,
+          run_non_empty_domains,
+          new_fragment_uris));
+      continue;
+    }
+
+    auto fragment_name = array_dir.compute_new_fragment_name(
+        run_uris.front().uri_, run_uris.back().uri_, write_version);
+    auto new_fragment_uri =
+        array_dir.get_fragments_dir(write_version).join_path(fragment_name);
+    auto vac_uri = array_dir.get_vacuum_uri(new_fragment_uri);
+
+    auto st = copy_tiles(*array_for_reads, run.fragments_, new_fragment_uri);
+    if (st.ok()) {
+      st = write_vacuum_file(vac_uri, run_uris);
+    }
+    if (!st.ok()) {
+      bool is_dir = false;
+      throw_if_not_ok(vfs->is_dir(new_fragment_uri, &is_dir));
+      if (is_dir)
+        throw_if_not_ok(vfs->remove_dir(new_fragment_uri));
+      return st;
+    }
+    new_fragment_uris->emplace_back(new_fragment_uri);
+  }
+
+  return Status::Ok();
+}
+
+Status FragmentConsolidator::copy_tiles(
+    Array& array_for_reads,
+    const std::vector<shared_ptr<FragmentMetadata>>& fragments,
+    const URI& new_fragment_uri) {
+  auto timer_se = stats_->start_timer("consolidate_copy_tiles");
+
+  // For easy reference
+  auto vfs = storage_manager_->vfs();
+  const auto& array_schema = array_for_reads.array_schema_latest();
+  const auto& encryption_key = array_for_reads.get_encryption_key();
+  const auto& array_dir = array_for_reads.array_directory();
+  auto write_version = array_schema.write_version();
+
+  // The attributes and dimensions to copy, then the timestamps if the new
+  // fragment includes them.
+  std::vector<std::string> names;
+  for (const auto& attr : array_schema.attributes()) {
+    names.emplace_back(attr->name());
+  }
+  for (unsigned d = 0; d < array_schema.dim_num(); ++d) {
+    names.emplace_back(array_schema.dimension_ptr(d)->name());
+  }
+  if (config_.with_timestamps_) {
+    names.emplace_back(constants::timestamps);
+  }
+
+  // Load the tile metadata of the fragments to copy.
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, fragments.size(), [&](uint64_t f) {
+        auto& frag_md = fragments[f];
+        std::vector<std::string> frag_names;
+        for (const auto& name : names) {
+          if (name != constants::timestamps || frag_md->has_timestamps()) {
+            frag_names.emplace_back(name);
+          }
+        }
+
+        RETURN_NOT_OK(frag_md->load_rtree(encryption_key));
+        RETURN_NOT_OK(frag_md->load_tile_offsets(
+            encryption_key, std::vector<std::string>(frag_names)));
+        for (const auto& name : frag_names) {
+          if (array_schema.var_size(name)) {
+            RETURN_NOT_OK(frag_md->load_tile_var_sizes(encryption_key, name));
+          }
+        }
+        RETURN_NOT_OK(frag_md->load_tile_min_values(
+            encryption_key, std::vector<std::string>(frag_names)));
+        RETURN_NOT_OK(frag_md->load_tile_max_values(
+            encryption_key, std::vector<std::string>(frag_names)));
+        RETURN_NOT_OK(frag_md->load_tile_sum_values(
+            encryption_key, std::vector<std::string>(frag_names)));
+        return frag_md->load_tile_null_count_values(
+            encryption_key, std::move(frag_names));
+      });
+  RETURN_NOT_OK(status);
+
+  // Create the fragment directory, the directory for the new fragment
+  // URI, and the commit directory.
+  RETURN_NOT_OK(vfs->create_dir(array_dir.get_fragments_dir(write_version)));
+  RETURN_NOT_OK(vfs->create_dir(new_fragment_uri));
+  RETURN_NOT_OK(vfs->create_dir(array_dir.get_commits_dir(write_version)));
+
+  // Create the fragment metadata.
+  std::pair<uint64_t, uint64_t> timestamp_range;
+  RETURN_NOT_OK(
+      utils::parse::get_timestamp_range(new_fragment_uri, &timestamp_range));
+  auto meta = make_shared<FragmentMetadata>(
+      HERE(),
+      storage_manager_,
+      nullptr,
+      array_for_reads.array_schema_latest_ptr(),
+      new_fragment_uri,
+      timestamp_range,
+      false,
+      config_.with_timestamps_,
+      false);
+  RETURN_NOT_OK(meta->init(array_schema.domain().domain()));
+
+  uint64_t tile_num = 0;
+  for (auto& frag_md : fragments) {
+    tile_num += frag_md->tile_num();
+  }
+  RETURN_NOT_OK(meta->set_num_tiles(tile_num));
+
+  // Set the MBRs.
+  uint64_t tid = 0;
+  for (auto& frag_md : fragments) {
+    for (uint64_t t = 0; t < frag_md->tile_num(); ++t) {
+      RETURN_NOT_OK(meta->set_mbr(tid++, frag_md->mbr(t)));
+    }
+  }
+  meta->set_last_tile_cell_num(fragments.back()->last_tile_cell_num());
+
+  // Copy the tiles of each attribute/dimension, one fragment after the other.
+  status = parallel_for(
+      storage_manager_->compute_tp(), 0, names.size(), [&](uint64_t i) {
+        const auto& name = names[i];
+        const auto var_size = array_schema.var_size(name);
+        const auto nullable = array_schema.is_nullable(name);
+        auto&& [st, uri] = meta->uri(name);
+        RETURN_NOT_OK(st);
+        auto&& [st_var, var_uri] = meta->var_uri(name);
+        RETURN_NOT_OK(st_var);
+        auto&& [st_validity, validity_uri] = meta->validity_uri(name);
+        RETURN_NOT_OK(st_validity);
+
+        uint64_t tid = 0;
+        for (auto& frag_md : fragments) {
+          const auto frag_tile_num = frag_md->tile_num();
+          if (name == constants::timestamps && !frag_md->has_timestamps()) {
+            RETURN_NOT_OK(write_timestamp_tiles(
+                array_schema, encryption_key, *frag_md, *uri, tid, *meta));
+            tid += frag_tile_num;
+            continue;
+          }
+
+          uint64_t size = 0, var_file_size = 0, validity_size = 0;
+          for (uint64_t t = 0; t < frag_tile_num; ++t) {
+            meta->copy_tile_metadata(name, tid + t, *frag_md, t);
+            size += frag_md->persisted_tile_size(name, t);
+            if (var_size) {
+              var_file_size += frag_md->persisted_tile_var_size(name, t);
+            }
+            if (nullable) {
+              validity_size += frag_md->persisted_tile_validity_size(name, t);
+            }
+          }
+          tid += frag_tile_num;
+
+          auto&& [st_src, src_uri] = frag_md->uri(name);
+          RETURN_NOT_OK(st_src);
+          RETURN_NOT_OK(append_file(*src_uri, *uri, size));
+          if (var_size) {
+            auto&& [st_src_var, src_var_uri] = frag_md->var_uri(name);
+            RETURN_NOT_OK(st_src_var);
+            RETURN_NOT_OK(append_file(*src_var_uri, *var_uri, var_file_size));
+          }
+          if (nullable) {
+            auto&& [st_src_validity, src_validity_uri] =
+                frag_md->validity_uri(name);
+            RETURN_NOT_OK(st_src_validity);
+            RETURN_NOT_OK(
+                append_file(*src_validity_uri, *validity_uri, validity_size));
+          }
+        }
+
+        RETURN_NOT_OK(vfs->close_file(*uri));
+        if (var_size) {
+          RETURN_NOT_OK(vfs->close_file(*var_uri));
+        }
+        if (nullable) {
+          RETURN_NOT_OK(vfs->close_file(*validity_uri));
+        }
+        return Status::Ok();
+      });
+  RETURN_NOT_OK(status);
+
+  // Set the processed conditions on new fragment.
+  std::vector<std::string> processed_conditions;
+  for (auto& location : array_dir.delete_and_update_tiles_location()) {
+    processed_conditions.emplace_back(location.condition_marker());
+  }
+  meta->set_processed_conditions(processed_conditions);
+
+  // Compute fragment min/max/sum/null count and flush fragment metadata to
+  // storage
+  meta->compute_fragment_min_max_sum_null_count();
+  meta->store(encryption_key);
+
+  // The following will make the fragment visible
+  RETURN_NOT_OK(vfs->touch(array_dir.get_commit_uri(new_fragment_uri)));
+
+  stats_->add_counter("consolidate_copy_tiles_num", tile_num);
+
+  return Status::Ok();
+}
+
+Status FragmentConsolidator::write_timestamp_tiles(
+    const ArraySchema& array_schema,
+    const EncryptionKey& encryption_key,
+    const FragmentMetadata& frag_md,
+    const URI& uri,
+    uint64_t tid,
+    FragmentMetadata& meta) {
+  // Get a copy of the timestamps filter pipeline, with an encryption filter
+  // appended when necessary.
+  FilterPipeline filters = array_schema.filters(constants::timestamps);
+  RETURN_NOT_OK(
+      FilterPipeline::append_encryption_filter(&filters, encryption_key));
+  const bool tile_chunking = filters.use_tile_chunking(
+      false, array_schema.version(), constants::timestamp_type);
+
+  // Every cell of the fragment carries the fragment timestamp.
+  const uint64_t timestamp = frag_md.timestamp_range().first;
+  ByteVec value(sizeof(uint64_t));
+  memcpy(value.data(), &timestamp, sizeof(uint64_t));
+  for (uint64_t t = 0; t < frag_md.tile_num(); ++t) {
+    const auto cell_num = frag_md.cell_num(t);
+    std::vector<uint64_t> timestamps(cell_num, timestamp);
+    WriterTile tile(
+        array_schema.write_version(),
+        constants::timestamp_type,
+        constants::timestamp_size,
+        cell_num * constants::timestamp_size);
+    RETURN_NOT_OK(tile.write(timestamps.data(), 0, tile.size()));
+
+    // Store filter-free tiles as a single chunk when requested, as the
+    // writer does.
+    bool use_chunking = tile_chunking;
+    if (config_.single_chunk_unfiltered_tiles_ && filters.empty() &&
+        tile.size() <= std::numeric_limits<uint32_t>::max()) {
+      use_chunking = false;
+    }
+    RETURN_NOT_OK(filters.run_forward(
+        stats_,
+        &tile,
+        nullptr,
+        storage_manager_->compute_tp(),
+        use_chunking));
+    auto& filtered = tile.filtered_buffer();
+    RETURN_NOT_OK(
+        storage_manager_->vfs()->write(uri, filtered.data(), filtered.size()));
+
+    meta.set_tile_offset(constants::timestamps, tid + t, filtered.size());
+    meta.set_tile_min(constants::timestamps, tid + t, value);
+    meta.set_tile_max(constants::timestamps, tid + t, value);
+    const uint64_t sum = timestamp * cell_num;
+    ByteVec sum_value(sizeof(uint64_t));
+    memcpy(sum_value.data(), &sum, sizeof(uint64_t));
+    meta.set_tile_sum(constants::timestamps, tid + t, sum_value);
+  }
+
+  return Status::Ok();
+}
+
+Status FragmentConsolidator::append_file(
+    const URI& from, const URI& to, uint64_t size) const {
+  auto vfs = storage_manager_->vfs();
+  std::vector<uint8_t> buffer(
+      std::min<uint64_t>(size, std::max<uint64_t>(config_.buffer_size_, 1)));
+  for (uint64_t offset = 0; offset < size; offset += buffer.size()) {
+    auto nbytes = std::min<uint64_t>(buffer.size(), size - offset);
+    RETURN_NOT_OK(vfs->read(from, offset, buffer.data(), nbytes, false));
+    RETURN_NOT_OK(vfs->write(to, buffer.data(), nbytes));
+  }
+
+  return Status::Ok();
+}
+
+bool FragmentConsolidator::precedes_in_global_order(
+    const Domain& domain, const NDRange& a, const NDRange& b) {
+  const auto dim_num = domain.dim_num();
+  auto dim_idx = [dim_num](Layout layout, unsigned i) {
+    return layout == Layout::COL_MAJOR ? dim_num - 1 - i : i;
+  };
+
+  // Compare the space tiles first, on the tile order. On each dimension, `a`
+  // either lies in earlier tiles than `b`, or both lie in the same tile.
+  for (unsigned i = 0; i < dim_num; ++i) {
+    auto d = dim_idx(domain.tile_order(), i);
+    if (!domain.dimension_ptr(d)->tile_extent()) {
+      continue;
+    }
+    if (domain.tile_order_cmp(d, a[d].end_fixed(), b[d].start_fixed()) < 0) {
+      return true;
+    }
+    if (domain.tile_order_cmp(d, a[d].start_fixed(), b[d].end_fixed()) != 0 ||
+        domain.tile_order_cmp(d, a[d].end_fixed(), b[d].start_fixed()) != 0) {
+      return false;
+    }
+  }
+
+  // Within the same space tile, compare the cells on the cell order.
+  for (unsigned i = 0; i < dim_num; ++i) {
+    auto d = dim_idx(domain.cell_order(), i);
+    auto coord_size = domain.dimension_ptr(d)->coord_size();
+    UntypedDatumView a_start{a[d].start_fixed(), coord_size};
+    UntypedDatumView a_end{a[d].end_fixed(), coord_size};
+    UntypedDatumView b_start{b[d].start_fixed(), coord_size};
+    UntypedDatumView b_end{b[d].end_fixed(), coord_size};
+    if (domain.cell_order_cmp(d, a_end, b_start) < 0) {
+      return true;
+    }
+    if (domain.cell_order_cmp(d, a_start, b_end) != 0 ||
+        domain.cell_order_cmp(d, a_end, b_start) != 0) {
+      return false;
+    }
+  }
+
+  return false;
+}
+
 tuple<std::vector<ByteVec>, std::vector<uint64_t>>
 FragmentConsolidator::create_buffers(
     stats::Stats* stats,
@@ -614,7 +1331,8 @@ Status FragmentConsolidator::create_queries(
     const NDRange& subarray,
     Query** query_r,
     Query** query_w,
-    URI* new_fragment_uri) {
+    URI* new_fragment_uri,
+    bool partition) {
   auto timer_se = stats_->start_timer("consolidate_create_queries");
 
   const auto dense = array_for_reads->array_schema_latest().dense();
@@ -633,6 +1351,8 @@ Status FragmentConsolidator::create_queries(
     auto& domain{array_for_reads->array_schema_latest().domain()};
     domain.expand_to_tiles(&read_subarray);
     RETURN_NOT_OK((*query_r)->set_subarray_unsafe(read_subarray));
+  } else if (partition) {
+    RETURN_NOT_OK((*query_r)->set_subarray_unsafe(subarray));
   }
 
   // Enable consolidation with timestamps on the reader, if applicable.
@@ -654,6 +1374,10 @@ Status FragmentConsolidator::create_queries(
   RETURN_NOT_OK((*query_w)->set_layout(Layout::GLOBAL_ORDER));
   RETURN_NOT_OK((*query_w)->disable_checks_consolidation());
   (*query_w)->set_fragment_size(config_.max_fragment_size_);
+  if (partition &&
+      commit_partitions_together(array_for_reads->array_schema_latest())) {
+    RETURN_NOT_OK((*query_w)->defer_commit());
+  }
   if (array_for_reads->array_schema_latest().dense()) {
     RETURN_NOT_OK((*query_w)->set_subarray_unsafe(subarray));
   }
@@ -925,6 +1649,22 @@ Status FragmentConsolidator::set_config(const Config& config) {
   RETURN_NOT_OK(merged_config.get<uint64_t>(
       "sm.consolidation.timestamp_end", &config_.timestamp_end_, &found));
   assert(found);
+  config_.partition_num_ = 1;
+  RETURN_NOT_OK(merged_config.get<uint32_t>(
+      "sm.consolidation.partition_num", &config_.partition_num_, &found));
+  assert(found);
+  config_.partition_commit_together_ = true;
+  RETURN_NOT_OK(merged_config.get<bool>(
+      "sm.consolidation.partition_commit_together",
+      &config_.partition_commit_together_,
+      &found));
+  assert(found);
+  config_.single_chunk_unfiltered_tiles_ = false;
+  RETURN_NOT_OK(merged_config.get<bool>(
+      "sm.single_chunk_unfiltered_tiles",
+      &config_.single_chunk_unfiltered_tiles_,
+      &found));
+  assert(found);
   std::string reader =
       merged_config.get("sm.query.sparse_global_order.reader", &found);
   assert(found);
@@ -937,6 +1677,10 @@ Status FragmentConsolidator::set_config(const Config& config) {
     return logger_->status(Status_ConsolidatorError(
         "Invalid configuration; Minimum fragments config parameter is larger "
         "than the maximum"));
+  if (config_.partition_num_ == 0)
+    return logger_->status(Status_ConsolidatorError(
+        "Invalid configuration; Partition number config parameter must be "
+        "positive"));
   if (config_.size_ratio_ > 1.0f || config_.size_ratio_ < 0.0f)
     return logger_->status(Status_ConsolidatorError(
         "Invalid configuration; Step size ratio config parameter must be in "
@@ -50,6 +50,10 @@ namespace tiledb::sm {
 
 class ArraySchema;
 class Config;
+class Dimension;
+class Domain;
+class EncryptionKey;
+class FragmentMetadata;
 class Query;
 class URI;
 
@@ -174,6 +178,20 @@ class FragmentConsolidator : public Consolidator {
     bool use_refactored_reader_;
     /** Purge deleted cells or not. */
     bool purge_deleted_cells_;
+    /** Number of partitions consolidated concurrently in a single step. */
+    uint32_t partition_num_;
+    /** Commit the fragments of the partitions together or not. */
+    bool partition_commit_together_;
+    /** Store filter-free fixed-size tiles as a single chunk or not. */
+    bool single_chunk_unfiltered_tiles_;
+  };
+
+  /** A run of consecutive fragments of a consolidation step. */
+  struct FragmentRun {
+    /** The fragments of the run, in timestamp order. */
+    std::vector<shared_ptr<FragmentMetadata>> fragments_;
+    /** Consolidate the run by copying its tiles or by merging its cells. */
+    bool copy_tiles_;
   };
 
   /* ********************************* */
@@ -219,8 +237,10 @@ class FragmentConsolidator : public Consolidator {
    * @param union_non_empty_domains The union of the non-empty domains of
    *     the fragments in `to_consolidate`. Applicable only when those
    *     fragments are *not* all sparse.
-   * @param new_fragment_uri The URI of the fragment created after
-   *     consolidating the `to_consolidate` fragments.
+   * @param new_fragment_uris The URIs of the fragments created after
+   *     consolidating the `to_consolidate` fragments, in order. There is
+   *     more than one if the result was split on the maximum fragment size
+   *     or on partitions.
    * @return Status
    */
   Status consolidate_internal(
@@ -228,7 +248,87 @@ class FragmentConsolidator : public Consolidator {
       shared_ptr<Array> array_for_writes,
       const std::vector<TimestampedURI>& to_consolidate,
       const NDRange& union_non_empty_domains,
-      URI* new_fragment_uri);
+      std::vector<URI>* new_fragment_uris);
+
+  /**
+   * Consolidates the fragments loaded in `array_for_reads` by merging their
+   * cells, over the whole domain or over partitions of it.
+   *
+   * @param array_for_reads Array used for reads, with the fragments loaded.
+   * @param array_for_writes Array used for writes.
+   * @param to_consolidate The fragments to consolidate.
+   * @param union_non_empty_domains The union of the non-empty domains of
+   *     the fragments in `to_consolidate`.
+   * @param new_fragment_uris The URIs of the fragments created, in order.
+   * @return Status
+   */
+  Status merge_fragments(
+      shared_ptr<Array> array_for_reads,
+      shared_ptr<Array> array_for_writes,
+      const std::vector<TimestampedURI>& to_consolidate,
+      const NDRange& union_non_empty_domains,
+      std::vector<URI>* new_fragment_uris);
+
+  /**
+   * Consolidates the input fragments into one fragment per partition of
+   * their domain, running the partitions concurrently. The fragments are
+   * either committed together once all partitions are written, or each as
+   * soon as its partition is written. If any partition fails, the
+   * uncommitted fragments of all partitions are removed.
+   *
+   * @param array_for_reads Array used for reads.
+   * @param array_for_writes Array used for writes.
+   * @param to_consolidate The fragments to consolidate in this consolidation
+   *     step.
+   * @param partitions The disjoint partitions of the domain of the fragments.
+   * @param new_fragment_uris The URIs of the fragments created, in order.
+   * @return Status
+   */
+  Status consolidate_partitions(
+      shared_ptr<Array> array_for_reads,
+      shared_ptr<Array> array_for_writes,
+      const std::vector<TimestampedURI>& to_consolidate,
+      const std::vector<NDRange>& partitions,
+      std::vector<URI>* new_fragment_uris);
+
+  /**
+   * Returns whether the fragments of the partitions of a step are committed
+   * together. They always are for arrays allowing duplicates, as reads do
+   * not merge the duplicates of a committed partition with the fragments it
+   * consolidates until the vacuum file of the step is written.
+   */
+  bool commit_partitions_together(const ArraySchema& array_schema) const;
+
+  /**
+   * Splits the union of the non-empty domains of the fragments to
+   * consolidate into at most `sm.consolidation.partition_num` disjoint
+   * partitions, aligned to the space tiles. Only the outermost dimension of
+   * the tile order is split, so the partitions follow each other in the
+   * global order. It must be an integer dimension with a tile extent, and
+   * the cell order must not be Hilbert.
+   *
+   * @param array_schema The array schema.
+   * @param union_non_empty_domains The union of the non-empty domains of
+   *     the fragments to consolidate.
+   * @return The partitions, or a single one if the domain is not split.
+   */
+  std::vector<NDRange> compute_partitions(
+      const ArraySchema& array_schema,
+      const NDRange& union_non_empty_domains) const;
+
+  /**
+   * Splits a range of a dimension into at most `sm.consolidation.partition_num`
+   * ranges, each covering whole space tiles of the dimension clipped to the
+   * range.
+   *
+   * @tparam T The dimension type.
+   * @param dim The dimension.
+   * @param range The range to split.
+   * @return The ranges.
+   */
+  template <class T>
+  std::vector<Range> split_on_tiles(
+      const Dimension& dim, const Range& range) const;
 
   /**
    * Copies the array by reading from the fragments to be consolidated
@@ -237,13 +337,113 @@ class FragmentConsolidator : public Consolidator {
    *
    * @param query_r The read query.
    * @param query_w The write query.
+   * @param buffers The buffers to copy the cells through.
+   * @param buffer_sizes The buffer sizes.
+   * @param stats The stats to record the progress of the copy in.
    * @return Status
    */
   Status copy_array(
       Query* query_r,
       Query* query_w,
       std::vector<ByteVec>* buffers,
-      std::vector<uint64_t>* buffer_sizes);
+      std::vector<uint64_t>* buffer_sizes,
+      stats::Stats* stats);
+
+  /**
+   * Splits the fragments loaded in `array_for_reads` in runs of consecutive
+   * fragments, consolidated either by copying their filtered tiles
+   * byte-for-byte into a new fragment or by reading and rewriting their
+   * cells. The tiles of a fragment can be copied when the fragments are
+   * sparse, it is written with the latest array schema and format version,
+   * carries no delete metadata nor pending delete/update conditions, and no
+   * other fragment of the step overlaps it in the global order. In a copied
+   * run, each fragment precedes the next one in the global order and, since
+   * sparse tiles other than the last one are implicitly full, ends with a
+   * full tile.
+   *
+   * @param array_for_reads Array used for reads, with the fragments loaded.
+   * @return The runs, in timestamp order, or none if no tiles can be copied
+   *     or copying them would not reduce the number of fragments.
+   */
+  std::vector<FragmentRun> compute_fragment_runs(Array& array_for_reads) const;
+
+  /**
+   * Consolidates each run of fragments into its own fragments, by copying
+   * the tiles of the copied runs and merging the cells of the others. Runs
+   * of a single fragment are kept as they are.
+   *
+   * @param array_for_reads Array used for reads.
+   * @param array_for_writes Array used for writes.
+   * @param runs The runs computed by `compute_fragment_runs`.
+   * @param new_fragment_uris The URIs of the fragments replacing the runs,
+   *     in order.
+   * @return Status
+   */
+  Status consolidate_runs(
+      shared_ptr<Array> array_for_reads,
+      shared_ptr<Array> array_for_writes,
+      const std::vector<FragmentRun>& runs,
+      std::vector<URI>* new_fragment_uris);
+
+  /**
+   * Creates the new fragment by concatenating the filtered tiles of
+   * `fragments`, along with their offsets, MBRs and min/max/sum/null count
+   * metadata. Timestamps tiles are generated for the fragments that do not
+   * have them, if the consolidated fragment includes timestamps.
+   *
+   * @param array_for_reads Array used for reads.
+   * @param fragments The fragments to copy, in global order.
+   * @param new_fragment_uri The URI of the new fragment.
+   * @return Status
+   */
+  Status copy_tiles(
+      Array& array_for_reads,
+      const std::vector<shared_ptr<FragmentMetadata>>& fragments,
+      const URI& new_fragment_uri);
+
+  /**
+   * Writes the timestamps tiles of a fragment that does not store
+   * timestamps, setting all its cells to the fragment timestamp.
+   *
+   * @param array_schema The array schema.
+   * @param encryption_key The encryption key of the array.
+   * @param frag_md The fragment whose cells the tiles cover.
+   * @param uri The URI of the timestamps file of the new fragment.
+   * @param tid The index of the first tile in the new fragment.
+   * @param meta The metadata of the new fragment.
+   * @return Status
+   */
+  Status write_timestamp_tiles(
+      const ArraySchema& array_schema,
+      const EncryptionKey& encryption_key,
+      const FragmentMetadata& frag_md,
+      const URI& uri,
+      uint64_t tid,
+      FragmentMetadata& meta);
+
+  /**
+   * Appends the first `size` bytes of a file to another file, in pieces
+   * of at most the consolidation buffer size.
+   *
+   * @param from The file to copy from.
+   * @param to The file to append to.
+   * @param size The number of bytes to copy.
+   * @return Status
+   */
+  Status append_file(const URI& from, const URI& to, uint64_t size) const;
+
+  /**
+   * Checks if all the cells within non-empty domain `a` precede all the
+   * cells within non-empty domain `b` in the global order. This is
+   * conservative: it may return `false` for some disjoint domains.
+   *
+   * @param domain The array domain.
+   * @param a The first non-empty domain.
+   * @param b The second non-empty domain.
+   * @return `true` if `a` precedes `b` in the global order.
+   */
+  static bool precedes_in_global_order(
+      const Domain& domain, const NDRange& a, const NDRange& b);
 
   /**
    * Creates the buffers that will be used upon reading the input fragments and
@@ -276,6 +476,9 @@ class FragmentConsolidator : public Consolidator {
    * @param query_r This query reads from the fragments to be consolidated.
    * @param query_w This query writes to the new consolidated fragment.
    * @param new_fragment_uri The URI of the new fragment to be created.
+   * @param partition If `true`, `subarray` is a partition of the fragments
+   *     to consolidate, which the read query is restricted to for sparse
+   *     arrays as well.
    * @return Status
    */
   Status create_queries(
@@ -284,7 +487,8 @@ class FragmentConsolidator : public Consolidator {
       const NDRange& subarray,
       Query** query_r,
       Query** query_w,
-      URI* new_fragment_uri);
+      URI* new_fragment_uri,
+      bool partition = false);
 
   /**
    * Based on the input fragment info, this algorithm decides the (sorted) list
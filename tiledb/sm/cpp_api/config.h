@@ -278,6 +278,12 @@ class Config {
    *    sparse fragment writes. Note that ties during deduplication are broken
    *    arbitrarily. <br>
    *    **Default**: false
+   * - `sm.single_chunk_unfiltered_tiles` <br>
+   *    If `true`, fixed-size tiles of attributes and dimensions without
+   *    filters are written as a single chunk instead of 64KiB chunks, so that
+   *    readers with `vfs.file.use_mmap` set can use them in place. Reading
+   *    such tiles can't be parallelized over chunks. <br>
+   *    **Default**: false
    * - `sm.check_coord_dups` <br>
    *    This is applicable only if `sm.dedup_coords` is `false`.
    *    If `true`, an error will be thrown if there are cells with duplicate
@@ -307,6 +313,10 @@ class Config {
    * - `sm.io_concurrency_level` <br>
    *    Upper-bound on number of threads to allocate for IO-bound tasks. <br>
    *    **Default*: # cores
+   * - `sm.filter.fused_reverse_kernels` <br>
+   *    If `true`, adjacent filters with a fused kernel (positive delta followed
+   *    by bit width reduction) are reversed in a single pass on reads. <br>
+   *    **Default**: true
    * - `sm.vacuum.mode` <br>
    *    The vacuuming mode, one of
    *    `commits` (remove only consolidated commit files),
@@ -352,6 +362,23 @@ class Config {
    *    **Experimental** <br>
    *    Purge deleted cells from the consolidated fragment or not.<br>
    *    **Default**: false
+   * - `sm.consolidation.partition_num` <br>
+   *    **Experimental** <br>
+   *    The number of disjoint, space tile aligned partitions the consolidated
+   *    domain is split into in each consolidation step. The partitions are
+   *    consolidated concurrently, each into its own fragment, using separate
+   *    buffers of `sm.consolidation.buffer_size`. Only the outermost dimension
+   *    of the tile order is partitioned, and only when it is an integer
+   *    dimension with a tile extent. <br>
+   *    **Default**: 1
+   * - `sm.consolidation.partition_commit_together` <br>
+   *    **Experimental** <br>
+   *    If `true`, the fragments of the partitions of a consolidation step are
+   *    made visible together, with a single consolidated commits file, once
+   *    all partitions are written. Otherwise, each fragment is committed as
+   *    soon as its partition is written. Arrays allowing duplicates always
+   *    commit the partitions together. <br>
+   *    **Default**: true
    * - `sm.consolidation.step_min_frags` <br>
    *    The minimum number of fragments to consolidate in a single step.<br>
    *    **Default**: UINT32_MAX
@@ -410,6 +437,19 @@ class Config {
    *    Which reader to use for sparse unordered with dups queries.
    *    "refactored" or "legacy".<br>
    *    **Default**: refactored
+   * - `sm.query.sparse_unordered.writer` <br>
+   *    **Experimental** <br>
+   *    Which writer to use for sparse unordered writes. "batch" writes the
+   *    cells of every submission as one fragment. "streaming" accepts cells
+   *    over any number of submissions, and sorts and writes them as a
+   *    fragment in the background whenever the cells buffered reach a
+   *    quarter of `sm.mem.total_budget`. <br>
+   *    **Default**: batch
+   * - `sm.query.sparse_unordered.merge_runs` <br>
+   *    **Experimental** <br>
+   *    If `true`, the streaming sparse unordered writer consolidates the
+   *    fragments it wrote into one when the query is finalized. <br>
+   *    **Default**: false
    * - `sm.mem.malloc_trim` <br>
    *    Should malloc_trim be called on context and query destruction? This
    *    might reduce residual memory usage. <br>
@@ -427,6 +467,44 @@ class Config {
    * - `sm.mem.total_budget` <br>
    *    Memory budget for readers and writers. <br>
    *    **Default**: 10GB
+   * - `sm.mem.context_budget` <br>
+   *    Budget of the memory tracked across a context: array R-trees, tile
+   *    offsets and tile metadata of all open arrays, and the tiles held by
+   *    sparse readers. Zero means unlimited. <br>
+   *    **Default**: 0
+   * - `sm.tile_cache_size` <br>
+   *    The byte budget of the cache of unfiltered tiles shared by all the
+   *    readers of a context. Repeated reads of the same tiles are served from
+   *    memory without I/O or unfiltering. A value of zero disables the
+   *    cache. <br>
+   *    **Default**: 0
+   * - `sm.fragment_metadata_cache_size` <br>
+   *    The byte budget of the cache of loaded fragment metadata (footers,
+   *    R-trees, tile offsets and tile metadata) shared by all the arrays of a
+   *    context. Reopening an array then only reads the metadata of newly
+   *    committed fragments from storage. Encrypted components are never
+   *    cached. A value of zero disables the cache. <br>
+   *    **Default**: 0
+   * - `sm.array_schema_cache_size` <br>
+   *    The byte budget of the cache of array schemas shared by all the arrays
+   *    of a context, keyed by schema URI. Opening an array then does not read
+   *    and deserialize schemas that were loaded before. Encrypted schemas are
+   *    never cached. A value of zero disables the cache. <br>
+   *    **Default**: 0
+   * - `sm.array_directory.incremental_reopen` <br>
+   *    If `true`, reopening an array keeps the directory entries listed by
+   *    the previous open that are older than a safety window before their
+   *    latest timestamp and only relists the rest, using a server-side
+   *    start-after listing where the backend supports it (S3). Writes,
+   *    consolidations and vacuums within the window are observed even when
+   *    committed out of timestamp order; older ones, e.g. consolidating or
+   *    vacuuming old fragments, are only observed when the array is opened
+   *    again. <br>
+   *    **Default**: false
+   * - `sm.array_directory.incremental_reopen_window_ms` <br>
+   *    The safety window, in milliseconds, relisted by incremental reopens
+   *    before the latest timestamp of the previous listing. <br>
+   *    **Default**: 600000
    * - `sm.mem.reader.sparse_global_order.ratio_coords` <br>
    *    Ratio of the budget allocated for coordinates in the sparse global
    *    order reader. <br>
@@ -506,6 +584,19 @@ class Config {
    *    The maximum number of parallel operations on objects with `file:///`
    *    URIs. <br>
    *    **Default**: `1`
+   * - `vfs.file.use_io_uring` <br>
+   *    If `true`, the batched tile reads on objects with `file:///` URIs are
+   *    all submitted at once through io_uring and completed asynchronously,
+   *    instead of being read by the I/O threads with blocking system calls.
+   *    Requires TileDB to be built with `TILEDB_IO_URING=ON` on Linux,
+   *    otherwise it is ignored with a warning. <br>
+   *    **Default**: false
+   * - `vfs.file.use_mmap` <br>
+   *    If `true`, the tile data of arrays with `file:///` URIs is read by
+   *    memory-mapping the fragment files instead of copying it into buffers.
+   *    Tiles of attributes and dimensions without filters are then used in
+   *    place. Ignored on Windows. <br>
+   *    **Default**: false
    * - `vfs.azure.storage_account_name` <br>
    *    Set the Azure Storage Account name. <br>
    *    **Default**: ""
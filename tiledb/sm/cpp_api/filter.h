@@ -285,6 +285,10 @@ class Filter {
         return "DEPRECATED";
       case TILEDB_FILTER_WEBP:
         return "WEBP";
+      case TILEDB_FILTER_ADAPTIVE_COMPRESSION:
+        return "ADAPTIVE_COMPRESSION";
+      case TILEDB_FILTER_PFOR:
+        return "PFOR";
     }
     return "";
   }
@@ -329,6 +333,7 @@ class Filter {
         break;
       case TILEDB_SCALE_FLOAT_FACTOR:
       case TILEDB_SCALE_FLOAT_OFFSET:
+      case TILEDB_ADAPTIVE_DECODE_COST_WEIGHT:
         if (!std::is_same<double, T>::value)
           throw std::invalid_argument("Option value must be double.");
         break;
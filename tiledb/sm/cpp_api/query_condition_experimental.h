@@ -0,0 +1,167 @@
+/**
+ * @file   query_condition_experimental.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the C++ experimental API for the query condition.
+ */
+
+#ifndef TILEDB_CPP_API_QUERY_CONDITION_EXPERIMENTAL_H
+#define TILEDB_CPP_API_QUERY_CONDITION_EXPERIMENTAL_H
+
+#include "context.h"
+#include "query_condition.h"
+#include "tiledb.h"
+#include "tiledb_experimental.h"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace tiledb {
+class QueryConditionExperimental {
+ public:
+  /**
+   * Factory function for creating a new set membership query condition.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * tiledb::Context ctx;
+   * std::vector<int32_t> ids = {1, 7, 42};
+   * auto qc = tiledb::QueryConditionExperimental::create<int32_t>(
+   *   ctx, "sensor_id", ids, TILEDB_IN);
+   * @endcode
+   *
+   * @tparam T Datatype of the field. Must be an arithmetic type.
+   * @param ctx The TileDB context.
+   * @param field_name The field name.
+   * @param values The set of values.
+   * @param op The set membership operator (TILEDB_IN or TILEDB_NOT_IN).
+   * @return A new QueryCondition object.
+   */
+  template <
+      typename T,
+      typename std::enable_if<std::is_arithmetic<T>::value>::type* = nullptr>
+  static QueryCondition create(
+      const Context& ctx,
+      const std::string& field_name,
+      const std::vector<T>& values,
+      tiledb_query_condition_op_t op) {
+    std::vector<uint64_t> offsets(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+      offsets[i] = i * sizeof(T);
+    }
+
+    return create(
+        ctx,
+        field_name,
+        values.data(),
+        values.size() * sizeof(T),
+        offsets.data(),
+        offsets.size() * sizeof(uint64_t),
+        op);
+  }
+
+  /**
+   * Factory function for creating a new set membership query condition on a
+   * string field.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * tiledb::Context ctx;
+   * std::vector<std::string> names = {"alice", "bob"};
+   * auto qc = tiledb::QueryConditionExperimental::create(
+   *   ctx, "name", names, TILEDB_NOT_IN);
+   * @endcode
+   *
+   * @param ctx The TileDB context.
+   * @param field_name The field name.
+   * @param values The set of values.
+   * @param op The set membership operator (TILEDB_IN or TILEDB_NOT_IN).
+   * @return A new QueryCondition object.
+   */
+  static QueryCondition create(
+      const Context& ctx,
+      const std::string& field_name,
+      const std::vector<std::string>& values,
+      tiledb_query_condition_op_t op) {
+    std::string data;
+    std::vector<uint64_t> offsets;
+    offsets.reserve(values.size());
+    for (const auto& value : values) {
+      offsets.push_back(data.size());
+      data += value;
+    }
+
+    return create(
+        ctx,
+        field_name,
+        data.data(),
+        data.size(),
+        offsets.data(),
+        offsets.size() * sizeof(uint64_t),
+        op);
+  }
+
+  /**
+   * Factory function for creating a new set membership query condition from
+   * raw buffers, laid out as var-sized query buffers.
+   *
+   * @param ctx The TileDB context.
+   * @param field_name The field name.
+   * @param data The concatenated set member values.
+   * @param data_size The byte size of `data`.
+   * @param offsets The starting byte offset of each member in `data`.
+   * @param offsets_size The byte size of `offsets`.
+   * @param op The set membership operator (TILEDB_IN or TILEDB_NOT_IN).
+   * @return A new QueryCondition object.
+   */
+  static QueryCondition create(
+      const Context& ctx,
+      const std::string& field_name,
+      const void* data,
+      uint64_t data_size,
+      const uint64_t* offsets,
+      uint64_t offsets_size,
+      tiledb_query_condition_op_t op) {
+    tiledb_query_condition_t* qc;
+    ctx.handle_error(tiledb_query_condition_alloc_set_membership(
+        ctx.ptr().get(),
+        field_name.c_str(),
+        data,
+        data_size,
+        offsets,
+        offsets_size,
+        op,
+        &qc));
+    return QueryCondition(ctx, qc);
+  }
+};
+
+}  // namespace tiledb
+
+#endif  // TILEDB_CPP_API_QUERY_CONDITION_EXPERIMENTAL_H
@@ -67,6 +67,60 @@ class QueryExperimental {
         update_value_size));
   }
 
+  /**
+   * Adds an aggregate to compute for a read query. No data buffers can be set
+   * on an aggregate query.
+   *
+   * **Example:**
+   * @code{.cpp}
+   * QueryExperimental::add_aggregate(ctx, query, "a", TILEDB_AGGREGATE_SUM);
+   * query.submit();
+   * auto&& [sum, valid] = QueryExperimental::get_aggregate<int64_t>(
+   *     ctx, query, "a", TILEDB_AGGREGATE_SUM);
+   * @endcode
+   *
+   * @param ctx TileDB context.
+   * @param query Query object.
+   * @param field_name The name of the aggregated field.
+   * @param op The aggregate operator.
+   */
+  static void add_aggregate(
+      const Context& ctx,
+      Query& query,
+      const std::string& field_name,
+      tiledb_query_aggregate_op_t op) {
+    ctx.handle_error(tiledb_query_add_aggregate(
+        ctx.ptr().get(), query.ptr().get(), field_name.c_str(), op));
+  }
+
+  /**
+   * Gets the result of an aggregate after the query completed.
+   *
+   * @tparam T The result type, `uint64_t` for `COUNT` and `NULL_COUNT`.
+   * @param ctx TileDB context.
+   * @param query Query object.
+   * @param field_name The name of the aggregated field.
+   * @param op The aggregate operator.
+   * @return The result and `false` if no non-null value was aggregated.
+   */
+  template <typename T>
+  static std::pair<T, bool> get_aggregate(
+      const Context& ctx,
+      const Query& query,
+      const std::string& field_name,
+      tiledb_query_aggregate_op_t op) {
+    T value{};
+    uint8_t validity = 0;
+    ctx.handle_error(tiledb_query_get_aggregate(
+        ctx.ptr().get(),
+        query.ptr().get(),
+        field_name.c_str(),
+        op,
+        &value,
+        &validity));
+    return {value, validity != 0};
+  }
+
   /**
    * Get the number of relevant fragments from the subarray. Should only be
    * called after size estimation was asked for.
@@ -79,6 +79,8 @@ inline const std::string& filter_option_str(FilterOption filter_option_) {
       return constants::filter_option_webp_input_format;
     case FilterOption::WEBP_LOSSLESS:
       return constants::filter_option_webp_lossless;
+    case FilterOption::ADAPTIVE_DECODE_COST_WEIGHT:
+      return constants::filter_option_adaptive_decode_cost_weight;
     default:
       return constants::empty_str;
   }
@@ -108,6 +110,9 @@ inline Status filter_option_enum(
     *filter_option_ = FilterOption::WEBP_INPUT_FORMAT;
   else if (filter_option_str == constants::filter_option_webp_lossless)
     *filter_option_ = FilterOption::WEBP_LOSSLESS;
+  else if (
+      filter_option_str == constants::filter_option_adaptive_decode_cost_weight)
+    *filter_option_ = FilterOption::ADAPTIVE_DECODE_COST_WEIGHT;
   else
     return Status_Error("Invalid FilterOption " + filter_option_str);
 
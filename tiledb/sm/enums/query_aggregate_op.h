@@ -0,0 +1,105 @@
+/**
+ * @file query_aggregate_op.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This defines the tiledb QueryAggregateOp enum that maps to
+ * tiledb_query_aggregate_op_t C-api enum.
+ */
+
+#ifndef TILEDB_QUERY_AGGREGATE_OP_H
+#define TILEDB_QUERY_AGGREGATE_OP_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/misc/constants.h"
+#include "tiledb/stdx/utility/to_underlying.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** Defines the query aggregate ops. */
+enum class QueryAggregateOp : uint8_t {
+#define TILEDB_QUERY_AGGREGATE_OP_ENUM(id) id
+#include "tiledb/sm/c_api/tiledb_enum.h"
+#undef TILEDB_QUERY_AGGREGATE_OP_ENUM
+};
+
+/** Returns the string representation of the input QueryAggregateOp type. */
+inline const std::string& query_aggregate_op_str(
+    QueryAggregateOp query_aggregate_op) {
+  switch (query_aggregate_op) {
+    case QueryAggregateOp::AGGREGATE_COUNT:
+      return constants::query_aggregate_op_count_str;
+    case QueryAggregateOp::AGGREGATE_SUM:
+      return constants::query_aggregate_op_sum_str;
+    case QueryAggregateOp::AGGREGATE_MIN:
+      return constants::query_aggregate_op_min_str;
+    case QueryAggregateOp::AGGREGATE_MAX:
+      return constants::query_aggregate_op_max_str;
+    case QueryAggregateOp::AGGREGATE_NULL_COUNT:
+      return constants::query_aggregate_op_null_count_str;
+    default:
+      return constants::empty_str;
+  }
+}
+
+/** Returns the query aggregate op given a string representation. */
+inline Status query_aggregate_op_enum(
+    const std::string& query_aggregate_op_str,
+    QueryAggregateOp* query_aggregate_op) {
+  if (query_aggregate_op_str == constants::query_aggregate_op_count_str)
+    *query_aggregate_op = QueryAggregateOp::AGGREGATE_COUNT;
+  else if (query_aggregate_op_str == constants::query_aggregate_op_sum_str)
+    *query_aggregate_op = QueryAggregateOp::AGGREGATE_SUM;
+  else if (query_aggregate_op_str == constants::query_aggregate_op_min_str)
+    *query_aggregate_op = QueryAggregateOp::AGGREGATE_MIN;
+  else if (query_aggregate_op_str == constants::query_aggregate_op_max_str)
+    *query_aggregate_op = QueryAggregateOp::AGGREGATE_MAX;
+  else if (
+      query_aggregate_op_str == constants::query_aggregate_op_null_count_str)
+    *query_aggregate_op = QueryAggregateOp::AGGREGATE_NULL_COUNT;
+  else {
+    return Status_Error("Invalid QueryAggregateOp " + query_aggregate_op_str);
+  }
+  return Status::Ok();
+}
+
+inline void ensure_query_aggregate_op_is_valid(
+    QueryAggregateOp query_aggregate_op) {
+  auto op_enum{::stdx::to_underlying(query_aggregate_op)};
+  if (op_enum > 4) {
+    throw std::runtime_error(
+        "Invalid Query Aggregate Op " + std::to_string(op_enum));
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_AGGREGATE_OP_H
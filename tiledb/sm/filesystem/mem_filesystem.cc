@@ -506,6 +506,24 @@ Status MemFilesystem::read(
   return node->read(offset, buffer, nbytes);
 }
 
+Status MemFilesystem::read_batch(
+    const std::string& path, const std::vector<ReadRange>& ranges) const {
+  FSNode* node;
+  std::unique_lock<std::mutex> node_lock;
+  RETURN_NOT_OK(lookup_node(path, &node, &node_lock));
+
+  if (node == nullptr) {
+    return LOG_STATUS(Status_MemFSError(
+        std::string("File not found, read failed for : " + path)));
+  }
+
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(node->read(range.offset_, range.buffer_, range.nbytes_));
+  }
+
+  return Status::Ok();
+}
+
 Status MemFilesystem::remove(const std::string& path, const bool is_dir) const {
   std::vector<std::string> tokens = tokenize(path);
 
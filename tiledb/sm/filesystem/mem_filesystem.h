@@ -39,6 +39,7 @@
 
 #include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
+#include "tiledb/sm/filesystem/read_range.h"
 
 using namespace tiledb::common;
 
@@ -162,6 +163,16 @@ class MemFilesystem {
       void* buffer,
       const uint64_t nbytes) const;
 
+  /**
+   * Reads multiple ranges of a file, looking up the file only once.
+   *
+   * @param path The full name of the file
+   * @param ranges The ranges to read
+   * @return Status.
+   */
+  Status read_batch(
+      const std::string& path, const std::vector<ReadRange>& ranges) const;
+
   /**
    * Removes a given path and its contents.
    *
@@ -45,12 +45,19 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#ifdef HAVE_IO_URING
+#include <liburing.h>
+#endif
+
+#include <algorithm>
 #include <fstream>
 #include <future>
 #include <iostream>
+#include <limits>
 #include <queue>
 #include <sstream>
 
@@ -62,7 +69,9 @@ namespace sm {
 
 Posix::Posix()
     : default_config_(Config())
-    , config_(default_config_) {
+    , config_(default_config_)
+    , use_io_uring_(false)
+    , use_mmap_(false) {
 }
 
 bool Posix::both_slashes(char a, char b) {
@@ -90,6 +99,241 @@ Status Posix::read_all(int fd, void* buffer, uint64_t nbytes, uint64_t offset) {
   return Status::Ok();
 }
 
+Status Posix::read_all_vectored(
+    int fd, std::vector<struct iovec>& iov, uint64_t offset) {
+  size_t first = 0;
+  while (first < iov.size()) {
+#if defined(__linux__)
+    const int iovcnt =
+        static_cast<int>(std::min<size_t>(iov.size() - first, IOV_MAX));
+    ssize_t actual_read = ::preadv(fd, &iov[first], iovcnt, offset);
+#else
+    // Fall back to one read per buffer where `preadv` may not be available.
+    ssize_t actual_read =
+        ::pread(fd, iov[first].iov_base, iov[first].iov_len, offset);
+#endif
+    if (actual_read < 0) {
+      return LOG_STATUS(
+          Status_IOError(std::string("POSIX read error: ") + strerror(errno)));
+    } else if (actual_read == 0) {
+      return LOG_STATUS(Status_IOError("POSIX incomplete read: EOF reached"));
+    }
+    offset += actual_read;
+
+    // Skip the buffers that were filled and advance into a partial one.
+    uint64_t remaining = actual_read;
+    while (first < iov.size() && remaining >= iov[first].iov_len) {
+      remaining -= iov[first].iov_len;
+      first++;
+    }
+    if (remaining > 0) {
+      iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + remaining;
+      iov[first].iov_len -= remaining;
+    }
+  }
+
+  return Status::Ok();
+}
+
+#ifdef HAVE_IO_URING
+namespace {
+
+/**
+ * An io_uring owned by a thread. It is created on the first batched read of
+ * the thread and reused by the following ones until the thread exits.
+ */
+class ThreadRing {
+ public:
+  /** Destructor. */
+  ~ThreadRing() {
+    reset();
+  }
+
+  /**
+   * Returns the ring of the thread, creating it if needed.
+   *
+   * @param ring Set to the ring.
+   * @return Status
+   */
+  Status get(struct io_uring** ring) {
+    if (!initialized_) {
+      int ret =
+          io_uring_queue_init(constants::io_uring_queue_depth, &ring_, 0);
+      if (ret < 0) {
+        return LOG_STATUS(Status_IOError(
+            std::string("Cannot initialize io_uring; ") + strerror(-ret)));
+      }
+      initialized_ = true;
+    }
+
+    *ring = &ring_;
+    return Status::Ok();
+  }
+
+  /** Destroys the ring, dropping the entries that were not submitted. */
+  void reset() {
+    if (initialized_) {
+      io_uring_queue_exit(&ring_);
+      initialized_ = false;
+    }
+  }
+
+ private:
+  /** The ring. */
+  struct io_uring ring_;
+
+  /** Whether the ring was created. */
+  bool initialized_ = false;
+};
+
+/** The io_uring of the calling thread. */
+thread_local ThreadRing thread_ring;
+
+}  // namespace
+
+Status Posix::read_runs_io_uring(int fd, std::vector<ReadRun>& runs) {
+  struct io_uring* ring = nullptr;
+  RETURN_NOT_OK(thread_ring.get(&ring));
+  const unsigned depth = static_cast<unsigned>(
+      std::min<size_t>(runs.size(), constants::io_uring_queue_depth));
+
+  // Keep the submission queue full until all the runs are submitted. After
+  // an error, no new run is submitted and the loop stops.
+  Status st = Status::Ok();
+  std::vector<uint8_t> completed(runs.size(), 0);
+  size_t next = 0;
+  unsigned pending = 0;
+  unsigned in_flight = 0;
+  int ret = 0;
+  while (st.ok() && (next < runs.size() || in_flight > 0)) {
+    struct io_uring_sqe* sqe = nullptr;
+    while (next < runs.size() && in_flight + pending < depth &&
+           (sqe = io_uring_get_sqe(ring)) != nullptr) {
+      auto& run = runs[next++];
+      io_uring_prep_readv(
+          sqe,
+          fd,
+          run.iov_.data(),
+          static_cast<unsigned>(std::min<size_t>(run.iov_.size(), IOV_MAX)),
+          run.offset_);
+      io_uring_sqe_set_data(sqe, &run);
+      pending++;
+    }
+
+    if (pending > 0) {
+      ret = io_uring_submit(ring);
+      if (ret < 0) {
+        st = LOG_STATUS(Status_IOError(
+            std::string("io_uring submission error: ") + strerror(-ret)));
+        break;
+      }
+      pending -= static_cast<unsigned>(ret);
+      in_flight += static_cast<unsigned>(ret);
+    }
+
+    if (in_flight == 0) {
+      st = LOG_STATUS(
+          Status_IOError("io_uring submission error: No entry submitted"));
+      break;
+    }
+
+    struct io_uring_cqe* cqe = nullptr;
+    ret = io_uring_wait_cqe(ring, &cqe);
+    if (ret == -EINTR) {
+      continue;
+    } else if (ret < 0) {
+      st = LOG_STATUS(Status_IOError(
+          std::string("io_uring completion error: ") + strerror(-ret)));
+      break;
+    }
+    auto run = static_cast<ReadRun*>(io_uring_cqe_get_data(cqe));
+    const int res = cqe->res;
+    io_uring_cqe_seen(ring, cqe);
+    in_flight--;
+    completed[run - runs.data()] = 1;
+
+    if (res < 0) {
+      st = LOG_STATUS(
+          Status_IOError(std::string("POSIX read error: ") + strerror(-res)));
+      break;
+    }
+
+    // Finish short reads synchronously, from where the kernel stopped.
+    uint64_t remaining = static_cast<uint64_t>(res);
+    auto first = run->iov_.begin();
+    while (first != run->iov_.end() && remaining >= first->iov_len) {
+      remaining -= first->iov_len;
+      first++;
+    }
+    if (first != run->iov_.end()) {
+      first->iov_base = static_cast<char*>(first->iov_base) + remaining;
+      first->iov_len -= remaining;
+      run->iov_.erase(run->iov_.begin(), first);
+      st = read_all_vectored(fd, run->iov_, run->offset_ + res);
+    }
+  }
+
+  if (st.ok()) {
+    return st;
+  }
+
+  // The kernel writes into the buffers of the reads in flight until they
+  // complete, and the caller frees them on error. Cancel the reads, then
+  // wait for all of them to complete before returning.
+  unsigned cancels = 0;
+  for (size_t r = 0; r < next - pending; r++) {
+    if (completed[r]) {
+      continue;
+    }
+
+    struct io_uring_sqe* sqe = io_uring_get_sqe(ring);
+    if (sqe == nullptr) {
+      // Cancelling is best effort, the reads are waited for below anyway.
+      break;
+    }
+    io_uring_prep_cancel(sqe, &runs[r], 0);
+    io_uring_sqe_set_data(sqe, nullptr);
+    cancels++;
+  }
+
+  // The reads prepared but not submitted yet go first in the queue.
+  ret = cancels > 0 ? io_uring_submit(ring) : 0;
+  if (ret > 0) {
+    const unsigned submitted = static_cast<unsigned>(ret);
+    in_flight += std::min(submitted, pending);
+    cancels = submitted - std::min(submitted, pending);
+  } else {
+    cancels = 0;
+  }
+
+  unsigned outstanding = in_flight + cancels;
+  while (outstanding > 0) {
+    struct io_uring_cqe* cqe = nullptr;
+    ret = io_uring_wait_cqe(ring, &cqe);
+    if (ret == -EINTR || ret == -EAGAIN) {
+      continue;
+    } else if (ret < 0) {
+      LOG_STATUS_NO_RETURN_VALUE(Status_IOError(
+          std::string("Cannot wait for io_uring reads in flight; ") +
+          strerror(-ret)));
+      break;
+    }
+    io_uring_cqe_seen(ring, cqe);
+    outstanding--;
+  }
+
+  // Drop the entries that were never submitted, they reference the caller's
+  // buffers. The next batched read of the thread gets a new ring.
+  thread_ring.reset();
+  return st;
+}
+#else
+Status Posix::read_runs_io_uring(int, std::vector<ReadRun>&) {
+  return LOG_STATUS(
+      Status_VFSError("TileDB was built without io_uring support"));
+}
+#endif
+
 void Posix::adjacent_slashes_dedup(std::string* path) {
   assert(utils::parse::starts_with(*path, "file://"));
   path->erase(
@@ -248,6 +492,21 @@ Status Posix::init(const Config& config, ThreadPool* vfs_thread_pool) {
   config_ = config;
   vfs_thread_pool_ = vfs_thread_pool;
 
+  bool found = false;
+  RETURN_NOT_OK(
+      config.get<bool>("vfs.file.use_io_uring", &use_io_uring_, &found));
+  assert(found);
+  RETURN_NOT_OK(config.get<bool>("vfs.file.use_mmap", &use_mmap_, &found));
+  assert(found);
+#ifndef HAVE_IO_URING
+  if (use_io_uring_) {
+    LOG_WARN(
+        "TileDB was built without io_uring support, ignoring "
+        "'vfs.file.use_io_uring'; Batched reads use preadv instead");
+    use_io_uring_ = false;
+  }
+#endif
+
   return Status::Ok();
 }
 
@@ -452,6 +711,190 @@ Status Posix::read(
   return st;
 }
 
+Status Posix::read_batch(
+    const std::string& path,
+    const std::vector<ReadRange>& ranges,
+    const uint64_t max_gap,
+    uint64_t* num_reads) const {
+  *num_reads = 0;
+  if (ranges.empty()) {
+    return Status::Ok();
+  }
+
+  // Open file
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return LOG_STATUS(Status_IOError(
+        std::string("Cannot read from file; ") + strerror(errno)));
+  }
+
+  auto st = [&]() {
+    // Checks
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0) {
+      return LOG_STATUS(Status_IOError(
+          std::string("Cannot read from file; ") + strerror(errno)));
+    }
+    if (ranges.back().end() > static_cast<uint64_t>(file_stat.st_size)) {
+      return LOG_STATUS(
+          Status_IOError("Cannot read from file; Read exceeds file size"));
+    }
+    if (ranges.back().offset_ >
+        static_cast<uint64_t>(std::numeric_limits<off_t>::max())) {
+      return LOG_STATUS(Status_IOError(
+          std::string("Cannot read from file ' ") + path.c_str() +
+          "'; offset > typemax(off_t)"));
+    }
+
+    // The bytes between two ranges of a run are all read into the same
+    // scratch buffer, as they are not used.
+    uint64_t scratch_size = 0;
+    for (size_t i = 1; i < ranges.size(); i++) {
+      const uint64_t gap = ranges[i].offset_ - ranges[i - 1].end();
+      if (gap <= max_gap) {
+        scratch_size = std::max(scratch_size, gap);
+      }
+    }
+    std::vector<char> scratch(scratch_size);
+
+    std::vector<ReadRun> runs;
+    size_t run_start = 0;
+    while (run_start < ranges.size()) {
+      auto& run = runs.emplace_back();
+      run.offset_ = ranges[run_start].offset_;
+      uint64_t run_bytes = 0;
+      size_t i = run_start;
+      do {
+        if (i > run_start) {
+          const uint64_t gap = ranges[i].offset_ - ranges[i - 1].end();
+          if (gap > 0) {
+            run.iov_.push_back({scratch.data(), gap});
+            run_bytes += gap;
+          }
+        }
+        run.iov_.push_back({ranges[i].buffer_, ranges[i].nbytes_});
+        run_bytes += ranges[i].nbytes_;
+        i++;
+      } while (i < ranges.size() &&
+               ranges[i].offset_ - ranges[i - 1].end() <= max_gap &&
+               run_bytes + ranges[i].end() - ranges[i - 1].end() <= SSIZE_MAX);
+      run_start = i;
+    }
+    *num_reads = runs.size();
+
+    if (use_io_uring_) {
+      return read_runs_io_uring(fd, runs);
+    }
+
+    for (auto& run : runs) {
+      RETURN_NOT_OK(read_all_vectored(fd, run.iov_, run.offset_));
+    }
+
+    return Status::Ok();
+  }();
+
+  // Close file
+  if (close(fd)) {
+    LOG_STATUS_NO_RETURN_VALUE(
+        Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+  }
+  return st;
+}
+
+Status Posix::map(
+    const std::string& path,
+    const uint64_t offset,
+    const uint64_t nbytes,
+    shared_ptr<char>* data) const {
+  std::vector<shared_ptr<char>> mapped;
+  RETURN_NOT_OK(map_batch(path, {{offset, nbytes}}, &mapped));
+  *data = std::move(mapped[0]);
+  return Status::Ok();
+}
+
+Status Posix::map_batch(
+    const std::string& path,
+    const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+    std::vector<shared_ptr<char>>* data) const {
+  // Compute the span of all the ranges
+  uint64_t start = std::numeric_limits<uint64_t>::max();
+  uint64_t end = 0;
+  for (const auto& [offset, nbytes] : ranges) {
+    if (nbytes == 0) {
+      return LOG_STATUS(
+          Status_IOError("Cannot map file '" + path + "'; Empty range"));
+    }
+    start = std::min(start, offset);
+    end = std::max(end, offset + nbytes);
+  }
+  if (ranges.empty()) {
+    return LOG_STATUS(
+        Status_IOError("Cannot map file '" + path + "'; No ranges"));
+  }
+
+  // Open file
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return LOG_STATUS(
+        Status_IOError(std::string("Cannot map file; ") + strerror(errno)));
+  }
+
+  // Checks
+  struct stat file_stat;
+  Status st = Status::Ok();
+  if (fstat(fd, &file_stat) != 0) {
+    st = LOG_STATUS(
+        Status_IOError(std::string("Cannot map file; ") + strerror(errno)));
+  } else if (end > static_cast<uint64_t>(file_stat.st_size)) {
+    st = LOG_STATUS(Status_IOError("Cannot map file; Map exceeds file size"));
+  }
+
+  // The mapping must start at a page boundary.
+  const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  const uint64_t map_offset = start - start % page_size;
+  const uint64_t map_size = end - map_offset;
+  void* addr = MAP_FAILED;
+  if (st.ok()) {
+    addr = ::mmap(
+        nullptr,
+        map_size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE,
+        fd,
+        static_cast<off_t>(map_offset));
+    if (addr == MAP_FAILED) {
+      st = LOG_STATUS(
+          Status_IOError(std::string("Cannot map file; ") + strerror(errno)));
+    }
+  }
+
+  // Close file, the mapping stays valid
+  if (close(fd)) {
+    LOG_STATUS_NO_RETURN_VALUE(
+        Status_IOError(std::string("Cannot close file; ") + strerror(errno)));
+  }
+  RETURN_NOT_OK(st);
+
+  shared_ptr<char> mapping(
+      static_cast<char*>(addr),
+      [addr, map_size](char*) { munmap(addr, map_size); });
+
+  // Start reading the pages of the ranges in the background, they are all
+  // used. The pages in between the ranges are left alone.
+  data->clear();
+  data->reserve(ranges.size());
+  for (const auto& [offset, nbytes] : ranges) {
+    const uint64_t advise_offset = offset - offset % page_size;
+    posix_madvise(
+        mapping.get() + (advise_offset - map_offset),
+        nbytes + (offset - advise_offset),
+        POSIX_MADV_WILLNEED);
+    data->emplace_back(mapping, mapping.get() + (offset - map_offset));
+  }
+
+  return Status::Ok();
+}
+
 Status Posix::sync(const std::string& path) {
   uint32_t permissions = 0;
 
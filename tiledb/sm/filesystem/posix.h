@@ -37,6 +37,7 @@
 
 #include <ftw.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #include <functional>
 #include <string>
@@ -45,6 +46,7 @@
 #include "tiledb/common/status.h"
 #include "tiledb/common/thread_pool.h"
 #include "tiledb/sm/config/config.h"
+#include "tiledb/sm/filesystem/read_range.h"
 
 using namespace tiledb::common;
 
@@ -136,6 +138,22 @@ class Posix {
    */
   Status init(const Config& config, ThreadPool* vfs_thread_pool);
 
+  /**
+   * Returns `true` if batched reads are submitted through io_uring, as set by
+   * `vfs.file.use_io_uring`.
+   */
+  inline bool use_io_uring() const {
+    return use_io_uring_;
+  }
+
+  /**
+   * Returns `true` if tile data is read by memory-mapping files, as set by
+   * `vfs.file.use_mmap`.
+   */
+  inline bool use_mmap() const {
+    return use_mmap_;
+  }
+
   /**
    * Checks if the input is an existing directory.
    *
@@ -214,6 +232,58 @@ class Posix {
       void* buffer,
       uint64_t nbytes) const;
 
+  /**
+   * Reads multiple ranges of a file. The file is opened and its size checked
+   * once for the whole batch. Runs of ranges separated by at most `max_gap`
+   * bytes are read with a single vectored read, the gaps being read into a
+   * scratch buffer and discarded. If io_uring is enabled, the vectored reads
+   * of all the runs are submitted at once and completed asynchronously.
+   *
+   * @param path The name of the file.
+   * @param ranges The ranges to read, sorted by offset and not overlapping.
+   * @param max_gap The maximum gap between two ranges read together.
+   * @param num_reads Set to the number of vectored reads issued.
+   * @return Status.
+   */
+  Status read_batch(
+      const std::string& path,
+      const std::vector<ReadRange>& ranges,
+      uint64_t max_gap,
+      uint64_t* num_reads) const;
+
+  /**
+   * Maps a range of a file in memory. The mapping is private: writes through
+   * it are never carried to the file.
+   *
+   * @param path The name of the file.
+   * @param offset The offset where the range begins.
+   * @param nbytes The size of the range.
+   * @param data Set to the start of the range in memory. The mapping is
+   *     released when the last copy of the pointer is destroyed.
+   * @return Status.
+   */
+  Status map(
+      const std::string& path,
+      uint64_t offset,
+      uint64_t nbytes,
+      shared_ptr<char>* data) const;
+
+  /**
+   * Maps multiple ranges of a file in memory with a single mapping spanning
+   * all of them. Only the pages of the ranges are read ahead. The mapping is
+   * private: writes through it are never carried to the file.
+   *
+   * @param path The name of the file.
+   * @param ranges The (offset, size) ranges to map.
+   * @param data Set to the start of each range in memory. The mapping is
+   *     released when the last copy of any of the pointers is destroyed.
+   * @return Status.
+   */
+  Status map_batch(
+      const std::string& path,
+      const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+      std::vector<shared_ptr<char>>* data) const;
+
   /**
    * Syncs a file or directory.
    *
@@ -237,6 +307,15 @@ class Posix {
       const std::string& path, const void* buffer, uint64_t buffer_size);
 
  private:
+  /** A run of ranges of a file that is read with a single vectored read. */
+  struct ReadRun {
+    /** The file offset of the first range of the run. */
+    uint64_t offset_;
+
+    /** The range buffers, interleaved with the scratch buffer for gaps. */
+    std::vector<struct iovec> iov_;
+  };
+
   /** Default config. */
   Config default_config_;
 
@@ -246,6 +325,12 @@ class Posix {
   /** Thread pool from parent VFS instance. */
   ThreadPool* vfs_thread_pool_;
 
+  /** Whether batched reads are submitted through io_uring. */
+  bool use_io_uring_;
+
+  /** Whether tile data is read by memory-mapping files. */
+  bool use_mmap_;
+
   static void adjacent_slashes_dedup(std::string* path);
 
   static bool both_slashes(char a, char b);
@@ -278,6 +363,31 @@ class Posix {
   static Status read_all(
       int fd, void* buffer, uint64_t nbytes, uint64_t offset);
 
+  /**
+   * Reads into all the given buffers from the file descriptor, starting at
+   * the given offset and retrying as necessary.
+   *
+   * @param fd Open file descriptor to read from
+   * @param iov The buffers to fill in order. This is modified as data is read.
+   * @param offset Offset in file to start reading from.
+   * @return Status
+   */
+  static Status read_all_vectored(
+      int fd, std::vector<struct iovec>& iov, uint64_t offset);
+
+  /**
+   * Reads the given runs from the file descriptor, submitting all of them
+   * through the io_uring of the calling thread at once, up to the queue
+   * depth, and completing them as they finish. Short reads are completed
+   * synchronously. On error, the reads in flight are cancelled and waited
+   * for before returning.
+   *
+   * @param fd Open file descriptor to read from
+   * @param runs The runs to read. Their buffers may be modified.
+   * @return Status
+   */
+  static Status read_runs_io_uring(int fd, std::vector<ReadRun>& runs);
+
   static int unlink_cb(
       const char* fpath,
       const struct stat* sb,
@@ -0,0 +1,64 @@
+/**
+ * @file   read_range.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines struct ReadRange.
+ */
+
+#ifndef TILEDB_READ_RANGE_H
+#define TILEDB_READ_RANGE_H
+
+#include <cstdint>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A byte range of a file to read, along with the buffer receiving the data.
+ * Used by the batched read APIs of the VFS and its backends.
+ */
+struct ReadRange {
+  /** The offset in the file where the read begins. */
+  uint64_t offset_;
+
+  /** The buffer to read into, of at least `nbytes_` bytes. */
+  void* buffer_;
+
+  /** The number of bytes to read. */
+  uint64_t nbytes_;
+
+  /** Returns the offset in the file right after the range. */
+  inline uint64_t end() const {
+    return offset_ + nbytes_;
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_READ_RANGE_H
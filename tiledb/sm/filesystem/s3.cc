@@ -801,7 +801,10 @@ Status S3::ls(
 }
 
 tuple<Status, optional<std::vector<directory_entry>>> S3::ls_with_sizes(
-    const URI& prefix, const std::string& delimiter, int max_paths) const {
+    const URI& prefix,
+    const std::string& delimiter,
+    int max_paths,
+    const URI& start_after) const {
   RETURN_NOT_OK_TUPLE(init_client(), nullopt);
 
   const auto prefix_dir = prefix.add_trailing_slash();
@@ -822,6 +825,12 @@ tuple<Status, optional<std::vector<directory_entry>>> S3::ls_with_sizes(
   list_objects_request.SetDelimiter(delimiter.c_str());
   if (request_payer_ != Aws::S3::Model::RequestPayer::NOT_SET)
     list_objects_request.SetRequestPayer(request_payer_);
+  if (!start_after.is_invalid()) {
+    // The marker makes S3 return only the keys that sort after it.
+    Aws::Http::URI aws_start_after = start_after.c_str();
+    list_objects_request.SetMarker(
+        remove_front_slash(aws_start_after.GetPath().c_str()).c_str());
+  }
 
   std::vector<directory_entry> entries;
 
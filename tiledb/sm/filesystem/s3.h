@@ -242,13 +242,16 @@ class S3 {
    * @param prefix The parent path to list sub-paths.
    * @param delimiter The uri is truncated to the first delimiter
    * @param max_paths The maximum number of paths to be retrieved
+   * @param start_after If not empty, only the objects whose key sorts after
+   *     this URI are listed. S3 skips the preceding keys server side.
    * @return A list of directory_entry objects
    */
   tuple<Status, optional<std::vector<filesystem::directory_entry>>>
   ls_with_sizes(
       const URI& prefix,
       const std::string& delimiter = "/",
-      int max_paths = -1) const;
+      int max_paths = -1,
+      const URI& start_after = URI()) const;
 
   /**
    * Renames an object.
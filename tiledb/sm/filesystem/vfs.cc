@@ -43,6 +43,8 @@
 #include "tiledb/sm/stats/global_stats.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <list>
 #include <sstream>
@@ -735,6 +737,46 @@ Status VFS::ls(const URI& parent, std::vector<URI>* uris) const {
   return Status::Ok();
 }
 
+Status VFS::ls_after(
+    const URI& parent,
+    const URI& start_after,
+    std::vector<URI>* uris) const {
+  stats_->add_counter("ls_num", 1);
+
+  optional<std::vector<directory_entry>> entries;
+  if (parent.is_s3()) {
+#ifdef HAVE_S3
+    Status st;
+    std::tie(st, entries) = s3_.ls_with_sizes(parent, "/", -1, start_after);
+    RETURN_NOT_OK(st);
+    parallel_sort(
+        compute_tp_,
+        entries->begin(),
+        entries->end(),
+        [](const directory_entry& l, const directory_entry& r) {
+          return l.path().native() < r.path().native();
+        });
+#else
+    return LOG_STATUS(Status_VFSError("TileDB was built without S3 support"));
+#endif
+  } else {
+    Status st;
+    std::tie(st, entries) = ls_with_sizes(parent);
+    RETURN_NOT_OK(st);
+  }
+
+  // The marker of the S3 listing may still let through a common prefix equal
+  // to `start_after`, so the filtering is applied for all backends.
+  for (auto& fs : *entries) {
+    URI uri(fs.path().native());
+    if (uri.to_string() > start_after.to_string()) {
+      uris->emplace_back(std::move(uri));
+    }
+  }
+
+  return Status::Ok();
+}
+
 tuple<Status, optional<std::vector<directory_entry>>> VFS::ls_with_sizes(
     const URI& parent) const {
   // Noop if `parent` is not a directory, do not error out.
@@ -1199,6 +1241,260 @@ Status VFS::read(
   }
 }
 
+Status VFS::read_batch(const URI& uri, std::vector<ReadRange> ranges) {
+  if (ranges.empty()) {
+    return Status::Ok();
+  }
+
+  // Sort the ranges by offset and make sure they do not overlap, as the
+  // backends may read the gaps and the ranges of a batch in a single
+  // operation.
+  std::sort(
+      ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+        return a.offset_ < b.offset_;
+      });
+  uint64_t nbytes = ranges[0].nbytes_;
+  for (uint64_t i = 1; i < ranges.size(); i++) {
+    if (ranges[i].offset_ < ranges[i - 1].end()) {
+      return LOG_STATUS(Status_VFSError(
+          "Cannot read batch from '" + uri.to_string() +
+          "'; Ranges must not overlap"));
+    }
+    nbytes += ranges[i].nbytes_;
+  }
+  stats_->add_counter("read_byte_num", nbytes);
+  stats_->add_counter("read_batch_num", 1);
+  stats_->add_counter("read_batch_range_num", ranges.size());
+
+  // Get config params
+  uint64_t min_parallel_size = vfs_params_.min_parallel_size_;
+  uint64_t max_ops = 0;
+  RETURN_NOT_OK(max_parallel_ops(uri, &max_ops));
+
+  // The local backends serve the nearby ranges of a batch with a single
+  // operation. The other backends serve a single byte range per request, so
+  // runs of nearby ranges are coalesced in one read into a scratch buffer,
+  // and scattered in the range buffers once read.
+  const bool coalesce = !uri.is_file() && !uri.is_memfs();
+  std::vector<ReadRange> reads;
+  std::vector<std::pair<uint64_t, uint64_t>> runs;
+  std::vector<std::vector<char>> scratch;
+  if (coalesce) {
+    uint64_t run_start = 0;
+    while (run_start < ranges.size()) {
+      const uint64_t run_end = coalesced_run_end(ranges, run_start);
+      if (run_end - run_start == 1) {
+        reads.push_back(ranges[run_start]);
+      } else {
+        const uint64_t offset = ranges[run_start].offset_;
+        const uint64_t span = ranges[run_end - 1].end() - offset;
+        auto& run_scratch = scratch.emplace_back(span);
+        runs.emplace_back(run_start, run_end);
+        reads.push_back({offset, run_scratch.data(), span});
+      }
+      run_start = run_end;
+    }
+  } else {
+    reads = ranges;
+  }
+
+  // Split the reads larger than min_parallel_size in up to max_ops reads, the
+  // same way `read` does.
+  std::vector<ReadRange> split_reads;
+  uint64_t read_nbytes = 0;
+  for (const auto& read : reads) {
+    const uint64_t num_ops = std::min(
+        std::max(read.nbytes_ / min_parallel_size, uint64_t(1)), max_ops);
+    const uint64_t op_nbytes = utils::math::ceil(read.nbytes_, num_ops);
+    for (uint64_t begin = 0; begin < read.nbytes_; begin += op_nbytes) {
+      split_reads.push_back(
+          {read.offset_ + begin,
+           static_cast<char*>(read.buffer_) + begin,
+           std::min(op_nbytes, read.nbytes_ - begin)});
+    }
+    read_nbytes += read.nbytes_;
+  }
+
+  // Cap the number of tasks at the configured maximum number of parallel
+  // operations. Each request of the remote backends gets its own task,
+  // while the local ones make sure that each task is responsible for at
+  // least min_parallel_size bytes.
+  uint64_t num_tasks = std::min<uint64_t>(max_ops, split_reads.size());
+  if (!coalesce) {
+    num_tasks = std::min(
+        num_tasks, std::max(read_nbytes / min_parallel_size, uint64_t(1)));
+  }
+
+#ifndef _WIN32
+  // With io_uring, a single thread submits all the reads of the batch.
+  if (uri.is_file() && posix_.use_io_uring()) {
+    num_tasks = 1;
+  }
+#endif
+
+  if (num_tasks <= 1) {
+    RETURN_NOT_OK(read_batch_impl(uri, split_reads));
+  } else {
+    // Split the reads in contiguous slices of roughly equal byte sizes.
+    std::vector<std::vector<ReadRange>> slices(1);
+    const uint64_t slice_nbytes = utils::math::ceil(read_nbytes, num_tasks);
+    uint64_t cur_nbytes = 0;
+    for (const auto& read : split_reads) {
+      if (cur_nbytes >= slice_nbytes) {
+        slices.emplace_back();
+        cur_nbytes = 0;
+      }
+      slices.back().push_back(read);
+      cur_nbytes += read.nbytes_;
+    }
+
+    std::vector<ThreadPool::Task> results;
+    results.reserve(slices.size());
+    for (auto& slice : slices) {
+      auto task = cancelable_tasks_.execute(io_tp_, [this, &uri, &slice]() {
+        return read_batch_impl(uri, slice);
+      });
+      results.push_back(std::move(task));
+    }
+    Status st = io_tp_->wait_all(results);
+    if (!st.ok()) {
+      std::stringstream errmsg;
+      errmsg << "VFS parallel batch read error '" << uri.to_string() << "'; "
+             << st.message();
+      return LOG_STATUS(Status_VFSError(errmsg.str()));
+    }
+  }
+
+  // Scatter the coalesced runs in the range buffers.
+  for (uint64_t r = 0; r < runs.size(); r++) {
+    const auto [run_start, run_end] = runs[r];
+    const uint64_t offset = ranges[run_start].offset_;
+    for (uint64_t i = run_start; i < run_end; i++) {
+      std::memcpy(
+          ranges[i].buffer_,
+          scratch[r].data() + (ranges[i].offset_ - offset),
+          ranges[i].nbytes_);
+    }
+  }
+
+  return Status::Ok();
+}
+
+bool VFS::use_mmap(const URI& uri) const {
+#ifdef _WIN32
+  (void)uri;
+  return false;
+#else
+  return uri.is_file() && posix_.use_mmap();
+#endif
+}
+
+Status VFS::map(
+    const URI& uri,
+    const uint64_t offset,
+    const uint64_t nbytes,
+    shared_ptr<char>* data) {
+  stats_->add_counter("map_byte_num", nbytes);
+  stats_->add_counter("map_ops_num", 1);
+
+  if (!uri.is_file()) {
+    return LOG_STATUS(Status_VFSError(
+        "Cannot map '" + uri.to_string() +
+        "'; Only local files can be mapped"));
+  }
+#ifdef _WIN32
+  (void)offset;
+  (void)data;
+  return LOG_STATUS(Status_VFSError(
+      "Cannot map '" + uri.to_string() +
+      "'; Mapping files is not supported on Windows"));
+#else
+  return posix_.map(uri.to_path(), offset, nbytes, data);
+#endif
+}
+
+Status VFS::map_batch(
+    const URI& uri,
+    const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+    std::vector<shared_ptr<char>>* data) {
+  for (const auto& range : ranges) {
+    stats_->add_counter("map_byte_num", range.second);
+  }
+  stats_->add_counter("map_ops_num", 1);
+
+  if (!uri.is_file()) {
+    return LOG_STATUS(Status_VFSError(
+        "Cannot map '" + uri.to_string() +
+        "'; Only local files can be mapped"));
+  }
+#ifdef _WIN32
+  (void)ranges;
+  (void)data;
+  return LOG_STATUS(Status_VFSError(
+      "Cannot map '" + uri.to_string() +
+      "'; Mapping files is not supported on Windows"));
+#else
+  return posix_.map_batch(uri.to_path(), ranges, data);
+#endif
+}
+
+Status VFS::read_batch_impl(
+    const URI& uri, const std::vector<ReadRange>& ranges) {
+  if (uri.is_file()) {
+#ifdef _WIN32
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(
+          read_impl(uri, range.offset_, range.buffer_, range.nbytes_, false));
+    }
+    stats_->add_counter("read_batch_ops_num", ranges.size());
+    return Status::Ok();
+#else
+    uint64_t num_reads = 0;
+    RETURN_NOT_OK(posix_.read_batch(
+        uri.to_path(), ranges, vfs_params_.min_batch_gap_, &num_reads));
+    stats_->add_counter("read_ops_num", num_reads);
+    stats_->add_counter("read_batch_ops_num", num_reads);
+    return Status::Ok();
+#endif
+  }
+  if (uri.is_memfs()) {
+    stats_->add_counter("read_ops_num", 1);
+    stats_->add_counter("read_batch_ops_num", 1);
+    return memfs_.read_batch(uri.to_path(), ranges);
+  }
+
+  // The remaining backends serve a single byte range per request, the
+  // ranges were already coalesced by `read_batch`.
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(
+        read_impl(uri, range.offset_, range.buffer_, range.nbytes_, false));
+  }
+  stats_->add_counter("read_batch_ops_num", ranges.size());
+
+  return Status::Ok();
+}
+
+uint64_t VFS::coalesced_run_end(
+    const std::vector<ReadRange>& ranges, const uint64_t run_start) const {
+  // A range joins the run if the run stays below the maximum batch size, and
+  // either the run is still below the minimum batch size or the gap before
+  // the range is small enough.
+  const uint64_t offset = ranges[run_start].offset_;
+  uint64_t run_end = run_start + 1;
+  while (run_end < ranges.size()) {
+    const uint64_t span = ranges[run_end].end() - offset;
+    const uint64_t gap = ranges[run_end].offset_ - ranges[run_end - 1].end();
+    if (span > vfs_params_.max_batch_size_ ||
+        (span > vfs_params_.min_batch_size_ &&
+         gap > vfs_params_.min_batch_gap_)) {
+      break;
+    }
+    run_end++;
+  }
+
+  return run_end;
+}
+
 Status VFS::read_impl(
     const URI& uri,
     const uint64_t offset,
@@ -47,6 +47,7 @@
 #include "tiledb/sm/cache/lru_cache.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/mem_filesystem.h"
+#include "tiledb/sm/filesystem/read_range.h"
 #include "tiledb/sm/misc/cancelable_tasks.h"
 #include "tiledb/sm/stats/stats.h"
 #include "uri.h"
@@ -87,7 +88,10 @@ struct VFSParameters {
   VFSParameters() = delete;
 
   VFSParameters(const Config& config)
-      : min_parallel_size_(
+      : max_batch_size_(config.get<uint64_t>("vfs.max_batch_size").value())
+      , min_batch_gap_(config.get<uint64_t>("vfs.min_batch_gap").value())
+      , min_batch_size_(config.get<uint64_t>("vfs.min_batch_size").value())
+      , min_parallel_size_(
             config.get<uint64_t>("vfs.min_parallel_size").value())
       , read_ahead_cache_size_(
             config.get<uint64_t>("vfs.read_ahead_cache_size").value())
@@ -95,6 +99,18 @@ struct VFSParameters {
 
   ~VFSParameters() = default;
 
+  /** The maximum number of bytes in a coalesced batched read operation. */
+  uint64_t max_batch_size_;
+
+  /** The maximum gap in bytes between two ranges coalesced in one read. */
+  uint64_t min_batch_gap_;
+
+  /**
+   * The number of bytes below which a coalesced read takes the next range
+   * regardless of the gap.
+   */
+  uint64_t min_batch_size_;
+
   /** The minimum number of bytes in a parallel operation. */
   uint64_t min_parallel_size_;
 
@@ -349,6 +365,23 @@ class VFS {
   tuple<Status, optional<std::vector<filesystem::directory_entry>>>
   ls_with_sizes(const URI& parent) const;
 
+  /**
+   * Retrieves the URIs that have the first input as parent and sort after
+   * `start_after`, in sorted order. This is used to refresh a previous
+   * listing of `parent` whose last URI is `start_after`. S3 skips the
+   * preceding entries server side; the other backends list `parent` fully
+   * and filter the result.
+   *
+   * @param parent The target directory to list.
+   * @param start_after The URI after which entries are listed.
+   * @param uris The URIs that are contained in the parent after `start_after`.
+   * @return Status
+   */
+  Status ls_after(
+      const URI& parent,
+      const URI& start_after,
+      std::vector<URI>* uris) const;
+
   /**
    * Renames a file.
    *
@@ -402,6 +435,64 @@ class VFS {
       uint64_t nbytes,
       bool use_read_ahead = true);
 
+  /**
+   * Reads a batch of byte ranges from a file. Ranges separated by less than
+   * `vfs.min_batch_gap` bytes are served by a single backend operation
+   * (vectored reads on POSIX, coalesced ranged reads bounded by
+   * `vfs.min_batch_size` and `vfs.max_batch_size` on object stores). Reads
+   * larger than `vfs.min_parallel_size` are split as in `read`, and the
+   * batch is spread over at most `max_parallel_ops` tasks of the I/O thread
+   * pool, unless local file reads are submitted through io_uring. The
+   * read-ahead cache is not used.
+   *
+   * @param uri The URI of the file.
+   * @param ranges The ranges to read. They must not overlap.
+   * @return Status
+   */
+  Status read_batch(const URI& uri, std::vector<ReadRange> ranges);
+
+  /**
+   * Returns `true` if the data of the given file should be memory-mapped
+   * rather than read, i.e. if it is a local file and `vfs.file.use_mmap` is
+   * set. Always `false` on Windows.
+   *
+   * @param uri The URI of the file.
+   */
+  bool use_mmap(const URI& uri) const;
+
+  /**
+   * Maps a range of a local file in memory. Writes through the mapping are
+   * private and never carried to the file.
+   *
+   * @param uri The URI of the file.
+   * @param offset The offset where the range begins.
+   * @param nbytes The size of the range.
+   * @param data Set to the start of the range in memory. The mapping is
+   *     released when the last copy of the pointer is destroyed.
+   * @return Status
+   */
+  Status map(
+      const URI& uri,
+      uint64_t offset,
+      uint64_t nbytes,
+      shared_ptr<char>* data);
+
+  /**
+   * Maps multiple ranges of a local file in memory, with a single mapping
+   * spanning all of them. Writes through the mapping are private and never
+   * carried to the file.
+   *
+   * @param uri The URI of the file.
+   * @param ranges The (offset, size) ranges to map.
+   * @param data Set to the start of each range in memory. The mapping is
+   *     released when the last copy of any of the pointers is destroyed.
+   * @return Status
+   */
+  Status map_batch(
+      const URI& uri,
+      const std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+      std::vector<shared_ptr<char>>* data);
+
   /** Checks if a given filesystem is supported. */
   bool supports_fs(Filesystem fs) const;
 
@@ -742,6 +833,29 @@ class VFS {
       uint64_t nbytes,
       bool use_read_ahead);
 
+  /**
+   * Reads a batch of sorted, non-overlapping ranges from a file by calling
+   * the specific backend batched read function. Backends without a batched
+   * read issue one read per range.
+   *
+   * @param uri The URI of the file.
+   * @param ranges The ranges to read, sorted by offset.
+   * @return Status
+   */
+  Status read_batch_impl(const URI& uri, const std::vector<ReadRange>& ranges);
+
+  /**
+   * Returns the end of the run of ranges starting at `run_start` that can be
+   * coalesced in a single read, given the `vfs.min_batch_gap`,
+   * `vfs.min_batch_size` and `vfs.max_batch_size` parameters.
+   *
+   * @param ranges The ranges to read, sorted by offset.
+   * @param run_start The index of the first range of the run.
+   * @return The index right after the last range of the run.
+   */
+  uint64_t coalesced_run_end(
+      const std::vector<ReadRange>& ranges, uint64_t run_start) const;
+
   /**
    * Executes a read, using the read-ahead cache as necessary.
    *
@@ -0,0 +1,464 @@
+/**
+ * @file   adaptive_compression_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class AdaptiveCompressionFilter.
+ */
+
+#include "tiledb/sm/filter/adaptive_compression_filter.h"
+#include "tiledb/common/common.h"
+#include "tiledb/common/heap_memory.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/compressors/lz4_compressor.h"
+#include "tiledb/sm/compressors/rle_compressor.h"
+#include "tiledb/sm/enums/compressor.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/enums/filter_option.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+namespace {
+
+/** A compressor the filter may choose, and its relative decode cost. */
+struct Candidate {
+  /** The compressor. */
+  Compressor compressor;
+
+  /** The compression level. */
+  int level;
+
+  /** Per-byte decode cost, relative to LZ4. */
+  double decode_cost;
+};
+
+/**
+ * The candidate compressors. On equal scores the earlier candidate wins, so
+ * the list is ordered from cheapest to most expensive to encode.
+ */
+constexpr std::array<Candidate, 5> candidates = {{
+    {Compressor::NO_COMPRESSION, 0, 0.0},
+    {Compressor::RLE, 0, 0.5},
+    {Compressor::LZ4, 0, 1.0},
+    {Compressor::ZSTD, 1, 2.5},
+    {Compressor::ZSTD, 9, 2.5},
+}};
+
+/** Number of slices sampled from a part. */
+constexpr uint64_t sample_num_slices = 4;
+
+/** Size in bytes of each slice sampled from a part. */
+constexpr uint64_t sample_slice_size = 4096;
+
+/** Size in bytes of the metadata recorded for each part. */
+constexpr uint64_t part_metadata_size =
+    sizeof(uint8_t) + 2 * sizeof(uint32_t);
+
+/** Returns the largest compression overhead of any candidate. */
+uint64_t max_overhead(uint64_t nbytes, uint64_t value_size) {
+  return std::max(
+      {ZStd::overhead(nbytes),
+       LZ4::overhead(nbytes),
+       RLE::overhead(nbytes, value_size)});
+}
+
+/** Compresses `input` onto the end of `output` with the given compressor. */
+Status compress_with(
+    Compressor compressor,
+    int level,
+    uint64_t value_size,
+    shared_ptr<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>
+        compress_ctx_pool,
+    ConstBuffer* input,
+    Buffer* output) {
+  switch (compressor) {
+    case Compressor::RLE:
+      return RLE::compress(value_size, input, output);
+    case Compressor::LZ4:
+      return LZ4::compress(level, input, output);
+    case Compressor::ZSTD:
+      return ZStd::compress(level, compress_ctx_pool, input, output);
+    default:
+      return LOG_STATUS(Status_FilterError(
+          "AdaptiveCompressionFilter error; unsupported compressor"));
+  }
+}
+
+}  // namespace
+
+AdaptiveCompressionFilter::AdaptiveCompressionFilter(double decode_cost_weight)
+    : Filter(FilterType::FILTER_ADAPTIVE_COMPRESSION)
+    , decode_cost_weight_(decode_cost_weight)
+    , zstd_compress_ctx_pool_(nullptr)
+    , zstd_decompress_ctx_pool_(nullptr) {
+}
+
+double AdaptiveCompressionFilter::decode_cost_weight() const {
+  return decode_cost_weight_;
+}
+
+void AdaptiveCompressionFilter::dump(FILE* out) const {
+  if (out == nullptr)
+    out = stdout;
+  fprintf(
+      out,
+      "AdaptiveCompression: DECODE_COST_WEIGHT=%lf",
+      decode_cost_weight_);
+}
+
+AdaptiveCompressionFilter* AdaptiveCompressionFilter::clone_impl() const {
+  return tdb_new(AdaptiveCompressionFilter, decode_cost_weight_);
+}
+
+Status AdaptiveCompressionFilter::set_option_impl(
+    FilterOption option, const void* value) {
+  if (value == nullptr)
+    return LOG_STATUS(Status_FilterError(
+        "Adaptive compression filter error; invalid option value"));
+
+  switch (option) {
+    case FilterOption::ADAPTIVE_DECODE_COST_WEIGHT: {
+      auto val = *(double*)value;
+      if (!std::isfinite(val) || val < 0) {
+        return LOG_STATUS(Status_FilterError(
+            "Adaptive compression filter error; decode cost weight must be a "
+            "finite non-negative number"));
+      }
+      decode_cost_weight_ = val;
+      return Status::Ok();
+    }
+    default:
+      return LOG_STATUS(Status_FilterError(
+          "Adaptive compression filter error; unknown option"));
+  }
+}
+
+Status AdaptiveCompressionFilter::get_option_impl(
+    FilterOption option, void* value) const {
+  switch (option) {
+    case FilterOption::ADAPTIVE_DECODE_COST_WEIGHT:
+      *(double*)value = decode_cost_weight_;
+      return Status::Ok();
+    default:
+      return LOG_STATUS(Status_FilterError(
+          "Adaptive compression filter error; unknown option"));
+  }
+}
+
+Compressor AdaptiveCompressionFilter::choose(
+    uint64_t value_size,
+    const ConstBuffer& part,
+    double decode_cost_weight,
+    shared_ptr<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>
+        compress_ctx_pool,
+    int* level) {
+  *level = 0;
+  const uint64_t nbytes = part.size();
+  if (nbytes == 0)
+    return Compressor::NO_COMPRESSION;
+
+  // Large parts are sampled with value-aligned slices spread evenly over the
+  // part, so that a run or a noisy region at one end does not decide alone.
+  std::vector<uint8_t> sample_data;
+  ConstBuffer sample(part.data(), nbytes);
+  if (nbytes > sample_num_slices * sample_slice_size) {
+    const uint64_t slice_size =
+        std::max(value_size, sample_slice_size / value_size * value_size);
+    const uint64_t stride = nbytes / sample_num_slices;
+    auto data = static_cast<const uint8_t*>(part.data());
+    sample_data.reserve(sample_num_slices * slice_size);
+    for (uint64_t i = 0; i < sample_num_slices; i++) {
+      uint64_t start = i * stride / value_size * value_size;
+      uint64_t end = std::min(start + slice_size, nbytes);
+      sample_data.insert(sample_data.end(), data + start, data + end);
+    }
+    sample = ConstBuffer(sample_data.data(), sample_data.size());
+  }
+
+  Buffer scratch;
+  if (!scratch.realloc(sample.size() + max_overhead(sample.size(), value_size))
+           .ok())
+    return Compressor::NO_COMPRESSION;
+
+  // Not compressing costs the full size and no decode work.
+  Compressor best = Compressor::NO_COMPRESSION;
+  double best_score = static_cast<double>(nbytes);
+  const double scale =
+      static_cast<double>(nbytes) / static_cast<double>(sample.size());
+  for (const auto& candidate : candidates) {
+    if (candidate.compressor == Compressor::NO_COMPRESSION)
+      continue;
+    if (candidate.compressor == Compressor::RLE && nbytes % value_size != 0)
+      continue;
+    if (candidate.compressor == Compressor::ZSTD &&
+        compress_ctx_pool == nullptr)
+      continue;
+
+    scratch.reset_size();
+    ConstBuffer input(sample.data(), sample.size());
+    if (!compress_with(
+             candidate.compressor,
+             candidate.level,
+             value_size,
+             compress_ctx_pool,
+             &input,
+             &scratch)
+             .ok())
+      continue;
+
+    double score = static_cast<double>(scratch.size()) * scale +
+                   decode_cost_weight * candidate.decode_cost *
+                       static_cast<double>(nbytes);
+    if (score < best_score) {
+      best_score = score;
+      best = candidate.compressor;
+      *level = candidate.level;
+    }
+  }
+
+  return best;
+}
+
+Status AdaptiveCompressionFilter::run_forward(
+    const WriterTile& tile,
+    WriterTile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  if (input->size() > std::numeric_limits<uint32_t>::max())
+    return LOG_STATUS(
+        Status_FilterError("Input is too large to be compressed."));
+
+  const uint64_t value_size = datatype_size(tile.type());
+  std::vector<ConstBuffer> data_parts = input->buffers(),
+                           metadata_parts = input_metadata->buffers();
+
+  // Allocate output metadata
+  auto num_metadata_parts = static_cast<uint32_t>(metadata_parts.size());
+  auto num_data_parts = static_cast<uint32_t>(data_parts.size());
+  auto metadata_size = 2 * sizeof(uint32_t) +
+                       (num_metadata_parts + num_data_parts) *
+                           part_metadata_size;
+  RETURN_NOT_OK(output_metadata->prepend_buffer(metadata_size));
+  RETURN_NOT_OK(output_metadata->write(&num_metadata_parts, sizeof(uint32_t)));
+  RETURN_NOT_OK(output_metadata->write(&num_data_parts, sizeof(uint32_t)));
+
+  // Ensure space in output buffer for the worst case of any candidate.
+  uint64_t output_size_ub = 0;
+  for (const auto& part : metadata_parts)
+    output_size_ub += part.size() + max_overhead(part.size(), value_size);
+  for (const auto& part : data_parts)
+    output_size_ub += part.size() + max_overhead(part.size(), value_size);
+  RETURN_NOT_OK(output->prepend_buffer(output_size_ub));
+  Buffer* buffer_ptr = output->buffer_ptr(0);
+  assert(buffer_ptr != nullptr);
+  buffer_ptr->reset_offset();
+
+  for (const auto& part : metadata_parts)
+    RETURN_NOT_OK(compress_part(value_size, part, buffer_ptr, output_metadata));
+  for (const auto& part : data_parts)
+    RETURN_NOT_OK(compress_part(value_size, part, buffer_ptr, output_metadata));
+
+  return Status::Ok();
+}
+
+Status AdaptiveCompressionFilter::compress_part(
+    uint64_t value_size,
+    const ConstBuffer& part,
+    Buffer* output,
+    FilterBuffer* output_metadata) const {
+  int level = 0;
+  Compressor compressor = choose(
+      value_size, part, decode_cost_weight_, zstd_compress_ctx_pool_, &level);
+
+  auto input_size = static_cast<uint32_t>(part.size());
+  const uint64_t orig_size = output->size();
+  if (compressor != Compressor::NO_COMPRESSION) {
+    ConstBuffer input_buffer(part.data(), part.size());
+    RETURN_NOT_OK(compress_with(
+        compressor,
+        level,
+        value_size,
+        zstd_compress_ctx_pool_,
+        &input_buffer,
+        output));
+
+    // The sample may have been more compressible than the whole part.
+    if (output->size() - orig_size >= input_size) {
+      output->set_size(orig_size);
+      output->set_offset(orig_size);
+      compressor = Compressor::NO_COMPRESSION;
+    }
+  }
+  if (compressor == Compressor::NO_COMPRESSION && input_size > 0)
+    RETURN_NOT_OK(output->write(part.data(), input_size));
+
+  if (output->size() > std::numeric_limits<uint32_t>::max())
+    return LOG_STATUS(
+        Status_FilterError("Compressed output exceeds uint32 max."));
+
+  // Write the part compressor, original and compressed size to metadata
+  auto compressor_char = static_cast<uint8_t>(compressor);
+  auto compressed_size = static_cast<uint32_t>(output->size() - orig_size);
+  RETURN_NOT_OK(output_metadata->write(&compressor_char, sizeof(uint8_t)));
+  RETURN_NOT_OK(output_metadata->write(&input_size, sizeof(uint32_t)));
+  RETURN_NOT_OK(output_metadata->write(&compressed_size, sizeof(uint32_t)));
+
+  return Status::Ok();
+}
+
+Status AdaptiveCompressionFilter::run_reverse(
+    const Tile& tile,
+    Tile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output,
+    const Config&) const {
+  const uint64_t value_size = datatype_size(tile.type());
+
+  // Read the number of parts from input metadata.
+  uint32_t num_metadata_parts, num_data_parts;
+  RETURN_NOT_OK(input_metadata->read(&num_metadata_parts, sizeof(uint32_t)));
+  RETURN_NOT_OK(input_metadata->read(&num_data_parts, sizeof(uint32_t)));
+
+  // Get a buffer for output.
+  RETURN_NOT_OK(output->prepend_buffer(0));
+  Buffer* data_buffer = output->buffer_ptr(0);
+  assert(data_buffer != nullptr);
+  RETURN_NOT_OK(output_metadata->prepend_buffer(0));
+  Buffer* metadata_buffer = output_metadata->buffer_ptr(0);
+  assert(metadata_buffer != nullptr);
+
+  for (uint32_t i = 0; i < num_metadata_parts; i++)
+    RETURN_NOT_OK(
+        decompress_part(value_size, input, metadata_buffer, input_metadata));
+  for (uint32_t i = 0; i < num_data_parts; i++)
+    RETURN_NOT_OK(
+        decompress_part(value_size, input, data_buffer, input_metadata));
+
+  return Status::Ok();
+}
+
+Status AdaptiveCompressionFilter::decompress_part(
+    uint64_t value_size,
+    FilterBuffer* input,
+    Buffer* output,
+    FilterBuffer* input_metadata) const {
+  // Read the part metadata
+  uint8_t compressor_char;
+  uint32_t compressed_size, uncompressed_size;
+  RETURN_NOT_OK(input_metadata->read(&compressor_char, sizeof(uint8_t)));
+  RETURN_NOT_OK(input_metadata->read(&uncompressed_size, sizeof(uint32_t)));
+  RETURN_NOT_OK(input_metadata->read(&compressed_size, sizeof(uint32_t)));
+  auto compressor = static_cast<Compressor>(compressor_char);
+
+  // Ensure space in the output buffer if possible.
+  if (output->owns_data()) {
+    RETURN_NOT_OK(output->realloc(output->alloced_size() + uncompressed_size));
+  } else if (output->offset() + uncompressed_size > output->size()) {
+    return LOG_STATUS(Status_FilterError(
+        "AdaptiveCompressionFilter error; output buffer too small."));
+  }
+
+  ConstBuffer input_buffer(nullptr, 0);
+  RETURN_NOT_OK(input->get_const_buffer(compressed_size, &input_buffer));
+
+  PreallocatedBuffer output_buffer(output->cur_data(), uncompressed_size);
+
+  // Invoke the decompressor recorded for the part
+  Status st = Status::Ok();
+  switch (compressor) {
+    case Compressor::NO_COMPRESSION:
+      if (compressed_size != uncompressed_size)
+        return LOG_STATUS(Status_FilterError(
+            "AdaptiveCompressionFilter error; uncompressed part size "
+            "mismatch."));
+      st = output_buffer.write(input_buffer.data(), uncompressed_size);
+      break;
+    case Compressor::RLE:
+      st = RLE::decompress(value_size, &input_buffer, &output_buffer);
+      break;
+    case Compressor::LZ4:
+      st = LZ4::decompress(&input_buffer, &output_buffer);
+      break;
+    case Compressor::ZSTD:
+      st = ZStd::decompress(
+          zstd_decompress_ctx_pool_, &input_buffer, &output_buffer);
+      break;
+    default:
+      return LOG_STATUS(Status_FilterError(
+          "AdaptiveCompressionFilter error; unknown part compressor " +
+          std::to_string(compressor_char)));
+  }
+
+  if (output->owns_data())
+    output->advance_size(uncompressed_size);
+  output->advance_offset(uncompressed_size);
+  input->advance_offset(compressed_size);
+
+  return st;
+}
+
+void AdaptiveCompressionFilter::serialize_impl(Serializer& serializer) const {
+  serializer.write<double>(decode_cost_weight_);
+}
+
+void AdaptiveCompressionFilter::init_compression_resource_pool(uint64_t size) {
+  std::lock_guard g(zstd_compress_ctx_pool_mtx_);
+  if (zstd_compress_ctx_pool_ == nullptr) {
+    zstd_compress_ctx_pool_ =
+        make_shared<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>(
+            HERE(), size);
+  }
+}
+
+void AdaptiveCompressionFilter::init_decompression_resource_pool(
+    uint64_t size) {
+  std::lock_guard g(zstd_decompress_ctx_pool_mtx_);
+  if (zstd_decompress_ctx_pool_ == nullptr) {
+    zstd_decompress_ctx_pool_ =
+        make_shared<BlockingResourcePool<ZStd::ZSTD_Decompress_Context>>(
+            HERE(), size);
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,204 @@
+/**
+ * @file   adaptive_compression_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class AdaptiveCompressionFilter.
+ */
+
+#ifndef TILEDB_ADAPTIVE_COMPRESSION_FILTER_H
+#define TILEDB_ADAPTIVE_COMPRESSION_FILTER_H
+
+#include <mutex>
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/compressors/zstd_compressor.h"
+#include "tiledb/sm/filter/filter.h"
+#include "tiledb/sm/misc/resource_pool.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+enum class Compressor : uint8_t;
+
+/**
+ * A filter that picks a compressor per part. On write, each part is sampled
+ * and the sample is compressed with every candidate codec (none, RLE, LZ4 and
+ * two zstd levels). The candidate minimizing
+ *
+ *   estimated_compressed_size + decode_cost_weight * decode_cost * part_size
+ *
+ * is then used for the whole part, where `decode_cost` is a relative
+ * per-byte decode cost of the codec (0 for no compression, 1 for LZ4). A
+ * weight of 0 selects the smallest output regardless of read CPU. If the
+ * chosen codec does not shrink the part, it is stored uncompressed.
+ *
+ * The chosen codec is recorded per part, so reads never re-evaluate the
+ * selection.
+ *
+ * The forward output metadata has the format:
+ *   uint32_t - Number of metadata parts
+ *   uint32_t - Number of data parts
+ *   metadata_part0
+ *   ...
+ *   metadata_partN
+ *   data_part0
+ *   ...
+ *   data_partN
+ * Where each metadata_part/data_part has the format:
+ *   uint8_t  - Compressor used for the part
+ *   uint32_t - part uncompressed length
+ *   uint32_t - part compressed length
+ *
+ * The forward output data format is the concatenated compressed parts, in
+ * the same order as the metadata.
+ *
+ * The reverse output format is simply:
+ *   uint8_t[] - Array of uncompressed bytes
+ */
+class AdaptiveCompressionFilter : public Filter {
+ public:
+  /** The default weight of decode cost against storage size. */
+  static constexpr double default_decode_cost_weight = 0.05;
+
+  /**
+   * Constructor.
+   *
+   * @param decode_cost_weight Weight of decode cost against storage size.
+   */
+  explicit AdaptiveCompressionFilter(
+      double decode_cost_weight = default_decode_cost_weight);
+
+  /** Returns the weight of decode cost against storage size. */
+  double decode_cost_weight() const;
+
+  /** Dumps the filter details in ASCII format in the selected output. */
+  void dump(FILE* out) const override;
+
+  /**
+   * Compress the given input into the given output, choosing a compressor
+   * for each part.
+   */
+  Status run_forward(
+      const WriterTile& tile,
+      WriterTile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const override;
+
+  /**
+   * Decompress the given input into the given output, using the compressor
+   * recorded for each part.
+   */
+  Status run_reverse(
+      const Tile& tile,
+      Tile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output,
+      const Config& config) const override;
+
+  /**
+   * Returns the compressor that would be chosen for the given bytes.
+   *
+   * @param value_size Size in bytes of a single value of the data.
+   * @param part The data to sample.
+   * @param decode_cost_weight Weight of decode cost against storage size.
+   * @param compress_ctx_pool Context pool for zstd compression.
+   * @param level Set to the compression level of the chosen compressor.
+   * @return The chosen compressor.
+   */
+  static Compressor choose(
+      uint64_t value_size,
+      const ConstBuffer& part,
+      double decode_cost_weight,
+      shared_ptr<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>
+          compress_ctx_pool,
+      int* level);
+
+ private:
+  /** Weight of decode cost against storage size. */
+  double decode_cost_weight_;
+
+  /** Mutex guarding zstd_compress_ctx_pool */
+  std::mutex zstd_compress_ctx_pool_mtx_;
+
+  /** Mutex guarding zstd_decompress_ctx_pool */
+  std::mutex zstd_decompress_ctx_pool_mtx_;
+
+  /** A resource pool to be used in ZStd compressor for improved performance */
+  shared_ptr<BlockingResourcePool<ZStd::ZSTD_Compress_Context>>
+      zstd_compress_ctx_pool_;
+
+  /** A resource pool to be used in ZStd decompressor for improved performance
+   */
+  shared_ptr<BlockingResourcePool<ZStd::ZSTD_Decompress_Context>>
+      zstd_decompress_ctx_pool_;
+
+  /** Returns a new clone of this filter. */
+  AdaptiveCompressionFilter* clone_impl() const override;
+
+  /** Chooses a compressor for a single part and compresses it. */
+  Status compress_part(
+      uint64_t value_size,
+      const ConstBuffer& part,
+      Buffer* output,
+      FilterBuffer* output_metadata) const;
+
+  /**
+   * Decompresses a single part, appending onto the single output buffer.
+   */
+  Status decompress_part(
+      uint64_t value_size,
+      FilterBuffer* input,
+      Buffer* output,
+      FilterBuffer* input_metadata) const;
+
+  /** Gets an option from this filter. */
+  Status get_option_impl(FilterOption option, void* value) const override;
+
+  /** Sets an option on this filter. */
+  Status set_option_impl(FilterOption option, const void* value) override;
+
+  /** Serializes this filter's metadata to the given buffer. */
+  void serialize_impl(Serializer& serializer) const override;
+
+  /** Initializes the compression resource pool */
+  void init_compression_resource_pool(uint64_t size) override;
+
+  /** Initializes the decompression resource pool */
+  void init_decompression_resource_pool(uint64_t size) override;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ADAPTIVE_COMPRESSION_FILTER_H
@@ -47,6 +47,7 @@
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/tile/encoded_strings.h"
 #include "tiledb/sm/tile/tile.h"
 
 using namespace tiledb::common;
@@ -588,7 +589,12 @@ Status CompressionFilter::decompress_var_string_coords(
   auto offsets_view = span<uint64_t>(
       reinterpret_cast<std::uint64_t*>(offsets_tile->data()),
       uncompressed_offsets_size);
+  const uint64_t cell_num =
+      uncompressed_offsets_size / constants::cell_var_offset_size;
 
+  // Besides decoding the cells, the encoded form is kept on the offsets tile
+  // when values repeat enough for query conditions to evaluate string
+  // predicates once per distinct value or run.
   if (compressor_ == Compressor::RLE) {
     uint8_t rle_len_bytesize, string_len_bytesize;
     RETURN_NOT_OK(input_metadata.read(&rle_len_bytesize, sizeof(uint8_t)));
@@ -599,6 +605,16 @@ Status CompressionFilter::decompress_var_string_coords(
         string_len_bytesize,
         output_view,
         offsets_view));
+
+    auto&& [run_strings, run_ends] =
+        RLE::runs(input_view, rle_len_bytesize, string_len_bytesize);
+    if (EncodedStrings::worth_keeping(run_strings.size(), cell_num) &&
+        !run_ends.empty() && run_ends.back() == cell_num) {
+      std::vector<std::string> values(run_strings.begin(), run_strings.end());
+      offsets_tile->set_encoded_strings(make_shared<EncodedStrings>(
+          HERE(),
+          EncodedStrings::from_runs(std::move(values), std::move(run_ends))));
+    }
   } else if (compressor_ == Compressor::DICTIONARY_ENCODING) {
     uint8_t ids_bytesize = 0, string_len_bytesize = 0;
     uint32_t dict_size = 0;
@@ -611,6 +627,15 @@ Status CompressionFilter::decompress_var_string_coords(
         flattened_dict, string_len_bytesize);
     DictEncoding::decompress(
         input_view, dict, ids_bytesize, output_view, offsets_view);
+
+    if (EncodedStrings::worth_keeping(dict.size(), cell_num)) {
+      auto ids = DictEncoding::decode_ids(input_view, ids_bytesize);
+      if (ids.size() == cell_num) {
+        offsets_tile->set_encoded_strings(make_shared<EncodedStrings>(
+            HERE(),
+            EncodedStrings::from_dictionary(std::move(dict), std::move(ids))));
+      }
+    }
   }
 
   if (output_buffer->owns_data())
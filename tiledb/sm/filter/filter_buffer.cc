@@ -51,21 +51,22 @@ FilterBuffer::BufferOrView::BufferOrView(
     const shared_ptr<Buffer>& buffer, uint64_t offset, uint64_t nbytes) {
   is_view_ = true;
   underlying_buffer_ = buffer;
-  view_ = tdb_unique_ptr<Buffer>(
-      tdb_new(Buffer, (char*)buffer->data() + offset, nbytes));
+  view_ = Buffer((char*)buffer->data() + offset, nbytes);
 }
 
-FilterBuffer::BufferOrView::BufferOrView(BufferOrView&& other) {
+FilterBuffer::BufferOrView::BufferOrView(BufferOrView&& other)
+    : is_view_(false) {
   underlying_buffer_.swap(other.underlying_buffer_);
   view_.swap(other.view_);
   std::swap(is_view_, other.is_view_);
 }
 
 Buffer* FilterBuffer::BufferOrView::buffer() const {
-  return is_view_ ? view_.get() : underlying_buffer_.get();
+  return is_view_ ? &view_ : underlying_buffer_.get();
 }
 
-shared_ptr<Buffer> FilterBuffer::BufferOrView::underlying_buffer() const {
+const shared_ptr<Buffer>& FilterBuffer::BufferOrView::underlying_buffer()
+    const {
   return underlying_buffer_;
 }
 
@@ -78,8 +79,7 @@ FilterBuffer::BufferOrView FilterBuffer::BufferOrView::get_view(
   if (is_view_) {
     BufferOrView new_view(underlying_buffer_);
     new_view.is_view_ = true;
-    new_view.view_ = tdb_unique_ptr<Buffer>(
-        tdb_new(Buffer, (char*)view_->data() + offset, nbytes));
+    new_view.view_ = Buffer((char*)view_.data() + offset, nbytes);
     return new_view;
   } else {
     return BufferOrView(underlying_buffer_, offset, nbytes);
@@ -128,7 +128,7 @@ Status FilterBuffer::init(void* data, uint64_t nbytes) {
     return LOG_STATUS(Status_FilterError(
         "FilterBuffer error; cannot init buffer: read-only."));
 
-  shared_ptr<Buffer> buffer(tdb_new(Buffer, data, nbytes));
+  auto buffer = make_shared<Buffer>(HERE(), data, nbytes);
   offset_ = 0;
   buffers_.emplace_back(buffer);
   current_relative_offset_ = 0;
@@ -477,6 +477,26 @@ Status FilterBuffer::prepend_buffer(uint64_t nbytes) {
   return Status::Ok();
 }
 
+bool FilterBuffer::prepend_in_place(const FilterBuffer* other) {
+  if (read_only_ || fixed_allocation_data_ != nullptr ||
+      other->storage_ == nullptr || other->buffers_.size() != 1)
+    return false;
+
+  const auto& input = other->buffers_.front();
+  Buffer* input_buf = input.buffer();
+  if (input_buf->size() == 0 ||
+      !other->storage_->is_exclusive(input.underlying_buffer()))
+    return false;
+
+  buffers_.emplace_front(
+      input.underlying_buffer(),
+      (char*)input_buf->data() - (char*)input.underlying_buffer()->data(),
+      input_buf->size());
+  reset_offset();
+
+  return true;
+}
+
 Status FilterBuffer::append_view(
     const FilterBuffer* other, uint64_t offset, uint64_t nbytes) {
   if (read_only_)
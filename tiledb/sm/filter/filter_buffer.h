@@ -182,6 +182,22 @@ class FilterBuffer {
    */
   Status prepend_buffer(uint64_t nbytes);
 
+  /**
+   * Prepend a writable view covering all of `other` to the front of the list
+   * of underlying buffers, and reset the offset. This is only done if `other`
+   * consists of a single buffer from a FilterStorage pool that is not
+   * referenced anywhere else, in which case a filter whose output has the
+   * same size as its input may overwrite its input instead of allocating a
+   * new buffer. Otherwise this instance is left unmodified.
+   *
+   * The filter must produce each output byte only after it has consumed the
+   * input bytes at or before the same position.
+   *
+   * @param other Buffer to overwrite
+   * @return true if the view was prepended
+   */
+  bool prepend_in_place(const FilterBuffer* other);
+
   /**
    * Read a number of bytes from the current global offset into the given
    * buffer.
@@ -290,7 +306,7 @@ class FilterBuffer {
     /** Move constructor. */
     BufferOrView(BufferOrView&& other);
 
-    /** Deleted copy constructor (due to the tdb_unique_ptr). */
+    /** Deleted copy constructor. */
     BufferOrView(const BufferOrView& other) = delete;
 
     /**
@@ -312,7 +328,7 @@ class FilterBuffer {
     bool is_view() const;
 
     /** Return a pointer to the underlying buffer. */
-    shared_ptr<Buffer> underlying_buffer() const;
+    const shared_ptr<Buffer>& underlying_buffer() const;
 
    private:
     /**
@@ -326,9 +342,9 @@ class FilterBuffer {
 
     /**
      * If this instance is a view, the view Buffer (which does not own its
-     * data). Otherwise nullptr.
+     * data). It is stored inline so that creating a view does not allocate.
      */
-    tdb_unique_ptr<Buffer> view_;
+    mutable Buffer view_;
   };
 
   /**
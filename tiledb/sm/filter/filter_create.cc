@@ -32,6 +32,7 @@
  */
 
 #include "filter_create.h"
+#include "adaptive_compression_filter.h"
 #include "bit_width_reduction_filter.h"
 #include "bitshuffle_filter.h"
 #include "byteshuffle_filter.h"
@@ -42,6 +43,7 @@
 #include "filter.h"
 #include "float_scaling_filter.h"
 #include "noop_filter.h"
+#include "pfor_filter.h"
 #include "positive_delta_filter.h"
 #include "tiledb/common/logger_public.h"
 #include "tiledb/sm/crypto/encryption_key.h"
@@ -89,6 +91,10 @@ tiledb::sm::Filter* tiledb::sm::FilterCreate::make(FilterType type) {
         throw WebpNotPresentError();
       }
     }
+    case tiledb::sm::FilterType::FILTER_ADAPTIVE_COMPRESSION:
+      return tdb_new(tiledb::sm::AdaptiveCompressionFilter);
+    case tiledb::sm::FilterType::FILTER_PFOR:
+      return tdb_new(tiledb::sm::PFORFilter);
     default:
       throw StatusException(
           "FilterCreate",
@@ -175,6 +181,13 @@ shared_ptr<tiledb::sm::Filter> tiledb::sm::FilterCreate::deserialize(
         throw WebpNotPresentError();
       }
     }
+    case FilterType::FILTER_ADAPTIVE_COMPRESSION: {
+      double decode_cost_weight = deserializer.read<double>();
+      return make_shared<AdaptiveCompressionFilter>(HERE(), decode_cost_weight);
+    }
+    case FilterType::FILTER_PFOR: {
+      return make_shared<PFORFilter>(HERE());
+    }
     default:
       throw StatusException(
           "FilterCreate", "Deserialization error; unknown type");
@@ -0,0 +1,768 @@
+/**
+ * @file   filter_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the vectorized kernels used by the XOR, delta and PFOR
+ * filters and by the DoubleDelta decompressor.
+ *
+ * Every kernel has a scalar version, an SSE2 version and an AVX2 version,
+ * except bit unpacking, which needs gathers and per-lane shifts and so has
+ * no SSE2 version.
+ * The AVX2 versions are compiled with a function-level target attribute, so
+ * the library does not require AVX2; the version is picked at runtime from
+ * the CPU features. All kernels operate on unsigned integers, which gives
+ * the wrapping semantics of two's complement for signed types as well.
+ */
+
+#include "tiledb/sm/filter/filter_kernels.h"
+#include "tiledb/sm/filter/simd_target.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#if defined(TILEDB_SIMD_X86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace tiledb {
+namespace sm {
+namespace filter_kernels {
+
+namespace {
+
+/* ********************************* */
+/*          CPU DETECTION            */
+/* ********************************* */
+
+#if defined(TILEDB_SIMD_X86)
+/** Runs the cpuid instruction; `regs` receives eax, ebx, ecx and edx. */
+void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+  for (int i = 0; i < 4; i++)
+    regs[i] = static_cast<uint32_t>(r[i]);
+#else
+  __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/** Returns the XCR0 register, i.e. the register state enabled by the OS. */
+uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+SimdLevel detect_simd_level() {
+#if defined(TILEDB_SIMD_X86)
+  // SSE2 is part of x86-64.
+  SimdLevel level = SimdLevel::SSE2;
+
+  uint32_t regs[4];
+  cpuid(0, 0, regs);
+  const uint32_t max_leaf = regs[0];
+  cpuid(1, 0, regs);
+  const bool osxsave = regs[2] & (1u << 27);
+  const bool avx = regs[2] & (1u << 28);
+
+  // AVX2 also needs the OS to save the YMM registers, and AVX-512 the
+  // opmask and ZMM registers. Builds configured without AVX2 (e.g.
+  // `bootstrap --disable-avx2`) stop at SSE2.
+#if !defined(TILEDB_DISABLE_AVX2)
+  if (max_leaf >= 7 && osxsave && avx && (xgetbv0() & 0x6) == 0x6) {
+    cpuid(7, 0, regs);
+    if (regs[1] & (1u << 5))
+      level = SimdLevel::AVX2;
+    const bool avx512f = regs[1] & (1u << 16);
+    const bool avx512bw = regs[1] & (1u << 30);
+    if (level == SimdLevel::AVX2 && avx512f && avx512bw &&
+        (xgetbv0() & 0xe6) == 0xe6)
+      level = SimdLevel::AVX512;
+  }
+#else
+  (void)max_leaf;
+  (void)osxsave;
+  (void)avx;
+#endif
+
+  return level;
+#else
+  return SimdLevel::SCALAR;
+#endif
+}
+
+/* ********************************* */
+/*          SCALAR KERNELS           */
+/* ********************************* */
+
+template <class U>
+void xor_encode_scalar(const U* input, U* output, uint64_t n) {
+  // Backwards, so that every input is read before it is overwritten.
+  for (uint64_t i = n; i-- > 1;)
+    output[i] = input[i] ^ input[i - 1];
+  if (n > 0)
+    output[0] = input[0];
+}
+
+/**
+ * Inclusive scan with XOR (`Xor` is true) or addition, starting from
+ * `carry`. Returns the last output value.
+ */
+template <class U, bool Xor>
+U scan_scalar(const U* input, U* output, uint64_t n, U carry) {
+  for (uint64_t i = 0; i < n; i++) {
+    carry = Xor ? static_cast<U>(carry ^ input[i]) :
+                  static_cast<U>(carry + input[i]);
+    output[i] = carry;
+  }
+  return carry;
+}
+
+/** Delta encoding; `T` is the original type, used for comparisons. */
+template <class T, class U>
+bool delta_encode_scalar(const U* input, U* output, uint64_t n, U base) {
+  // Backwards, so that every input is read before it is overwritten.
+  bool positive = true;
+  for (uint64_t i = n; i-- > 0;) {
+    U prev = i == 0 ? base : input[i - 1];
+    positive &= static_cast<T>(input[i]) >= static_cast<T>(prev);
+    output[i] = static_cast<U>(input[i] - prev);
+  }
+  return positive;
+}
+
+/** Returns a mask of the low `bit_width` bits; `bit_width` must be < 64. */
+inline uint64_t low_bits_mask(uint8_t bit_width) {
+  return (uint64_t(1) << bit_width) - 1;
+}
+
+template <class U>
+void pack_bits_scalar(
+    const U* input, uint8_t* output, uint64_t n, U reference, uint8_t width) {
+  if (width == 0)
+    return;
+
+  // At most 7 bits are pending before a value is added, and values are at
+  // most max_packed_bit_width bits, so the accumulator never overflows.
+  const uint64_t mask = low_bits_mask(width);
+  uint64_t pending = 0;
+  unsigned num_pending = 0;
+  for (uint64_t i = 0; i < n; i++) {
+    const auto value = static_cast<U>(input[i] - reference);
+    pending |= (static_cast<uint64_t>(value) & mask) << num_pending;
+    num_pending += width;
+    for (; num_pending >= 8; num_pending -= 8) {
+      *output++ = static_cast<uint8_t>(pending);
+      pending >>= 8;
+    }
+  }
+  if (num_pending > 0)
+    *output = static_cast<uint8_t>(pending);
+}
+
+/**
+ * Unpacks values [begin, n) of `n` packed values. Packed values are read
+ * with unaligned 8-byte loads, which assumes a little-endian host like the
+ * rest of the format; the loads are shortened near the end of the input.
+ */
+template <class U>
+void unpack_bits_scalar(
+    const uint8_t* input,
+    U* output,
+    uint64_t begin,
+    uint64_t n,
+    U reference,
+    uint8_t width) {
+  if (width == 0) {
+    std::fill(output + begin, output + n, reference);
+    return;
+  }
+
+  const uint64_t nbytes = packed_size(n, width);
+  const uint64_t mask = low_bits_mask(width);
+  for (uint64_t i = begin; i < n; i++) {
+    const uint64_t bit = i * width;
+    const uint64_t byte = bit / 8;
+    uint64_t word = 0;
+    std::memcpy(&word, input + byte, std::min<uint64_t>(8, nbytes - byte));
+    const auto value = static_cast<U>((word >> (bit % 8)) & mask);
+    output[i] = static_cast<U>(reference + value);
+  }
+}
+
+#if defined(TILEDB_SIMD_X86)
+
+/* ********************************* */
+/*           SSE2 KERNELS            */
+/* ********************************* */
+
+template <class U, bool Xor>
+inline __m128i combine_sse2(__m128i a, __m128i b) {
+  if constexpr (Xor)
+    return _mm_xor_si128(a, b);
+  else if constexpr (sizeof(U) == 1)
+    return _mm_add_epi8(a, b);
+  else if constexpr (sizeof(U) == 2)
+    return _mm_add_epi16(a, b);
+  else if constexpr (sizeof(U) == 4)
+    return _mm_add_epi32(a, b);
+  else
+    return _mm_add_epi64(a, b);
+}
+
+template <class U>
+inline __m128i sub_sse2(__m128i a, __m128i b) {
+  if constexpr (sizeof(U) == 1)
+    return _mm_sub_epi8(a, b);
+  else if constexpr (sizeof(U) == 2)
+    return _mm_sub_epi16(a, b);
+  else if constexpr (sizeof(U) == 4)
+    return _mm_sub_epi32(a, b);
+  else
+    return _mm_sub_epi64(a, b);
+}
+
+template <class U>
+inline __m128i set1_sse2(U value) {
+  if constexpr (sizeof(U) == 1)
+    return _mm_set1_epi8(static_cast<char>(value));
+  else if constexpr (sizeof(U) == 2)
+    return _mm_set1_epi16(static_cast<short>(value));
+  else if constexpr (sizeof(U) == 4)
+    return _mm_set1_epi32(static_cast<int>(value));
+  else
+    return _mm_set1_epi64x(static_cast<long long>(value));
+}
+
+/** Inclusive scan of the elements of one register. */
+template <class U, bool Xor>
+inline __m128i scan_register_sse2(__m128i x) {
+  x = combine_sse2<U, Xor>(x, _mm_slli_si128(x, sizeof(U)));
+  if constexpr (sizeof(U) <= 4)
+    x = combine_sse2<U, Xor>(x, _mm_slli_si128(x, 2 * sizeof(U)));
+  if constexpr (sizeof(U) <= 2)
+    x = combine_sse2<U, Xor>(x, _mm_slli_si128(x, 4 * sizeof(U)));
+  if constexpr (sizeof(U) == 1)
+    x = combine_sse2<U, Xor>(x, _mm_slli_si128(x, 8));
+  return x;
+}
+
+template <class U>
+void xor_encode_sse2(const U* input, U* output, uint64_t n) {
+  constexpr uint64_t w = sizeof(__m128i) / sizeof(U);
+  uint64_t i = n;
+  while (i >= w + 1) {
+    i -= w;
+    __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    __m128i prev =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i - 1));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(output + i), _mm_xor_si128(cur, prev));
+  }
+  xor_encode_scalar(input, output, i);
+}
+
+template <class U, bool Xor>
+U scan_sse2(const U* input, U* output, uint64_t n, U carry) {
+  constexpr uint64_t w = sizeof(__m128i) / sizeof(U);
+  uint64_t i = 0;
+  for (; i + w <= n; i += w) {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    x = scan_register_sse2<U, Xor>(x);
+    x = combine_sse2<U, Xor>(x, set1_sse2<U>(carry));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), x);
+    carry = output[i + w - 1];
+  }
+  return scan_scalar<U, Xor>(input + i, output + i, n - i, carry);
+}
+
+template <class T, class U>
+bool delta_encode_sse2(const U* input, U* output, uint64_t n, U base) {
+  // SSE2 has no 64-bit comparison.
+  if constexpr (sizeof(U) == 8) {
+    return delta_encode_scalar<T>(input, output, n, base);
+  } else {
+    constexpr uint64_t w = sizeof(__m128i) / sizeof(U);
+    // Unsigned values are compared as signed ones after flipping the sign.
+    const __m128i flip = set1_sse2<U>(
+        std::is_signed<T>::value ? U(0) : U(U(1) << (8 * sizeof(U) - 1)));
+    __m128i negative = _mm_setzero_si128();
+    uint64_t i = n;
+    while (i >= w + 1) {
+      i -= w;
+      __m128i cur =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+      __m128i prev =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i - 1));
+      __m128i cur_s = _mm_xor_si128(cur, flip);
+      __m128i prev_s = _mm_xor_si128(prev, flip);
+      if constexpr (sizeof(U) == 1)
+        negative = _mm_or_si128(negative, _mm_cmpgt_epi8(prev_s, cur_s));
+      else if constexpr (sizeof(U) == 2)
+        negative = _mm_or_si128(negative, _mm_cmpgt_epi16(prev_s, cur_s));
+      else
+        negative = _mm_or_si128(negative, _mm_cmpgt_epi32(prev_s, cur_s));
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(output + i), sub_sse2<U>(cur, prev));
+    }
+    bool positive = _mm_movemask_epi8(negative) == 0;
+    return delta_encode_scalar<T>(input, output, i, base) && positive;
+  }
+}
+
+/* ********************************* */
+/*           AVX2 KERNELS            */
+/* ********************************* */
+
+template <class U, bool Xor>
+TILEDB_TARGET_AVX2 inline __m256i combine_avx2(__m256i a, __m256i b) {
+  if constexpr (Xor)
+    return _mm256_xor_si256(a, b);
+  else if constexpr (sizeof(U) == 1)
+    return _mm256_add_epi8(a, b);
+  else if constexpr (sizeof(U) == 2)
+    return _mm256_add_epi16(a, b);
+  else if constexpr (sizeof(U) == 4)
+    return _mm256_add_epi32(a, b);
+  else
+    return _mm256_add_epi64(a, b);
+}
+
+template <class U>
+TILEDB_TARGET_AVX2 inline __m256i sub_avx2(__m256i a, __m256i b) {
+  if constexpr (sizeof(U) == 1)
+    return _mm256_sub_epi8(a, b);
+  else if constexpr (sizeof(U) == 2)
+    return _mm256_sub_epi16(a, b);
+  else if constexpr (sizeof(U) == 4)
+    return _mm256_sub_epi32(a, b);
+  else
+    return _mm256_sub_epi64(a, b);
+}
+
+/** Returns all lanes where `a` > `b` (signed comparison). */
+template <class U>
+TILEDB_TARGET_AVX2 inline __m256i cmpgt_avx2(__m256i a, __m256i b) {
+  if constexpr (sizeof(U) == 1)
+    return _mm256_cmpgt_epi8(a, b);
+  else if constexpr (sizeof(U) == 2)
+    return _mm256_cmpgt_epi16(a, b);
+  else if constexpr (sizeof(U) == 4)
+    return _mm256_cmpgt_epi32(a, b);
+  else
+    return _mm256_cmpgt_epi64(a, b);
+}
+
+template <class U>
+TILEDB_TARGET_AVX2 inline __m256i set1_avx2(U value) {
+  if constexpr (sizeof(U) == 1)
+    return _mm256_set1_epi8(static_cast<char>(value));
+  else if constexpr (sizeof(U) == 2)
+    return _mm256_set1_epi16(static_cast<short>(value));
+  else if constexpr (sizeof(U) == 4)
+    return _mm256_set1_epi32(static_cast<int>(value));
+  else
+    return _mm256_set1_epi64x(static_cast<long long>(value));
+}
+
+/**
+ * Returns the shuffle mask that broadcasts the last element of each 128-bit
+ * lane to the whole lane.
+ */
+template <class U>
+TILEDB_TARGET_AVX2 inline __m256i last_element_mask_avx2() {
+  alignas(32) int8_t mask[32];
+  for (int k = 0; k < 32; k++)
+    mask[k] = static_cast<int8_t>(16 - sizeof(U) + k % sizeof(U));
+  return _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+}
+
+template <class U>
+TILEDB_TARGET_AVX2 void xor_encode_avx2(const U* input, U* output, uint64_t n) {
+  constexpr uint64_t w = sizeof(__m256i) / sizeof(U);
+  uint64_t i = n;
+  while (i >= w + 1) {
+    i -= w;
+    __m256i cur =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+    __m256i prev =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i - 1));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output + i), _mm256_xor_si256(cur, prev));
+  }
+  xor_encode_scalar(input, output, i);
+}
+
+template <class U, bool Xor>
+TILEDB_TARGET_AVX2 U scan_avx2(const U* input, U* output, uint64_t n, U carry) {
+  constexpr uint64_t w = sizeof(__m256i) / sizeof(U);
+  const __m256i last = last_element_mask_avx2<U>();
+  __m256i carry_v = set1_avx2<U>(carry);
+  uint64_t i = 0;
+  for (; i + w <= n; i += w) {
+    __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+
+    // Scan within each 128-bit lane.
+    x = combine_avx2<U, Xor>(x, _mm256_slli_si256(x, sizeof(U)));
+    if constexpr (sizeof(U) <= 4)
+      x = combine_avx2<U, Xor>(x, _mm256_slli_si256(x, 2 * sizeof(U)));
+    if constexpr (sizeof(U) <= 2)
+      x = combine_avx2<U, Xor>(x, _mm256_slli_si256(x, 4 * sizeof(U)));
+    if constexpr (sizeof(U) == 1)
+      x = combine_avx2<U, Xor>(x, _mm256_slli_si256(x, 8));
+
+    // Carry the total of the low lane into the high lane, then the total of
+    // the previous registers into both.
+    __m256i low = _mm256_permute2x128_si256(x, x, 0x08);
+    x = combine_avx2<U, Xor>(x, _mm256_shuffle_epi8(low, last));
+    x = combine_avx2<U, Xor>(x, carry_v);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), x);
+
+    carry_v = _mm256_shuffle_epi8(_mm256_permute2x128_si256(x, x, 0x11), last);
+  }
+
+  if (i > 0)
+    carry = output[i - 1];
+  return scan_scalar<U, Xor>(input + i, output + i, n - i, carry);
+}
+
+template <class T, class U>
+TILEDB_TARGET_AVX2 bool delta_encode_avx2(
+    const U* input, U* output, uint64_t n, U base) {
+  constexpr uint64_t w = sizeof(__m256i) / sizeof(U);
+  // Unsigned values are compared as signed ones after flipping the sign.
+  const __m256i flip = set1_avx2<U>(
+      std::is_signed<T>::value ? U(0) : U(U(1) << (8 * sizeof(U) - 1)));
+  __m256i negative = _mm256_setzero_si256();
+  uint64_t i = n;
+  while (i >= w + 1) {
+    i -= w;
+    __m256i cur =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+    __m256i prev =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i - 1));
+    negative = _mm256_or_si256(
+        negative,
+        cmpgt_avx2<U>(
+            _mm256_xor_si256(prev, flip), _mm256_xor_si256(cur, flip)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output + i), sub_avx2<U>(cur, prev));
+  }
+  bool positive = _mm256_testz_si256(negative, negative) != 0;
+  return delta_encode_scalar<T>(input, output, i, base) && positive;
+}
+
+/**
+ * Bit offsets of the values in a group of 8 packed values, split into a
+ * byte index and a shift. Groups of 8 values start on a byte boundary.
+ */
+struct PackedGroupLayout {
+  alignas(32) int32_t byte[8];
+  alignas(32) int64_t shift[8];
+
+  explicit PackedGroupLayout(uint8_t width) {
+    for (int k = 0; k < 8; k++) {
+      byte[k] = k * width / 8;
+      shift[k] = k * width % 8;
+    }
+  }
+};
+
+/**
+ * Unpacks whole groups of 8 values whose loads stay within the input.
+ * Every value is gathered with a 4-byte load from its first byte, which
+ * holds it entirely as long as `width` is at most 25. Returns the number of
+ * values unpacked.
+ */
+TILEDB_TARGET_AVX2 uint64_t unpack_bits_avx2(
+    const uint8_t* input,
+    uint32_t* output,
+    uint64_t n,
+    uint32_t reference,
+    uint8_t width) {
+  const PackedGroupLayout layout(width);
+  const __m256i byte_index =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.byte));
+  const __m256i shift = _mm256_setr_epi32(
+      static_cast<int>(layout.shift[0]),
+      static_cast<int>(layout.shift[1]),
+      static_cast<int>(layout.shift[2]),
+      static_cast<int>(layout.shift[3]),
+      static_cast<int>(layout.shift[4]),
+      static_cast<int>(layout.shift[5]),
+      static_cast<int>(layout.shift[6]),
+      static_cast<int>(layout.shift[7]));
+  const __m256i mask =
+      _mm256_set1_epi32(static_cast<int>(low_bits_mask(width)));
+  const __m256i ref = _mm256_set1_epi32(static_cast<int>(reference));
+
+  const uint64_t nbytes = packed_size(n, width);
+  const uint64_t group_reach = layout.byte[7] + sizeof(uint32_t);
+  uint64_t i = 0;
+  for (; i + 8 <= n && i * width / 8 + group_reach <= nbytes; i += 8) {
+    auto group = reinterpret_cast<const int*>(input + i * width / 8);
+    __m256i v = _mm256_i32gather_epi32(group, byte_index, 1);
+    v = _mm256_and_si256(_mm256_srlv_epi32(v, shift), mask);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output + i), _mm256_add_epi32(v, ref));
+  }
+  return i;
+}
+
+/**
+ * 64-bit version of the above, with 8-byte loads, which hold any value of
+ * at most max_packed_bit_width bits.
+ */
+TILEDB_TARGET_AVX2 uint64_t unpack_bits_avx2(
+    const uint8_t* input,
+    uint64_t* output,
+    uint64_t n,
+    uint64_t reference,
+    uint8_t width) {
+  const PackedGroupLayout layout(width);
+  const __m128i byte_index_lo =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(layout.byte));
+  const __m128i byte_index_hi =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(layout.byte + 4));
+  const __m256i shift_lo =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.shift));
+  const __m256i shift_hi =
+      _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.shift + 4));
+  const __m256i mask =
+      _mm256_set1_epi64x(static_cast<long long>(low_bits_mask(width)));
+  const __m256i ref = _mm256_set1_epi64x(static_cast<long long>(reference));
+
+  const uint64_t nbytes = packed_size(n, width);
+  const uint64_t group_reach = layout.byte[7] + sizeof(uint64_t);
+  uint64_t i = 0;
+  for (; i + 8 <= n && i * width / 8 + group_reach <= nbytes; i += 8) {
+    auto group = reinterpret_cast<const long long*>(input + i * width / 8);
+    __m256i lo = _mm256_i32gather_epi64(group, byte_index_lo, 1);
+    __m256i hi = _mm256_i32gather_epi64(group, byte_index_hi, 1);
+    lo = _mm256_and_si256(_mm256_srlv_epi64(lo, shift_lo), mask);
+    hi = _mm256_and_si256(_mm256_srlv_epi64(hi, shift_hi), mask);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output + i), _mm256_add_epi64(lo, ref));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output + i + 4), _mm256_add_epi64(hi, ref));
+  }
+  return i;
+}
+
+#endif  // TILEDB_SIMD_X86
+
+/**
+ * Lowers `level` to what this CPU supports. The filter kernels have no
+ * AVX-512 versions, AVX2 is used instead.
+ */
+SimdLevel effective_level(SimdLevel level) {
+  return std::min({level, simd_level(), SimdLevel::AVX2});
+}
+
+}  // namespace
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+SimdLevel simd_level() {
+  static const SimdLevel level = detect_simd_level();
+  return level;
+}
+
+const char* simd_level_str(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::SCALAR:
+      return "scalar";
+    case SimdLevel::SSE2:
+      return "sse2";
+    case SimdLevel::AVX2:
+      return "avx2";
+    case SimdLevel::AVX512:
+      return "avx512";
+  }
+  return "";
+}
+
+template <class T>
+void xor_encode(const T* input, T* output, uint64_t n, SimdLevel level) {
+  using U = typename std::make_unsigned<T>::type;
+  auto in = reinterpret_cast<const U*>(input);
+  auto out = reinterpret_cast<U*>(output);
+  switch (effective_level(level)) {
+#if defined(TILEDB_SIMD_X86)
+    case SimdLevel::AVX2:
+      return xor_encode_avx2(in, out, n);
+    case SimdLevel::SSE2:
+      return xor_encode_sse2(in, out, n);
+#endif
+    default:
+      return xor_encode_scalar(in, out, n);
+  }
+}
+
+template <class T>
+void xor_decode(const T* input, T* output, uint64_t n, SimdLevel level) {
+  using U = typename std::make_unsigned<T>::type;
+  auto in = reinterpret_cast<const U*>(input);
+  auto out = reinterpret_cast<U*>(output);
+  switch (effective_level(level)) {
+#if defined(TILEDB_SIMD_X86)
+    case SimdLevel::AVX2:
+      scan_avx2<U, true>(in, out, n, U(0));
+      return;
+    case SimdLevel::SSE2:
+      scan_sse2<U, true>(in, out, n, U(0));
+      return;
+#endif
+    default:
+      scan_scalar<U, true>(in, out, n, U(0));
+      return;
+  }
+}
+
+template <class T>
+bool delta_encode(
+    const T* input, T* output, uint64_t n, T base, SimdLevel level) {
+  using U = typename std::make_unsigned<T>::type;
+  auto in = reinterpret_cast<const U*>(input);
+  auto out = reinterpret_cast<U*>(output);
+  auto b = static_cast<U>(base);
+  switch (effective_level(level)) {
+#if defined(TILEDB_SIMD_X86)
+    case SimdLevel::AVX2:
+      return delta_encode_avx2<T>(in, out, n, b);
+    case SimdLevel::SSE2:
+      return delta_encode_sse2<T>(in, out, n, b);
+#endif
+    default:
+      return delta_encode_scalar<T>(in, out, n, b);
+  }
+}
+
+template <class T>
+T delta_decode(
+    const T* input, T* output, uint64_t n, T base, SimdLevel level) {
+  using U = typename std::make_unsigned<T>::type;
+  auto in = reinterpret_cast<const U*>(input);
+  auto out = reinterpret_cast<U*>(output);
+  auto b = static_cast<U>(base);
+  switch (effective_level(level)) {
+#if defined(TILEDB_SIMD_X86)
+    case SimdLevel::AVX2:
+      return static_cast<T>(scan_avx2<U, false>(in, out, n, b));
+    case SimdLevel::SSE2:
+      return static_cast<T>(scan_sse2<U, false>(in, out, n, b));
+#endif
+    default:
+      return static_cast<T>(scan_scalar<U, false>(in, out, n, b));
+  }
+}
+
+template <class T>
+void pack_bits(
+    const T* input,
+    uint8_t* output,
+    uint64_t n,
+    T reference,
+    uint8_t bit_width) {
+  using U = typename std::make_unsigned<T>::type;
+  pack_bits_scalar(
+      reinterpret_cast<const U*>(input),
+      output,
+      n,
+      static_cast<U>(reference),
+      bit_width);
+}
+
+template <class T>
+void unpack_bits(
+    const uint8_t* input,
+    T* output,
+    uint64_t n,
+    T reference,
+    uint8_t bit_width,
+    SimdLevel level) {
+  using U = typename std::make_unsigned<T>::type;
+  auto out = reinterpret_cast<U*>(output);
+  auto ref = static_cast<U>(reference);
+  uint64_t begin = 0;
+#if defined(TILEDB_SIMD_X86)
+  if (effective_level(level) == SimdLevel::AVX2 && bit_width > 0) {
+    if constexpr (sizeof(U) == sizeof(uint32_t)) {
+      if (bit_width <= 25)
+        begin = unpack_bits_avx2(input, out, n, ref, bit_width);
+    } else if constexpr (sizeof(U) == sizeof(uint64_t)) {
+      begin = unpack_bits_avx2(input, out, n, ref, bit_width);
+    }
+  }
+#else
+  (void)level;
+#endif
+  unpack_bits_scalar(input, out, begin, n, ref, bit_width);
+}
+
+/* ********************************* */
+/*     EXPLICIT INSTANTIATIONS       */
+/* ********************************* */
+
+#define TILEDB_FILTER_KERNELS_INSTANTIATE(T)                                  \
+  template void xor_encode<T>(const T*, T*, uint64_t, SimdLevel);             \
+  template void xor_decode<T>(const T*, T*, uint64_t, SimdLevel);             \
+  template bool delta_encode<T>(const T*, T*, uint64_t, T, SimdLevel);        \
+  template T delta_decode<T>(const T*, T*, uint64_t, T, SimdLevel);           \
+  template void pack_bits<T>(const T*, uint8_t*, uint64_t, T, uint8_t);       \
+  template void unpack_bits<T>(                                               \
+      const uint8_t*, T*, uint64_t, T, uint8_t, SimdLevel);
+
+TILEDB_FILTER_KERNELS_INSTANTIATE(int8_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(uint8_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(int16_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(uint16_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(int32_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(uint32_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(int64_t)
+TILEDB_FILTER_KERNELS_INSTANTIATE(uint64_t)
+
+#undef TILEDB_FILTER_KERNELS_INSTANTIATE
+
+}  // namespace filter_kernels
+}  // namespace sm
+}  // namespace tiledb
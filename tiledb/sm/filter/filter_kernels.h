@@ -0,0 +1,151 @@
+/**
+ * @file   filter_kernels.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the vectorized kernels used by the XOR, delta and PFOR
+ * filters and by the DoubleDelta decompressor.
+ */
+
+#ifndef TILEDB_FILTER_KERNELS_H
+#define TILEDB_FILTER_KERNELS_H
+
+#include <cstdint>
+
+namespace tiledb {
+namespace sm {
+namespace filter_kernels {
+
+/**
+ * Instruction set extensions the kernels may use, in increasing order.
+ * SSE2, AVX2 and AVX-512 kernels are only built for x86-64. AVX512 stands
+ * for AVX-512F with AVX-512BW.
+ */
+enum class SimdLevel : uint8_t { SCALAR = 0, SSE2, AVX2, AVX512 };
+
+/**
+ * Returns the highest level supported by both the build and the CPU. It is
+ * detected once per process and used by default by all kernels. Builds with
+ * TILEDB_DISABLE_AVX2 defined never go beyond SSE2.
+ */
+SimdLevel simd_level();
+
+/** Returns the name of the given level, e.g. "avx2". */
+const char* simd_level_str(SimdLevel level);
+
+/*
+ * The kernels below are defined for the 8, 16, 32 and 64 bit integer types.
+ * Integer arithmetic wraps around. `output` may either be equal to `input`
+ * (in place) or not overlap it at all. A `level` above simd_level() is
+ * lowered to simd_level().
+ */
+
+/**
+ * XOR encoding: output[0] = input[0] and
+ * output[i] = input[i] ^ input[i - 1] for i > 0.
+ */
+template <class T>
+void xor_encode(
+    const T* input, T* output, uint64_t n, SimdLevel level = simd_level());
+
+/**
+ * Inverse of xor_encode: output[0] = input[0] and
+ * output[i] = output[i - 1] ^ input[i] for i > 0.
+ */
+template <class T>
+void xor_decode(
+    const T* input, T* output, uint64_t n, SimdLevel level = simd_level());
+
+/**
+ * Positive delta encoding relative to `base`: output[i] = input[i] - prev,
+ * where prev is `base` for i == 0 and input[i - 1] otherwise.
+ *
+ * @return false if some input[i] < prev, in which case the contents of
+ *     `output` are unspecified.
+ */
+template <class T>
+bool delta_encode(
+    const T* input,
+    T* output,
+    uint64_t n,
+    T base,
+    SimdLevel level = simd_level());
+
+/**
+ * Inverse of delta_encode: output[i] = prev + input[i], where prev is `base`
+ * for i == 0 and output[i - 1] otherwise.
+ *
+ * @return The last decoded value, or `base` if n == 0.
+ */
+template <class T>
+T delta_decode(
+    const T* input,
+    T* output,
+    uint64_t n,
+    T base,
+    SimdLevel level = simd_level());
+
+/** The widest bit width supported by pack_bits and unpack_bits. */
+constexpr uint8_t max_packed_bit_width = 56;
+
+/** Returns the number of bytes holding `n` packed values of `bit_width`. */
+constexpr uint64_t packed_size(uint64_t n, uint8_t bit_width) {
+  return (n * bit_width + 7) / 8;
+}
+
+/**
+ * Frame-of-reference bit packing: writes the low `bit_width` bits of
+ * input[i] - reference for every i, least significant bit first, to the
+ * packed_size(n, bit_width) bytes at `output`. `bit_width` may be at most
+ * min(8 * sizeof(T), max_packed_bit_width).
+ */
+template <class T>
+void pack_bits(
+    const T* input,
+    uint8_t* output,
+    uint64_t n,
+    T reference,
+    uint8_t bit_width);
+
+/**
+ * Inverse of pack_bits: output[i] = reference + the i-th packed value. Reads
+ * no more than packed_size(n, bit_width) bytes at `input`.
+ */
+template <class T>
+void unpack_bits(
+    const uint8_t* input,
+    T* output,
+    uint64_t n,
+    T reference,
+    uint8_t bit_width,
+    SimdLevel level = simd_level());
+
+}  // namespace filter_kernels
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FILTER_KERNELS_H
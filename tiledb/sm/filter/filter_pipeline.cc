@@ -41,6 +41,7 @@
 #include "tiledb/sm/filter/encryption_aes256gcm_filter.h"
 #include "tiledb/sm/filter/filter.h"
 #include "tiledb/sm/filter/filter_storage.h"
+#include "tiledb/sm/filter/fused_filter_kernels.h"
 #include "tiledb/sm/filter/noop_filter.h"
 #include "tiledb/sm/misc/parallel_functions.h"
 #include "tiledb/sm/stats/global_stats.h"
@@ -183,11 +184,11 @@ Status FilterPipeline::filter_chunks_forward(
 
   // Run each chunk through the entire pipeline.
   auto status = parallel_for(compute_tp, 0, nchunks, [&](uint64_t i) {
-    // TODO(ttd): can we instead allocate one FilterStorage per thread?
-    // or make it threadsafe?
-    FilterStorage storage;
-    FilterBuffer input_data(&storage), output_data(&storage);
-    FilterBuffer input_metadata(&storage), output_metadata(&storage);
+    // Scratch buffers come from the per-thread pool, which keeps them
+    // allocated across chunks and tiles.
+    FilterStorage* storage = &FilterStorage::thread_local_storage();
+    FilterBuffer input_data(storage), output_data(storage);
+    FilterBuffer input_metadata(storage), output_metadata(storage);
 
     // First filter's input is the original chunk.
     uint64_t offset = var_sizes ? chunk_offsets[i] : i * chunk_size;
@@ -229,11 +230,10 @@ Status FilterPipeline::filter_chunks_forward(
     }
 
     // Save the finished chunk (last stage's output). This is safe to do
-    // because when the local FilterStorage goes out of scope, it will not
-    // free the buffers saved here as their shared_ptr counters will not
-    // be zero. However, as the output may have been a view on the input, we
-    // do need to save both here to prevent the input buffer from being
-    // freed.
+    // because the thread's FilterStorage will not hand out the buffers saved
+    // here again until their shared_ptr counters drop back to one. However,
+    // as the output may have been a view on the input, we do need to save
+    // both here to prevent the input buffer from being reused.
     auto& io = final_stage_io[i];
     auto& io_input = io.first;
     auto& io_output = io.second;
@@ -403,12 +403,18 @@ Status FilterPipeline::run_reverse(
     const uint64_t max_chunk_index,
     uint64_t concurrency_level,
     const Config& config) const {
+  bool found = false;
+  bool use_fused_kernels = true;
+  RETURN_NOT_OK(config.get<bool>(
+      "sm.filter.fused_reverse_kernels", &use_fused_kernels, &found));
+  assert(found);
+
   // Run each chunk through the entire pipeline.
   for (size_t i = min_chunk_index; i < max_chunk_index; i++) {
     auto& chunk = chunk_data.filtered_chunks_[i];
-    FilterStorage storage;
-    FilterBuffer input_data(&storage), output_data(&storage);
-    FilterBuffer input_metadata(&storage), output_metadata(&storage);
+    FilterStorage* storage = &FilterStorage::thread_local_storage();
+    FilterBuffer input_data(storage), output_data(storage);
+    FilterBuffer input_metadata(storage), output_metadata(storage);
 
     // First filter's input is the filtered chunk data.
     RETURN_NOT_OK(input_metadata.init(
@@ -429,6 +435,14 @@ Status FilterPipeline::run_reverse(
          filter_idx--) {
       auto& f = filters_[filter_idx];
 
+      // Undo this filter and the one before it in a single pass if possible.
+      bool fused = use_fused_kernels && filter_idx > 0 &&
+                   FusedFilterKernels::can_fuse_reverse(
+                       *filters_[filter_idx - 1], *f, tile->type());
+      if (fused) {
+        filter_idx--;
+      }
+
       // Clear and reset I/O buffers
       input_data.reset_offset();
       input_data.set_read_only(true);
@@ -449,16 +463,27 @@ Status FilterPipeline::run_reverse(
             "read_unfiltered_byte_num", chunk.unfiltered_data_size_);
       }
 
-      f->init_decompression_resource_pool(concurrency_level);
-
-      RETURN_NOT_OK(f->run_reverse(
-          *tile,
-          offsets_tile,
-          &input_metadata,
-          &input_data,
-          &output_metadata,
-          &output_data,
-          config));
+      if (fused) {
+        RETURN_NOT_OK(FusedFilterKernels::run_reverse(
+            *filters_[filter_idx],
+            *f,
+            tile->type(),
+            &input_metadata,
+            &input_data,
+            &output_metadata,
+            &output_data));
+      } else {
+        f->init_decompression_resource_pool(concurrency_level);
+
+        RETURN_NOT_OK(f->run_reverse(
+            *tile,
+            offsets_tile,
+            &input_metadata,
+            &input_data,
+            &output_metadata,
+            &output_data,
+            config));
+      }
 
       input_data.set_read_only(false);
       input_metadata.set_read_only(false);
@@ -33,13 +33,47 @@
 #include "tiledb/sm/filter/filter_storage.h"
 #include "tiledb/common/heap_memory.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/misc/constants.h"
+
+#include <atomic>
 
 using namespace tiledb::common;
 
 namespace tiledb {
 namespace sm {
 
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+FilterStorage::FilterStorage()
+    : FilterStorage(
+          std::numeric_limits<uint64_t>::max(),
+          std::numeric_limits<uint64_t>::max()) {
+}
+
+FilterStorage::FilterStorage(
+    uint64_t max_buffer_size, uint64_t max_num_available)
+    : max_buffer_size_(max_buffer_size)
+    , max_num_available_(max_num_available) {
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+FilterStorage& FilterStorage::thread_local_storage() {
+  // Chunks are at most `max_tile_chunk_size` bytes, but filters such as
+  // compressors may need a somewhat larger output buffer. Anything bigger
+  // (e.g. unchunked tiles) is not kept alive between pipeline runs.
+  thread_local FilterStorage storage(2 * constants::max_tile_chunk_size, 32);
+  return storage;
+}
+
 shared_ptr<Buffer> FilterStorage::get_buffer() {
+  if (available_.empty())
+    recover_unused();
+
   if (available_.empty())
     available_.emplace_back(tdb_new(Buffer));
 
@@ -52,6 +86,15 @@ shared_ptr<Buffer> FilterStorage::get_buffer() {
   return in_use_.back();
 }
 
+bool FilterStorage::is_exclusive(const shared_ptr<Buffer>& buffer) const {
+  if (buffer == nullptr ||
+      in_use_list_map_.find(buffer.get()) == in_use_list_map_.end())
+    return false;
+
+  // One reference is held by the in_use_ list, the other one by the caller.
+  return buffer.use_count() == 2;
+}
+
 uint64_t FilterStorage::num_available() const {
   return available_.size();
 }
@@ -69,19 +112,44 @@ Status FilterStorage::reclaim(Buffer* buffer) {
 
   // An "unused" buffer will have exactly one reference, which is the held by
   // the in_use_ list.
-  if (it->second->use_count() == 1) {
-    buffer->reset_offset();
-    buffer->reset_size();
-
-    auto list_node = it->second;
-    shared_ptr<Buffer> ptr = std::move(*list_node);
-    in_use_.erase(list_node);
-    in_use_list_map_.erase(it);
-    available_.push_front(std::move(ptr));
-  }
+  if (it->second->use_count() == 1)
+    recycle(it->second);
 
   return Status::Ok();
 }
 
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+void FilterStorage::recycle(std::list<shared_ptr<Buffer>>::iterator list_node) {
+  shared_ptr<Buffer> ptr = std::move(*list_node);
+  in_use_list_map_.erase(ptr.get());
+  in_use_.erase(list_node);
+
+  // The last user may have released the buffer from another thread.
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  if (available_.size() >= max_num_available_)
+    return;
+
+  if (ptr->alloced_size() > max_buffer_size_) {
+    ptr->clear();
+  } else {
+    ptr->reset_offset();
+    ptr->reset_size();
+  }
+
+  available_.push_front(std::move(ptr));
+}
+
+void FilterStorage::recover_unused() {
+  for (auto it = in_use_.begin(); it != in_use_.end();) {
+    auto list_node = it++;
+    if (list_node->use_count() == 1)
+      recycle(list_node);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
@@ -33,12 +33,14 @@
 #ifndef TILEDB_FILTER_STORAGE_H
 #define TILEDB_FILTER_STORAGE_H
 
+#include <limits>
 #include <list>
 #include <memory>
 #include <unordered_map>
 
 #include "tiledb/common/common.h"
 #include "tiledb/common/heap_memory.h"
+#include "tiledb/common/macros.h"
 #include "tiledb/common/status.h"
 
 using namespace tiledb::common;
@@ -50,18 +52,63 @@ class Buffer;
 
 /**
  * Manages a ref-counted pool of buffers, used for filter I/O.
+ *
+ * A pool may outlive the filter buffers that borrow from it (e.g. when it is
+ * used as a per-thread scratch arena across chunks and tiles). Buffers that
+ * are released without being reclaimed are recovered lazily by get_buffer().
  */
 class FilterStorage {
  public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. The pool retains every buffer it is given back. */
+  FilterStorage();
+
+  /**
+   * Constructor.
+   *
+   * @param max_buffer_size Buffers whose allocation exceeds this size have
+   *     their memory released when they are returned to the pool.
+   * @param max_num_available Maximum number of buffers kept in the available
+   *     list; buffers returned beyond that are freed.
+   */
+  FilterStorage(uint64_t max_buffer_size, uint64_t max_num_available);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(FilterStorage);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(FilterStorage);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Returns the scratch pool of the calling thread. It is reused by every
+   * filter pipeline run on that thread, so that buffers keep their
+   * allocations across chunks and tiles.
+   */
+  static FilterStorage& thread_local_storage();
+
   /**
    * Return a buffer from the pool, allocating a new one if necessary. The
    * buffer returned by this function will not be available for reuse until it
-   * is reclaimed by this instance via the reclaim() method.
+   * is reclaimed by this instance via the reclaim() method, or until every
+   * other reference to it has been dropped.
    *
    * @return Buffer from the pool
    */
   shared_ptr<Buffer> get_buffer();
 
+  /**
+   * Return true if the given buffer is handed out by this pool and the given
+   * reference is the only one held outside of the pool, i.e. its contents
+   * may be overwritten without affecting any other filter buffer or view.
+   *
+   * @param buffer Reference to a buffer (must not be a temporary copy).
+   */
+  bool is_exclusive(const shared_ptr<Buffer>& buffer) const;
+
   /** Return the number of buffers in the internal available list. */
   uint64_t num_available() const;
 
@@ -81,6 +128,16 @@ class FilterStorage {
   Status reclaim(Buffer* buffer);
 
  private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Allocation size above which returned buffers are freed. */
+  uint64_t max_buffer_size_;
+
+  /** Maximum number of buffers kept in the available list. */
+  uint64_t max_num_available_;
+
   /** List of buffers that are available to be used (may be empty). */
   std::list<shared_ptr<Buffer>> available_;
 
@@ -93,6 +150,22 @@ class FilterStorage {
    */
   std::unordered_map<Buffer*, std::list<shared_ptr<Buffer>>::iterator>
       in_use_list_map_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /**
+   * Moves an unused buffer from the in-use list back to the available list,
+   * releasing its memory if the pool limits require it.
+   */
+  void recycle(std::list<shared_ptr<Buffer>>::iterator list_node);
+
+  /**
+   * Returns to the available list all in-use buffers whose only remaining
+   * reference is held by the pool.
+   */
+  void recover_unused();
 };
 
 }  // namespace sm
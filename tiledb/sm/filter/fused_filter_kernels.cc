@@ -0,0 +1,358 @@
+/**
+ * @file   fused_filter_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class FusedFilterKernels.
+ */
+
+#include "tiledb/sm/filter/fused_filter_kernels.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/filter.h"
+#include "tiledb/sm/filter/filter_buffer.h"
+#include "tiledb/sm/filter/filter_kernels.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+namespace {
+
+/**
+ * Number of elements decoded at a time. A block of 64-bit values takes 4KB,
+ * which keeps the decoded block and the packed input in L1.
+ */
+constexpr uint32_t block_nelts = 512;
+
+/**
+ * Reads the data produced by reversing BitWidthReductionFilter as a byte
+ * stream, decoding it one block at a time instead of materializing it.
+ *
+ * The window format is documented in BitWidthReductionFilter.
+ */
+template <class T>
+class BitWidthReductionReader {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param metadata Metadata positioned on the first window header.
+   * @param data Reduced data.
+   * @param num_windows Number of windows.
+   */
+  BitWidthReductionReader(
+      FilterBuffer* metadata, FilterBuffer* data, uint32_t num_windows)
+      : metadata_(metadata)
+      , data_(data)
+      , windows_left_(num_windows)
+      , window_bytes_left_(0)
+      , window_reduced_(false)
+      , window_bits_(0)
+      , window_value_offset_(0)
+      , block_offset_(0)
+      , block_size_(0) {
+  }
+
+  /** Reads the next `nbytes` bytes of decoded data into `dst`. */
+  Status read(void* dst, uint32_t nbytes) {
+    auto out = static_cast<char*>(dst);
+    while (nbytes > 0) {
+      if (block_offset_ == block_size_) {
+        if (window_bytes_left_ == 0)
+          RETURN_NOT_OK(next_window());
+
+        if (!window_reduced_) {
+          // Windows that were not reduced are copied straight through.
+          auto n = std::min(nbytes, window_bytes_left_);
+          RETURN_NOT_OK(data_->read(out, n));
+          window_bytes_left_ -= n;
+          out += n;
+          nbytes -= n;
+          continue;
+        }
+
+        RETURN_NOT_OK(decode_block());
+      }
+
+      auto n = std::min(nbytes, block_size_ - block_offset_);
+      std::memcpy(out, reinterpret_cast<char*>(block_) + block_offset_, n);
+      block_offset_ += n;
+      out += n;
+      nbytes -= n;
+    }
+
+    return Status::Ok();
+  }
+
+ private:
+  /** Reads the header of the next window. */
+  Status next_window() {
+    if (windows_left_ == 0)
+      return LOG_STATUS(Status_FilterError(
+          "Fused filter error; bit width reduction data is too short."));
+    windows_left_--;
+
+    RETURN_NOT_OK(metadata_->read(&window_value_offset_, sizeof(T)));
+    RETURN_NOT_OK(metadata_->read(&window_bits_, sizeof(uint8_t)));
+    RETURN_NOT_OK(metadata_->read(&window_bytes_left_, sizeof(uint32_t)));
+    window_reduced_ = window_bits_ < sizeof(T) * 8 &&
+                      window_bytes_left_ % sizeof(T) == 0;
+
+    return Status::Ok();
+  }
+
+  /** Decodes the next block of the current (reduced) window. */
+  Status decode_block() {
+    auto nelts = std::min(
+        block_nelts, window_bytes_left_ / static_cast<uint32_t>(sizeof(T)));
+    RETURN_NOT_OK(data_->read(packed_, nelts * (window_bits_ / 8)));
+
+    switch (window_bits_) {
+      case 8:
+        widen<int8_t, uint8_t>(nelts);
+        break;
+      case 16:
+        widen<int16_t, uint16_t>(nelts);
+        break;
+      case 32:
+        widen<int32_t, uint32_t>(nelts);
+        break;
+      default:
+        return LOG_STATUS(Status_FilterError(
+            "Fused filter error; invalid bit width reduction window."));
+    }
+
+    block_offset_ = 0;
+    block_size_ = nelts * sizeof(T);
+    window_bytes_left_ -= block_size_;
+
+    return Status::Ok();
+  }
+
+  /** Widens `nelts` packed values and adds the window value offset. */
+  template <class S, class U>
+  void widen(uint32_t nelts) {
+    using R = typename std::conditional<std::is_signed<T>::value, S, U>::type;
+    for (uint32_t j = 0; j < nelts; j++) {
+      R packed_value;
+      std::memcpy(&packed_value, packed_ + j * sizeof(R), sizeof(R));
+      T value = packed_value;
+      value += window_value_offset_;
+      block_[j] = value;
+    }
+  }
+
+  /** The metadata, positioned on the next window header. */
+  FilterBuffer* metadata_;
+
+  /** The reduced data, positioned on the next packed value. */
+  FilterBuffer* data_;
+
+  /** Number of window headers not read yet. */
+  uint32_t windows_left_;
+
+  /** Number of (decoded) bytes of the current window not yet produced. */
+  uint32_t window_bytes_left_;
+
+  /** True if the values of the current window were reduced. */
+  bool window_reduced_;
+
+  /** Bit width of the values of the current window. */
+  uint8_t window_bits_;
+
+  /** Value offset of the current window. */
+  T window_value_offset_;
+
+  /** Decoded block. */
+  T block_[block_nelts];
+
+  /** Packed input of the decoded block. */
+  char packed_[block_nelts * sizeof(T)];
+
+  /** Offset in bytes of the next unread byte of the decoded block. */
+  uint32_t block_offset_;
+
+  /** Size in bytes of the decoded block. */
+  uint32_t block_size_;
+};
+
+/**
+ * Reverses POSITIVE_DELTA -> BIT_WIDTH_REDUCTION. The format of the
+ * metadata and data is documented in the two filter classes.
+ */
+template <class T>
+Status run_reverse_delta_bit_width(
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) {
+  uint32_t orig_length, bit_width_num_windows;
+  RETURN_NOT_OK(input_metadata->read(&orig_length, sizeof(uint32_t)));
+  RETURN_NOT_OK(
+      input_metadata->read(&bit_width_num_windows, sizeof(uint32_t)));
+
+  // The positive delta metadata follows the bit width reduction window
+  // headers; read it through a separate view so that both can be consumed
+  // together.
+  const uint64_t window_md_size =
+      sizeof(T) + sizeof(uint8_t) + sizeof(uint32_t);
+  const uint64_t delta_md_offset =
+      input_metadata->offset() + bit_width_num_windows * window_md_size;
+  if (delta_md_offset > input_metadata->size())
+    return LOG_STATUS(Status_FilterError(
+        "Fused filter error; invalid bit width reduction metadata."));
+  FilterBuffer delta_metadata;
+  RETURN_NOT_OK(delta_metadata.append_view(
+      input_metadata,
+      delta_md_offset,
+      input_metadata->size() - delta_md_offset));
+
+  BitWidthReductionReader<T> reader(
+      input_metadata, input, bit_width_num_windows);
+
+  uint32_t num_windows;
+  RETURN_NOT_OK(delta_metadata.read(&num_windows, sizeof(uint32_t)));
+
+  RETURN_NOT_OK(output->prepend_buffer(orig_length));
+  output->reset_offset();
+
+  T block[block_nelts];
+  for (uint32_t i = 0; i < num_windows; i++) {
+    T window_value_offset;
+    uint32_t window_nbytes;
+    RETURN_NOT_OK(delta_metadata.read(&window_value_offset, sizeof(T)));
+    RETURN_NOT_OK(delta_metadata.read(&window_nbytes, sizeof(uint32_t)));
+
+    // Windows that were not delta encoded are copied through.
+    const bool encoded = window_nbytes % sizeof(T) == 0;
+    T prev_value = window_value_offset;
+    while (window_nbytes > 0) {
+      auto nbytes = std::min(
+          window_nbytes, block_nelts * static_cast<uint32_t>(sizeof(T)));
+      RETURN_NOT_OK(reader.read(block, nbytes));
+
+      if (encoded) {
+        prev_value = filter_kernels::delta_decode(
+            block, block, nbytes / sizeof(T), prev_value);
+      }
+
+      RETURN_NOT_OK(output->write(block, nbytes));
+      window_nbytes -= nbytes;
+    }
+  }
+
+  // Output metadata is a view on the input metadata, skipping what was used
+  // by both filters.
+  auto md_offset = delta_metadata.offset();
+  RETURN_NOT_OK(output_metadata->append_view(
+      &delta_metadata, md_offset, delta_metadata.size() - md_offset));
+
+  return Status::Ok();
+}
+
+}  // namespace
+
+bool FusedFilterKernels::can_fuse_reverse(
+    const Filter& first, const Filter& second, Datatype type) {
+  // Both filters pass other types through unmodified. Datetime and time
+  // values are int64 but are stored unencoded too, as the filters only
+  // encode `datatype_is_integer` types; the fused kernel passes them through
+  // in one step.
+  const bool datetime = datatype_is_datetime(type) || datatype_is_time(type);
+  if (!datetime && (!datatype_is_integer(type) || datatype_size(type) == 1))
+    return false;
+
+  return first.type() == FilterType::FILTER_POSITIVE_DELTA &&
+         second.type() == FilterType::FILTER_BIT_WIDTH_REDUCTION;
+}
+
+Status FusedFilterKernels::run_reverse(
+    const Filter&,
+    const Filter&,
+    Datatype type,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) {
+  switch (type) {
+    case Datatype::INT16:
+      return run_reverse_delta_bit_width<int16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT16:
+      return run_reverse_delta_bit_width<uint16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT32:
+      return run_reverse_delta_bit_width<int>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT32:
+      return run_reverse_delta_bit_width<unsigned>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT64:
+      return run_reverse_delta_bit_width<int64_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT64:
+      return run_reverse_delta_bit_width<uint64_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      RETURN_NOT_OK(output->append_view(input));
+      RETURN_NOT_OK(output_metadata->append_view(input_metadata));
+      return Status::Ok();
+    default:
+      return LOG_STATUS(
+          Status_FilterError("Fused filter error; unsupported input type"));
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
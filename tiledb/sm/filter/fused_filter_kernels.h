@@ -0,0 +1,90 @@
+/**
+ * @file   fused_filter_kernels.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class FusedFilterKernels.
+ */
+
+#ifndef TILEDB_FUSED_FILTER_KERNELS_H
+#define TILEDB_FUSED_FILTER_KERNELS_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/enums/datatype.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class Filter;
+class FilterBuffer;
+
+/**
+ * Kernels that reverse two adjacent filters of a pipeline in a single pass.
+ *
+ * Running the filters one after the other materializes the full
+ * intermediate chunk between them. A fused kernel instead decodes the first
+ * step one small block at a time and applies the second step while the
+ * block is still in cache.
+ *
+ * Supported filter pairs (in forward order):
+ *   POSITIVE_DELTA -> BIT_WIDTH_REDUCTION, on integer types wider than one
+ *   byte.
+ */
+class FusedFilterKernels {
+ public:
+  /**
+   * Returns true if the filters `first` and `second`, applied in that order
+   * in the forward direction on data of the given type, can be reversed by
+   * run_reverse().
+   */
+  static bool can_fuse_reverse(
+      const Filter& first, const Filter& second, Datatype type);
+
+  /**
+   * Reverses `second` and then `first` in a single pass. The inputs and
+   * outputs have the same meaning as in Filter::run_reverse; `input` and
+   * `input_metadata` are the ones `second` would have received, `output` and
+   * `output_metadata` the ones `first` would have produced.
+   *
+   * @pre can_fuse_reverse(first, second, type) is true.
+   */
+  static Status run_reverse(
+      const Filter& first,
+      const Filter& second,
+      Datatype type,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_FUSED_FILTER_KERNELS_H
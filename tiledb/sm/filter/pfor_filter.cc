@@ -0,0 +1,464 @@
+/**
+ * @file   pfor_filter.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class PFORFilter.
+ */
+
+#include "tiledb/sm/filter/pfor_filter.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/filter_buffer.h"
+#include "tiledb/sm/filter/filter_kernels.h"
+#include "tiledb/sm/tile/tile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/** Returns the number of bits needed to represent `value`. */
+template <class U>
+static inline uint8_t bit_length(U value) {
+  uint8_t length = 0;
+  for (uint8_t shift = 4 * sizeof(U); shift > 0; shift /= 2) {
+    if ((value >> shift) != 0) {
+      value >>= shift;
+      length += shift;
+    }
+  }
+  return length + static_cast<uint8_t>(value);
+}
+
+/** Returns the size of a block header for values of type `T`. */
+template <class T>
+static constexpr uint64_t block_header_size() {
+  return sizeof(T) + 2 * sizeof(uint8_t);
+}
+
+void PFORFilter::dump(FILE* out) const {
+  if (out == nullptr)
+    out = stdout;
+  fprintf(out, "PFORFilter");
+}
+
+PFORFilter* PFORFilter::clone_impl() const {
+  return tdb_new(PFORFilter);
+}
+
+template <class T>
+uint8_t PFORFilter::choose_bit_width(const T* values, uint32_t n, T reference) {
+  using U = std::make_unsigned_t<T>;
+  constexpr uint8_t full_width = 8 * sizeof(T);
+  constexpr uint8_t max_width =
+      std::min<uint8_t>(full_width - 1, filter_kernels::max_packed_bit_width);
+
+  // Histogram of the number of bits needed by each value.
+  uint32_t counts[full_width + 1] = {};
+  for (uint32_t i = 0; i < n; i++)
+    counts[bit_length(static_cast<U>(U(values[i]) - U(reference)))]++;
+
+  // Values needing more bits than the width are exceptions; try every width
+  // from the widest down, counting the exceptions incrementally.
+  uint64_t best_size = uint64_t(n) * sizeof(T);
+  uint8_t best_width = full_width;
+  uint64_t num_exceptions = 0;
+  for (uint8_t width = full_width; width > max_width; width--)
+    num_exceptions += counts[width];
+  for (int width = max_width; width >= 0; width--) {
+    uint64_t size = filter_kernels::packed_size(n, uint8_t(width)) +
+                    num_exceptions * (sizeof(uint8_t) + sizeof(T));
+    if (size < best_size) {
+      best_size = size;
+      best_width = uint8_t(width);
+    }
+    num_exceptions += counts[width];
+  }
+
+  return best_width;
+}
+
+Status PFORFilter::run_forward(
+    const WriterTile& tile,
+    WriterTile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  switch (tile.type()) {
+    case Datatype::INT8:
+      return run_forward<int8_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::BLOB:
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return run_forward<uint8_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT16:
+      return run_forward<int16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT16:
+      return run_forward<uint16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT32:
+      return run_forward<int32_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT32:
+      return run_forward<uint32_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT64:
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return run_forward<int64_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT64:
+      return run_forward<uint64_t>(
+          input_metadata, input, output_metadata, output);
+    default:
+      // Non-integer data is passed through unmodified.
+      RETURN_NOT_OK(output->append_view(input));
+      RETURN_NOT_OK(output_metadata->append_view(input_metadata));
+      return Status::Ok();
+  }
+}
+
+template <class T>
+Status PFORFilter::run_forward(
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  // Compute the upper bound on the size of the output. A block is stored
+  // unmodified unless encoding makes it smaller.
+  std::vector<ConstBuffer> parts = input->buffers();
+  auto num_parts = static_cast<uint32_t>(parts.size());
+  uint64_t output_size_ub = 0;
+  for (const auto& part : parts) {
+    uint64_t nelts = part.size() / sizeof(T);
+    uint64_t num_blocks = (nelts + block_nelts - 1) / block_nelts;
+    output_size_ub += part.size() + num_blocks * block_header_size<T>();
+  }
+
+  // Allocate space in output buffer for the upper bound.
+  RETURN_NOT_OK(output->prepend_buffer(output_size_ub));
+  output->reset_offset();
+
+  // Forward the existing metadata, then write this filter's metadata.
+  RETURN_NOT_OK(output_metadata->append_view(input_metadata));
+  uint32_t metadata_size = (num_parts + 1) * sizeof(uint32_t);
+  RETURN_NOT_OK(output_metadata->prepend_buffer(metadata_size));
+  RETURN_NOT_OK(output_metadata->write(&num_parts, sizeof(uint32_t)));
+  for (const auto& part : parts) {
+    auto part_size = static_cast<uint32_t>(part.size());
+    RETURN_NOT_OK(output_metadata->write(&part_size, sizeof(uint32_t)));
+  }
+
+  // Encode all parts.
+  for (const auto& part : parts)
+    RETURN_NOT_OK(encode_part<T>(part, output));
+
+  return Status::Ok();
+}
+
+template <class T>
+Status PFORFilter::encode_part(
+    const ConstBuffer& part, FilterBuffer* output) const {
+  using U = std::make_unsigned_t<T>;
+  constexpr uint8_t full_width = 8 * sizeof(T);
+
+  auto data = static_cast<const char*>(part.data());
+  uint64_t nelts = part.size() / sizeof(T);
+  T block[block_nelts];
+  uint8_t packed[block_nelts * sizeof(T)];
+  uint8_t positions[block_nelts];
+  T highs[block_nelts];
+
+  for (uint64_t start = 0; start < nelts; start += block_nelts) {
+    auto n = static_cast<uint32_t>(
+        std::min<uint64_t>(block_nelts, nelts - start));
+    std::memcpy(block, data + start * sizeof(T), n * sizeof(T));
+
+    T reference = *std::min_element(block, block + n);
+    uint8_t bit_width = choose_bit_width(block, n, reference);
+    RETURN_NOT_OK(output->write(&reference, sizeof(T)));
+    RETURN_NOT_OK(output->write(&bit_width, sizeof(uint8_t)));
+
+    if (bit_width == full_width) {
+      // Encoding does not pay off; store the block unmodified.
+      uint8_t num_exceptions = 0;
+      RETURN_NOT_OK(output->write(&num_exceptions, sizeof(uint8_t)));
+      RETURN_NOT_OK(output->write(block, n * sizeof(T)));
+      continue;
+    }
+
+    // Collect the high bits of the values that do not fit the width. Their
+    // low bits are packed with the other values.
+    uint8_t num_exceptions = 0;
+    for (uint32_t i = 0; i < n; i++) {
+      U high = static_cast<U>(U(block[i]) - U(reference)) >> bit_width;
+      if (high != 0) {
+        positions[num_exceptions] = static_cast<uint8_t>(i);
+        highs[num_exceptions] = static_cast<T>(high);
+        num_exceptions++;
+      }
+    }
+    RETURN_NOT_OK(output->write(&num_exceptions, sizeof(uint8_t)));
+
+    filter_kernels::pack_bits(block, packed, n, reference, bit_width);
+    RETURN_NOT_OK(
+        output->write(packed, filter_kernels::packed_size(n, bit_width)));
+    if (num_exceptions > 0) {
+      RETURN_NOT_OK(output->write(positions, num_exceptions));
+      RETURN_NOT_OK(output->write(highs, num_exceptions * sizeof(T)));
+    }
+  }
+
+  // Write any trailing bytes that do not form a whole value.
+  uint64_t trailing = part.size() % sizeof(T);
+  if (trailing > 0)
+    RETURN_NOT_OK(output->write(data + nelts * sizeof(T), trailing));
+
+  return Status::Ok();
+}
+
+Status PFORFilter::run_reverse(
+    const Tile& tile,
+    Tile* const,
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output,
+    const Config&) const {
+  switch (tile.type()) {
+    case Datatype::INT8:
+      return run_reverse<int8_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::BLOB:
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return run_reverse<uint8_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT16:
+      return run_reverse<int16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT16:
+      return run_reverse<uint16_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT32:
+      return run_reverse<int32_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT32:
+      return run_reverse<uint32_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::INT64:
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return run_reverse<int64_t>(
+          input_metadata, input, output_metadata, output);
+    case Datatype::UINT64:
+      return run_reverse<uint64_t>(
+          input_metadata, input, output_metadata, output);
+    default:
+      // Non-integer data was passed through unmodified.
+      RETURN_NOT_OK(output->append_view(input));
+      RETURN_NOT_OK(output_metadata->append_view(input_metadata));
+      return Status::Ok();
+  }
+}
+
+template <class T>
+Status PFORFilter::run_reverse(
+    FilterBuffer* input_metadata,
+    FilterBuffer* input,
+    FilterBuffer* output_metadata,
+    FilterBuffer* output) const {
+  uint32_t num_parts;
+  RETURN_NOT_OK(input_metadata->read(&num_parts, sizeof(uint32_t)));
+  std::vector<uint32_t> part_sizes(num_parts);
+  uint64_t total_size = 0;
+  for (uint32_t i = 0; i < num_parts; i++) {
+    RETURN_NOT_OK(input_metadata->read(&part_sizes[i], sizeof(uint32_t)));
+    total_size += part_sizes[i];
+  }
+
+  RETURN_NOT_OK(output->prepend_buffer(total_size));
+  output->reset_offset();
+
+  // Decode all parts.
+  for (uint32_t part_size : part_sizes)
+    RETURN_NOT_OK(decode_part<T>(part_size, input, output));
+
+  // Output metadata is a view on the input metadata, skipping what was used by
+  // this filter.
+  auto md_offset = input_metadata->offset();
+  RETURN_NOT_OK(output_metadata->append_view(
+      input_metadata, md_offset, input_metadata->size() - md_offset));
+
+  return Status::Ok();
+}
+
+template <class T>
+Status PFORFilter::decode_part(
+    uint32_t nbytes, FilterBuffer* input, FilterBuffer* output) const {
+  using U = std::make_unsigned_t<T>;
+  constexpr uint8_t full_width = 8 * sizeof(T);
+
+  uint64_t nelts = nbytes / sizeof(T);
+  T block[block_nelts];
+  uint8_t positions[block_nelts];
+  T highs[block_nelts];
+
+  for (uint64_t start = 0; start < nelts; start += block_nelts) {
+    auto n = static_cast<uint32_t>(
+        std::min<uint64_t>(block_nelts, nelts - start));
+
+    T reference;
+    uint8_t bit_width, num_exceptions;
+    RETURN_NOT_OK(input->read(&reference, sizeof(T)));
+    RETURN_NOT_OK(input->read(&bit_width, sizeof(uint8_t)));
+    RETURN_NOT_OK(input->read(&num_exceptions, sizeof(uint8_t)));
+
+    if (bit_width == full_width) {
+      // The block was stored unmodified.
+      RETURN_NOT_OK(output->write(input, n * sizeof(T)));
+      input->advance_offset(n * sizeof(T));
+      continue;
+    }
+    if (bit_width > full_width ||
+        bit_width > filter_kernels::max_packed_bit_width ||
+        num_exceptions > n) {
+      return LOG_STATUS(Status_FilterError(
+          "PFOR filter error; invalid block header in filtered data"));
+    }
+
+    uint64_t packed_nbytes = filter_kernels::packed_size(n, bit_width);
+    if (packed_nbytes > 0) {
+      ConstBuffer packed(nullptr, 0);
+      RETURN_NOT_OK(input->get_const_buffer(packed_nbytes, &packed));
+      filter_kernels::unpack_bits(
+          static_cast<const uint8_t*>(packed.data()),
+          block,
+          n,
+          reference,
+          bit_width);
+      input->advance_offset(packed_nbytes);
+    } else {
+      std::fill(block, block + n, reference);
+    }
+
+    // Patch the exceptions with their high bits.
+    if (num_exceptions > 0) {
+      RETURN_NOT_OK(input->read(positions, num_exceptions));
+      RETURN_NOT_OK(input->read(highs, num_exceptions * sizeof(T)));
+    }
+    for (uint8_t i = 0; i < num_exceptions; i++) {
+      if (positions[i] >= n) {
+        return LOG_STATUS(Status_FilterError(
+            "PFOR filter error; invalid exception position in filtered data"));
+      }
+      T& value = block[positions[i]];
+      value = static_cast<T>(U(value) + (U(highs[i]) << bit_width));
+    }
+
+    RETURN_NOT_OK(output->write(block, n * sizeof(T)));
+  }
+
+  // Copy any trailing bytes that do not form a whole value.
+  uint64_t trailing = nbytes % sizeof(T);
+  if (trailing > 0) {
+    RETURN_NOT_OK(output->write(input, trailing));
+    input->advance_offset(trailing);
+  }
+
+  return Status::Ok();
+}
+
+template uint8_t PFORFilter::choose_bit_width<int8_t>(
+    const int8_t*, uint32_t, int8_t);
+template uint8_t PFORFilter::choose_bit_width<uint8_t>(
+    const uint8_t*, uint32_t, uint8_t);
+template uint8_t PFORFilter::choose_bit_width<int16_t>(
+    const int16_t*, uint32_t, int16_t);
+template uint8_t PFORFilter::choose_bit_width<uint16_t>(
+    const uint16_t*, uint32_t, uint16_t);
+template uint8_t PFORFilter::choose_bit_width<int32_t>(
+    const int32_t*, uint32_t, int32_t);
+template uint8_t PFORFilter::choose_bit_width<uint32_t>(
+    const uint32_t*, uint32_t, uint32_t);
+template uint8_t PFORFilter::choose_bit_width<int64_t>(
+    const int64_t*, uint32_t, int64_t);
+template uint8_t PFORFilter::choose_bit_width<uint64_t>(
+    const uint64_t*, uint32_t, uint64_t);
+
+}  // namespace sm
+}  // namespace tiledb
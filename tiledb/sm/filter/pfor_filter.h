@@ -0,0 +1,166 @@
+/**
+ * @file   pfor_filter.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares class PFORFilter.
+ */
+
+#ifndef TILEDB_PFOR_FILTER_H
+#define TILEDB_PFOR_FILTER_H
+
+#include "tiledb/common/status.h"
+#include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/filter.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A patched frame-of-reference (PFOR) filter for integer data.
+ *
+ * Each part of the input is split into blocks of `block_nelts` values. The
+ * values of a block are stored relative to the block minimum, packed to an
+ * arbitrary number of bits. The bit width is chosen per block to minimize the
+ * block size: values that do not fit are stored as exceptions, which keep the
+ * low bits in the packed array and their high bits after it. Blocks that
+ * would not shrink are stored unmodified.
+ *
+ * Chain it after POSITIVE_DELTA to store sorted or monotonic data, such as
+ * counters, as delta+FOR.
+ *
+ * Input metadata is not compressed or modified. Non-integer input is passed
+ * through unmodified.
+ *
+ * The forward output metadata has the format:
+ *   uint32_t - Number of parts
+ *   uint32_t - Number of bytes in part0
+ *   ...
+ *   uint32_t - Number of bytes in partN
+ *
+ * The forward output data format is the concatenated encoded parts, where
+ * each part has the format:
+ *   block0
+ *   ...
+ *   blockN
+ *   uint8_t[] - Trailing bytes of the part that do not form a whole value
+ * And each block has the format:
+ *   T - Block minimum
+ *   uint8_t - Bit width, 8 * sizeof(T) if the block is stored unmodified
+ *   uint8_t - Number of exceptions
+ *   uint8_t[] - Packed values (see filter_kernels::pack_bits)
+ *   uint8_t[] - Positions of the exceptions in the block
+ *   T[] - High bits of the exceptions, i.e. value >> bit width
+ *
+ * The reverse output format is simply:
+ *   T[] - Array of original elements
+ */
+class PFORFilter : public Filter {
+ public:
+  /** Number of values in a block. */
+  static constexpr uint32_t block_nelts = 128;
+
+  /** Constructor. */
+  PFORFilter()
+      : Filter(FilterType::FILTER_PFOR) {
+  }
+
+  /** Dumps the filter details in ASCII format in the selected output. */
+  void dump(FILE* out) const override;
+
+  /**
+   * Encode the given input into the given output.
+   */
+  Status run_forward(
+      const WriterTile& tile,
+      WriterTile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const override;
+
+  /**
+   * Decode the given input into the given output.
+   */
+  Status run_reverse(
+      const Tile& tile,
+      Tile* const offsets_tile,
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output,
+      const Config& config) const override;
+
+  /**
+   * Chooses the bit width of a block of values, minimizing the encoded size.
+   *
+   * @tparam T Value type.
+   * @param values The values of the block.
+   * @param n Number of values, at most `block_nelts`.
+   * @param reference The minimum of the values.
+   * @return The chosen bit width, or 8 * sizeof(T) if the block should be
+   *     stored unmodified.
+   */
+  template <class T>
+  static uint8_t choose_bit_width(const T* values, uint32_t n, T reference);
+
+ private:
+  /** Returns a new clone of this filter. */
+  PFORFilter* clone_impl() const override;
+
+  /** Run forward, templated on the tile type. */
+  template <class T>
+  Status run_forward(
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const;
+
+  /** Encodes a single part of the input. */
+  template <class T>
+  Status encode_part(const ConstBuffer& part, FilterBuffer* output) const;
+
+  /** Run reverse, templated on the tile type. */
+  template <class T>
+  Status run_reverse(
+      FilterBuffer* input_metadata,
+      FilterBuffer* input,
+      FilterBuffer* output_metadata,
+      FilterBuffer* output) const;
+
+  /** Decodes a single part of `nbytes` decoded bytes from the input. */
+  template <class T>
+  Status decode_part(
+      uint32_t nbytes, FilterBuffer* input, FilterBuffer* output) const;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_PFOR_FILTER_H
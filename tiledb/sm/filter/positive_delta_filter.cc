@@ -35,15 +35,21 @@
 #include "tiledb/sm/enums/datatype.h"
 #include "tiledb/sm/enums/filter_option.h"
 #include "tiledb/sm/enums/filter_type.h"
+#include "tiledb/sm/filter/filter_kernels.h"
 #include "tiledb/sm/filter/filter_pipeline.h"
 #include "tiledb/sm/misc/utils.h"
 #include "tiledb/sm/tile/tile.h"
 
+#include <algorithm>
+
 using namespace tiledb::common;
 
 namespace tiledb {
 namespace sm {
 
+/** Number of values encoded or decoded at a time. */
+static constexpr uint32_t block_nelts = 512;
+
 PositiveDeltaFilter::PositiveDeltaFilter()
     : Filter(FilterType::FILTER_POSITIVE_DELTA) {
   max_window_size_ = 1024;
@@ -217,20 +223,22 @@ Status PositiveDeltaFilter::encode_part(
           output->write((char*)input->data() + input->offset(), window_nbytes));
       input->advance_offset(window_nbytes);
     } else {
-      // Encode and write the relative values to output.
-      T prev_value = input->value<T>();
-      for (uint32_t j = 0; j < window_nelts; j++) {
-        T curr_value = input->value<T>();
-        if (curr_value < prev_value)
+      // Encode and write the relative values to output, one block at a
+      // time.
+      auto values = reinterpret_cast<const T*>(
+          static_cast<const char*>(input->data()) + input->offset());
+      T prev_value = values[0];
+      T block[block_nelts];
+      for (uint32_t j = 0; j < window_nelts; j += block_nelts) {
+        uint32_t nelts = std::min(block_nelts, window_nelts - j);
+        if (!filter_kernels::delta_encode(values + j, block, nelts, prev_value))
           return LOG_STATUS(Status_FilterError(
               "Positive delta filter error: delta is not positive."));
 
-        T delta = curr_value - prev_value;
-        RETURN_NOT_OK(output->write(&delta, sizeof(T)));
-        input->advance_offset(sizeof(T));
-
-        prev_value = curr_value;
+        RETURN_NOT_OK(output->write(block, nelts * sizeof(T)));
+        prev_value = values[j + nelts - 1];
       }
+      input->advance_offset(window_nbytes);
     }
   }
 
@@ -330,7 +338,11 @@ Status PositiveDeltaFilter::run_reverse(
   uint32_t num_windows;
   RETURN_NOT_OK(input_metadata->read(&num_windows, sizeof(uint32_t)));
 
-  RETURN_NOT_OK(output->prepend_buffer(input->size()));
+  // Decoding does not change the size, so the input is overwritten when it is
+  // not shared. Each delta is read before its decoded value is written.
+  const bool in_place = output->prepend_in_place(input);
+  if (!in_place)
+    RETURN_NOT_OK(output->prepend_buffer(input->size()));
   output->reset_offset();
 
   // Read each window
@@ -343,19 +355,23 @@ Status PositiveDeltaFilter::run_reverse(
 
     if (window_nbytes % sizeof(T) != 0) {
       // Window was not encoded.
-      RETURN_NOT_OK(output->write(input, window_nbytes));
+      if (in_place) {
+        output->advance_offset(window_nbytes);
+      } else {
+        RETURN_NOT_OK(output->write(input, window_nbytes));
+      }
       input->advance_offset(window_nbytes);
     } else {
-      // Read and decode each window value.
+      // Read and decode the window values one block at a time.
       uint32_t window_nelts = window_nbytes / sizeof(T);
       T prev_value = window_value_offset;
-      for (uint32_t j = 0; j < window_nelts; j++) {
-        T delta;
-        RETURN_NOT_OK(input->read(&delta, sizeof(T)));
-        T decoded_value = prev_value + delta;
-        RETURN_NOT_OK(output->write(&decoded_value, tile_type_size));
-
-        prev_value = decoded_value;
+      T block[block_nelts];
+      for (uint32_t j = 0; j < window_nelts; j += block_nelts) {
+        uint32_t nelts = std::min(block_nelts, window_nelts - j);
+        RETURN_NOT_OK(input->read(block, nelts * sizeof(T)));
+        prev_value =
+            filter_kernels::delta_decode(block, block, nelts, prev_value);
+        RETURN_NOT_OK(output->write(block, nelts * sizeof(T)));
       }
     }
   }
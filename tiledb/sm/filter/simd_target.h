@@ -0,0 +1,52 @@
+/**
+ * @file   simd_target.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the macros used to compile kernels for instruction set
+ * extensions the library is not built for. Functions marked with a target
+ * macro may only be called once filter_kernels::simd_level() reports the
+ * matching level.
+ */
+
+#ifndef TILEDB_SIMD_TARGET_H
+#define TILEDB_SIMD_TARGET_H
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define TILEDB_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define TILEDB_TARGET_AVX2
+#define TILEDB_TARGET_AVX512
+#else
+#define TILEDB_TARGET_AVX2 __attribute__((target("avx2")))
+#define TILEDB_TARGET_AVX512 \
+  __attribute__((target("avx2,avx512f,avx512bw")))
+#endif
+#endif
+
+#endif  // TILEDB_SIMD_TARGET_H
@@ -0,0 +1,138 @@
+/**
+ * @file   bench_filter_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Microbenchmarks of the filter kernels at every SIMD level supported by the
+ * CPU, on one maximum-size tile chunk. Prints the throughput of every kernel
+ * in MB/s.
+ *
+ * Usage: bench_filter_kernels [iterations]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../filter_kernels.h"
+#include "tiledb/sm/misc/constants.h"
+
+using namespace tiledb::sm;
+using namespace tiledb::sm::filter_kernels;
+
+namespace {
+
+/** Returns the levels supported by this CPU. */
+std::vector<SimdLevel> supported_levels() {
+  std::vector<SimdLevel> levels;
+  for (auto level : {SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2}) {
+    if (level <= simd_level())
+      levels.push_back(level);
+  }
+  return levels;
+}
+
+/** Keeps the results of the benchmarked kernels alive. */
+volatile uint64_t sink;
+
+/**
+ * Runs `f` `iterations` times and prints the best throughput over `nbytes`
+ * processed per run.
+ */
+template <class F>
+void run(
+    const char* type,
+    const char* kernel,
+    SimdLevel level,
+    uint64_t nbytes,
+    uint64_t iterations,
+    F&& f) {
+  double best = 0;
+  for (uint64_t i = 0; i < iterations; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    sink = static_cast<uint64_t>(f());
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    best = std::max(best, nbytes / elapsed.count() / 1e6);
+  }
+  std::printf(
+      "%-10s %-14s %-8s %10.1f MB/s\n",
+      type,
+      kernel,
+      simd_level_str(level),
+      best);
+}
+
+template <class T>
+void bench_kernels(const char* type, uint64_t iterations) {
+  const uint64_t n = constants::max_tile_chunk_size / sizeof(T);
+  const uint64_t nbytes = n * sizeof(T);
+  std::vector<T> input(n);
+  std::iota(input.begin(), input.end(), T(0));
+  std::vector<T> output(n);
+  const uint8_t bit_width = std::min<uint8_t>(8 * sizeof(T) - 1, 11);
+  std::vector<uint8_t> packed(packed_size(n, bit_width));
+  pack_bits(input.data(), packed.data(), n, T(0), bit_width);
+
+  for (auto level : supported_levels()) {
+    run(type, "xor encode", level, nbytes, iterations, [&] {
+      xor_encode(input.data(), output.data(), n, level);
+      return output[n - 1];
+    });
+    run(type, "xor decode", level, nbytes, iterations, [&] {
+      xor_decode(input.data(), output.data(), n, level);
+      return output[n - 1];
+    });
+    run(type, "delta encode", level, nbytes, iterations, [&] {
+      return delta_encode(input.data(), output.data(), n, T(0), level);
+    });
+    run(type, "delta decode", level, nbytes, iterations, [&] {
+      return delta_decode(input.data(), output.data(), n, T(0), level);
+    });
+    run(type, "unpack bits", level, nbytes, iterations, [&] {
+      unpack_bits(packed.data(), output.data(), n, T(0), bit_width, level);
+      return output[n - 1];
+    });
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const uint64_t iterations =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100;
+  std::printf("simd level: %s\n", simd_level_str(simd_level()));
+  bench_kernels<uint8_t>("uint8", iterations);
+  bench_kernels<uint16_t>("uint16", iterations);
+  bench_kernels<uint32_t>("uint32", iterations);
+  bench_kernels<uint64_t>("uint64", iterations);
+  return 0;
+}
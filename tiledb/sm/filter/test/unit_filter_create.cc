@@ -410,6 +410,43 @@ TEST_CASE("Filter: Test XOR filter deserialization", "[filter][xor]") {
   CHECK(filter1->type() == filtertype0);
 }
 
+TEST_CASE("Filter: Test PFOR filter deserialization", "[filter][pfor]") {
+  FilterType filtertype0 = FilterType::FILTER_PFOR;
+  char serialized_buffer[5];
+  char* p = &serialized_buffer[0];
+  buffer_offset<uint8_t, 0>(p) = static_cast<uint8_t>(filtertype0);
+  buffer_offset<uint32_t, 1>(p) = 0;  // metadata_length
+
+  Deserializer deserializer(&serialized_buffer, sizeof(serialized_buffer));
+  auto filter1{
+      FilterCreate::deserialize(deserializer, constants::format_version)};
+
+  // Check type
+  CHECK(filter1->type() == filtertype0);
+}
+
+TEST_CASE(
+    "Filter: Test adaptive compression filter deserialization",
+    "[filter][adaptive-compression]") {
+  FilterType filtertype0 = FilterType::FILTER_ADAPTIVE_COMPRESSION;
+  double weight0 = 0.25;
+  char serialized_buffer[13];
+  char* p = &serialized_buffer[0];
+  buffer_offset<uint8_t, 0>(p) = static_cast<uint8_t>(filtertype0);
+  buffer_offset<uint32_t, 1>(p) = sizeof(double);  // metadata_length
+  buffer_offset<double, 5>(p) = weight0;
+
+  Deserializer deserializer(&serialized_buffer, sizeof(serialized_buffer));
+  auto filter1{
+      FilterCreate::deserialize(deserializer, constants::format_version)};
+  CHECK(filter1->type() == filtertype0);
+  double weight1 = 0.0;
+  REQUIRE(filter1
+              ->get_option(FilterOption::ADAPTIVE_DECODE_COST_WEIGHT, &weight1)
+              .ok());
+  CHECK(weight0 == weight1);
+}
+
 TEST_CASE("Filter: Test WEBP filter deserialization", "[filter][webp]") {
   if constexpr (webp_filter_exists) {
     Buffer buffer;
@@ -0,0 +1,205 @@
+/**
+ * @file   unit_filter_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the vectorized filter kernels against their scalar versions.
+ */
+
+#include <test/support/tdb_catch.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../filter_kernels.h"
+
+using namespace tiledb::sm::filter_kernels;
+
+namespace {
+
+/** Sizes covering empty input, partial registers and several registers. */
+const std::vector<uint64_t> sizes = {
+    0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 257, 1000};
+
+/** All levels; the ones above simd_level() fall back to it. */
+const std::vector<SimdLevel> levels = {
+    SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2};
+
+template <class T>
+std::vector<T> random_values(uint64_t n, bool sorted) {
+  std::mt19937_64 gen(n);
+  std::vector<T> values(n);
+  for (auto& v : values)
+    v = static_cast<T>(gen());
+  if (sorted)
+    std::sort(values.begin(), values.end());
+  return values;
+}
+
+template <class T>
+void check_xor() {
+  for (auto n : sizes) {
+    auto input = random_values<T>(n, false);
+    std::vector<T> expected(n);
+    for (uint64_t i = 0; i < n; i++)
+      expected[i] = i == 0 ? input[0] : static_cast<T>(input[i] ^ input[i - 1]);
+
+    for (auto level : levels) {
+      for (bool in_place : {false, true}) {
+        std::vector<T> data = input;
+        std::vector<T> other(n);
+        T* encoded = in_place ? data.data() : other.data();
+        xor_encode(data.data(), encoded, n, level);
+        CHECK(std::equal(encoded, encoded + n, expected.begin()));
+
+        std::vector<T> copy(encoded, encoded + n);
+        std::vector<T> decoded_other(n);
+        T* decoded = in_place ? copy.data() : decoded_other.data();
+        xor_decode(copy.data(), decoded, n, level);
+        CHECK(std::equal(decoded, decoded + n, input.begin()));
+      }
+    }
+  }
+}
+
+template <class T>
+void check_delta() {
+  for (auto n : sizes) {
+    auto input = random_values<T>(n, true);
+    T base = n > 0 ? input[0] : T(0);
+
+    for (auto level : levels) {
+      for (bool in_place : {false, true}) {
+        std::vector<T> data = input;
+        std::vector<T> other(n);
+        T* encoded = in_place ? data.data() : other.data();
+        CHECK(delta_encode(data.data(), encoded, n, base, level));
+        for (uint64_t i = 0; i < n; i++) {
+          T prev = i == 0 ? base : input[i - 1];
+          CHECK(encoded[i] == static_cast<T>(input[i] - prev));
+        }
+
+        std::vector<T> copy(encoded, encoded + n);
+        std::vector<T> decoded_other(n);
+        T* decoded = in_place ? copy.data() : decoded_other.data();
+        T last = delta_decode(copy.data(), decoded, n, base, level);
+        CHECK(std::equal(decoded, decoded + n, input.begin()));
+        CHECK(last == (n > 0 ? input[n - 1] : base));
+      }
+
+      // A decreasing value anywhere is detected.
+      for (uint64_t pos = 1; pos < n; pos += std::max<uint64_t>(1, n / 5)) {
+        if (input[pos - 1] == std::numeric_limits<T>::lowest())
+          continue;
+        std::vector<T> data = input;
+        data[pos] = static_cast<T>(data[pos - 1] - 1);
+        std::vector<T> encoded(n);
+        CHECK(!delta_encode(data.data(), encoded.data(), n, base, level));
+      }
+    }
+  }
+}
+
+template <class T>
+void check_bit_packing() {
+  using U = std::make_unsigned_t<T>;
+  const uint8_t max_width =
+      std::min<uint8_t>(8 * sizeof(T), max_packed_bit_width);
+  for (auto n : sizes) {
+    auto input = random_values<T>(n, false);
+    T reference = n > 0 ? *std::min_element(input.begin(), input.end()) : T(0);
+
+    for (uint8_t width = 0; width <= max_width; width++) {
+      U mask = width == 8 * sizeof(T) ? U(~U(0)) : U((U(1) << width) - 1);
+      std::vector<uint8_t> packed(packed_size(n, width));
+      pack_bits(input.data(), packed.data(), n, reference, width);
+
+      for (auto level : levels) {
+        std::vector<T> output(n);
+        unpack_bits(packed.data(), output.data(), n, reference, width, level);
+        for (uint64_t i = 0; i < n; i++) {
+          U low = static_cast<U>(U(input[i]) - U(reference)) & mask;
+          CHECK(output[i] == static_cast<T>(U(reference) + low));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE(
+    "Filter kernels: bit packing",
+    "[filter][filter-kernels]",
+    int8_t,
+    uint8_t,
+    int16_t,
+    uint16_t,
+    int32_t,
+    uint32_t,
+    int64_t,
+    uint64_t) {
+  check_bit_packing<TestType>();
+}
+
+TEMPLATE_TEST_CASE(
+    "Filter kernels: XOR encoding",
+    "[filter][filter-kernels]",
+    int8_t,
+    uint8_t,
+    int16_t,
+    uint16_t,
+    int32_t,
+    uint32_t,
+    int64_t,
+    uint64_t) {
+  check_xor<TestType>();
+}
+
+TEMPLATE_TEST_CASE(
+    "Filter kernels: positive delta encoding",
+    "[filter][filter-kernels]",
+    int8_t,
+    uint8_t,
+    int16_t,
+    uint16_t,
+    int32_t,
+    uint32_t,
+    int64_t,
+    uint64_t) {
+  check_delta<TestType>();
+}
+
+TEST_CASE("Filter kernels: SIMD level", "[filter][filter-kernels]") {
+  auto level = simd_level();
+  CHECK(level == simd_level());
+  CHECK(std::string(simd_level_str(level)).size() > 0);
+}
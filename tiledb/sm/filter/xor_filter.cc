@@ -33,6 +33,7 @@
 #include "tiledb/common/logger.h"
 #include "tiledb/sm/enums/filter_option.h"
 #include "tiledb/sm/filter/filter_buffer.h"
+#include "tiledb/sm/filter/filter_kernels.h"
 #include "tiledb/sm/tile/tile.h"
 
 #include "tiledb/sm/filter/xor_filter.h"
@@ -95,13 +96,15 @@ Status XORFilter::run_forward(
     FilterBuffer* input,
     FilterBuffer* output_metadata,
     FilterBuffer* output) const {
-  // Output size does not change with this filter.
-  RETURN_NOT_OK(output->prepend_buffer(input->size()));
+  // Output size does not change with this filter, so the input is
+  // overwritten when it is not shared.
+  auto parts = input->buffers();
+  if (!output->prepend_in_place(input))
+    RETURN_NOT_OK(output->prepend_buffer(input->size()));
   Buffer* output_buf = output->buffer_ptr(0);
   assert(output_buf != nullptr);
 
   // Write the metadata
-  auto parts = input->buffers();
   auto num_parts = (uint32_t)parts.size();
   uint32_t metadata_size = sizeof(uint32_t) + num_parts * sizeof(uint32_t);
   RETURN_NOT_OK(output_metadata->append_view(input_metadata));
@@ -113,6 +116,11 @@ Status XORFilter::run_forward(
     auto part_size = (uint32_t)part.size();
     RETURN_NOT_OK(output_metadata->write(&part_size, sizeof(uint32_t)));
     RETURN_NOT_OK(xor_part<T>(&part, output_buf));
+
+    if (output_buf->owns_data()) {
+      output_buf->advance_size(part_size);
+    }
+    output_buf->advance_offset(part_size);
   }
 
   return Status::Ok();
@@ -130,19 +138,10 @@ Status XORFilter::xor_part(const ConstBuffer* part, Buffer* output) const {
     return Status::Ok();
   }
 
-  // Write starting element.
+  // The output may alias the part; the kernel supports working in place.
   const T* part_array = static_cast<const T*>(part->data());
-  RETURN_NOT_OK(output->write(part_array, sizeof(T)));
-  output->advance_offset(sizeof(T));
-
-  for (uint32_t j = 1; j < num_elems_in_part; ++j) {
-    T value = part_array[j] ^ part_array[j - 1];
-    RETURN_NOT_OK(output->write(&value, sizeof(T)));
-
-    if (j != num_elems_in_part - 1) {
-      output->advance_offset(sizeof(T));
-    }
-  }
+  T* output_array = static_cast<T*>(output->cur_data());
+  filter_kernels::xor_encode(part_array, output_array, num_elems_in_part);
 
   return Status::Ok();
 }
@@ -200,7 +199,8 @@ Status XORFilter::run_reverse(
   uint32_t num_parts;
   RETURN_NOT_OK(input_metadata->read(&num_parts, sizeof(uint32_t)));
 
-  RETURN_NOT_OK(output->prepend_buffer(input->size()));
+  if (!output->prepend_in_place(input))
+    RETURN_NOT_OK(output->prepend_buffer(input->size()));
   Buffer* output_buf = output->buffer_ptr(0);
   assert(output_buf != nullptr);
 
@@ -240,17 +240,9 @@ Status XORFilter::unxor_part(const ConstBuffer* part, Buffer* output) const {
     return Status::Ok();
   }
 
-  // Write starting element.
   const T* part_array = static_cast<const T*>(part->data());
   T* output_array = static_cast<T*>(output->cur_data());
-  output_array[0] = part_array[0];
-
-  T last_element = part_array[0];
-  for (uint32_t j = 1; j < num_elems_in_part; ++j) {
-    T value = last_element ^ part_array[j];
-    output_array[j] = value;
-    last_element = value;
-  }
+  filter_kernels::xor_decode(part_array, output_array, num_elems_in_part);
 
   return Status::Ok();
 }
@@ -975,15 +975,20 @@ void FragmentInfo::ensure_loaded() const {
 }
 
 Status FragmentInfo::load_and_replace(
-    const URI& new_fragment_uri,
+    const std::vector<URI>& new_fragment_uris,
     const std::vector<TimestampedURI>& to_replace) {
-  // Load the new single fragment info
-  auto&& [st, new_single_fragment_info] = load(new_fragment_uri);
-  RETURN_NOT_OK(st);
+  // Load the new single fragment infos
+  std::vector<SingleFragmentInfo> new_single_fragment_info;
+  new_single_fragment_info.reserve(new_fragment_uris.size());
+  for (auto& uri : new_fragment_uris) {
+    auto&& [st, info] = load(uri);
+    RETURN_NOT_OK(st);
+    new_single_fragment_info.emplace_back(std::move(info.value()));
+  }
 
   // Replace single fragment info elements with the new
-  // single fragment info
-  RETURN_NOT_OK(replace(new_single_fragment_info.value(), to_replace));
+  // single fragment infos
+  RETURN_NOT_OK(replace(new_single_fragment_info, to_replace));
 
   return Status::Ok();
 }
@@ -1101,7 +1106,7 @@ tuple<Status, optional<SingleFragmentInfo>> FragmentInfo::load(
 }
 
 Status FragmentInfo::replace(
-    const SingleFragmentInfo& new_single_fragment_info,
+    const std::vector<SingleFragmentInfo>& new_single_fragment_info,
     const std::vector<TimestampedURI>& to_replace) {
   auto to_replace_it = to_replace.begin();
   auto single_fragment_info_it = single_fragment_info_vec_.begin();
@@ -1116,9 +1121,12 @@ Status FragmentInfo::replace(
             to_replace_it->uri_.to_string()) {
       updated_single_fragment_info_vec.emplace_back(*single_fragment_info_it);
       ++single_fragment_info_it;
-    } else {  // Match - add new fragment only once and advance both iterators
+    } else {  // Match - add new fragments only once and advance both iterators
       if (!new_fragment_added) {
-        updated_single_fragment_info_vec.emplace_back(new_single_fragment_info);
+        updated_single_fragment_info_vec.insert(
+            updated_single_fragment_info_vec.end(),
+            new_single_fragment_info.begin(),
+            new_single_fragment_info.end());
         new_fragment_added = true;
       }
       ++single_fragment_info_it;
@@ -1128,7 +1136,9 @@ Status FragmentInfo::replace(
 
   single_fragment_info_vec_ = std::move(updated_single_fragment_info_vec);
 
-  assert(fragment_num() == old_fragment_num - to_replace.size() + 1);
+  assert(
+      fragment_num() == old_fragment_num - to_replace.size() +
+                            new_single_fragment_info.size());
   (void)old_fragment_num;  // When running in release mode, this is not used
 
   return Status::Ok();
@@ -285,18 +285,19 @@ class FragmentInfo {
   /**
    * It replaces a sequence of SingleFragmentInfo elements in
    * `single_fragment_info_vec_` which are determined by `to_replace`.
-   * It then loads a SingleFragmentInfo object for the `new_fragment_uri`
-   * fragment, and adds it in `single_fragment_info_vec_` at the postion
-   * of the first element of the corresponding `to_replace` object.
+   * It then loads a SingleFragmentInfo object for each of the
+   * `new_fragment_uris` fragments, and adds them in
+   * `single_fragment_info_vec_` at the postion of the first element of the
+   * corresponding `to_replace` object.
    *
-   * @param new_fragment_uri The new fragment to be loaded as a
-   *     SingleFragmentInfo object.
+   * @param new_fragment_uris The new fragments to be loaded as
+   *     SingleFragmentInfo objects, in order.
    * @param to_replace The SingleFragmentInfo elements to be replaced
-   *     in `single_fragment_info_vec_` by the new SingleFragmentInfo object.
+   *     in `single_fragment_info_vec_` by the new SingleFragmentInfo objects.
    * @return Status
    */
   Status load_and_replace(
-      const URI& new_fragment_uri,
+      const std::vector<URI>& new_fragment_uris,
       const std::vector<TimestampedURI>& to_replace);
 
   /** Returns the vector with the info about individual fragments. */
@@ -455,7 +456,7 @@ class FragmentInfo {
    * with `new_single_fragment_info`.
    */
   Status replace(
-      const SingleFragmentInfo& new_single_fragment_info,
+      const std::vector<SingleFragmentInfo>& new_single_fragment_info,
       const std::vector<TimestampedURI>& to_replace);
 
   /** Returns a copy of this object. */
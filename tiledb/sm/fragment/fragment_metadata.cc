@@ -41,6 +41,7 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/array_schema/domain.h"
 #include "tiledb/sm/buffer/buffer.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/constants.h"
@@ -56,6 +57,7 @@
 #include "tiledb/type/range/range.h"
 
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -364,6 +366,80 @@ void FragmentMetadata::set_tile_null_count(
   tile_null_counts_[idx][tid] = null_count;
 }
 
+void FragmentMetadata::copy_tile_metadata(
+    const std::string& name,
+    uint64_t tid,
+    FragmentMetadata& src,
+    uint64_t src_tid) {
+  auto it = idx_map_.find(name);
+  assert(it != idx_map_.end());
+  auto idx = it->second;
+  auto src_it = src.idx_map_.find(name);
+  assert(src_it != src.idx_map_.end());
+  auto src_idx = src_it->second;
+  const auto var_size = array_schema_->var_size(name);
+
+  // Offsets and sizes of the tile in the files of this fragment
+  set_tile_offset(name, tid, src.persisted_tile_size(name, src_tid));
+  if (var_size) {
+    set_tile_var_offset(name, tid, src.persisted_tile_var_size(name, src_tid));
+    set_tile_var_size(name, tid, src.tile_var_size(name, src_tid));
+  }
+  if (array_schema_->is_nullable(name)) {
+    set_tile_validity_offset(
+        name, tid, src.persisted_tile_validity_size(name, src_tid));
+    set_tile_null_count(name, tid, src.get_tile_null_count(name, src_tid));
+  }
+
+  // Min/max values
+  tid += tile_index_base_;
+  if (!tile_min_buffer_[idx].empty() &&
+      !src.tile_min_buffer_[src_idx].empty()) {
+    if (var_size) {
+      auto copy_var = [&](const std::vector<uint8_t>& src_offsets,
+                          const std::vector<char>& src_values,
+                          std::vector<uint8_t>& offsets,
+                          std::vector<char>& values) {
+        auto src_offs = (const uint64_t*)src_offsets.data();
+        auto start = src_offs[src_tid];
+        auto end = src_tid == src.tile_num() - 1 ? src_values.size() :
+                                                   src_offs[src_tid + 1];
+        ((uint64_t*)offsets.data())[tid] = values.size();
+        values.insert(
+            values.end(), src_values.begin() + start, src_values.begin() + end);
+      };
+      copy_var(
+          src.tile_min_buffer_[src_idx],
+          src.tile_min_var_buffer_[src_idx],
+          tile_min_buffer_[idx],
+          tile_min_var_buffer_[idx]);
+      copy_var(
+          src.tile_max_buffer_[src_idx],
+          src.tile_max_var_buffer_[src_idx],
+          tile_max_buffer_[idx],
+          tile_max_var_buffer_[idx]);
+    } else {
+      auto size = array_schema_->cell_size(name);
+      memcpy(
+          &tile_min_buffer_[idx][tid * size],
+          &src.tile_min_buffer_[src_idx][src_tid * size],
+          size);
+      memcpy(
+          &tile_max_buffer_[idx][tid * size],
+          &src.tile_max_buffer_[src_idx][src_tid * size],
+          size);
+    }
+  }
+
+  // Sum
+  if (!tile_sums_[idx].empty() && !src.tile_sums_[src_idx].empty()) {
+    memcpy(
+        &tile_sums_[idx][tid * sizeof(uint64_t)],
+        &src.tile_sums_[src_idx][src_tid * sizeof(uint64_t)],
+        sizeof(uint64_t));
+  }
+}
+
 template <>
 void FragmentMetadata::compute_fragment_min_max_sum<char>(
     const std::string& name);
@@ -792,10 +868,15 @@ Status FragmentMetadata::load(
   auto meta_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
   // Load the metadata file size when we are not reading from consolidated
-  // buffer
+  // buffer. A cached footer records it, saving the request to storage.
   if (fragment_metadata_tile == nullptr) {
-    RETURN_NOT_OK(
-        storage_manager_->vfs()->file_size(meta_uri, &meta_file_size_));
+    auto cached{cached_footer()};
+    if (cached != nullptr) {
+      meta_file_size_ = cached->file_size_;
+    } else {
+      RETURN_NOT_OK(
+          storage_manager_->vfs()->file_size(meta_uri, &meta_file_size_));
+    }
   }
 
   // Get fragment name version
@@ -3983,15 +4064,57 @@ tuple<Status, optional<Tile>> FragmentMetadata::read_generic_tile_from_file(
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
+  // Serve the component from the cache if possible. Decrypted components are
+  // never cached, so that they cannot be served without the key.
+  auto& cache{storage_manager_->resources().fragment_metadata_cache()};
+  const bool use_cache =
+      cache.enabled() &&
+      encryption_key.encryption_type() == EncryptionType::NO_ENCRYPTION;
+  if (use_cache) {
+    auto cached{cache.read(cache_key(offset))};
+    if (cached != nullptr) {
+      storage_manager_->stats()->add_counter("num_frag_meta_cache_hits", 1);
+      auto tile{Tile::from_generic(cached->size())};
+      if (cached->size() > 0) {
+        std::memcpy(tile.data(), cached->data_.data(), cached->size());
+      }
+      return {Status::Ok(), std::move(tile)};
+    }
+  }
+
   // Read metadata
   GenericTileIO tile_io(storage_manager_->resources(), fragment_metadata_uri);
   auto&& [st, tile_opt] =
       tile_io.read_generic(offset, encryption_key, storage_manager_->config());
   RETURN_NOT_OK_TUPLE(st, nullopt);
 
+  if (use_cache) {
+    CachedFragmentMetadataComponent component;
+    auto data = tile_opt->data_as<uint8_t>();
+    component.data_.assign(data, data + tile_opt->size());
+    cache.insert(cache_key(offset), std::move(component));
+  }
+
   return {Status::Ok(), std::move(*tile_opt)};
 }
 
+FragmentMetadataCacheKey FragmentMetadata::cache_key(uint64_t offset) const {
+  uint32_t format_version;
+  auto name = fragment_uri_.remove_trailing_slash().last_path_part();
+  throw_if_not_ok(utils::parse::get_fragment_version(name, &format_version));
+  return {fragment_uri_.to_string(), format_version, offset};
+}
+
+shared_ptr<const CachedFragmentMetadataComponent>
+FragmentMetadata::cached_footer() const {
+  auto& cache{storage_manager_->resources().fragment_metadata_cache()};
+  if (!cache.enabled()) {
+    return nullptr;
+  }
+
+  return cache.read(cache_key(FragmentMetadataCacheKey::footer_offset));
+}
+
 Status FragmentMetadata::read_file_footer(
     std::shared_ptr<Tile>& tile,
     uint64_t* footer_offset,
@@ -3999,8 +4122,14 @@ Status FragmentMetadata::read_file_footer(
   URI fragment_metadata_uri = fragment_uri_.join_path(
       std::string(constants::fragment_metadata_filename));
 
-  // Get footer offset
-  RETURN_NOT_OK(get_footer_offset_and_size(footer_offset, footer_size));
+  // Get footer offset, from the cache if the footer was loaded before
+  auto cached{cached_footer()};
+  if (cached != nullptr) {
+    *footer_offset = cached->footer_offset_;
+    *footer_size = cached->size();
+  } else {
+    RETURN_NOT_OK(get_footer_offset_and_size(footer_offset, footer_size));
+  }
 
   tile = make_shared<Tile>(HERE(), Tile::from_generic(*footer_size));
 
@@ -4017,12 +4146,34 @@ Status FragmentMetadata::read_file_footer(
         std::to_string(memory_tracker_->get_memory_budget())));
   }
 
+  if (cached != nullptr) {
+    storage_manager_->stats()->add_counter("num_frag_meta_cache_hits", 1);
+    if (*footer_size > 0) {
+      std::memcpy(tile->data(), cached->data_.data(), *footer_size);
+    }
+    return Status::Ok();
+  }
+
   // Read footer
-  return storage_manager_->vfs()->read(
+  RETURN_NOT_OK(storage_manager_->vfs()->read(
       fragment_metadata_uri,
       *footer_offset,
       tile->data_as<uint8_t>(),
-      *footer_size);
+      *footer_size));
+
+  auto& cache{storage_manager_->resources().fragment_metadata_cache()};
+  if (cache.enabled()) {
+    CachedFragmentMetadataComponent component;
+    auto data = tile->data_as<uint8_t>();
+    component.data_.assign(data, data + *footer_size);
+    component.footer_offset_ = *footer_offset;
+    component.file_size_ = meta_file_size_;
+    cache.insert(
+        cache_key(FragmentMetadataCacheKey::footer_offset),
+        std::move(component));
+  }
+
+  return Status::Ok();
 }
 
 Status FragmentMetadata::write_generic_tile_to_file(
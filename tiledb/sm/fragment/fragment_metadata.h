@@ -61,6 +61,8 @@ class ArraySchema;
 class Buffer;
 class EncryptionKey;
 class MemoryTracker;
+struct CachedFragmentMetadataComponent;
+struct FragmentMetadataCacheKey;
 
 /** Stores the metadata structures of a fragment. */
 class FragmentMetadata {
@@ -661,6 +663,25 @@ class FragmentMetadata {
   void set_tile_null_count(
       const std::string& name, uint64_t tid, uint64_t null_count);
 
+  /**
+   * Copies the metadata of a tile of another fragment with the same array
+   * schema into tile `tid` of this fragment, for a fragment that receives the
+   * filtered tiles of `src` byte-for-byte. This sets the tile offsets and
+   * sizes, the min/max/sum and the null count. The tiles of each attribute
+   * must be copied in increasing `tid` order, as var-sized min/max values are
+   * appended to the existing ones.
+   *
+   * @param name The attribute/dimension whose tile metadata is copied.
+   * @param tid The index of the tile in this fragment.
+   * @param src The fragment the tile is copied from.
+   * @param src_tid The index of the tile in `src`.
+   */
+  void copy_tile_metadata(
+      const std::string& name,
+      uint64_t tid,
+      FragmentMetadata& src,
+      uint64_t src_tid);
+
   /**
    * Compute fragment min, max, sum, null count for all dimensions/attributes.
    */
@@ -1996,6 +2017,21 @@ class FragmentMetadata {
   tuple<Status, optional<Tile>> read_generic_tile_from_file(
       const EncryptionKey& encryption_key, uint64_t offset) const;
 
+  /**
+   * Returns the key of a component of this fragment in the context's
+   * fragment metadata cache.
+   *
+   * @param offset The generic tile offset of the component, or
+   *     `FragmentMetadataCacheKey::footer_offset` for the footer.
+   */
+  FragmentMetadataCacheKey cache_key(uint64_t offset) const;
+
+  /**
+   * Returns the footer of this fragment from the context's fragment metadata
+   * cache, or `nullptr` if it is not cached.
+   */
+  shared_ptr<const CachedFragmentMetadataComponent> cached_footer() const;
+
   /**
    * Reads the fragment metadata file footer (which contains the generic tile
    * offsets) into the input buffer.
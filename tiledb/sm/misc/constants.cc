@@ -326,6 +326,27 @@ const std::string query_condition_op_eq_str = "EQ";
 /** TILEDB_NE Query Condition Op String **/
 const std::string query_condition_op_ne_str = "NE";
 
+/** TILEDB_IN Query Condition Op String **/
+const std::string query_condition_op_in_str = "IN";
+
+/** TILEDB_NOT_IN Query Condition Op String **/
+const std::string query_condition_op_not_in_str = "NOT_IN";
+
+/** TILEDB_AGGREGATE_COUNT Query Aggregate Op String **/
+const std::string query_aggregate_op_count_str = "COUNT";
+
+/** TILEDB_AGGREGATE_SUM Query Aggregate Op String **/
+const std::string query_aggregate_op_sum_str = "SUM";
+
+/** TILEDB_AGGREGATE_MIN Query Aggregate Op String **/
+const std::string query_aggregate_op_min_str = "MIN";
+
+/** TILEDB_AGGREGATE_MAX Query Aggregate Op String **/
+const std::string query_aggregate_op_max_str = "MAX";
+
+/** TILEDB_AGGREGATE_NULL_COUNT Query Aggregate Op String **/
+const std::string query_aggregate_op_null_count_str = "NULL_COUNT";
+
 /** TILEDB_AND Query Condition Combination Op String **/
 const std::string query_condition_combination_op_and_str = "AND";
 
@@ -401,6 +422,12 @@ const std::string filter_xor_str = "XOR";
 /** String describing FILTER_WEBP. */
 const std::string filter_webp_str = "WEBP";
 
+/** String describing FILTER_ADAPTIVE_COMPRESSION. */
+const std::string filter_adaptive_compression_str = "ADAPTIVE_COMPRESSION";
+
+/** String describing FILTER_PFOR. */
+const std::string filter_pfor_str = "PFOR";
+
 /** The string representation for FilterOption type compression_level. */
 const std::string filter_option_compression_level_str = "COMPRESSION_LEVEL";
 
@@ -431,6 +458,13 @@ const std::string filter_option_webp_input_format = "WEBP_INPUT_FORMAT";
 /** The string representation for FilterOption type webp_lossless. */
 const std::string filter_option_webp_lossless = "WEBP_LOSSLESS";
 
+/**
+ * The string representation for FilterOption type
+ * adaptive_decode_cost_weight.
+ */
+const std::string filter_option_adaptive_decode_cost_weight =
+    "ADAPTIVE_DECODE_COST_WEIGHT";
+
 /** The string representation for type int32. */
 const std::string int32_str = "INT32";
 
@@ -686,6 +720,9 @@ const unsigned int gcs_max_attempts = 100;
 /** Milliseconds of wait time between GCS attempts. */
 const unsigned int gcs_attempt_sleep_ms = 1000;
 
+/** Maximum number of reads in flight in an io_uring batched file read. */
+const unsigned int io_uring_queue_depth = 128;
+
 /** An allocation tag used for logging. */
 const std::string s3_allocation_tag = "TileDB";
 
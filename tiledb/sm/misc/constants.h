@@ -313,6 +313,27 @@ extern const std::string query_condition_op_eq_str;
 /** TILEDB_NE Query Condition Op String **/
 extern const std::string query_condition_op_ne_str;
 
+/** TILEDB_IN Query Condition Op String **/
+extern const std::string query_condition_op_in_str;
+
+/** TILEDB_NOT_IN Query Condition Op String **/
+extern const std::string query_condition_op_not_in_str;
+
+/** TILEDB_AGGREGATE_COUNT Query Aggregate Op String **/
+extern const std::string query_aggregate_op_count_str;
+
+/** TILEDB_AGGREGATE_SUM Query Aggregate Op String **/
+extern const std::string query_aggregate_op_sum_str;
+
+/** TILEDB_AGGREGATE_MIN Query Aggregate Op String **/
+extern const std::string query_aggregate_op_min_str;
+
+/** TILEDB_AGGREGATE_MAX Query Aggregate Op String **/
+extern const std::string query_aggregate_op_max_str;
+
+/** TILEDB_AGGREGATE_NULL_COUNT Query Aggregate Op String **/
+extern const std::string query_aggregate_op_null_count_str;
+
 /** TILEDB_AND Query Condition Combination Op String **/
 extern const std::string query_condition_combination_op_and_str;
 
@@ -388,6 +409,12 @@ extern const std::string filter_xor_str;
 /** String describing FILTER_WEBP. */
 extern const std::string filter_webp_str;
 
+/** String describing FILTER_ADAPTIVE_COMPRESSION. */
+extern const std::string filter_adaptive_compression_str;
+
+/** String describing FILTER_PFOR. */
+extern const std::string filter_pfor_str;
+
 /** The string representation for FilterOption type compression_level. */
 extern const std::string filter_option_compression_level_str;
 
@@ -416,6 +443,12 @@ extern const std::string filter_option_webp_input_format;
 /** The string representation for FilterOption type webp_lossless. */
 extern const std::string filter_option_webp_lossless;
 
+/**
+ * The string representation for FilterOption type
+ * adaptive_decode_cost_weight.
+ */
+extern const std::string filter_option_adaptive_decode_cost_weight;
+
 /** The string representation for type int32. */
 extern const std::string int32_str;
 
@@ -666,6 +699,9 @@ extern const unsigned int gcs_max_attempts;
 /** Milliseconds of wait time between GCS attempts. */
 extern const unsigned int gcs_attempt_sleep_ms;
 
+/** Maximum number of reads in flight in an io_uring batched file read. */
+extern const unsigned int io_uring_queue_depth;
+
 /** An allocation tag used for logging. */
 extern const std::string s3_allocation_tag;
 
@@ -38,6 +38,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
+#include <vector>
 
 using namespace tiledb::common;
 
@@ -401,6 +403,94 @@ Status parallel_for_2d(
   return return_st;
 }
 
+/**
+ * Sort the given values by the given unsigned integer keys with a
+ * least-significant-digit radix sort, possibly in parallel. The sort is
+ * stable, and `keys` is reordered along with `values`.
+ *
+ * @tparam KeyT Unsigned integer key type
+ * @tparam ValueT Value type
+ * @param tp The threadpool to use.
+ * @param keys The sort key of every value.
+ * @param values The values to sort.
+ * @param key_bits The number of low-order bits in use by the keys.
+ */
+template <typename KeyT, typename ValueT>
+void parallel_radix_sort(
+    ThreadPool* const tp,
+    std::vector<KeyT>& keys,
+    std::vector<ValueT>& values,
+    const unsigned key_bits = 8 * sizeof(KeyT)) {
+  static_assert(std::is_unsigned_v<KeyT>);
+  assert(tp);
+  assert(keys.size() == values.size());
+
+  // Sort one byte of the keys per pass. Every pass splits the range into
+  // one chunk per concurrency level: each chunk counts its digits, then
+  // scatters its elements at the offsets that the counts of the preceding
+  // digits and chunks leave for it, which keeps every pass stable.
+  constexpr unsigned digit_bits = 8;
+  constexpr uint64_t radix = uint64_t(1) << digit_bits;
+  constexpr uint64_t min_chunk_len = 4096;
+  const uint64_t n = keys.size();
+  if (n <= 1) {
+    return;
+  }
+
+  const uint64_t chunk_num = std::max<uint64_t>(
+      1, std::min<uint64_t>(tp->concurrency_level(), n / min_chunk_len));
+  const uint64_t chunk_len = (n + chunk_num - 1) / chunk_num;
+  std::vector<uint64_t> offsets(chunk_num * radix);
+  std::vector<KeyT> keys_tmp;
+  std::vector<ValueT> values_tmp;
+
+  for (unsigned shift = 0; shift < key_bits; shift += digit_bits) {
+    // Count the digits of every chunk.
+    std::fill(offsets.begin(), offsets.end(), 0);
+    throw_if_not_ok(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      uint64_t* const count = &offsets[c * radix];
+      const uint64_t end = std::min(n, (c + 1) * chunk_len);
+      for (uint64_t i = c * chunk_len; i < end; ++i) {
+        ++count[(keys[i] >> shift) & (radix - 1)];
+      }
+      return Status::Ok();
+    }));
+
+    // Turn the counts into scatter offsets, skipping the pass if all the
+    // keys share the digit.
+    bool skip = false;
+    uint64_t offset = 0;
+    for (uint64_t digit = 0; digit < radix && !skip; ++digit) {
+      const uint64_t start = offset;
+      for (uint64_t c = 0; c < chunk_num; ++c) {
+        const uint64_t count = offsets[c * radix + digit];
+        offsets[c * radix + digit] = offset;
+        offset += count;
+      }
+      skip = offset - start == n;
+    }
+    if (skip) {
+      continue;
+    }
+
+    // Scatter every chunk.
+    keys_tmp.resize(n);
+    values_tmp.resize(n);
+    throw_if_not_ok(parallel_for(tp, 0, chunk_num, [&](uint64_t c) {
+      uint64_t* const offset = &offsets[c * radix];
+      const uint64_t end = std::min(n, (c + 1) * chunk_len);
+      for (uint64_t i = c * chunk_len; i < end; ++i) {
+        const uint64_t pos = offset[(keys[i] >> shift) & (radix - 1)]++;
+        keys_tmp[pos] = keys[i];
+        values_tmp[pos] = std::move(values[i]);
+      }
+      return Status::Ok();
+    }));
+    keys.swap(keys_tmp);
+    values.swap(values_tmp);
+  }
+}
+
 }  // namespace sm
 }  // namespace tiledb
 
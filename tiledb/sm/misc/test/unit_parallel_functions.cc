@@ -0,0 +1,102 @@
+/**
+ * @file   unit_parallel_functions.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2024 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests the parallel functions.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/parallel_functions.h"
+
+#include <numeric>
+#include <random>
+
+using namespace tiledb::sm;
+
+TEST_CASE(
+    "Parallel radix sort: sort keys and values",
+    "[parallel-functions][radix-sort]") {
+  // Use enough keys to split every pass into several chunks.
+  const uint64_t n = GENERATE(0, 1, 100, 4 * 4096 + 17);
+  const unsigned key_bits = GENERATE(8u, 20u, 64u);
+  ThreadPool tp(4);
+
+  std::mt19937_64 gen(n + key_bits);
+  const uint64_t mask =
+      key_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << key_bits) - 1;
+  std::vector<uint64_t> keys(n);
+  for (auto& key : keys) {
+    key = gen() & mask;
+  }
+  std::vector<uint64_t> values(n);
+  std::iota(values.begin(), values.end(), 0);
+
+  // The sort is stable, so ties keep their original order.
+  std::vector<std::pair<uint64_t, uint64_t>> expected(n);
+  for (uint64_t i = 0; i < n; i++) {
+    expected[i] = {keys[i], values[i]};
+  }
+  std::stable_sort(
+      expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+      });
+
+  parallel_radix_sort(&tp, keys, values, key_bits);
+
+  REQUIRE(keys.size() == n);
+  REQUIRE(values.size() == n);
+  for (uint64_t i = 0; i < n; i++) {
+    CHECK(keys[i] == expected[i].first);
+    CHECK(values[i] == expected[i].second);
+  }
+}
+
+TEST_CASE(
+    "Parallel radix sort: duplicate keys",
+    "[parallel-functions][radix-sort]") {
+  // Few distinct keys in several chunks, to check the stability across the
+  // chunk boundaries.
+  const uint64_t n = 3 * 4096 + 5;
+  ThreadPool tp(3);
+
+  std::vector<uint32_t> keys(n);
+  std::vector<uint64_t> values(n);
+  for (uint64_t i = 0; i < n; i++) {
+    keys[i] = static_cast<uint32_t>((n - i) % 7) << 16;
+    values[i] = i;
+  }
+
+  parallel_radix_sort(&tp, keys, values);
+
+  for (uint64_t i = 1; i < n; i++) {
+    CHECK(keys[i - 1] <= keys[i]);
+    if (keys[i - 1] == keys[i]) {
+      CHECK(values[i - 1] < values[i]);
+    }
+  }
+}
@@ -0,0 +1,207 @@
+/**
+ * @file   unit_tournament_tree.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * Tests class TournamentTree.
+ */
+
+#include <test/support/tdb_catch.h>
+#include "tiledb/sm/misc/tournament_tree.h"
+
+#include <functional>
+#include <queue>
+#include <random>
+
+using namespace tiledb::sm;
+
+TEST_CASE("TournamentTree: Test k-way merge", "[tournament_tree][merge]") {
+  const size_t slot_num = GENERATE(1, 2, 5, 64);
+
+  // Sorted inputs, with values shared between inputs.
+  std::mt19937 gen(slot_num);
+  std::uniform_int_distribution<int> dist(0, 100);
+  std::vector<std::vector<int>> inputs(slot_num);
+  std::vector<int> expected;
+  for (size_t s = 0; s < slot_num; s++) {
+    inputs[s].resize(s % 3 == 2 ? 0 : 20);
+    for (auto& v : inputs[s]) {
+      v = dist(gen);
+    }
+    std::sort(inputs[s].begin(), inputs[s].end());
+    expected.insert(expected.end(), inputs[s].begin(), inputs[s].end());
+  }
+  std::sort(expected.begin(), expected.end());
+
+  // Merge, pushing the next value of an input once its head is popped.
+  TournamentTree<int, std::greater<int>> tree(slot_num, std::greater<int>());
+  std::vector<size_t> next(slot_num, 0);
+  for (size_t s = 0; s < slot_num; s++) {
+    if (!inputs[s].empty()) {
+      tree.emplace(s, inputs[s][next[s]++]);
+    }
+  }
+
+  std::vector<int> merged;
+  while (!tree.empty()) {
+    auto s = tree.top_slot();
+    merged.emplace_back(tree.top());
+    tree.pop();
+    if (next[s] < inputs[s].size()) {
+      tree.emplace(s, inputs[s][next[s]++]);
+    }
+  }
+  CHECK(merged == expected);
+}
+
+TEST_CASE(
+    "TournamentTree: Test several values per slot",
+    "[tournament_tree][slots]") {
+  TournamentTree<int, std::greater<int>> tree(3, std::greater<int>());
+  std::priority_queue<int, std::vector<int>, std::greater<int>> expected;
+
+  // Push to any slot, including ones that do not hold the winner.
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  for (int i = 0; i < 300; i++) {
+    if (i % 4 == 3) {
+      REQUIRE(tree.top() == expected.top());
+      tree.pop();
+      expected.pop();
+    } else {
+      int v = dist(gen);
+      tree.emplace(i % 3, v);
+      expected.push(v);
+    }
+  }
+
+  while (!expected.empty()) {
+    REQUIRE(!tree.empty());
+    CHECK(tree.top() == expected.top());
+    tree.pop();
+    expected.pop();
+  }
+  CHECK(tree.empty());
+}
+
+TEST_CASE("TournamentTree: Test ties", "[tournament_tree][ties]") {
+  // Values compare on their first member only; ties go to the lowest slot.
+  using Value = std::pair<int, size_t>;
+  auto cmp = [](const Value& a, const Value& b) { return a.first > b.first; };
+  TournamentTree<Value, decltype(cmp)> tree(4, cmp);
+  for (size_t s : {3, 1, 2, 0}) {
+    tree.emplace(s, 7, s);
+  }
+
+  for (size_t s = 0; s < 4; s++) {
+    CHECK(tree.top_slot() == s);
+    CHECK(tree.top().second == s);
+    tree.pop();
+  }
+  CHECK(tree.empty());
+}
+
+TEST_CASE(
+    "TournamentTree: Test non-strict ties", "[tournament_tree][ties]") {
+  // With a non-strict comparator, ties go to the highest slot.
+  using Value = std::pair<int, size_t>;
+  auto cmp = [](const Value& a, const Value& b) { return a.first >= b.first; };
+  TournamentTree<Value, decltype(cmp)> tree(4, cmp);
+  for (size_t s : {3, 1, 2, 0}) {
+    tree.emplace(s, 7, s);
+  }
+
+  for (size_t s = 4; s-- > 0;) {
+    CHECK(tree.top_slot() == s);
+    CHECK(tree.top().second == s);
+    tree.pop();
+  }
+  CHECK(tree.empty());
+}
+
+TEST_CASE(
+    "TournamentTree: Test replace top and runner up",
+    "[tournament_tree][replace-top]") {
+  const size_t slot_num = GENERATE(1, 3, 8);
+  const bool strict = GENERATE(true, false);
+
+  // Sorted inputs with many ties, merged by replacing the top with the next
+  // value of its input.
+  using Value = std::pair<int, size_t>;
+  auto cmp = [strict](const Value& a, const Value& b) {
+    return strict ? a.first > b.first : a.first >= b.first;
+  };
+  std::mt19937 gen(slot_num);
+  std::uniform_int_distribution<int> dist(0, 10);
+  std::vector<std::vector<int>> inputs(slot_num);
+  std::vector<int> expected;
+  for (size_t s = 0; s < slot_num; s++) {
+    inputs[s].resize(s == 1 ? 0 : 30);
+    for (auto& v : inputs[s]) {
+      v = dist(gen);
+    }
+    std::sort(inputs[s].begin(), inputs[s].end());
+    expected.insert(expected.end(), inputs[s].begin(), inputs[s].end());
+  }
+  std::sort(expected.begin(), expected.end());
+
+  TournamentTree<Value, decltype(cmp)> tree(slot_num, cmp);
+  TournamentTree<Value, decltype(cmp)> reference(slot_num, cmp);
+  std::vector<size_t> next(slot_num, 0);
+  for (size_t s = 0; s < slot_num; s++) {
+    if (!inputs[s].empty()) {
+      tree.emplace(s, inputs[s][next[s]++], s);
+      reference.emplace(s, inputs[s][0], s);
+    }
+  }
+
+  std::vector<int> merged;
+  while (!tree.empty()) {
+    // The runner up is the top after a pop, ties included.
+    auto s = tree.top_slot();
+    REQUIRE(s == reference.top_slot());
+    const Value* runner_up = tree.runner_up();
+    reference.pop();
+    if (reference.empty()) {
+      CHECK(runner_up == nullptr);
+    } else {
+      REQUIRE(runner_up != nullptr);
+      CHECK(*runner_up == reference.top());
+    }
+
+    merged.emplace_back(tree.top().first);
+    if (next[s] < inputs[s].size()) {
+      tree.replace_top(inputs[s][next[s]], s);
+      reference.emplace(s, inputs[s][next[s]], s);
+      next[s]++;
+    } else {
+      tree.pop();
+    }
+  }
+  CHECK(reference.empty());
+  CHECK(merged == expected);
+}
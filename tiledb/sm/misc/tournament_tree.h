@@ -0,0 +1,230 @@
+/**
+ * @file   tournament_tree.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class TournamentTree.
+ */
+
+#ifndef TILEDB_TOURNAMENT_TREE_H
+#define TILEDB_TOURNAMENT_TREE_H
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * A priority queue for k-way merges, with one slot per input. Each slot
+ * holds the pending values of its input in a small heap, and a tournament
+ * tree over the slots keeps the winner of every subtree. Pushing to or
+ * popping from a slot replays only the path from its leaf to the root, so
+ * an update costs `log(k)` comparisons, against about twice that for a
+ * binary heap pop followed by a push.
+ *
+ * Unlike a loser tree, any slot can be updated, not just the one holding
+ * the current winner. Replacing the top value with the next value of its
+ * input, the common step of a merge, replays its path only once.
+ *
+ * `Compare` follows the `std::priority_queue` convention: `cmp(a, b)` is
+ * true if `a` has a lower priority than `b`, and `top()` returns the value
+ * with the highest priority. With a strict comparator, ties go to the lowest
+ * slot. With a non-strict one, such as `GlobalCmpReverse`, `cmp` is true on
+ * ties and they go to the highest slot.
+ *
+ * @tparam T The value type.
+ * @tparam Compare The comparator type.
+ */
+template <class T, class Compare>
+class TournamentTree {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param slot_num The number of slots.
+   * @param cmp The comparator.
+   */
+  TournamentTree(size_t slot_num, Compare cmp)
+      : cmp_(std::move(cmp))
+      , slots_(slot_num)
+      , leaf_num_(1) {
+    while (leaf_num_ < slot_num) {
+      leaf_num_ *= 2;
+    }
+    nodes_.resize(2 * leaf_num_, npos);
+  }
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns true if no slot holds a value. */
+  inline bool empty() const {
+    return nodes_[1] == npos;
+  }
+
+  /** Returns the value with the highest priority. */
+  inline const T& top() const {
+    assert(!empty());
+    return slots_[nodes_[1]].front();
+  }
+
+  /** Returns the slot of the value with the highest priority. */
+  inline size_t top_slot() const {
+    assert(!empty());
+    return nodes_[1];
+  }
+
+  /** Returns the number of values held by a slot. */
+  inline size_t slot_size(size_t slot) const {
+    assert(slot < slots_.size());
+    return slots_[slot].size();
+  }
+
+  /**
+   * Returns the value that would have the highest priority after `pop()`,
+   * or nullptr if there is none. The slot of the top value must hold no
+   * other value.
+   */
+  const T* runner_up() const {
+    assert(!empty());
+    const size_t slot = nodes_[1];
+    assert(slots_[slot].size() == 1);
+
+    // Replay the matches of the path of the slot as if it were empty,
+    // keeping the left child first so that ties resolve as in `pop()`.
+    size_t winner = npos;
+    for (size_t i = leaf_num_ + slot; i > 1; i /= 2) {
+      const size_t sibling = nodes_[i ^ 1];
+      winner = (i % 2 == 0) ? match(winner, sibling) : match(sibling, winner);
+    }
+    return winner == npos ? nullptr : &slots_[winner].front();
+  }
+
+  /** Removes the value with the highest priority. */
+  void pop() {
+    assert(!empty());
+    const size_t slot = nodes_[1];
+    auto& heap = slots_[slot];
+    std::pop_heap(heap.begin(), heap.end(), cmp_);
+    heap.pop_back();
+    replay(slot);
+  }
+
+  /**
+   * Adds a value to a slot.
+   *
+   * @param slot The slot.
+   * @param args The arguments to construct the value with.
+   */
+  template <class... Args>
+  void emplace(size_t slot, Args&&... args) {
+    assert(slot < slots_.size());
+    auto& heap = slots_[slot];
+    heap.emplace_back(std::forward<Args>(args)...);
+    std::push_heap(heap.begin(), heap.end(), cmp_);
+    replay(slot);
+  }
+
+  /**
+   * Replaces the value with the highest priority by a new value in the same
+   * slot. This is equivalent to `pop()` followed by `emplace()` on the slot
+   * of the top value, with a single replay.
+   *
+   * @param args The arguments to construct the value with.
+   */
+  template <class... Args>
+  void replace_top(Args&&... args) {
+    assert(!empty());
+    const size_t slot = nodes_[1];
+    auto& heap = slots_[slot];
+    std::pop_heap(heap.begin(), heap.end(), cmp_);
+    heap.back() = T(std::forward<Args>(args)...);
+    std::push_heap(heap.begin(), heap.end(), cmp_);
+    replay(slot);
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Marks a node with no winner. */
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /** The comparator. */
+  Compare cmp_;
+
+  /** The pending values of each slot, as heaps. */
+  std::vector<std::vector<T>> slots_;
+
+  /** The number of leaves, a power of two. */
+  size_t leaf_num_;
+
+  /**
+   * The winning slot of each subtree, with the root at index 1 and the leaf
+   * of slot `s` at index `leaf_num_ + s`.
+   */
+  std::vector<size_t> nodes_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Returns the winner of a match between two slots. */
+  inline size_t match(size_t a, size_t b) const {
+    if (a == npos) {
+      return b;
+    }
+    if (b == npos) {
+      return a;
+    }
+    return cmp_(slots_[a].front(), slots_[b].front()) ? b : a;
+  }
+
+  /** Replays the matches from the leaf of a slot up to the root. */
+  void replay(size_t slot) {
+    size_t i = leaf_num_ + slot;
+    nodes_[i] = slots_[slot].empty() ? npos : slot;
+    for (i /= 2; i >= 1; i /= 2) {
+      nodes_[i] = match(nodes_[2 * i], nodes_[2 * i + 1]);
+    }
+  }
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_TOURNAMENT_TREE_H
@@ -0,0 +1,65 @@
+/**
+ * @file   member_set.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class MemberSet.
+ */
+
+#include "tiledb/sm/query/ast/member_set.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+MemberSet::MemberSet(
+    const void* data,
+    const uint64_t data_size,
+    const uint64_t* offsets,
+    const uint64_t num_members)
+    : data_(data == nullptr ? "" : static_cast<const char*>(data), data_size)
+    , hashed_(false) {
+  members_.reserve(num_members);
+  for (uint64_t i = 0; i < num_members; i++) {
+    const uint64_t end = i + 1 < num_members ? offsets[i + 1] : data_size;
+    members_.emplace_back(data_.data() + offsets[i], end - offsets[i]);
+  }
+
+  std::sort(members_.begin(), members_.end());
+  members_.erase(
+      std::unique(members_.begin(), members_.end()), members_.end());
+
+  if (members_.size() > hash_threshold) {
+    set_.reserve(members_.size());
+    set_.insert(members_.begin(), members_.end());
+    hashed_ = true;
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,168 @@
+/**
+ * @file   member_set.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class MemberSet.
+ */
+
+#ifndef TILEDB_MEMBER_SET_H
+#define TILEDB_MEMBER_SET_H
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The set of values of a set membership (IN/NOT_IN) query condition.
+ *
+ * Members are compared byte-wise. Small sets are kept as a sorted vector
+ * searched with a binary search; larger sets are also indexed by a hash set
+ * so that a lookup costs O(1) regardless of the number of members.
+ */
+class MemberSet {
+ public:
+  /* ********************************* */
+  /*         PUBLIC CONSTANTS          */
+  /* ********************************* */
+
+  /** Sets with more members than this are looked up through a hash set. */
+  static constexpr uint64_t hash_threshold = 16;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor.
+   *
+   * @param data The concatenated member values.
+   * @param data_size The byte size of `data`.
+   * @param offsets The starting byte offset of each member in `data`.
+   * @param num_members The number of members (elements of `offsets`).
+   */
+  MemberSet(
+      const void* data,
+      uint64_t data_size,
+      const uint64_t* offsets,
+      uint64_t num_members);
+
+  /** Destructor. */
+  ~MemberSet() = default;
+
+  DISABLE_COPY_AND_COPY_ASSIGN(MemberSet);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(MemberSet);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the distinct members, sorted byte-wise. */
+  inline const std::vector<std::string_view>& members() const {
+    return members_;
+  }
+
+  /** Returns the number of distinct members. */
+  inline uint64_t size() const {
+    return members_.size();
+  }
+
+  /**
+   * Returns true if the input value is a member of the set.
+   *
+   * @param value The value to look up.
+   * @param value_size The byte size of `value`.
+   */
+  inline bool contains(const void* value, uint64_t value_size) const {
+    std::string_view v(static_cast<const char*>(value), value_size);
+    if (hashed_) {
+      return set_.count(v) != 0;
+    }
+
+    return std::binary_search(members_.begin(), members_.end(), v);
+  }
+
+  /**
+   * Typed version of `contains`. Floating point zeros match members
+   * irrespective of their sign and NaN never matches, as for `EQ`.
+   *
+   * @tparam T The datatype of the value.
+   * @param value The value to look up.
+   * @param value_size The byte size of `value`.
+   */
+  template <typename T>
+  inline bool contains(const void* value, uint64_t value_size) const {
+    if constexpr (std::is_floating_point_v<T>) {
+      const T v = *static_cast<const T*>(value);
+      if (v != v) {
+        return false;
+      }
+
+      if (v == 0) {
+        const T zero = 0;
+        const T negative_zero = -zero;
+        return contains(&zero, sizeof(T)) ||
+               contains(&negative_zero, sizeof(T));
+      }
+    }
+
+    return contains(value, value_size);
+  }
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Owns the member values viewed by `members_` and `set_`. */
+  std::string data_;
+
+  /** Views of the distinct members, sorted byte-wise. */
+  std::vector<std::string_view> members_;
+
+  /** Hashed views of the members, populated only when `hashed_` is set. */
+  std::unordered_set<std::string_view> set_;
+
+  /** Whether lookups go through `set_`. */
+  bool hashed_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_MEMBER_SET_H
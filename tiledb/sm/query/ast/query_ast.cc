@@ -111,9 +111,26 @@ Status ASTNodeVal::check_node_validity(const ArraySchema& array_schema) const {
         field_name_);
   }
 
-  // Ensure that the condition value size matches the attribute's
-  // value size.
-  if (cell_size != constants::var_size && cell_size != condition_value_size &&
+  // Ensure that set membership operators are only used with a member set.
+  if (is_set_membership_op(op_) != (member_set_ != nullptr)) {
+    return Status_QueryConditionError(
+        "Set membership operators require a set of values: " + field_name_);
+  }
+
+  // Ensure that the set members' sizes match the attribute's value size.
+  if (member_set_ != nullptr) {
+    if (cell_size != constants::var_size && !supported_string_type(type)) {
+      for (const auto& member : member_set_->members()) {
+        if (member.size() != cell_size) {
+          return Status_QueryConditionError(
+              "Value node set member size mismatch: " +
+              std::to_string(cell_size) +
+              " != " + std::to_string(member.size()));
+        }
+      }
+    }
+  } else if (
+      cell_size != constants::var_size && cell_size != condition_value_size &&
       !(nullable && condition_value_view_.content() == nullptr) &&
       !supported_string_type(type) && (!var_size)) {
     return Status_QueryConditionError(
@@ -175,6 +192,10 @@ const QueryConditionOp& ASTNodeVal::get_op() const {
   return op_;
 }
 
+const MemberSet* ASTNodeVal::get_member_set() const {
+  return member_set_.get();
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeVal::get_children() const {
   throw std::runtime_error(
       "ASTNodeVal::get_children: Cannot get children from an AST value node.");
@@ -272,6 +293,12 @@ const QueryConditionOp& ASTNodeExpr::get_op() const {
       "ASTNodeExpr::get_op: Cannot get op from an AST expression node.");
 }
 
+const MemberSet* ASTNodeExpr::get_member_set() const {
+  throw std::runtime_error(
+      "ASTNodeExpr::get_member_set: Cannot get member set from an AST "
+      "expression node.");
+}
+
 const std::vector<tdb_unique_ptr<ASTNode>>& ASTNodeExpr::get_children() const {
   return nodes_;
 }
@@ -47,6 +47,7 @@
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/enums/query_condition_op.h"
+#include "tiledb/sm/query/ast/member_set.h"
 
 using namespace tiledb::common;
 
@@ -157,6 +158,16 @@ class ASTNode {
    */
   virtual const QueryConditionOp& get_op() const = 0;
 
+  /**
+   * @brief Get the member set of a set membership (IN/NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const MemberSet* The member set, or nullptr if the node is not a
+   * set membership node.
+   */
+  virtual const MemberSet* get_member_set() const = 0;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -216,6 +227,24 @@ class ASTNodeVal : public ASTNode {
     }
   };
 
+  /**
+   * @brief Construct a new set membership ASTNodeVal object.
+   *
+   * @param field_name The name of the field this operation applies to.
+   * @param member_set The set of values to test membership in.
+   * @param op The set membership operation (IN or NOT_IN).
+   */
+  ASTNodeVal(
+      const std::string& field_name,
+      shared_ptr<const MemberSet> member_set,
+      const QueryConditionOp op)
+      : field_name_(field_name)
+      , condition_value_data_(0)
+      , condition_value_view_((void*)"", 0)
+      , member_set_(std::move(member_set))
+      , op_(op) {
+  }
+
   /**
    * @brief Copy constructor.
    */
@@ -228,6 +257,7 @@ class ASTNodeVal : public ASTNode {
                  (void*)"" :
                  condition_value_data_.data()),
             condition_value_data_.size())
+      , member_set_(rhs.member_set_)
       , op_(rhs.op_) {
   }
 
@@ -243,6 +273,7 @@ class ASTNodeVal : public ASTNode {
                  (void*)"" :
                  condition_value_data_.data()),
             condition_value_data_.size())
+      , member_set_(rhs.member_set_)
       , op_(negate_query_condition_op(rhs.op_)) {
   }
 
@@ -351,6 +382,16 @@ class ASTNodeVal : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the member set of a set membership (IN/NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const MemberSet* The member set, or nullptr if the node is not a
+   * set membership node.
+   */
+  const MemberSet* get_member_set() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
@@ -380,6 +421,9 @@ class ASTNodeVal : public ASTNode {
   /** A view of the value data. */
   UntypedDatumView condition_value_view_;
 
+  /** The set of values for set membership operators, nullptr otherwise. */
+  shared_ptr<const MemberSet> member_set_;
+
   /** The comparison operator. */
   QueryConditionOp op_;
 };
@@ -528,6 +572,16 @@ class ASTNodeExpr : public ASTNode {
    */
   const QueryConditionOp& get_op() const override;
 
+  /**
+   * @brief Get the member set of a set membership (IN/NOT_IN) node.
+   * This is an AST value node getter method.
+   * It should throw an exception if called on an expression node.
+   *
+   * @return const MemberSet* The member set, or nullptr if the node is not a
+   * set membership node.
+   */
+  const MemberSet* get_member_set() const override;
+
   /**
    * @brief Get the vector of children nodes.
    * This is an AST expression node getter method.
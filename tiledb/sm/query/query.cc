@@ -51,6 +51,7 @@
 #include "tiledb/sm/query/readers/sparse_unordered_with_dups_reader.h"
 #include "tiledb/sm/query/writers/global_order_writer.h"
 #include "tiledb/sm/query/writers/ordered_writer.h"
+#include "tiledb/sm/query/writers/streaming_writer.h"
 #include "tiledb/sm/query/writers/unordered_writer.h"
 #include "tiledb/sm/rest/rest_client.h"
 #include "tiledb/sm/storage_manager/storage_manager.h"
@@ -103,6 +104,7 @@ Query::Query(
     , offsets_buffer_name_("")
     , disable_checks_consolidation_(false)
     , consolidation_with_timestamps_(false)
+    , defer_commit_(false)
     , force_legacy_reader_(false)
     , fragment_name_(fragment_name)
     , remote_query_(false)
@@ -716,6 +718,14 @@ void Query::init() {
 
     throw_if_not_ok(check_buffer_names());
 
+    // Aggregate queries don't return cells.
+    if (!aggregates_.empty() &&
+        (!buffers_.empty() || !label_buffers_.empty())) {
+      throw QueryStatusException(
+          "Cannot init query; Setting buffers is not supported for aggregate "
+          "queries");
+    }
+
     // Create dimension label queries and remove labels from subarray.
     if (uses_dimension_labels()) {
       if (!condition_.empty()) {
@@ -930,6 +940,21 @@ Status Query::set_consolidation_with_timestamps() {
   return Status::Ok();
 }
 
+Status Query::defer_commit() {
+  if (status_ != QueryStatus::UNINITIALIZED) {
+    return logger_->status(
+        Status_QueryError("Cannot defer commit after initialization"));
+  }
+
+  if (type_ != QueryType::WRITE || layout_ != Layout::GLOBAL_ORDER) {
+    return logger_->status(Status_QueryError(
+        "Cannot defer commit; Applicable only to global order writes"));
+  }
+
+  defer_commit_ = true;
+  return Status::Ok();
+}
+
 void Query::set_processed_conditions(
     std::vector<std::string>& processed_conditions) {
   processed_conditions_ = processed_conditions;
@@ -1016,22 +1041,42 @@ Status Query::create_strategy(bool skip_checks_serialization) {
             "Cannot create strategy; dense writes do not support layout " +
             layout_str(layout_));
       }
-      strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
-          UnorderedWriter,
-          stats_->create_child("Writer"),
-          logger_,
-          storage_manager_,
-          array_,
-          config_,
-          buffers_,
-          subarray_,
-          layout_,
-          written_fragment_info_,
-          coords_info_,
-          written_buffers_,
-          remote_query_,
-          fragment_name_,
-          skip_checks_serialization));
+      bool found = false;
+      if (config_.get("sm.query.sparse_unordered.writer", &found) ==
+          "streaming") {
+        strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
+            StreamingWriter,
+            stats_->create_child("Writer"),
+            logger_,
+            storage_manager_,
+            array_,
+            config_,
+            buffers_,
+            subarray_,
+            layout_,
+            written_fragment_info_,
+            coords_info_,
+            remote_query_,
+            fragment_name_,
+            skip_checks_serialization));
+      } else {
+        strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
+            UnorderedWriter,
+            stats_->create_child("Writer"),
+            logger_,
+            storage_manager_,
+            array_,
+            config_,
+            buffers_,
+            subarray_,
+            layout_,
+            written_fragment_info_,
+            coords_info_,
+            written_buffers_,
+            remote_query_,
+            fragment_name_,
+            skip_checks_serialization));
+      }
     } else if (layout_ == Layout::GLOBAL_ORDER) {
       strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
           GlobalOrderWriter,
@@ -1047,6 +1092,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
           written_fragment_info_,
           disable_checks_consolidation_,
           processed_conditions_,
+          defer_commit_,
           coords_info_,
           remote_query_,
           fragment_name_,
@@ -1061,6 +1107,22 @@ Status Query::create_strategy(bool skip_checks_serialization) {
       all_dense &= frag_md->dense();
     }
 
+    // Aggregates are only computed by the refactored readers.
+    const auto legacy_reader =
+        !is_dimension_label_ordered_read_ &&
+        !use_refactored_sparse_unordered_with_dups_reader(
+            layout_, *array_schema_) &&
+        !(use_refactored_sparse_global_order_reader(layout_, *array_schema_) &&
+          !array_schema_->dense() &&
+          (layout_ == Layout::GLOBAL_ORDER || layout_ == Layout::UNORDERED)) &&
+        !use_refactored_dense_reader(*array_schema_, all_dense);
+    if (!aggregates_.empty() &&
+        (is_dimension_label_ordered_read_ || legacy_reader)) {
+      return logger_->status(Status_QueryError(
+          "Cannot create strategy; Aggregates are not supported by the legacy "
+          "reader or for dimension label reads"));
+    }
+
     if (is_dimension_label_ordered_read_) {
       strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
           OrderedDimLabelReader,
@@ -1093,6 +1155,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
             subarray_,
             layout_,
             condition_,
+            aggregates_,
             skip_checks_serialization));
       } else {
         strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
@@ -1106,6 +1169,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
             subarray_,
             layout_,
             condition_,
+            aggregates_,
             skip_checks_serialization));
       }
     } else if (
@@ -1129,6 +1193,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
             subarray_,
             layout_,
             condition_,
+            aggregates_,
             consolidation_with_timestamps_,
             skip_checks_serialization));
       } else {
@@ -1143,6 +1208,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
             subarray_,
             layout_,
             condition_,
+            aggregates_,
             consolidation_with_timestamps_,
             skip_checks_serialization));
       }
@@ -1158,6 +1224,7 @@ Status Query::create_strategy(bool skip_checks_serialization) {
           subarray_,
           layout_,
           condition_,
+          aggregates_,
           skip_checks_serialization));
     } else {
       strategy_ = tdb_unique_ptr<IQueryStrategy>(tdb_new(
@@ -1635,6 +1702,65 @@ Status Query::add_update_value(
   return Status::Ok();
 }
 
+Status Query::add_aggregate(
+    const std::string& field_name, QueryAggregateOp op) {
+  if (type_ != QueryType::READ) {
+    return logger_->status(Status_QueryError(
+        "Cannot add aggregate; Operation only applicable to read queries"));
+  }
+
+  if (array_->is_remote()) {
+    return logger_->status(Status_QueryError(
+        "Cannot add aggregate; Aggregates are not supported for remote "
+        "arrays"));
+  }
+
+  if (status_ != QueryStatus::UNINITIALIZED) {
+    return logger_->status(Status_QueryError(
+        "Cannot add aggregate; The query was already submitted"));
+  }
+
+  for (const auto& aggregate : aggregates_) {
+    if (aggregate->field_name() == field_name && aggregate->op() == op) {
+      return logger_->status(
+          Status_QueryError("Cannot add aggregate; Aggregate already added"));
+    }
+  }
+
+  aggregates_.emplace_back(
+      make_shared<Aggregator>(HERE(), *array_schema_, field_name, op));
+  return Status::Ok();
+}
+
+Status Query::get_aggregate(
+    const std::string& field_name,
+    QueryAggregateOp op,
+    void* value,
+    uint8_t* validity) const {
+  if (value == nullptr) {
+    return logger_->status(
+        Status_QueryError("Cannot get aggregate; Value pointer is null"));
+  }
+
+  for (const auto& aggregate : aggregates_) {
+    if (aggregate->field_name() == field_name && aggregate->op() == op) {
+      if (aggregate->overflowed()) {
+        return logger_->status(Status_QueryError(
+            "Cannot get aggregate; The " + query_aggregate_op_str(op) +
+            " of field '" + field_name + "' overflowed its " +
+            datatype_str(aggregate->result_type()) + " result type"));
+      }
+
+      aggregate->get_result(value, validity);
+      return Status::Ok();
+    }
+  }
+
+  return logger_->status(Status_QueryError(
+      "Cannot get aggregate; No " + query_aggregate_op_str(op) +
+      " aggregate added for field '" + field_name + "'"));
+}
+
 void Query::add_index_ranges_from_label(
     uint32_t dim_idx,
     const bool is_point_ranges,
@@ -1997,6 +2123,14 @@ std::vector<WrittenFragmentInfo>& Query::get_written_fragment_info() {
   return written_fragment_info_;
 }
 
+std::vector<URI> Query::created_fragment_uris() const {
+  auto writer = dynamic_cast<GlobalOrderWriter*>(strategy_.get());
+  if (writer == nullptr) {
+    return {};
+  }
+  return writer->created_fragment_uris();
+}
+
 void Query::reset_coords_markers() {
   if ((type_ == QueryType::WRITE || type_ == QueryType::MODIFY_EXCLUSIVE) &&
       layout_ == Layout::GLOBAL_ORDER) {
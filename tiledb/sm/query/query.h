@@ -49,6 +49,7 @@
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/readers/aggregator.h"
 #include "tiledb/sm/query/query_remote_buffer_storage.h"
 #include "tiledb/sm/query/update_value.h"
 #include "tiledb/sm/query/validity_vector.h"
@@ -390,6 +391,13 @@ class Query {
    */
   Status set_consolidation_with_timestamps();
 
+  /**
+   * Defers the commit of the fragments of a global order write. They are
+   * written but not made visible, and the caller commits them, e.g. in a
+   * consolidated commits file along with fragments of other queries.
+   */
+  Status defer_commit();
+
   /**
    * Set the processed conditions for writes.
    *
@@ -539,6 +547,32 @@ class Query {
       const void* update_value,
       uint64_t update_value_size);
 
+  /**
+   * Adds an aggregate to compute for a read query. Aggregate queries don't
+   * return cells, so no data buffers can be set.
+   *
+   * @param field_name The name of the aggregated field.
+   * @param op The aggregate op.
+   * @return Status
+   */
+  Status add_aggregate(const std::string& field_name, QueryAggregateOp op);
+
+  /**
+   * Gets the result of an aggregate added to the query.
+   *
+   * @param field_name The name of the aggregated field.
+   * @param op The aggregate op.
+   * @param value Where to write the result, `COUNT`, `NULL_COUNT` and `SUM`
+   *     return 8 bytes, `MIN` and `MAX` return a value of the field type.
+   * @param validity Set to 0 if no value was aggregated, can be null.
+   * @return Status
+   */
+  Status get_aggregate(
+      const std::string& field_name,
+      QueryAggregateOp op,
+      void* value,
+      uint8_t* validity) const;
+
   /**
    * Adds ranges to a query initialize with label ranges.
    *
@@ -641,6 +675,13 @@ class Query {
   /** Returns a reference to the internal WrittenFragmentInfo list */
   std::vector<WrittenFragmentInfo>& get_written_fragment_info();
 
+  /**
+   * Returns the URIs of the fragments created so far by a global order
+   * write, committed or not, e.g. to remove them after a failure. It is
+   * empty for any other query.
+   */
+  std::vector<URI> created_fragment_uris() const;
+
   /** Called from serialization to mark the query as remote */
   void set_remote_query();
 
@@ -738,6 +779,9 @@ class Query {
   /** The update values. */
   std::vector<UpdateValue> update_values_;
 
+  /** The aggregates computed by a read query. */
+  std::vector<shared_ptr<Aggregator>> aggregates_;
+
   /** Set of attributes that have an update value. */
   std::set<std::string> attributes_with_update_value_;
 
@@ -779,6 +823,9 @@ class Query {
    */
   bool consolidation_with_timestamps_;
 
+  /** If `true`, the global order writer does not commit its fragments. */
+  bool defer_commit_;
+
   /* Scratch space used for REST requests. */
   shared_ptr<Buffer> rest_scratch_;
 
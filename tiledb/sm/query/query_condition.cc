@@ -37,12 +37,17 @@
 #include "tiledb/sm/enums/query_condition_op.h"
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/utils.h"
+#include "tiledb/sm/query/query_condition_kernels.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
+#include "tiledb/sm/tile/encoded_strings.h"
 #include "tiledb/storage_format/uri/parse_uri.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -116,6 +121,12 @@ Status QueryCondition::init(
     return Status_QueryConditionError("Cannot reinitialize query condition");
   }
 
+  if (is_set_membership_op(op)) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; Set membership operators require "
+        "a set of values");
+  }
+
   // AST Construction.
   tree_ = tdb_unique_ptr<ASTNode>(tdb_new(
       ASTNodeVal, field_name, condition_value, condition_value_size, op));
@@ -123,6 +134,51 @@ Status QueryCondition::init(
   return Status::Ok();
 }
 
+Status QueryCondition::init(
+    std::string&& field_name,
+    const void* const data,
+    const uint64_t data_size,
+    const void* const offsets,
+    const uint64_t offsets_size,
+    const QueryConditionOp& op) {
+  if (tree_) {
+    return Status_QueryConditionError("Cannot reinitialize query condition");
+  }
+
+  if (!is_set_membership_op(op)) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; Only set membership operators "
+        "accept a set of values");
+  }
+
+  if ((data == nullptr && data_size != 0) ||
+      (offsets == nullptr && offsets_size != 0) ||
+      offsets_size % constants::cell_var_offset_size != 0) {
+    return Status_QueryConditionError(
+        "Cannot initialize query condition; Invalid set data or offsets");
+  }
+
+  // Ensure the offsets are non-decreasing and within the data.
+  const uint64_t num_members = offsets_size / constants::cell_var_offset_size;
+  const uint64_t* member_offsets = static_cast<const uint64_t*>(offsets);
+  for (uint64_t i = 0; i < num_members; i++) {
+    const uint64_t end =
+        i + 1 < num_members ? member_offsets[i + 1] : data_size;
+    if (member_offsets[i] > end || end > data_size) {
+      return Status_QueryConditionError(
+          "Cannot initialize query condition; Invalid set offsets");
+    }
+  }
+
+  // AST Construction.
+  shared_ptr<const MemberSet> member_set = make_shared<MemberSet>(
+      HERE(), data, data_size, member_offsets, num_members);
+  tree_ = tdb_unique_ptr<ASTNode>(
+      tdb_new(ASTNodeVal, field_name, std::move(member_set), op));
+
+  return Status::Ok();
+}
+
 Status QueryCondition::check(const ArraySchema& array_schema) const {
   if (!tree_) {
     return Status::Ok();
@@ -520,6 +576,40 @@ struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NE> {
   }
 };
 
+/** Partial template specialization for `QueryConditionOp::IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return lhs != nullptr &&
+           static_cast<const MemberSet*>(rhs)->contains<T>(lhs, lhs_size);
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::NOT_IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmpNullChecks<T, QueryConditionOp::NOT_IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return lhs != nullptr &&
+           !static_cast<const MemberSet*>(rhs)->contains<T>(lhs, lhs_size);
+  }
+};
+
+/**
+ * Returns the value compared against by `BinaryCmp` and `BinaryCmpNullChecks`
+ * for the input value node: the member set for set membership operators and
+ * the condition value otherwise.
+ */
+static inline const void* qc_condition_value_content(
+    const tdb_unique_ptr<ASTNode>& node) {
+  if (is_set_membership_op(node->get_op())) {
+    return node->get_member_set();
+  }
+
+  return node->get_condition_value_view().content();
+}
+
 template <typename T, QueryConditionOp Op, typename CombinationOp>
 void QueryCondition::apply_ast_node(
     const tdb_unique_ptr<ASTNode>& node,
@@ -532,8 +622,7 @@ void QueryCondition::apply_ast_node(
     CombinationOp combination_op,
     std::vector<uint8_t>& result_cell_bitmap) const {
   const std::string& field_name = node->get_field_name();
-  const void* condition_value_content =
-      node->get_condition_value_view().content();
+  const void* condition_value_content = qc_condition_value_content(node);
   const size_t condition_value_size = node->get_condition_value_view().size();
   uint64_t starting_index = 0;
   for (const auto& rcs : result_cell_slabs) {
@@ -763,6 +852,30 @@ void QueryCondition::apply_ast_node(
           combination_op,
           result_cell_bitmap);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node<T, QueryConditionOp::IN, CombinationOp>(
+          node,
+          fragment_metadata,
+          stride,
+          var_size,
+          nullable,
+          fill_value,
+          result_cell_slabs,
+          combination_op,
+          result_cell_bitmap);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node<T, QueryConditionOp::NOT_IN, CombinationOp>(
+          node,
+          fragment_metadata,
+          stride,
+          var_size,
+          nullable,
+          fill_value,
+          result_cell_slabs,
+          combination_op,
+          result_cell_bitmap);
+      break;
     default:
       throw std::runtime_error(
           "QueryCondition::apply_ast_node: Cannot perform query comparison; "
@@ -1242,6 +1355,24 @@ struct QueryCondition::DenseDimCondition<
   }
 };
 
+template <typename T, QueryConditionOp Op>
+std::vector<uint8_t> QueryCondition::cmp_encoded_strings(
+    const EncodedStrings& encoded,
+    const void* condition_value_content,
+    const uint64_t condition_value_size) {
+  const auto& values = encoded.values();
+  std::vector<uint8_t> results(values.size());
+  for (uint64_t i = 0; i < values.size(); ++i) {
+    results[i] = BinaryCmp<T, Op>::cmp(
+        values[i].data(),
+        values[i].size(),
+        condition_value_content,
+        condition_value_size);
+  }
+
+  return results;
+}
+
 template <typename T, QueryConditionOp Op, typename CombinationOp>
 void QueryCondition::apply_ast_node_dense(
     const tdb_unique_ptr<ASTNode>& node,
@@ -1256,8 +1387,7 @@ void QueryCondition::apply_ast_node_dense(
     const void* cell_slab_coords,
     span<uint8_t> result_buffer) const {
   const std::string& field_name = node->get_field_name();
-  const void* condition_value_content =
-      node->get_condition_value_view().content();
+  const void* condition_value_content = qc_condition_value_content(node);
   const size_t condition_value_size = node->get_condition_value_view().size();
 
   // Get the nullable buffer.
@@ -1280,6 +1410,28 @@ void QueryCondition::apply_ast_node_dense(
     const uint64_t buffer_offsets_el =
         tile_offsets.size() / constants::cell_var_offset_size;
 
+    // For dictionary- or run-length-encoded strings, compare each distinct
+    // value or run once and look the results up for the cells, unless the
+    // slab has fewer cells than there are values.
+    const auto encoded = tile_offsets.encoded_strings();
+    if (encoded != nullptr && encoded->cell_num() == buffer_offsets_el &&
+        encoded->values().size() <= result_buffer.size()) {
+      const auto value_results = cmp_encoded_strings<T, Op>(
+          *encoded, condition_value_content, condition_value_size);
+      uint64_t run = 0;
+      for (uint64_t c = 0; c < result_buffer.size(); ++c) {
+        const uint64_t offset_idx = start + src_cell + c * stride;
+        const uint8_t cmp =
+            value_results[encoded->value_index(offset_idx, run)];
+        bool buffer_validity_val = buffer_validity == nullptr ?
+                                       true :
+                                       buffer_validity[start + c * stride] != 0;
+        result_buffer[c] =
+            combination_op(result_buffer[c], cmp && buffer_validity_val);
+      }
+      return;
+    }
+
     // Iterate through each cell in this slab.
     for (uint64_t c = 0; c < result_buffer.size(); ++c) {
       // Check the next cell here, which breaks vectorization but as this
@@ -1325,6 +1477,20 @@ void QueryCondition::apply_ast_node_dense(
       uint64_t buffer_offset = (start + src_cell) * cell_size;
       const uint64_t buffer_offset_inc = stride * cell_size;
 
+      // Use the vectorized kernel for contiguous numeric cells.
+      if constexpr (qc_kernel_supported<T, Op>) {
+        if (stride == 1 && cell_size == sizeof(T)) {
+          qc_compare_combine<T, Op>(
+              reinterpret_cast<const T*>(buffer + buffer_offset),
+              result_buffer.size(),
+              *static_cast<const T*>(condition_value_content),
+              buffer_validity == nullptr ? nullptr : buffer_validity + start,
+              combination_op,
+              result_buffer.data());
+          return;
+        }
+      }
+
       // Iterate through each cell in this slab.
       for (uint64_t c = 0; c < result_buffer.size(); ++c) {
         // Get the cell value.
@@ -1447,6 +1613,34 @@ void QueryCondition::apply_ast_node_dense(
           cell_slab_coords,
           result_buffer);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node_dense<T, QueryConditionOp::IN, CombinationOp>(
+          node,
+          array_schema,
+          result_tile,
+          start,
+          src_cell,
+          stride,
+          var_size,
+          nullable,
+          combination_op,
+          cell_slab_coords,
+          result_buffer);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node_dense<T, QueryConditionOp::NOT_IN, CombinationOp>(
+          node,
+          array_schema,
+          result_tile,
+          start,
+          src_cell,
+          stride,
+          var_size,
+          nullable,
+          combination_op,
+          cell_slab_coords,
+          result_buffer);
+      break;
     default:
       throw std::runtime_error(
           "Cannot perform query comparison; Unknown query condition "
@@ -2148,6 +2342,24 @@ struct QueryCondition::BinaryCmp<T, QueryConditionOp::NE> {
   }
 };
 
+/** Partial template specialization for `QueryConditionOp::IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmp<T, QueryConditionOp::IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return static_cast<const MemberSet*>(rhs)->contains<T>(lhs, lhs_size);
+  }
+};
+
+/** Partial template specialization for `QueryConditionOp::NOT_IN`. */
+template <typename T>
+struct QueryCondition::BinaryCmp<T, QueryConditionOp::NOT_IN> {
+  static inline bool cmp(
+      const void* lhs, uint64_t lhs_size, const void* rhs, uint64_t) {
+    return !static_cast<const MemberSet*>(rhs)->contains<T>(lhs, lhs_size);
+  }
+};
+
 template <typename T>
 struct QCMax {
   const T& operator()(const T& a, const T& b) const {
@@ -2168,8 +2380,7 @@ void QueryCondition::apply_ast_node_sparse(
     CombinationOp combination_op,
     std::vector<BitmapType>& result_bitmap) const {
   const auto tile_tuple = result_tile.tile_tuple(node->get_field_name());
-  const void* condition_value_content =
-      node->get_condition_value_view().content();
+  const void* condition_value_content = qc_condition_value_content(node);
   const size_t condition_value_size = node->get_condition_value_view().size();
   uint8_t* buffer_validity = nullptr;
 
@@ -2192,6 +2403,27 @@ void QueryCondition::apply_ast_node_sparse(
     const uint64_t buffer_offsets_el =
         tile_offsets.size() / constants::cell_var_offset_size;
 
+    // For dictionary- or run-length-encoded strings, compare each distinct
+    // value or run once and look the results up for the cells.
+    const auto encoded = tile_offsets.encoded_strings();
+    if (encoded != nullptr && encoded->cell_num() == buffer_offsets_el) {
+      const auto value_results = cmp_encoded_strings<T, Op>(
+          *encoded, condition_value_content, condition_value_size);
+      uint64_t run = 0;
+      for (uint64_t c = 0; c < buffer_offsets_el; ++c) {
+        const bool cmp = value_results[encoded->value_index(c, run)];
+        if constexpr (
+            std::is_same_v<CombinationOp, QCMax<BitmapType>> &&
+            nullable::value) {
+          result_bitmap[c] = combination_op(
+              result_bitmap[c], cmp && (buffer_validity[c] != 0));
+        } else {
+          result_bitmap[c] = combination_op(result_bitmap[c], cmp);
+        }
+      }
+      return;
+    }
+
     // Iterate through each cell.
     for (uint64_t c = 0; c < buffer_offsets_el; ++c) {
       // Check the previous cell here, which breaks vectorization but as this
@@ -2226,6 +2458,21 @@ void QueryCondition::apply_ast_node_sparse(
     const uint64_t cell_size = tile.cell_size();
     const uint64_t buffer_el = tile.size() / cell_size;
 
+    // Use the vectorized kernel for numeric cells. The validity buffer is
+    // only set when nulls need to be handled in this pass.
+    if constexpr (qc_kernel_supported<T, Op>) {
+      if (cell_size == sizeof(T)) {
+        qc_compare_combine<T, Op>(
+            reinterpret_cast<const T*>(buffer),
+            buffer_el,
+            *static_cast<const T*>(condition_value_content),
+            buffer_validity,
+            combination_op,
+            result_bitmap.data());
+        return;
+      }
+    }
+
     // Iterate through each cell without checking the bitmap to enable
     // vectorization.
     for (uint64_t c = 0; c < buffer_el; ++c) {
@@ -2309,6 +2556,22 @@ void QueryCondition::apply_ast_node_sparse(
           CombinationOp,
           nullable>(node, result_tile, var_size, combination_op, result_bitmap);
       break;
+    case QueryConditionOp::IN:
+      apply_ast_node_sparse<
+          T,
+          QueryConditionOp::IN,
+          BitmapType,
+          CombinationOp,
+          nullable>(node, result_tile, var_size, combination_op, result_bitmap);
+      break;
+    case QueryConditionOp::NOT_IN:
+      apply_ast_node_sparse<
+          T,
+          QueryConditionOp::NOT_IN,
+          BitmapType,
+          CombinationOp,
+          nullable>(node, result_tile, var_size, combination_op, result_bitmap);
+      break;
     default:
       throw std::runtime_error(
           "Cannot perform query comparison; Unknown query condition "
@@ -2599,6 +2862,221 @@ Status QueryCondition::apply_sparse(
   return Status::Ok();
 }
 
+/**
+ * Returns true if the tile min/max metadata of the field can be used as a
+ * zone map: fixed size, single value, numeric attributes.
+ */
+static bool zone_map_supported(
+    const ArraySchema& array_schema, const std::string& field_name) {
+  if (!array_schema.is_attr(field_name) || array_schema.var_size(field_name) ||
+      array_schema.cell_val_num(field_name) != 1) {
+    return false;
+  }
+
+  switch (array_schema.type(field_name)) {
+    case Datatype::CHAR:
+    case Datatype::STRING_ASCII:
+    case Datatype::STRING_UTF8:
+    case Datatype::STRING_UTF16:
+    case Datatype::STRING_UTF32:
+    case Datatype::STRING_UCS2:
+    case Datatype::STRING_UCS4:
+    case Datatype::ANY:
+    case Datatype::BLOB:
+      return false;
+    default:
+      return true;
+  }
+}
+
+std::vector<std::string> QueryCondition::zone_map_field_names(
+    const ArraySchema& array_schema) const {
+  std::vector<std::string> ret;
+  for (const auto& field_name : field_names()) {
+    if (zone_map_supported(array_schema, field_name)) {
+      ret.emplace_back(field_name);
+    }
+  }
+
+  return ret;
+}
+
+bool QueryCondition::tile_may_match(
+    FragmentMetadata& frag_md, uint64_t t) const {
+  // Tile metadata was added in format version 11.
+  if (tree_ == nullptr || frag_md.format_version() < 11) {
+    return true;
+  }
+
+  return tile_may_match(tree_, frag_md, t);
+}
+
+bool QueryCondition::tile_may_match(
+    const tdb_unique_ptr<ASTNode>& node,
+    FragmentMetadata& frag_md,
+    uint64_t t) const {
+  if (node->is_expr()) {
+    switch (node->get_combination_op()) {
+      case QueryConditionCombinationOp::AND:
+        for (const auto& child : node->get_children()) {
+          if (!tile_may_match(child, frag_md, t)) {
+            return false;
+          }
+        }
+        return true;
+      case QueryConditionCombinationOp::OR:
+        for (const auto& child : node->get_children()) {
+          if (tile_may_match(child, frag_md, t)) {
+            return true;
+          }
+        }
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  const auto& array_schema = *frag_md.array_schema();
+  const auto& field_name = node->get_field_name();
+  if (!zone_map_supported(array_schema, field_name)) {
+    return true;
+  }
+
+  switch (array_schema.type(field_name)) {
+    case Datatype::INT8:
+      return value_node_may_match<int8_t>(node, frag_md, t);
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      return value_node_may_match<uint8_t>(node, frag_md, t);
+    case Datatype::INT16:
+      return value_node_may_match<int16_t>(node, frag_md, t);
+    case Datatype::UINT16:
+      return value_node_may_match<uint16_t>(node, frag_md, t);
+    case Datatype::INT32:
+      return value_node_may_match<int32_t>(node, frag_md, t);
+    case Datatype::UINT32:
+      return value_node_may_match<uint32_t>(node, frag_md, t);
+    case Datatype::INT64:
+      return value_node_may_match<int64_t>(node, frag_md, t);
+    case Datatype::UINT64:
+      return value_node_may_match<uint64_t>(node, frag_md, t);
+    case Datatype::FLOAT32:
+      return value_node_may_match<float>(node, frag_md, t);
+    case Datatype::FLOAT64:
+      return value_node_may_match<double>(node, frag_md, t);
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return value_node_may_match<int64_t>(node, frag_md, t);
+    default:
+      return true;
+  }
+}
+
+template <typename T>
+bool QueryCondition::value_node_may_match(
+    const tdb_unique_ptr<ASTNode>& node,
+    FragmentMetadata& frag_md,
+    uint64_t t) {
+  const auto& field_name = node->get_field_name();
+  const auto op = node->get_op();
+  const auto cell_num = frag_md.cell_num(t);
+  const uint64_t null_count =
+      frag_md.array_schema()->is_nullable(field_name) ?
+          frag_md.get_tile_null_count(field_name, t) :
+          0;
+
+  // A null value matches the null cells for `EQ` and the non-null cells for
+  // `NE`.
+  const auto& value_view = node->get_condition_value_view();
+  if (value_view.content() == nullptr) {
+    return op == QueryConditionOp::EQ ? null_count != 0 :
+                                        null_count != cell_num;
+  }
+
+  // Null cells never match a non-null value.
+  if (null_count == cell_num) {
+    return false;
+  }
+
+  const T min = frag_md.get_tile_min_as<T>(field_name, t);
+  const T max = frag_md.get_tile_max_as<T>(field_name, t);
+
+  // NaN and infinite values are not reliably reflected by the min/max, but
+  // they turn the tile sum into NaN or infinity, or saturate it.
+  if constexpr (std::is_floating_point_v<T>) {
+    const double sum =
+        *static_cast<const double*>(frag_md.get_tile_sum(field_name, t));
+    if (!std::isfinite(sum) || sum == std::numeric_limits<double>::max() ||
+        sum == std::numeric_limits<double>::lowest()) {
+      return true;
+    }
+  }
+
+  if (is_set_membership_op(op)) {
+    const auto member_set = node->get_member_set();
+    if (op == QueryConditionOp::NOT_IN) {
+      return min != max || !member_set->contains<T>(&min, sizeof(T));
+    }
+
+    for (const auto& member : member_set->members()) {
+      if (member.size() != sizeof(T)) {
+        return true;
+      }
+
+      T value;
+      std::memcpy(&value, member.data(), sizeof(T));
+      if (min <= value && value <= max) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  if (value_view.size() != sizeof(T)) {
+    return true;
+  }
+
+  T value;
+  std::memcpy(&value, value_view.content(), sizeof(T));
+  switch (op) {
+    case QueryConditionOp::LT:
+      return min < value;
+    case QueryConditionOp::LE:
+      return min <= value;
+    case QueryConditionOp::GT:
+      return max > value;
+    case QueryConditionOp::GE:
+      return max >= value;
+    case QueryConditionOp::EQ:
+      return min <= value && value <= max;
+    case QueryConditionOp::NE:
+      return min != value || max != value;
+    default:
+      return true;
+  }
+}
+
 QueryCondition QueryCondition::negated_condition() {
   return QueryCondition(tree_->get_negated_tree());
 }
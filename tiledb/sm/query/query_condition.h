@@ -47,6 +47,7 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+class EncodedStrings;
 class FragmentMetadata;
 struct ResultCellSlab;
 class ResultTile;
@@ -112,6 +113,25 @@ class QueryCondition {
       uint64_t condition_value_size,
       const QueryConditionOp& op);
 
+  /**
+   * Initializes the instance with a set membership operation.
+   *
+   * @param field_name The name of the field this operation applies to.
+   * @param data The concatenated values of the set members.
+   * @param data_size The byte size of `data`.
+   * @param offsets The starting byte offset (uint64_t) of each member in
+   *     `data`.
+   * @param offsets_size The byte size of `offsets`.
+   * @param op The set membership operation (IN or NOT_IN).
+   */
+  Status init(
+      std::string&& field_name,
+      const void* data,
+      uint64_t data_size,
+      const void* offsets,
+      uint64_t offsets_size,
+      const QueryConditionOp& op);
+
   /**
    * Verifies that the current state contains supported comparison
    * operations. Currently, we support the following:
@@ -218,6 +238,28 @@ class QueryCondition {
       ResultTile& result_tile,
       std::vector<BitmapType>& result_bitmap);
 
+  /**
+   * Returns the names of the condition fields that `tile_may_match` can
+   * check against the tile min/max metadata of a fragment: the fixed size,
+   * single value, numeric attributes of `array_schema`.
+   *
+   * @param array_schema The array schema of the fragment.
+   */
+  std::vector<std::string> zone_map_field_names(
+      const ArraySchema& array_schema) const;
+
+  /**
+   * Uses the tile min/max metadata as a zone map to check if some cells of a
+   * tile can pass this query condition. Returns `false` only if no cell of
+   * the tile can pass it, in which case the tile doesn't need to be read.
+   * The tile min, max, sum and null count metadata of the fields returned by
+   * `zone_map_field_names` must be loaded.
+   *
+   * @param frag_md The fragment metadata.
+   * @param t The tile index.
+   */
+  bool tile_may_match(FragmentMetadata& frag_md, uint64_t t) const;
+
   /**
    * Reverse the query condition using De Morgan's law.
    */
@@ -298,6 +340,31 @@ class QueryCondition {
   /*          PRIVATE METHODS          */
   /* ********************************* */
 
+  /**
+   * Zone map check of a node of the AST, see `tile_may_match`.
+   *
+   * @param node The node to check.
+   * @param frag_md The fragment metadata.
+   * @param t The tile index.
+   */
+  bool tile_may_match(
+      const tdb_unique_ptr<ASTNode>& node,
+      FragmentMetadata& frag_md,
+      uint64_t t) const;
+
+  /**
+   * Zone map check of a value node, templated on the field type.
+   *
+   * @param node The value node to check.
+   * @param frag_md The fragment metadata.
+   * @param t The tile index.
+   */
+  template <typename T>
+  static bool value_node_may_match(
+      const tdb_unique_ptr<ASTNode>& node,
+      FragmentMetadata& frag_md,
+      uint64_t t);
+
   /**
    * Applies a value node on primitive-typed result cell slabs,
    * templated for a query condition operator.
@@ -395,6 +462,21 @@ class QueryCondition {
       CombinationOp combination_op,
       std::vector<uint8_t>& result_cell_bitmap) const;
 
+  /**
+   * Compares every value of dictionary- or run-length-encoded string cells
+   * against the value in a value node.
+   *
+   * @param encoded The encoded string cells.
+   * @param condition_value_content The value in the value node.
+   * @param condition_value_size The size of the value in the value node.
+   * @return The comparison result for each of `encoded.values()`.
+   */
+  template <typename T, QueryConditionOp Op>
+  static std::vector<uint8_t> cmp_encoded_strings(
+      const EncodedStrings& encoded,
+      const void* condition_value_content,
+      const uint64_t condition_value_size);
+
   /**
    * Applies a value node on a dense result tile,
    * templated for a query condition operator.
@@ -0,0 +1,404 @@
+/**
+ * @file   query_condition_kernels.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines the vectorized kernels used by the query condition to
+ * compare fixed-size numeric cells against a condition value.
+ *
+ * The AVX2 and AVX-512 versions are compiled with function-level target
+ * attributes and picked at runtime from the CPU features, like the filter
+ * kernels.
+ */
+
+#include "tiledb/sm/query/query_condition_kernels.h"
+#include "tiledb/sm/filter/simd_target.h"
+
+#include <array>
+#include <cstring>
+
+using namespace tiledb::sm::filter_kernels;
+
+namespace tiledb {
+namespace sm {
+
+namespace {
+
+#if defined(TILEDB_SIMD_X86)
+
+/* ********************************* */
+/*           AVX2 KERNELS            */
+/* ********************************* */
+
+/** Expands the low 8 bits of `mask` into 8 bytes set to 0 or 1. */
+inline uint64_t expand_mask(const uint32_t mask) {
+  static const std::array<uint64_t, 256> table = [] {
+    std::array<uint64_t, 256> t{};
+    for (uint64_t m = 0; m < 256; m++) {
+      for (uint64_t b = 0; b < 8; b++) {
+        if ((m >> b) & 1) {
+          t[m] |= uint64_t(1) << (8 * b);
+        }
+      }
+    }
+    return t;
+  }();
+  return table[mask & 0xff];
+}
+
+/** Broadcasts an integer value to all the lanes of a vector. */
+template <typename T>
+TILEDB_TARGET_AVX2 inline __m256i broadcast_avx2(const T v) {
+  if constexpr (sizeof(T) == 1) {
+    return _mm256_set1_epi8(static_cast<char>(v));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_set1_epi16(static_cast<short>(v));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(v));
+  }
+}
+
+/** Lane-wise signed equality of two integer vectors. */
+template <typename T>
+TILEDB_TARGET_AVX2 inline __m256i cmpeq_avx2(const __m256i a, const __m256i b) {
+  if constexpr (sizeof(T) == 1) {
+    return _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_cmpeq_epi32(a, b);
+  } else {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+}
+
+/** Lane-wise signed greater-than of two integer vectors. */
+template <typename T>
+TILEDB_TARGET_AVX2 inline __m256i cmpgt_avx2(const __m256i a, const __m256i b) {
+  if constexpr (sizeof(T) == 1) {
+    return _mm256_cmpgt_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_cmpgt_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_cmpgt_epi32(a, b);
+  } else {
+    return _mm256_cmpgt_epi64(a, b);
+  }
+}
+
+/**
+ * Compares two integer vectors with the input operator, returning all ones
+ * in the lanes that satisfy it. Unsigned values are biased into the signed
+ * range since AVX2 only has signed comparisons.
+ */
+template <typename T, QueryConditionOp Op>
+TILEDB_TARGET_AVX2 inline __m256i cmp_avx2(__m256i a, __m256i b) {
+  if constexpr (
+      std::is_unsigned_v<T> && Op != QueryConditionOp::EQ &&
+      Op != QueryConditionOp::NE) {
+    const __m256i bias = broadcast_avx2<T>(T(1) << (8 * sizeof(T) - 1));
+    a = _mm256_xor_si256(a, bias);
+    b = _mm256_xor_si256(b, bias);
+  }
+
+  const __m256i ones = _mm256_set1_epi8(-1);
+  if constexpr (Op == QueryConditionOp::LT) {
+    return cmpgt_avx2<T>(b, a);
+  } else if constexpr (Op == QueryConditionOp::LE) {
+    return _mm256_xor_si256(cmpgt_avx2<T>(a, b), ones);
+  } else if constexpr (Op == QueryConditionOp::GT) {
+    return cmpgt_avx2<T>(a, b);
+  } else if constexpr (Op == QueryConditionOp::GE) {
+    return _mm256_xor_si256(cmpgt_avx2<T>(b, a), ones);
+  } else if constexpr (Op == QueryConditionOp::EQ) {
+    return cmpeq_avx2<T>(a, b);
+  } else {
+    return _mm256_xor_si256(cmpeq_avx2<T>(a, b), ones);
+  }
+}
+
+/**
+ * Returns the floating point comparison predicate for the input operator.
+ * NaNs only satisfy `NE`, as with the scalar operators.
+ */
+template <QueryConditionOp Op>
+constexpr int fp_predicate() {
+  if constexpr (Op == QueryConditionOp::LT) {
+    return _CMP_LT_OQ;
+  } else if constexpr (Op == QueryConditionOp::LE) {
+    return _CMP_LE_OQ;
+  } else if constexpr (Op == QueryConditionOp::GT) {
+    return _CMP_GT_OQ;
+  } else if constexpr (Op == QueryConditionOp::GE) {
+    return _CMP_GE_OQ;
+  } else if constexpr (Op == QueryConditionOp::EQ) {
+    return _CMP_EQ_OQ;
+  } else {
+    return _CMP_NEQ_UQ;
+  }
+}
+
+/**
+ * Compares the longest prefix of `values` spanning whole vectors against
+ * `rhs`, writing 0 or 1 per value into `out`.
+ *
+ * @return The number of values compared.
+ */
+template <typename T, QueryConditionOp Op>
+TILEDB_TARGET_AVX2 uint64_t
+compare_avx2(const T* values, const uint64_t num, const T rhs, uint8_t* out) {
+  uint64_t i = 0;
+  if constexpr (std::is_same_v<T, float>) {
+    const __m256 b = _mm256_set1_ps(rhs);
+    for (; i + 8 <= num; i += 8) {
+      const __m256 a = _mm256_loadu_ps(values + i);
+      const uint64_t bytes = expand_mask(
+          _mm256_movemask_ps(_mm256_cmp_ps(a, b, fp_predicate<Op>())));
+      memcpy(out + i, &bytes, 8);
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const __m256d b = _mm256_set1_pd(rhs);
+    for (; i + 4 <= num; i += 4) {
+      const __m256d a = _mm256_loadu_pd(values + i);
+      const uint64_t bytes = expand_mask(
+          _mm256_movemask_pd(_mm256_cmp_pd(a, b, fp_predicate<Op>())));
+      memcpy(out + i, &bytes, 4);
+    }
+  } else if constexpr (sizeof(T) == 1) {
+    const __m256i b = broadcast_avx2<T>(rhs);
+    const __m256i one = _mm256_set1_epi8(1);
+    for (; i + 32 <= num; i += 32) {
+      const __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(out + i),
+          _mm256_and_si256(cmp_avx2<T, Op>(a, b), one));
+    }
+  } else if constexpr (sizeof(T) == 2) {
+    const __m256i b = broadcast_avx2<T>(rhs);
+    const __m256i one = _mm256_set1_epi8(1);
+    for (; i + 32 <= num; i += 32) {
+      const __m256i a0 =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+      const __m256i a1 =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i + 16));
+      // Packing works within 128-bit lanes, restore the element order.
+      const __m256i packed = _mm256_permute4x64_epi64(
+          _mm256_packs_epi16(cmp_avx2<T, Op>(a0, b), cmp_avx2<T, Op>(a1, b)),
+          0xd8);
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(out + i), _mm256_and_si256(packed, one));
+    }
+  } else if constexpr (sizeof(T) == 4) {
+    const __m256i b = broadcast_avx2<T>(rhs);
+    for (; i + 8 <= num; i += 8) {
+      const __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+      const uint64_t bytes = expand_mask(
+          _mm256_movemask_ps(_mm256_castsi256_ps(cmp_avx2<T, Op>(a, b))));
+      memcpy(out + i, &bytes, 8);
+    }
+  } else {
+    const __m256i b = broadcast_avx2<T>(rhs);
+    for (; i + 4 <= num; i += 4) {
+      const __m256i a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+      const uint64_t bytes = expand_mask(
+          _mm256_movemask_pd(_mm256_castsi256_pd(cmp_avx2<T, Op>(a, b))));
+      memcpy(out + i, &bytes, 4);
+    }
+  }
+
+  return i;
+}
+
+/* ********************************* */
+/*          AVX-512 KERNELS          */
+/* ********************************* */
+
+/** Returns the integer comparison predicate for the input operator. */
+template <QueryConditionOp Op>
+constexpr int int_predicate() {
+  if constexpr (Op == QueryConditionOp::LT) {
+    return _MM_CMPINT_LT;
+  } else if constexpr (Op == QueryConditionOp::LE) {
+    return _MM_CMPINT_LE;
+  } else if constexpr (Op == QueryConditionOp::GT) {
+    return _MM_CMPINT_NLE;
+  } else if constexpr (Op == QueryConditionOp::GE) {
+    return _MM_CMPINT_NLT;
+  } else if constexpr (Op == QueryConditionOp::EQ) {
+    return _MM_CMPINT_EQ;
+  } else {
+    return _MM_CMPINT_NE;
+  }
+}
+
+/**
+ * Compares one vector of values at `values` against `b`, returning the
+ * comparison mask. AVX-512 has unsigned comparisons, no bias is needed.
+ */
+template <typename T, QueryConditionOp Op, typename V>
+TILEDB_TARGET_AVX512 inline uint64_t cmp_avx512(const T* values, const V b) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm512_cmp_ps_mask(_mm512_loadu_ps(values), b, fp_predicate<Op>());
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm512_cmp_pd_mask(_mm512_loadu_pd(values), b, fp_predicate<Op>());
+  } else {
+    const __m512i a = _mm512_loadu_si512(values);
+    constexpr int pred = int_predicate<Op>();
+    constexpr bool is_signed = std::is_signed_v<T>;
+    if constexpr (sizeof(T) == 1) {
+      return is_signed ? _mm512_cmp_epi8_mask(a, b, pred) :
+                         _mm512_cmp_epu8_mask(a, b, pred);
+    } else if constexpr (sizeof(T) == 2) {
+      return is_signed ? _mm512_cmp_epi16_mask(a, b, pred) :
+                         _mm512_cmp_epu16_mask(a, b, pred);
+    } else if constexpr (sizeof(T) == 4) {
+      return is_signed ? _mm512_cmp_epi32_mask(a, b, pred) :
+                         _mm512_cmp_epu32_mask(a, b, pred);
+    } else {
+      return is_signed ? _mm512_cmp_epi64_mask(a, b, pred) :
+                         _mm512_cmp_epu64_mask(a, b, pred);
+    }
+  }
+}
+
+/** Broadcasts a value to all the lanes of a vector. */
+template <typename T>
+TILEDB_TARGET_AVX512 inline auto broadcast_avx512(const T v) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm512_set1_ps(v);
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm512_set1_pd(v);
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm512_set1_epi8(static_cast<char>(v));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm512_set1_epi16(static_cast<short>(v));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm512_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm512_set1_epi64(static_cast<long long>(v));
+  }
+}
+
+/**
+ * Compares the longest prefix of `values` spanning whole groups of 64 values
+ * against `rhs`, writing 0 or 1 per value into `out`. The masks of the
+ * vectors of a group are merged, so that the results of the group are
+ * written with a single 64-byte store.
+ *
+ * @return The number of values compared.
+ */
+template <typename T, QueryConditionOp Op>
+TILEDB_TARGET_AVX512 uint64_t
+compare_avx512(const T* values, const uint64_t num, const T rhs, uint8_t* out) {
+  constexpr uint64_t lanes = 64 / sizeof(T);
+  const auto b = broadcast_avx512<T>(rhs);
+  uint64_t i = 0;
+  for (; i + 64 <= num; i += 64) {
+    uint64_t mask = 0;
+    for (uint64_t v = 0; v < sizeof(T); v++) {
+      mask |= cmp_avx512<T, Op>(values + i + v * lanes, b) << (v * lanes);
+    }
+    _mm512_storeu_si512(out + i, _mm512_maskz_set1_epi8(mask, 1));
+  }
+
+  return i;
+}
+
+#endif  // TILEDB_SIMD_X86
+
+}  // namespace
+
+/* ********************************* */
+/*                API                */
+/* ********************************* */
+
+template <typename T, QueryConditionOp Op>
+void qc_compare(
+    const T* values,
+    const uint64_t num,
+    const T rhs,
+    uint8_t* out,
+    const SimdLevel level) {
+  static_assert(qc_kernel_supported<T, Op>);
+  uint64_t i = 0;
+#if defined(TILEDB_SIMD_X86)
+  switch (std::min(level, simd_level())) {
+    case SimdLevel::AVX512:
+      i = compare_avx512<T, Op>(values, num, rhs, out);
+      break;
+    case SimdLevel::AVX2:
+      i = compare_avx2<T, Op>(values, num, rhs, out);
+      break;
+    default:
+      break;
+  }
+#else
+  (void)level;
+#endif
+  for (; i < num; i++) {
+    out[i] = qc_scalar_cmp<Op>(values[i], rhs);
+  }
+}
+
+/* ********************************* */
+/*     EXPLICIT INSTANTIATIONS       */
+/* ********************************* */
+
+#define TILEDB_QC_KERNELS_INSTANTIATE_OP(T, Op) \
+  template void qc_compare<T, QueryConditionOp::Op>( \
+      const T*, uint64_t, T, uint8_t*, SimdLevel);
+
+#define TILEDB_QC_KERNELS_INSTANTIATE(T)   \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, LT) \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, LE) \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, GT) \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, GE) \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, EQ) \
+  TILEDB_QC_KERNELS_INSTANTIATE_OP(T, NE)
+
+TILEDB_QC_KERNELS_INSTANTIATE(int8_t)
+TILEDB_QC_KERNELS_INSTANTIATE(uint8_t)
+TILEDB_QC_KERNELS_INSTANTIATE(int16_t)
+TILEDB_QC_KERNELS_INSTANTIATE(uint16_t)
+TILEDB_QC_KERNELS_INSTANTIATE(int32_t)
+TILEDB_QC_KERNELS_INSTANTIATE(uint32_t)
+TILEDB_QC_KERNELS_INSTANTIATE(int64_t)
+TILEDB_QC_KERNELS_INSTANTIATE(uint64_t)
+TILEDB_QC_KERNELS_INSTANTIATE(float)
+TILEDB_QC_KERNELS_INSTANTIATE(double)
+TILEDB_QC_KERNELS_INSTANTIATE(char)
+
+#undef TILEDB_QC_KERNELS_INSTANTIATE
+#undef TILEDB_QC_KERNELS_INSTANTIATE_OP
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,159 @@
+/**
+ * @file   query_condition_kernels.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file declares the vectorized kernels used by the query condition to
+ * compare fixed-size numeric cells against a condition value.
+ */
+
+#ifndef TILEDB_QUERY_CONDITION_KERNELS_H
+#define TILEDB_QUERY_CONDITION_KERNELS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "tiledb/sm/enums/query_condition_op.h"
+#include "tiledb/sm/filter/filter_kernels.h"
+
+namespace tiledb {
+namespace sm {
+
+/** The number of cells compared per block by `qc_compare_combine`. */
+constexpr uint64_t qc_kernel_block_size = 256;
+
+/** True if `T` is one of the fixed-size numeric query condition types. */
+template <typename T>
+constexpr bool qc_kernel_type =
+    std::is_same_v<T, int8_t> || std::is_same_v<T, uint8_t> ||
+    std::is_same_v<T, int16_t> || std::is_same_v<T, uint16_t> ||
+    std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> ||
+    std::is_same_v<T, int64_t> || std::is_same_v<T, uint64_t> ||
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    std::is_same_v<T, char>;
+
+/** True if a vectorized kernel exists for datatype `T` and operator `Op`. */
+template <typename T, QueryConditionOp Op>
+constexpr bool qc_kernel_supported =
+    qc_kernel_type<T> &&
+    (Op == QueryConditionOp::LT || Op == QueryConditionOp::LE ||
+     Op == QueryConditionOp::GT || Op == QueryConditionOp::GE ||
+     Op == QueryConditionOp::EQ || Op == QueryConditionOp::NE);
+
+/** Compares two scalar values with the input operator. */
+template <QueryConditionOp Op, typename T>
+inline bool qc_scalar_cmp(const T lhs, const T rhs) {
+  if constexpr (Op == QueryConditionOp::LT) {
+    return lhs < rhs;
+  } else if constexpr (Op == QueryConditionOp::LE) {
+    return lhs <= rhs;
+  } else if constexpr (Op == QueryConditionOp::GT) {
+    return lhs > rhs;
+  } else if constexpr (Op == QueryConditionOp::GE) {
+    return lhs >= rhs;
+  } else if constexpr (Op == QueryConditionOp::EQ) {
+    return lhs == rhs;
+  } else {
+    return lhs != rhs;
+  }
+}
+
+/**
+ * Compares `num` contiguous values against `rhs`, writing 0 or 1 per value
+ * into `out`. Uses the widest vector instructions supported by the CPU, up
+ * to `level`, with a scalar loop for the remaining values. Defined for the
+ * types for which `qc_kernel_supported` holds.
+ *
+ * @tparam T The datatype of the values.
+ * @tparam Op The comparison operator.
+ * @param values The values to compare.
+ * @param num The number of values.
+ * @param rhs The value to compare against.
+ * @param out The comparison results.
+ * @param level The widest instruction set extension to use.
+ */
+template <typename T, QueryConditionOp Op>
+void qc_compare(
+    const T* values,
+    uint64_t num,
+    T rhs,
+    uint8_t* out,
+    filter_kernels::SimdLevel level = filter_kernels::simd_level());
+
+/**
+ * Compares `num` contiguous values against `rhs` and combines the results
+ * into `result` with `combination_op`, one cache-resident block at a time.
+ * Null cells compare as false when `validity` is provided.
+ *
+ * @tparam T The datatype of the values.
+ * @tparam Op The comparison operator.
+ * @tparam BitmapType The datatype of the result bitmap.
+ * @tparam CombinationOp The combination operation.
+ * @param values The values to compare.
+ * @param num The number of values.
+ * @param rhs The value to compare against.
+ * @param validity The validity values, or nullptr to ignore validity.
+ * @param combination_op The combination operation.
+ * @param result The result bitmap.
+ */
+template <
+    typename T,
+    QueryConditionOp Op,
+    typename BitmapType,
+    typename CombinationOp>
+inline void qc_compare_combine(
+    const T* values,
+    const uint64_t num,
+    const T rhs,
+    const uint8_t* validity,
+    CombinationOp combination_op,
+    BitmapType* result) {
+  uint8_t cmp[qc_kernel_block_size];
+  for (uint64_t start = 0; start < num; start += qc_kernel_block_size) {
+    const uint64_t n = std::min(qc_kernel_block_size, num - start);
+    qc_compare<T, Op>(values + start, n, rhs, cmp);
+
+    BitmapType* const block_result = result + start;
+    if (validity == nullptr) {
+      for (uint64_t c = 0; c < n; c++) {
+        block_result[c] = combination_op(block_result[c], cmp[c]);
+      }
+    } else {
+      const uint8_t* const block_validity = validity + start;
+      for (uint64_t c = 0; c < n; c++) {
+        block_result[c] = combination_op(
+            block_result[c], cmp[c] & (block_validity[c] != 0));
+      }
+    }
+  }
+}
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_QUERY_CONDITION_KERNELS_H
@@ -0,0 +1,665 @@
+/**
+ * @file   aggregator.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class Aggregator.
+ */
+
+#include "tiledb/sm/query/readers/aggregator.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/attribute.h"
+#include "tiledb/sm/crypto/encryption_key.h"
+#include "tiledb/sm/fragment/fragment_metadata.h"
+#include "tiledb/sm/tile/tile_metadata_generator.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class AggregatorStatusException : public StatusException {
+ public:
+  explicit AggregatorStatusException(const std::string& message)
+      : StatusException("Aggregator", message) {
+  }
+};
+
+/* ****************************** */
+/*             HELPERS            */
+/* ****************************** */
+
+/**
+ * Calls `fn` with a default value of the C++ type used to aggregate a
+ * datatype. Throws for datatypes that cannot be summed or compared.
+ */
+template <class Fn>
+static void apply_with_type(const Datatype type, Fn&& fn) {
+  switch (type) {
+    case Datatype::INT8:
+      fn(int8_t{});
+      break;
+    case Datatype::BOOL:
+    case Datatype::UINT8:
+      fn(uint8_t{});
+      break;
+    case Datatype::INT16:
+      fn(int16_t{});
+      break;
+    case Datatype::UINT16:
+      fn(uint16_t{});
+      break;
+    case Datatype::INT32:
+      fn(int32_t{});
+      break;
+    case Datatype::UINT32:
+      fn(uint32_t{});
+      break;
+    case Datatype::INT64:
+      fn(int64_t{});
+      break;
+    case Datatype::UINT64:
+      fn(uint64_t{});
+      break;
+    case Datatype::FLOAT32:
+      fn(float{});
+      break;
+    case Datatype::FLOAT64:
+      fn(double{});
+      break;
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      fn(int64_t{});
+      break;
+    default:
+      throw AggregatorStatusException(
+          "Unsupported datatype " + datatype_str(type));
+  }
+}
+
+/**
+ * Adds `value` to `sum`, saturating at the limits of the sum type.
+ *
+ * @return `true` if the sum overflowed.
+ */
+template <class SumT>
+static bool saturating_add(SumT& sum, const SumT value);
+
+template <>
+bool saturating_add<int64_t>(int64_t& sum, const int64_t value) {
+  if (sum > 0 && value > 0 &&
+      sum > std::numeric_limits<int64_t>::max() - value) {
+    sum = std::numeric_limits<int64_t>::max();
+    return true;
+  }
+
+  if (sum < 0 && value < 0 &&
+      sum < std::numeric_limits<int64_t>::min() - value) {
+    sum = std::numeric_limits<int64_t>::min();
+    return true;
+  }
+
+  sum += value;
+  return false;
+}
+
+template <>
+bool saturating_add<uint64_t>(uint64_t& sum, const uint64_t value) {
+  if (sum > std::numeric_limits<uint64_t>::max() - value) {
+    sum = std::numeric_limits<uint64_t>::max();
+    return true;
+  }
+
+  sum += value;
+  return false;
+}
+
+template <>
+bool saturating_add<double>(double& sum, const double value) {
+  if ((sum < 0.0) == (value < 0.0) &&
+      std::abs(sum) > std::numeric_limits<double>::max() - std::abs(value)) {
+    sum = sum < 0.0 ? std::numeric_limits<double>::lowest() :
+                      std::numeric_limits<double>::max();
+    return true;
+  }
+
+  sum += value;
+  return false;
+}
+
+/**
+ * Multiplies `value` by `count`, saturating at the limits of the sum type.
+ *
+ * @return `true` if the product overflowed.
+ */
+template <class SumT>
+static bool saturating_mul(SumT& value, const uint64_t count);
+
+template <>
+bool saturating_mul<int64_t>(int64_t& value, const uint64_t count) {
+  constexpr auto max = std::numeric_limits<int64_t>::max();
+  constexpr auto min = std::numeric_limits<int64_t>::min();
+  if (value == 0 || count == 0) {
+    value = 0;
+    return false;
+  }
+
+  if (count > static_cast<uint64_t>(max) ||
+      value > max / static_cast<int64_t>(count) ||
+      value < min / static_cast<int64_t>(count)) {
+    value = value > 0 ? max : min;
+    return true;
+  }
+
+  value *= static_cast<int64_t>(count);
+  return false;
+}
+
+template <>
+bool saturating_mul<uint64_t>(uint64_t& value, const uint64_t count) {
+  if (count != 0 && value > std::numeric_limits<uint64_t>::max() / count) {
+    value = std::numeric_limits<uint64_t>::max();
+    return true;
+  }
+
+  value *= count;
+  return false;
+}
+
+template <>
+bool saturating_mul<double>(double& value, const uint64_t count) {
+  const double product = value * static_cast<double>(count);
+  if (std::isinf(product)) {
+    value = product < 0.0 ? std::numeric_limits<double>::lowest() :
+                            std::numeric_limits<double>::max();
+    return true;
+  }
+
+  value = product;
+  return false;
+}
+
+/**
+ * Returns true if a sum reached the limits of its type, in which case the
+ * actual sum is unknown.
+ */
+template <class SumT>
+static bool is_saturated(const SumT sum) {
+  return sum == std::numeric_limits<SumT>::max() ||
+         sum == std::numeric_limits<SumT>::lowest();
+}
+
+/** Returns the type of a field, throwing if the field does not exist. */
+static Datatype field_type(
+    const ArraySchema& array_schema, const std::string& field_name) {
+  if (!array_schema.is_field(field_name)) {
+    throw AggregatorStatusException(
+        "Cannot aggregate; Unknown field '" + field_name + "'");
+  }
+
+  return array_schema.type(field_name);
+}
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+Aggregator::Aggregator(
+    const ArraySchema& array_schema,
+    const std::string& field_name,
+    const QueryAggregateOp op)
+    : field_name_(field_name)
+    , op_(op)
+    , type_(field_type(array_schema, field_name))
+    , nullable_(array_schema.is_nullable(field_name))
+    , cell_size_(array_schema.cell_size(field_name))
+    , fill_value_validity_(0) {
+  ensure_query_aggregate_op_is_valid(op_);
+
+  const auto attr = array_schema.attribute(field_name_);
+  if (op_ == QueryAggregateOp::AGGREGATE_NULL_COUNT && !nullable_) {
+    throw AggregatorStatusException(
+        "Cannot aggregate; NULL_COUNT requires a nullable attribute");
+  }
+
+  if (op_ == QueryAggregateOp::AGGREGATE_SUM ||
+      op_ == QueryAggregateOp::AGGREGATE_MIN ||
+      op_ == QueryAggregateOp::AGGREGATE_MAX) {
+    if (attr == nullptr || attr->var_size() || attr->cell_val_num() != 1) {
+      throw AggregatorStatusException(
+          "Cannot aggregate; " + query_aggregate_op_str(op_) +
+          " requires a fixed size attribute with one value per cell");
+    }
+
+    // Throws for unsupported datatypes.
+    apply_with_type(type_, [](auto) {});
+  }
+
+  if (attr != nullptr) {
+    const auto& fill_value = attr->fill_value();
+    fill_value_.resize(fill_value.size());
+    std::memcpy(fill_value_.data(), fill_value.data(), fill_value.size());
+    fill_value_validity_ = attr->fill_value_validity();
+  }
+
+  result_ = new_state();
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Datatype Aggregator::result_type() const {
+  switch (op_) {
+    case QueryAggregateOp::AGGREGATE_SUM: {
+      Datatype ret = Datatype::INT64;
+      apply_with_type(type_, [&](auto t) {
+        using SumT = typename metadata_generator_type_data<
+            decltype(t)>::sum_type;
+        if (std::is_same<SumT, uint64_t>::value) {
+          ret = Datatype::UINT64;
+        } else if (std::is_same<SumT, double>::value) {
+          ret = Datatype::FLOAT64;
+        }
+      });
+      return ret;
+    }
+    case QueryAggregateOp::AGGREGATE_MIN:
+    case QueryAggregateOp::AGGREGATE_MAX:
+      return type_;
+    default:
+      return Datatype::UINT64;
+  }
+}
+
+uint64_t Aggregator::result_size() const {
+  switch (op_) {
+    case QueryAggregateOp::AGGREGATE_MIN:
+    case QueryAggregateOp::AGGREGATE_MAX:
+      return cell_size_;
+    default:
+      return sizeof(uint64_t);
+  }
+}
+
+void Aggregator::load_tile_metadata(
+    FragmentMetadata& frag_md, const EncryptionKey& encryption_key) const {
+  // Fields added by schema evolution have no metadata in older fragments.
+  if (!frag_md.array_schema()->is_field(field_name_)) {
+    return;
+  }
+
+  if (nullable_ && op_ != QueryAggregateOp::AGGREGATE_COUNT) {
+    throw_if_not_ok(
+        frag_md.load_tile_null_count_values(encryption_key, {field_name_}));
+  }
+
+  switch (op_) {
+    case QueryAggregateOp::AGGREGATE_SUM:
+      throw_if_not_ok(
+          frag_md.load_tile_sum_values(encryption_key, {field_name_}));
+      break;
+    case QueryAggregateOp::AGGREGATE_MIN:
+      throw_if_not_ok(
+          frag_md.load_tile_min_values(encryption_key, {field_name_}));
+      break;
+    case QueryAggregateOp::AGGREGATE_MAX:
+      throw_if_not_ok(
+          frag_md.load_tile_max_values(encryption_key, {field_name_}));
+      break;
+    default:
+      break;
+  }
+}
+
+bool Aggregator::can_use_tile_metadata(
+    FragmentMetadata& frag_md, const uint64_t tile_idx) const {
+  // The cell count is always known.
+  if (op_ == QueryAggregateOp::AGGREGATE_COUNT) {
+    return true;
+  }
+
+  // Tile metadata was added in format version 11. Fields added by schema
+  // evolution have no metadata in older fragments.
+  if (frag_md.format_version() < 11 ||
+      !frag_md.array_schema()->is_field(field_name_)) {
+    return false;
+  }
+
+  // A saturated sum does not give the actual sum of the tile.
+  if (op_ == QueryAggregateOp::AGGREGATE_SUM) {
+    bool saturated = false;
+    apply_with_type(type_, [&](auto t) {
+      using SumT = typename metadata_generator_type_data<
+          decltype(t)>::sum_type;
+      saturated = is_saturated<SumT>(
+          *static_cast<SumT*>(frag_md.get_tile_sum(field_name_, tile_idx)));
+    });
+    return !saturated;
+  }
+
+  return true;
+}
+
+void Aggregator::aggregate_tile_metadata(
+    FragmentMetadata& frag_md, const uint64_t tile_idx) {
+  AggregateState state = new_state();
+  state.count_ = frag_md.cell_num(tile_idx);
+  if (op_ == QueryAggregateOp::AGGREGATE_COUNT) {
+    merge(state);
+    return;
+  }
+
+  if (nullable_) {
+    state.null_count_ = frag_md.get_tile_null_count(field_name_, tile_idx);
+  }
+
+  // Min and max of tiles without non-null cells are not meaningful.
+  const bool has_values = state.count_ != state.null_count_;
+  switch (op_) {
+    case QueryAggregateOp::AGGREGATE_SUM:
+      std::memcpy(
+          state.sum_.data(),
+          frag_md.get_tile_sum(field_name_, tile_idx),
+          sizeof(uint64_t));
+      break;
+    case QueryAggregateOp::AGGREGATE_MIN:
+      if (has_values) {
+        apply_with_type(type_, [&](auto t) {
+          using T = decltype(t);
+          auto min = frag_md.get_tile_min_as<T>(field_name_, tile_idx);
+          std::memcpy(state.min_.data(), &min, sizeof(T));
+        });
+      }
+      break;
+    case QueryAggregateOp::AGGREGATE_MAX:
+      if (has_values) {
+        apply_with_type(type_, [&](auto t) {
+          using T = decltype(t);
+          auto max = frag_md.get_tile_max_as<T>(field_name_, tile_idx);
+          std::memcpy(state.max_.data(), &max, sizeof(T));
+        });
+      }
+      break;
+    default:
+      break;
+  }
+
+  merge(state);
+}
+
+AggregateState Aggregator::new_state() const {
+  AggregateState state;
+  state.sum_.resize(sizeof(uint64_t), 0);
+
+  if (op_ == QueryAggregateOp::AGGREGATE_MIN ||
+      op_ == QueryAggregateOp::AGGREGATE_MAX) {
+    state.min_.resize(cell_size_);
+    state.max_.resize(cell_size_);
+    apply_with_type(type_, [&](auto t) {
+      using T = decltype(t);
+      const T min = metadata_generator_type_data<T>::min;
+      const T max = metadata_generator_type_data<T>::max;
+      std::memcpy(state.min_.data(), &min, sizeof(T));
+      std::memcpy(state.max_.data(), &max, sizeof(T));
+    });
+  }
+
+  return state;
+}
+
+template <class CountType>
+void Aggregator::aggregate_cells(
+    AggregateState& state,
+    const ResultTile::TileTuple* tile_tuple,
+    const uint64_t start,
+    const uint64_t stride,
+    const uint64_t num,
+    const CountType* counts) const {
+  // Counting cells does not look at the data.
+  if (op_ == QueryAggregateOp::AGGREGATE_COUNT) {
+    if (counts == nullptr) {
+      state.count_ += num;
+    } else {
+      for (uint64_t c = 0; c < num; c++) {
+        state.count_ += counts[c];
+      }
+    }
+
+    return;
+  }
+
+  // Cells without tiles take the fill value, use a zero stride to repeat it.
+  const void* values = fill_value_.data();
+  const uint8_t* validity = nullable_ ? &fill_value_validity_ : nullptr;
+  uint64_t value_stride = 0;
+  uint64_t validity_stride = 0;
+  if (tile_tuple != nullptr) {
+    values = tile_tuple->fixed_tile().data_as<char>() + start * cell_size_;
+    value_stride = stride;
+    if (nullable_) {
+      validity = tile_tuple->validity_tile().data_as<uint8_t>() + start;
+      validity_stride = stride;
+    }
+  }
+
+  // Null counts only look at the validity.
+  if (op_ == QueryAggregateOp::AGGREGATE_NULL_COUNT) {
+    for (uint64_t c = 0; c < num; c++) {
+      const uint64_t count = counts == nullptr ? 1 : counts[c];
+      state.count_ += count;
+      state.null_count_ += validity[c * validity_stride] == 0 ? count : 0;
+    }
+
+    return;
+  }
+
+  apply_with_type(type_, [&](auto t) {
+    using T = decltype(t);
+    aggregate_values<T, CountType>(
+        state,
+        static_cast<const T*>(values),
+        validity,
+        value_stride,
+        validity_stride,
+        num,
+        counts);
+  });
+}
+
+void Aggregator::merge(const AggregateState& state) {
+  std::lock_guard<std::mutex> lg(mtx_);
+  result_.count_ += state.count_;
+  result_.null_count_ += state.null_count_;
+  result_.overflow_ |= state.overflow_;
+
+  if (op_ == QueryAggregateOp::AGGREGATE_SUM ||
+      op_ == QueryAggregateOp::AGGREGATE_MIN ||
+      op_ == QueryAggregateOp::AGGREGATE_MAX) {
+    apply_with_type(type_, [&](auto t) { merge_values<decltype(t)>(state); });
+  }
+}
+
+bool Aggregator::overflowed() const {
+  std::lock_guard<std::mutex> lg(mtx_);
+  return result_.overflow_;
+}
+
+void Aggregator::get_result(void* value, uint8_t* validity) const {
+  std::lock_guard<std::mutex> lg(mtx_);
+  const bool has_values = result_.count_ != result_.null_count_;
+  switch (op_) {
+    case QueryAggregateOp::AGGREGATE_COUNT:
+      std::memcpy(value, &result_.count_, sizeof(uint64_t));
+      break;
+    case QueryAggregateOp::AGGREGATE_NULL_COUNT:
+      std::memcpy(value, &result_.null_count_, sizeof(uint64_t));
+      break;
+    case QueryAggregateOp::AGGREGATE_SUM:
+      std::memcpy(value, result_.sum_.data(), sizeof(uint64_t));
+      break;
+    case QueryAggregateOp::AGGREGATE_MIN:
+      std::memcpy(value, result_.min_.data(), cell_size_);
+      break;
+    case QueryAggregateOp::AGGREGATE_MAX:
+      std::memcpy(value, result_.max_.data(), cell_size_);
+      break;
+    default:
+      throw AggregatorStatusException("Invalid aggregate op");
+  }
+
+  if (validity != nullptr) {
+    const bool counts_only = op_ == QueryAggregateOp::AGGREGATE_COUNT ||
+                             op_ == QueryAggregateOp::AGGREGATE_NULL_COUNT;
+    *validity = counts_only || has_values ? 1 : 0;
+  }
+}
+
+/* ****************************** */
+/*         PRIVATE METHODS        */
+/* ****************************** */
+
+template <class T, class CountType>
+void Aggregator::aggregate_values(
+    AggregateState& state,
+    const T* values,
+    const uint8_t* validity,
+    const uint64_t stride,
+    const uint64_t validity_stride,
+    const uint64_t num,
+    const CountType* counts) const {
+  using SumT = typename metadata_generator_type_data<T>::sum_type;
+  auto sum = reinterpret_cast<SumT*>(state.sum_.data());
+  auto min = reinterpret_cast<T*>(state.min_.data());
+  auto max = reinterpret_cast<T*>(state.max_.data());
+
+  for (uint64_t c = 0; c < num; c++) {
+    const uint64_t count = counts == nullptr ? 1 : counts[c];
+    if (count == 0) {
+      continue;
+    }
+
+    state.count_ += count;
+    if (validity != nullptr && validity[c * validity_stride] == 0) {
+      state.null_count_ += count;
+      continue;
+    }
+
+    const T value = values[c * stride];
+    switch (op_) {
+      case QueryAggregateOp::AGGREGATE_SUM: {
+        // Cells in overlapping ranges are results more than once.
+        auto total = static_cast<SumT>(value);
+        if (saturating_mul<SumT>(total, count) |
+            saturating_add<SumT>(*sum, total)) {
+          state.overflow_ = true;
+        }
+        break;
+      }
+      case QueryAggregateOp::AGGREGATE_MIN:
+        if (value < *min) {
+          *min = value;
+        }
+        break;
+      case QueryAggregateOp::AGGREGATE_MAX:
+        if (value > *max) {
+          *max = value;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+template <class T>
+void Aggregator::merge_values(const AggregateState& state) {
+  using SumT = typename metadata_generator_type_data<T>::sum_type;
+  auto sum = reinterpret_cast<SumT*>(result_.sum_.data());
+  if (saturating_add<SumT>(
+          *sum, *reinterpret_cast<const SumT*>(state.sum_.data()))) {
+    result_.overflow_ = true;
+  }
+
+  if (op_ == QueryAggregateOp::AGGREGATE_MIN ||
+      op_ == QueryAggregateOp::AGGREGATE_MAX) {
+    auto min = reinterpret_cast<T*>(result_.min_.data());
+    auto max = reinterpret_cast<T*>(result_.max_.data());
+    const auto state_min = *reinterpret_cast<const T*>(state.min_.data());
+    const auto state_max = *reinterpret_cast<const T*>(state.max_.data());
+    if (state_min < *min) {
+      *min = state_min;
+    }
+    if (state_max > *max) {
+      *max = state_max;
+    }
+  }
+}
+
+// Explicit template instantiations
+template void Aggregator::aggregate_cells<uint8_t>(
+    AggregateState&,
+    const ResultTile::TileTuple*,
+    const uint64_t,
+    const uint64_t,
+    const uint64_t,
+    const uint8_t*) const;
+template void Aggregator::aggregate_cells<uint64_t>(
+    AggregateState&,
+    const ResultTile::TileTuple*,
+    const uint64_t,
+    const uint64_t,
+    const uint64_t,
+    const uint64_t*) const;
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,266 @@
+/**
+ * @file   aggregator.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class Aggregator.
+ */
+
+#ifndef TILEDB_AGGREGATOR_H
+#define TILEDB_AGGREGATOR_H
+
+#include <mutex>
+#include <string>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/macros.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/enums/query_aggregate_op.h"
+#include "tiledb/sm/misc/types.h"
+#include "tiledb/sm/query/readers/result_tile.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+class ArraySchema;
+class EncryptionKey;
+class FragmentMetadata;
+
+/**
+ * The partial result of an aggregate, computed over a subset of the cells.
+ * Partial results are computed independently (e.g. one per tile and thread)
+ * and merged into their aggregator.
+ */
+struct AggregateState {
+  /** Number of cells. */
+  uint64_t count_ = 0;
+
+  /** Number of null cells. */
+  uint64_t null_count_ = 0;
+
+  /** Running sum, stored as the sum type of the field. */
+  ByteVec sum_;
+
+  /** Did the running sum overflow its type. */
+  bool overflow_ = false;
+
+  /** Running minimum, stored as the type of the field. */
+  ByteVec min_;
+
+  /** Running maximum, stored as the type of the field. */
+  ByteVec max_;
+};
+
+/**
+ * Computes an aggregate (COUNT, SUM, MIN, MAX or NULL_COUNT) over a field for
+ * a read query. The readers feed it either the per tile metadata stored in
+ * the fragments, for tiles where it is known to match the query results, or
+ * the cells of the other result tiles.
+ *
+ * Sums saturate at the limits of their type, like the tile sums computed by
+ * the writers, and a SUM that overflowed has no result. SUM, MIN and MAX
+ * ignore null cells and their result is null when there are no non-null
+ * cells.
+ *
+ * Merging partial results is thread-safe.
+ */
+class Aggregator {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Constructor. Throws if the aggregate is not supported for the field.
+   *
+   * @param array_schema The array schema.
+   * @param field_name The name of the aggregated field.
+   * @param op The aggregate op.
+   */
+  Aggregator(
+      const ArraySchema& array_schema,
+      const std::string& field_name,
+      const QueryAggregateOp op);
+
+  DISABLE_COPY_AND_COPY_ASSIGN(Aggregator);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(Aggregator);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /** Returns the name of the aggregated field. */
+  inline const std::string& field_name() const {
+    return field_name_;
+  }
+
+  /** Returns the aggregate op. */
+  inline QueryAggregateOp op() const {
+    return op_;
+  }
+
+  /** Returns the datatype of the result. */
+  Datatype result_type() const;
+
+  /** Returns the size in bytes of the result. */
+  uint64_t result_size() const;
+
+  /**
+   * Returns `true` if the aggregate needs the tiles of the field to be loaded
+   * in order to process cells. Counting cells only needs the result bitmaps.
+   */
+  inline bool needs_tiles() const {
+    return op_ != QueryAggregateOp::AGGREGATE_COUNT;
+  }
+
+  /**
+   * Loads the tile metadata used by the aggregate for a fragment.
+   *
+   * @param frag_md The fragment metadata.
+   * @param encryption_key The key the array got opened with.
+   */
+  void load_tile_metadata(
+      FragmentMetadata& frag_md, const EncryptionKey& encryption_key) const;
+
+  /**
+   * Returns `true` if the tile metadata of a tile, loaded with
+   * `load_tile_metadata`, can be used in place of its cells. The caller is
+   * responsible for checking that all the cells of the tile are results.
+   *
+   * @param frag_md The fragment metadata.
+   * @param tile_idx The tile index.
+   */
+  bool can_use_tile_metadata(
+      FragmentMetadata& frag_md, const uint64_t tile_idx) const;
+
+  /**
+   * Aggregates a full tile using its metadata.
+   *
+   * @param frag_md The fragment metadata.
+   * @param tile_idx The tile index.
+   */
+  void aggregate_tile_metadata(
+      FragmentMetadata& frag_md, const uint64_t tile_idx);
+
+  /** Returns an empty partial result. */
+  AggregateState new_state() const;
+
+  /**
+   * Aggregates cells into a partial result.
+   *
+   * @tparam CountType The type of the cell counts.
+   * @param state The partial result.
+   * @param tile_tuple The tiles of the field. When null, the cells take the
+   *     fill value of the field.
+   * @param start The position of the first cell in the tile.
+   * @param stride The distance between two consecutive cells in the tile.
+   * @param num The number of cells to aggregate.
+   * @param counts The number of times each cell is a result, or null if all
+   *     cells are a result once.
+   */
+  template <class CountType>
+  void aggregate_cells(
+      AggregateState& state,
+      const ResultTile::TileTuple* tile_tuple,
+      const uint64_t start,
+      const uint64_t stride,
+      const uint64_t num,
+      const CountType* counts) const;
+
+  /** Merges a partial result into the aggregate. */
+  void merge(const AggregateState& state);
+
+  /** Returns `true` if the aggregated sum overflowed its result type. */
+  bool overflowed() const;
+
+  /**
+   * Returns the result of the aggregate. The sum is saturated if it
+   * overflowed, see `overflowed`.
+   *
+   * @param value Receives the result, of `result_size()` bytes.
+   * @param validity Receives 0 if the result is null, 1 otherwise. Optional.
+   */
+  void get_result(void* value, uint8_t* validity) const;
+
+ private:
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The name of the aggregated field. */
+  const std::string field_name_;
+
+  /** The aggregate op. */
+  const QueryAggregateOp op_;
+
+  /** The datatype of the field. */
+  const Datatype type_;
+
+  /** Is the field nullable. */
+  const bool nullable_;
+
+  /** The size of a cell of the field. */
+  const uint64_t cell_size_;
+
+  /** The fill value of the field. */
+  ByteVec fill_value_;
+
+  /** The validity of the fill value. */
+  uint8_t fill_value_validity_;
+
+  /** The result, merged from the partial results. */
+  AggregateState result_;
+
+  /** Protects `result_`. */
+  mutable std::mutex mtx_;
+
+  /* ********************************* */
+  /*          PRIVATE METHODS          */
+  /* ********************************* */
+
+  /** Typed implementation of `aggregate_cells`. */
+  template <class T, class CountType>
+  void aggregate_values(
+      AggregateState& state,
+      const T* values,
+      const uint8_t* validity,
+      const uint64_t stride,
+      const uint64_t validity_stride,
+      const uint64_t num,
+      const CountType* counts) const;
+
+  /** Typed implementation of `merge`. */
+  template <class T>
+  void merge_values(const AggregateState& state);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_AGGREGATOR_H
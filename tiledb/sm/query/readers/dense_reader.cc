@@ -77,6 +77,7 @@ DenseReader::DenseReader(
     Subarray& subarray,
     Layout layout,
     QueryCondition& condition,
+    std::vector<shared_ptr<Aggregator>> aggregates,
     bool skip_checks_serialization)
     : ReaderBase(
           stats,
@@ -87,7 +88,8 @@ DenseReader::DenseReader(
           buffers,
           subarray,
           layout,
-          condition)
+          condition,
+          std::move(aggregates))
     , array_memory_tracker_(array->memory_tracker()) {
   elements_mode_ = false;
 
@@ -97,7 +99,7 @@ DenseReader::DenseReader(
         "Cannot initialize dense reader; Storage manager not set");
   }
 
-  if (!skip_checks_serialization && buffers_.empty()) {
+  if (!skip_checks_serialization && buffers_.empty() && aggregates_.empty()) {
     throw DenseReaderStatusException(
         "Cannot initialize dense reader; Buffers not set");
   }
@@ -384,12 +386,41 @@ Status DenseReader::dense_read() {
     }
   }
 
+  // Add the fields loaded to compute aggregates in-engine.
+  for (auto& name : aggregate_field_names()) {
+    if (condition_names.count(name) != 0 || buffers_.count(name) != 0) {
+      continue;
+    }
+
+    names.emplace_back(name);
+    if (array_schema_.var_size(name)) {
+      var_names.emplace_back(name);
+    }
+  }
+
   // Pre-load all attribute offsets into memory for attributes
   // in query condition to be read.
-  RETURN_CANCEL_OR_ERROR(load_tile_var_sizes(
-      read_state_.partitioner_.subarray().relevant_fragments(), var_names));
-  RETURN_CANCEL_OR_ERROR(load_tile_offsets(
-      read_state_.partitioner_.subarray().relevant_fragments(), names));
+  const auto& relevant_fragments =
+      read_state_.partitioner_.subarray().relevant_fragments();
+  RETURN_CANCEL_OR_ERROR(load_tile_var_sizes(relevant_fragments, var_names));
+  RETURN_CANCEL_OR_ERROR(load_tile_offsets(relevant_fragments, names));
+
+  // Load the tile metadata used to skip tiles with the query condition.
+  RETURN_CANCEL_OR_ERROR(load_condition_tile_metadata(relevant_fragments));
+
+  // Aggregate the space tiles that can use the tile metadata.
+  std::vector<uint8_t> aggregated_from_metadata;
+  if (!aggregates_.empty()) {
+    RETURN_CANCEL_OR_ERROR(load_aggregate_tile_metadata(relevant_fragments));
+    aggregated_from_metadata.resize(tile_coords.size());
+    for (uint64_t t = 0; t < tile_coords.size(); t++) {
+      const DimType* tc = (DimType*)&tile_coords[t][0];
+      auto it = result_space_tiles.find(tc);
+      assert(it != result_space_tiles.end());
+      aggregated_from_metadata[t] = aggregate_space_tile_metadata<DimType>(
+          tile_extents, it->second, tile_subarrays[t]);
+    }
+  }
 
   uint64_t t_start = 0;
   uint64_t t_end = 0;
@@ -397,6 +428,7 @@ Status DenseReader::dense_read() {
   uint64_t subarray_end_cell = 0;
   std::vector<uint8_t> qc_result(
       condition_.empty() ? 0 : subarray.cell_num(), 1);
+  std::vector<ResultTile*> qc_skipped_tiles;
 
   // Keep track of the current var buffer sizes.
   std::map<std::string, uint64_t> var_buffer_sizes;
@@ -439,7 +471,8 @@ Status DenseReader::dense_read() {
         range_info,
         result_space_tiles,
         num_range_threads,
-        qc_result);
+        qc_result,
+        qc_skipped_tiles);
     RETURN_CANCEL_OR_ERROR(st);
 
     // For `qc_coords_mode` just fill in the coordinates and skip attribute
@@ -453,6 +486,45 @@ Status DenseReader::dense_read() {
       continue;
     }
 
+    // Tiles of the space tiles aggregated from their tile metadata don't
+    // need to be read.
+    std::vector<ResultTile*> tiles_to_read;
+    if (!aggregates_.empty()) {
+      for (uint64_t t = t_start; t < t_end; t++) {
+        if (aggregated_from_metadata[t]) {
+          continue;
+        }
+
+        const DimType* tc = (DimType*)&tile_coords[t][0];
+        auto it = result_space_tiles.find(tc);
+        assert(it != result_space_tiles.end());
+        for (const auto& result_tile : it->second.result_tiles()) {
+          tiles_to_read.push_back(
+              const_cast<ResultTile*>(&result_tile.second));
+        }
+      }
+      std::sort(tiles_to_read.begin(), tiles_to_read.end(), result_tile_cmp);
+
+      // Compute the aggregates that don't need tiles.
+      status = aggregate_attribute<DimType>(
+          field_aggregates(""),
+          "",
+          tile_extents,
+          subarray,
+          t_start,
+          t_end,
+          tile_subarrays,
+          tile_offsets,
+          range_info,
+          result_space_tiles,
+          qc_result,
+          aggregated_from_metadata,
+          num_range_threads);
+      RETURN_CANCEL_OR_ERROR(status);
+    } else {
+      tiles_to_read = result_tiles;
+    }
+
     // Process all attributes, names starts with the query condition names to
     // clear the memory. Also, a name in names might not be in the user buffers
     // so we might skip the copy but still clear the memory.
@@ -462,11 +534,15 @@ Status DenseReader::dense_read() {
         continue;
       }
 
+      to_read[0] = name;
       if (condition_names.count(name) == 0) {
         // Read and unfilter tiles.
-        to_read[0] = name;
         RETURN_CANCEL_OR_ERROR(
-            read_and_unfilter_attribute_tiles(to_read, result_tiles));
+            read_and_unfilter_attribute_tiles(to_read, tiles_to_read));
+      } else if (!qc_skipped_tiles.empty() && buffers_.count(name) != 0) {
+        // The tiles skipped by the query condition are still copied.
+        RETURN_CANCEL_OR_ERROR(
+            read_and_unfilter_attribute_tiles(to_read, qc_skipped_tiles));
       }
 
       // Only copy names that are present in the user buffers.
@@ -491,6 +567,26 @@ Status DenseReader::dense_read() {
         RETURN_CANCEL_OR_ERROR(status);
       }
 
+      // Compute the aggregates of this field.
+      auto aggregates = field_aggregates(name);
+      if (!aggregates.empty()) {
+        status = aggregate_attribute<DimType>(
+            aggregates,
+            name,
+            tile_extents,
+            subarray,
+            t_start,
+            t_end,
+            tile_subarrays,
+            tile_offsets,
+            range_info,
+            result_space_tiles,
+            qc_result,
+            aggregated_from_metadata,
+            num_range_threads);
+        RETURN_CANCEL_OR_ERROR(status);
+      }
+
       clear_tiles(name, result_tiles);
     }
 
@@ -756,8 +852,10 @@ Status DenseReader::apply_query_condition(
     const std::vector<RangeInfo<DimType>>& range_info,
     std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
     const uint64_t num_range_threads,
-    std::vector<uint8_t>& qc_result) {
+    std::vector<uint8_t>& qc_result,
+    std::vector<ResultTile*>& skipped_tiles) {
   auto timer_se = stats_->start_timer("apply_query_condition");
+  skipped_tiles.clear();
 
   if (!condition_.empty()) {
     // For easy reference.
@@ -776,9 +874,22 @@ Status DenseReader::apply_query_condition(
       }
     }
 
+    // Skip the tiles with no cells passing the query condition according to
+    // their min/max metadata.
+    std::vector<ResultTile*> qc_tiles;
+    qc_tiles.reserve(result_tiles.size());
+    for (auto rt : result_tiles) {
+      if (tile_excluded_by_condition(rt->frag_idx(), rt->tile_idx())) {
+        skipped_tiles.emplace_back(rt);
+      } else {
+        qc_tiles.emplace_back(rt);
+      }
+    }
+    stats_->add_counter("tiles_skipped_by_condition", skipped_tiles.size());
+
     // Read and unfilter query condition attributes.
     RETURN_CANCEL_OR_ERROR(
-        read_and_unfilter_attribute_tiles(qc_names, result_tiles));
+        read_and_unfilter_attribute_tiles(qc_names, qc_tiles));
 
     if (stride == UINT64_MAX) {
       stride = 1;
@@ -797,8 +908,18 @@ Status DenseReader::apply_query_condition(
           auto it = result_space_tiles.find(tc);
           assert(it != result_space_tiles.end());
 
-          // Iterate over all coordinates, retrieved in cell slab.
+          // Find out which fragment domains have a skipped tile.
           const auto& frag_domains = it->second.frag_domains();
+          std::vector<uint8_t> skipped(frag_domains.size(), 0);
+          if (!skipped_tiles.empty()) {
+            for (uint64_t i = 0; i < frag_domains.size(); i++) {
+              const auto f = frag_domains[i].fid();
+              skipped[i] = tile_excluded_by_condition(
+                  f, it->second.result_tile(f)->tile_idx());
+            }
+          }
+
+          // Iterate over all coordinates, retrieved in cell slab.
           TileCellSlabIter<DimType> iter(
               range_thread_idx,
               num_range_threads,
@@ -840,6 +961,12 @@ Status DenseReader::apply_query_condition(
                   }
                 }
 
+                // No cells of a skipped tile pass the condition.
+                if (skipped[i]) {
+                  std::memset(dest_ptr + start, 0, end - start + 1);
+                  continue;
+                }
+
                 RETURN_NOT_OK(condition_.apply_dense(
                     *(fragment_metadata_[frag_domains[i].fid()]
                           ->array_schema()
@@ -1307,6 +1434,230 @@ Status DenseReader::copy_fixed_tiles(
   return Status::Ok();
 }
 
+template <class DimType>
+bool DenseReader::aggregate_space_tile_metadata(
+    const std::vector<DimType>& tile_extents,
+    ResultSpaceTile<DimType>& result_space_tile,
+    const Subarray& tile_subarray) {
+  // The space tile needs to be fully in the subarray and written by a single
+  // fragment.
+  const auto& frag_domains = result_space_tile.frag_domains();
+  if (frag_domains.size() != 1 ||
+      tile_subarray.cell_num() != array_schema_.domain().cell_num_per_tile()) {
+    return false;
+  }
+
+  const auto f = frag_domains[0].fid();
+  if (!fragment_tile_metadata_usable(f)) {
+    return false;
+  }
+
+  const auto& start_coords = result_space_tile.start_coords();
+  const auto& frag_domain = frag_domains[0].domain();
+  for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+    auto dom = static_cast<const DimType*>(frag_domain[d].data());
+    if (dom[0] > start_coords[d] ||
+        dom[1] < start_coords[d] + tile_extents[d] - 1) {
+      return false;
+    }
+  }
+
+  return aggregate_tile_metadata(
+      f, result_space_tile.result_tile(f)->tile_idx());
+}
+
+template <class DimType>
+Status DenseReader::aggregate_attribute(
+    const std::vector<shared_ptr<Aggregator>>& aggregates,
+    const std::string& name,
+    const std::vector<DimType>& tile_extents,
+    const Subarray& subarray,
+    const uint64_t t_start,
+    const uint64_t t_end,
+    const DynamicArray<Subarray>& tile_subarrays,
+    const std::vector<uint64_t>& tile_offsets,
+    const std::vector<RangeInfo<DimType>>& range_info,
+    std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
+    const std::vector<uint8_t>& qc_result,
+    const std::vector<uint8_t>& aggregated_from_metadata,
+    const uint64_t num_range_threads) {
+  auto timer_se = stats_->start_timer("aggregate_attribute");
+
+  if (aggregates.empty()) {
+    return Status::Ok();
+  }
+
+  // For easy reference
+  const auto& tile_coords = subarray.tile_coords();
+  const auto global_order = layout_ == Layout::GLOBAL_ORDER;
+
+  // Process values in parallel.
+  auto status = parallel_for_2d(
+      storage_manager_->compute_tp(),
+      t_start,
+      t_end,
+      0,
+      num_range_threads,
+      [&](uint64_t t, uint64_t range_thread_idx) {
+        // Skip the tiles already aggregated from their tile metadata.
+        if (aggregated_from_metadata[t]) {
+          return Status::Ok();
+        }
+
+        // Find out result space tile and tile subarray.
+        const DimType* tc = (DimType*)&tile_coords[t][0];
+        auto it = result_space_tiles.find(tc);
+        assert(it != result_space_tiles.end());
+
+        return aggregate_tiles(
+            aggregates,
+            name,
+            tile_extents,
+            it->second,
+            subarray,
+            tile_subarrays[t],
+            global_order ? tile_offsets[t] : 0,
+            range_info,
+            qc_result,
+            range_thread_idx,
+            num_range_threads);
+      });
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+template <class DimType>
+Status DenseReader::aggregate_tiles(
+    const std::vector<shared_ptr<Aggregator>>& aggregates,
+    const std::string& name,
+    const std::vector<DimType>& tile_extents,
+    ResultSpaceTile<DimType>& result_space_tile,
+    const Subarray& subarray,
+    const Subarray& tile_subarray,
+    const uint64_t global_cell_offset,
+    const std::vector<RangeInfo<DimType>>& range_info,
+    const std::vector<uint8_t>& qc_result,
+    const uint64_t range_thread_idx,
+    const uint64_t num_range_threads) {
+  // For easy reference
+  const auto dim_num = array_schema_.dim_num();
+  const auto cell_order = array_schema_.cell_order();
+  auto stride = array_schema_.domain().stride<DimType>(layout_);
+  const auto& frag_domains = result_space_tile.frag_domains();
+
+  // Cache tile tuples. They are null for aggregates that don't need tiles and
+  // for fields added after the fragment was written.
+  std::vector<ResultTile::TileTuple*> tile_tuples(
+      frag_domains.size(), nullptr);
+  if (!name.empty()) {
+    for (uint32_t fd = 0; fd < frag_domains.size(); ++fd) {
+      tile_tuples[fd] = result_space_tile.result_tile(frag_domains[fd].fid())
+                            ->tile_tuple(name);
+    }
+  }
+
+  if (stride == UINT64_MAX) {
+    stride = 1;
+  }
+
+  // Partial results for this tile.
+  std::vector<AggregateState> states;
+  states.reserve(aggregates.size());
+  for (const auto& aggregate : aggregates) {
+    states.emplace_back(aggregate->new_state());
+  }
+
+  // Fragment domain of each cell of the slab, -1 for cells using the fill
+  // value, and query condition results of the slab.
+  std::vector<int32_t> cell_frag_domains;
+  std::vector<uint8_t> counts;
+
+  // Iterate over all coordinates, retrieved in cell slab.
+  TileCellSlabIter<DimType> iter(
+      range_thread_idx,
+      num_range_threads,
+      subarray,
+      tile_subarray,
+      tile_extents,
+      result_space_tile.start_coords(),
+      range_info,
+      cell_order);
+
+  // Initialise for global order, will be adjusted later for row/col major.
+  uint64_t cell_offset = global_cell_offset + iter.global_offset();
+  while (!iter.end()) {
+    // Compute cell offset for row/col major orders.
+    if (layout_ != Layout::GLOBAL_ORDER) {
+      cell_offset = iter.dest_offset_row_col();
+    }
+
+    // The most recent fragment domain overlapping a cell wins, as in
+    // copy_fixed_tiles.
+    const auto length = iter.cell_slab_length();
+    cell_frag_domains.assign(length, -1);
+    for (int32_t fd = (int32_t)frag_domains.size() - 1; fd >= 0; --fd) {
+      auto&& [overlaps, start, end] = cell_slab_overlaps_range(
+          dim_num,
+          frag_domains[fd].domain(),
+          iter.cell_slab_coords(),
+          length);
+      if (overlaps) {
+        std::fill(
+            cell_frag_domains.begin() + start,
+            cell_frag_domains.begin() + end + 1,
+            fd);
+      }
+    }
+
+    // Cells that don't pass the query condition are not aggregated.
+    const uint8_t* slab_counts = nullptr;
+    if (!condition_.empty()) {
+      counts.resize(length);
+      for (uint64_t c = 0; c < length; c++) {
+        counts[c] = qc_result[c + cell_offset] & 0x1;
+      }
+      slab_counts = counts.data();
+    }
+
+    // Aggregate the runs of cells coming from the same fragment domain.
+    uint64_t run_start = 0;
+    while (run_start < length) {
+      uint64_t run_end = run_start + 1;
+      while (run_end < length &&
+             cell_frag_domains[run_end] == cell_frag_domains[run_start]) {
+        run_end++;
+      }
+
+      const auto fd = cell_frag_domains[run_start];
+      for (uint64_t a = 0; a < aggregates.size(); a++) {
+        aggregates[a]->aggregate_cells(
+            states[a],
+            fd < 0 ? nullptr : tile_tuples[fd],
+            iter.pos_in_tile() + run_start * stride,
+            stride,
+            run_end - run_start,
+            slab_counts == nullptr ? nullptr : slab_counts + run_start);
+      }
+
+      run_start = run_end;
+    }
+
+    // Adjust the cell offset for global order.
+    if (layout_ == Layout::GLOBAL_ORDER) {
+      cell_offset += length;
+    }
+
+    ++iter;
+  }
+
+  for (uint64_t a = 0; a < aggregates.size(); a++) {
+    aggregates[a]->merge(states[a]);
+  }
+
+  return Status::Ok();
+}
+
 template <class DimType, class OffType>
 Status DenseReader::copy_offset_tiles(
     const std::string& name,
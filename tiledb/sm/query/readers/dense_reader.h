@@ -97,6 +97,7 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       Subarray& subarray,
       Layout layout,
       QueryCondition& condition,
+      std::vector<shared_ptr<Aggregator>> aggregates,
       bool skip_checks_serialization = false);
 
   /** Destructor. */
@@ -195,7 +196,11 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       uint64_t t_start,
       std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles);
 
-  /** Apply the query condition. */
+  /**
+   * Apply the query condition. The tiles with no cells passing the condition
+   * according to their min/max metadata are not read and returned in
+   * `skipped_tiles`.
+   */
   template <class DimType, class OffType>
   Status apply_query_condition(
       Subarray& subarray,
@@ -209,7 +214,8 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const std::vector<RangeInfo<DimType>>& range_info,
       std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
       const uint64_t num_range_threads,
-      std::vector<uint8_t>& qc_result);
+      std::vector<uint8_t>& qc_result,
+      std::vector<ResultTile*>& skipped_tiles);
 
   /** Fix offsets buffer after reading all offsets. */
   template <class OffType>
@@ -264,6 +270,55 @@ class DenseReader : public ReaderBase, public IQueryStrategy {
       const uint64_t range_thread_idx,
       const uint64_t num_range_threads);
 
+  /**
+   * Computes the aggregates of a space tile from the tile metadata, if the
+   * space tile is fully in the subarray and fully written by a single
+   * fragment.
+   *
+   * @return True if the space tile was aggregated.
+   */
+  template <class DimType>
+  bool aggregate_space_tile_metadata(
+      const std::vector<DimType>& tile_extents,
+      ResultSpaceTile<DimType>& result_space_tile,
+      const Subarray& tile_subarray);
+
+  /**
+   * Computes aggregates over the cells of the space tiles, skipping the tiles
+   * already aggregated from their tile metadata. The name is empty for
+   * aggregates that don't need tiles.
+   */
+  template <class DimType>
+  Status aggregate_attribute(
+      const std::vector<shared_ptr<Aggregator>>& aggregates,
+      const std::string& name,
+      const std::vector<DimType>& tile_extents,
+      const Subarray& subarray,
+      const uint64_t t_start,
+      const uint64_t t_end,
+      const DynamicArray<Subarray>& tile_subarrays,
+      const std::vector<uint64_t>& tile_offsets,
+      const std::vector<RangeInfo<DimType>>& range_info,
+      std::map<const DimType*, ResultSpaceTile<DimType>>& result_space_tiles,
+      const std::vector<uint8_t>& qc_result,
+      const std::vector<uint8_t>& aggregated_from_metadata,
+      const uint64_t num_range_threads);
+
+  /** Computes aggregates over the cells of a space tile. */
+  template <class DimType>
+  Status aggregate_tiles(
+      const std::vector<shared_ptr<Aggregator>>& aggregates,
+      const std::string& name,
+      const std::vector<DimType>& tile_extents,
+      ResultSpaceTile<DimType>& result_space_tile,
+      const Subarray& subarray,
+      const Subarray& tile_subarray,
+      const uint64_t global_cell_offset,
+      const std::vector<RangeInfo<DimType>>& range_info,
+      const std::vector<uint8_t>& qc_result,
+      const uint64_t range_thread_idx,
+      const uint64_t num_range_threads);
+
   /** Copy a tile var offsets to the output buffers. */
   template <class DimType, class OffType>
   Status copy_offset_tiles(
@@ -47,7 +47,7 @@ namespace sm {
  * by the fragment index and offset/size of the data in the on-disk file.
  *
  * This uses a vector for storage which will be replaced by datablocks when
- * ready.
+ * ready, or a memory mapping of the on-disk data when files are mapped.
  */
 class FilteredDataBlock {
  public:
@@ -66,7 +66,8 @@ class FilteredDataBlock {
   FilteredDataBlock(unsigned frag_idx, uint64_t offset, uint64_t size)
       : frag_idx_(frag_idx)
       , offset_(offset)
-      , filtered_data_(size) {
+      , size_(size)
+      , data_(nullptr) {
   }
 
   /* ********************************* */
@@ -83,22 +84,43 @@ class FilteredDataBlock {
     return offset_;
   }
 
+  /** Allocates the memory that the on-disk data is read into. */
+  inline void allocate() {
+    filtered_data_.resize(size_);
+    data_ = filtered_data_.data();
+  }
+
+  /**
+   * Uses a memory mapping of the on-disk data as the data of the block.
+   *
+   * @param mapped_data The start of the mapped on-disk data.
+   */
+  inline void set_mapped_data(shared_ptr<char> mapped_data) {
+    mapped_data_ = std::move(mapped_data);
+    data_ = mapped_data_.get();
+  }
+
+  /** @return The memory mapping of the data, or `nullptr` if not mapped. */
+  inline const shared_ptr<char>& mapped_data() const {
+    return mapped_data_;
+  }
+
   /**
    * @return Pointer to the data at a particular offset in the filtered data
    * file.
    */
   inline void* data_at(storage_size_t offset) {
-    return filtered_data_.data() + offset - offset_;
+    return data_ + offset - offset_;
   }
 
   /** @return Pointer to the data inside of the filtered data block. */
   inline void* data() {
-    return filtered_data_.data();
+    return data_;
   }
 
   /** @return Size of the data block. */
   inline storage_size_t size() const {
-    return filtered_data_.size();
+    return size_;
   }
 
   /**
@@ -108,7 +130,7 @@ class FilteredDataBlock {
   inline bool contains(
       unsigned frag_idx, storage_size_t offset, storage_size_t size) const {
     return frag_idx == frag_idx_ && offset >= offset_ &&
-           offset + size <= offset_ + filtered_data_.size();
+           offset + size <= offset_ + size_;
   }
 
  private:
@@ -122,8 +144,17 @@ class FilteredDataBlock {
   /** File offset of the on-disk data for this datablock. */
   storage_size_t offset_;
 
-  /** Data for the data block. */
+  /** Size of the on-disk data for this data block. */
+  storage_size_t size_;
+
+  /** Pointer to the data of the block, either allocated or mapped. */
+  char* data_;
+
+  /** Data for the data block, when it is read. */
   std::vector<char> filtered_data_;
+
+  /** Memory mapping of the on-disk data, when it is mapped. */
+  shared_ptr<char> mapped_data_;
 };
 
 /**
@@ -144,10 +175,7 @@ class FilteredData {
    * Constructor using a sorted list of result tiles.
    *
    * @param reader Reader object used to know which tile to skip.
-   * @param min_batch_size Minimum batch size we are trying to reach.
    * @param max_batch_size Maximum batch size to create.
-   * @param min_batch_gap Min gap between tiles we can tolerate in the data
-   * block.
    * @param fragment_metadata Fragment metadata for the array.
    * @param result_tiles Sorted list (per fragment/tile index) of result tiles.
    * Only the fragment index and tile index of each result tiles is used here.
@@ -160,9 +188,7 @@ class FilteredData {
    */
   FilteredData(
       const ReaderBase& reader,
-      const uint64_t min_batch_size,
       const uint64_t max_batch_size,
-      const uint64_t min_batch_gap,
       const std::vector<shared_ptr<FragmentMetadata>>& fragment_metadata,
       const std::vector<ResultTile*>& result_tiles,
       const std::string& name,
@@ -200,9 +226,7 @@ class FilteredData {
       auto fragment{fragment_metadata[rt->frag_idx()].get()};
       make_new_block_if_required(
           fragment,
-          min_batch_size,
           max_batch_size,
-          min_batch_gap,
           current_frag_idx,
           current_fixed_offset,
           current_fixed_size,
@@ -212,9 +236,7 @@ class FilteredData {
       if (var_sized) {
         make_new_block_if_required(
             fragment,
-            min_batch_size,
             max_batch_size,
-            min_batch_gap,
             current_frag_idx,
             current_var_offset,
             current_var_size,
@@ -225,9 +247,7 @@ class FilteredData {
       if (nullable) {
         make_new_block_if_required(
             fragment,
-            min_batch_size,
             max_batch_size,
-            min_batch_gap,
             current_frag_idx,
             current_nullable_offset,
             current_nullable_size,
@@ -242,21 +262,23 @@ class FilteredData {
     if (current_fixed_size != 0) {
       fixed_data_blocks_.emplace_back(
           *current_frag_idx, current_fixed_offset, current_fixed_size);
-      queue_last_block_for_read(TileType::FIXED);
     }
 
     if (current_var_size != 0) {
       var_data_blocks_.emplace_back(
           *current_frag_idx, current_var_offset, current_var_size);
-      queue_last_block_for_read(TileType::VAR);
     }
 
     if (current_nullable_size != 0) {
       nullable_data_blocks_.emplace_back(
           *current_frag_idx, current_nullable_offset, current_nullable_size);
-      queue_last_block_for_read(TileType::NULLABLE);
     }
 
+    // Queue the reads, once all the blocks are created.
+    queue_blocks_for_read(TileType::FIXED);
+    queue_blocks_for_read(TileType::VAR);
+    queue_blocks_for_read(TileType::NULLABLE);
+
     current_fixed_data_block_ = fixed_data_blocks_.begin();
     current_var_data_block_ = var_data_blocks_.begin();
     current_nullable_data_block_ = nullable_data_blocks_.begin();
@@ -283,6 +305,16 @@ class FilteredData {
     return current_data_block(TileType::FIXED)->data_at(offset);
   }
 
+  /**
+   * Get the memory mapping backing the fixed filtered data last returned by
+   * `fixed_filtered_data`.
+   *
+   * @return The mapping, or `nullptr` if the file was read instead.
+   */
+  inline const shared_ptr<char>& fixed_mapped_data() {
+    return current_data_block(TileType::FIXED)->mapped_data();
+  }
+
   /**
    * Get the var filtered data for the result tile.
    *
@@ -332,23 +364,58 @@ class FilteredData {
   /* ********************************* */
 
   /**
-   * Queue the last added data block for read.
+   * Queue the data blocks of a tile type for read. The blocks of a fragment
+   * are contiguous in the block list and are read with a single batched VFS
+   * read, which coalesces the nearby blocks so that the backend can serve
+   * them with as few operations as possible. When the VFS maps local files,
+   * the blocks of a fragment are mapped right away instead, with a single
+   * mapping of the file.
    *
    * @param type Tile type.
    */
-  void queue_last_block_for_read(TileType type) {
-    auto& block{data_blocks(type).back()};
-    auto offset{block.offset()};
-    auto data{block.data()};
-    auto size{block.size()};
-    URI uri{file_uri(fragment_metadata_[block.frag_idx()].get(), type)};
-    auto task =
-        storage_manager_->io_tp()->execute([this, offset, data, size, uri]() {
-          RETURN_NOT_OK(
-              storage_manager_->vfs()->read(uri, offset, data, size, false));
-          return Status::Ok();
-        });
-    read_tasks_.push_back(std::move(task));
+  void queue_blocks_for_read(TileType type) {
+    auto vfs{storage_manager_->vfs()};
+    auto& blocks{data_blocks(type)};
+    uint64_t first = 0;
+    while (first < blocks.size()) {
+      const auto frag_idx{blocks[first].frag_idx()};
+      URI uri{file_uri(fragment_metadata_[frag_idx].get(), type)};
+      uint64_t last = first;
+      while (last < blocks.size() && blocks[last].frag_idx() == frag_idx) {
+        last++;
+      }
+
+      if (vfs->use_mmap(uri)) {
+        std::vector<std::pair<uint64_t, uint64_t>> map_ranges;
+        for (uint64_t b = first; b < last; b++) {
+          map_ranges.emplace_back(blocks[b].offset(), blocks[b].size());
+        }
+
+        std::vector<shared_ptr<char>> mapped_data;
+        throw_if_not_ok(vfs->map_batch(uri, map_ranges, &mapped_data));
+        for (uint64_t b = first; b < last; b++) {
+          blocks[b].set_mapped_data(std::move(mapped_data[b - first]));
+        }
+
+        first = last;
+        continue;
+      }
+
+      std::vector<ReadRange> ranges;
+      for (uint64_t b = first; b < last; b++) {
+        auto& block{blocks[b]};
+        block.allocate();
+        ranges.push_back({block.offset(), block.data(), block.size()});
+      }
+      first = last;
+
+      auto task = storage_manager_->io_tp()->execute(
+          [this, uri, ranges = std::move(ranges)]() {
+            RETURN_NOT_OK(storage_manager_->vfs()->read_batch(uri, ranges));
+            return Status::Ok();
+          });
+      read_tasks_.push_back(std::move(task));
+    }
   }
 
   /** @return Data blocks corresponding to the tile type. */
@@ -463,15 +530,13 @@ class FilteredData {
 
   /**
    * We create a new block if the fragment indexes between this tile and the
-   * previous tile don't match, or if we have reached the minimum batch size and
-   * the gap between this tile and the previous one is too large, or if we have
-   * reached the maximum size.
+   * previous tile don't match, or if the tile does not directly follow the
+   * previous one, or if we have reached the maximum size. Blocks separated by
+   * a gap are coalesced by the batched VFS read instead, so that the gaps are
+   * never stored.
    *
    * @param fragment Fragment metadata for the tile.
-   * @param min_batch_size Minimum batch size we are trying to reach.
    * @param max_batch_size Maximum batch size to create.
-   * @param min_batch_gap Min gap between tiles we can tolerate in the data
-   * block.
    * @param current_frag_idx Current fragment index for the data blocks.
    * @param current_block_offset Current block offset.
    * @param current_block_size Current block size.
@@ -482,9 +547,7 @@ class FilteredData {
    */
   void make_new_block_if_required(
       const FragmentMetadata* fragment,
-      const uint64_t min_batch_size,
       const uint64_t max_batch_size,
-      const uint64_t min_batch_gap,
       optional<unsigned> current_block_frag_idx,
       storage_size_t& current_block_offset,
       storage_size_t& current_block_size,
@@ -501,17 +564,15 @@ class FilteredData {
     }
 
     uint64_t new_size{(offset + size) - current_block_offset};
-    uint64_t gap{offset - (current_block_offset + current_block_size)};
     if (current_block_frag_idx == rt->frag_idx() &&
-        new_size <= max_batch_size &&
-        (new_size <= min_batch_size || gap <= min_batch_gap)) {
+        offset == current_block_offset + current_block_size &&
+        new_size <= max_batch_size) {
       // Extend current batch.
       current_block_size = new_size;
     } else {
       // Push the old batch and start a new one.
       data_blocks(type).emplace_back(
           *current_block_frag_idx, current_block_offset, current_block_size);
-      queue_last_block_for_read(type);
       current_block_offset = offset;
       current_block_size = size;
     }
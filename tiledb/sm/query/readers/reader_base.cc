@@ -53,6 +53,7 @@
 #include "tiledb/sm/query/strategy_base.h"
 #include "tiledb/sm/query/writers/domain_buffer.h"
 #include "tiledb/sm/subarray/subarray.h"
+#include "tiledb/sm/tile/encoded_strings.h"
 
 namespace tiledb {
 namespace sm {
@@ -79,7 +80,8 @@ ReaderBase::ReaderBase(
     std::unordered_map<std::string, QueryBuffer>& buffers,
     Subarray& subarray,
     Layout layout,
-    QueryCondition& condition)
+    QueryCondition& condition,
+    std::vector<shared_ptr<Aggregator>> aggregates)
     : StrategyBase(
           stats,
           logger,
@@ -90,12 +92,11 @@ ReaderBase::ReaderBase(
           subarray,
           layout)
     , condition_(condition)
+    , aggregates_(std::move(aggregates))
     , user_requested_timestamps_(false)
     , use_timestamps_(false)
     , initial_data_loaded_(false)
-    , max_batch_size_(config.get<uint64_t>("vfs.max_batch_size").value())
-    , min_batch_gap_(config.get<uint64_t>("vfs.min_batch_gap").value())
-    , min_batch_size_(config.get<uint64_t>("vfs.min_batch_size").value()) {
+    , max_batch_size_(config.get<uint64_t>("vfs.max_batch_size").value()) {
   if (array != nullptr)
     fragment_metadata_ = array->fragment_metadata();
   timestamps_needed_for_deletes_and_updates_.resize(fragment_metadata_.size());
@@ -464,6 +465,170 @@ Status ReaderBase::load_tile_offsets(
   return Status::Ok();
 }
 
+std::vector<std::string> ReaderBase::aggregate_field_names() const {
+  std::vector<std::string> names;
+  for (const auto& aggregate : aggregates_) {
+    const auto& name = aggregate->field_name();
+    if (aggregate->needs_tiles() &&
+        std::find(names.begin(), names.end(), name) == names.end()) {
+      names.emplace_back(name);
+    }
+  }
+
+  return names;
+}
+
+std::vector<shared_ptr<Aggregator>> ReaderBase::field_aggregates(
+    const std::string& name) const {
+  std::vector<shared_ptr<Aggregator>> ret;
+  for (const auto& aggregate : aggregates_) {
+    if (name.empty() ? !aggregate->needs_tiles() :
+                       aggregate->needs_tiles() &&
+                           aggregate->field_name() == name) {
+      ret.emplace_back(aggregate);
+    }
+  }
+
+  return ret;
+}
+
+Status ReaderBase::load_aggregate_tile_metadata(
+    const RelevantFragments& relevant_fragments) {
+  if (aggregates_.empty()) {
+    return Status::Ok();
+  }
+
+  auto timer_se = stats_->start_timer("load_aggregate_tile_metadata");
+  const auto encryption_key = array_->encryption_key();
+
+  const auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      relevant_fragments.size(),
+      [&](const uint64_t i) {
+        auto frag_idx = relevant_fragments[i];
+        auto& fragment = fragment_metadata_[frag_idx];
+        if (!fragment_tile_metadata_usable(frag_idx)) {
+          return Status::Ok();
+        }
+
+        // The MBRs are needed to check the tile coverage of sparse fragments.
+        if (!fragment->dense()) {
+          RETURN_NOT_OK(fragment->load_rtree(*encryption_key));
+        }
+
+        for (const auto& aggregate : aggregates_) {
+          aggregate->load_tile_metadata(*fragment, *encryption_key);
+        }
+
+        return Status::Ok();
+      });
+
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+bool ReaderBase::fragment_tile_metadata_usable(const unsigned f) const {
+  auto& frag_md = *fragment_metadata_[f];
+  if (aggregates_.empty() || !condition_.empty() ||
+      !delete_and_update_conditions_.empty() || frag_md.has_delete_meta() ||
+      process_partial_timestamps(frag_md)) {
+    return false;
+  }
+
+  // Fragments consolidated with timestamps can contain duplicates that are
+  // removed by the reader.
+  return !frag_md.has_timestamps() || array_schema_.allows_dups();
+}
+
+bool ReaderBase::aggregate_tile_metadata(const unsigned f, const uint64_t t) {
+  auto& frag_md = *fragment_metadata_[f];
+  for (const auto& aggregate : aggregates_) {
+    if (!aggregate->can_use_tile_metadata(frag_md, t)) {
+      return false;
+    }
+  }
+
+  for (const auto& aggregate : aggregates_) {
+    aggregate->aggregate_tile_metadata(frag_md, t);
+  }
+
+  stats_->add_counter("aggregate_tile_metadata_num", 1);
+  return true;
+}
+
+Status ReaderBase::load_condition_tile_metadata(
+    const RelevantFragments& relevant_fragments) {
+  if (condition_.empty()) {
+    return Status::Ok();
+  }
+
+  auto timer_se = stats_->start_timer("load_condition_tile_metadata");
+  const auto encryption_key = array_->encryption_key();
+
+  const auto status = parallel_for(
+      storage_manager_->compute_tp(),
+      0,
+      relevant_fragments.size(),
+      [&](const uint64_t i) {
+        auto frag_idx = relevant_fragments[i];
+        auto& fragment = fragment_metadata_[frag_idx];
+
+        // Tile metadata was added in format version 11.
+        if (fragment->format_version() < 11) {
+          return Status::Ok();
+        }
+
+        const auto& frag_schema = *fragment->array_schema();
+        auto names = condition_.zone_map_field_names(frag_schema);
+        if (names.empty()) {
+          return Status::Ok();
+        }
+
+        // The MBRs are needed to check the overlap of sparse fragments.
+        if (!fragment->dense()) {
+          RETURN_NOT_OK(fragment->load_rtree(*encryption_key));
+        }
+
+        std::vector<std::string> nullable_names;
+        std::vector<std::string> float_names;
+        for (const auto& name : names) {
+          if (frag_schema.is_nullable(name)) {
+            nullable_names.emplace_back(name);
+          }
+
+          const auto type = frag_schema.type(name);
+          if (type == Datatype::FLOAT32 || type == Datatype::FLOAT64) {
+            float_names.emplace_back(name);
+          }
+        }
+
+        RETURN_NOT_OK(fragment->load_tile_min_values(
+            *encryption_key, std::vector<std::string>(names)));
+        RETURN_NOT_OK(
+            fragment->load_tile_max_values(*encryption_key, std::move(names)));
+        RETURN_NOT_OK(fragment->load_tile_null_count_values(
+            *encryption_key, std::move(nullable_names)));
+
+        // The tile sums are used to detect NaN and infinite values.
+        RETURN_NOT_OK(fragment->load_tile_sum_values(
+            *encryption_key, std::move(float_names)));
+
+        return Status::Ok();
+      });
+
+  RETURN_NOT_OK(status);
+
+  return Status::Ok();
+}
+
+bool ReaderBase::tile_excluded_by_condition(
+    const unsigned f, const uint64_t t) const {
+  return !condition_.empty() &&
+         !condition_.tile_may_match(*fragment_metadata_[f], t);
+}
+
 Status ReaderBase::load_tile_var_sizes(
     const RelevantFragments& relevant_fragments,
     const std::vector<std::string>& names) {
@@ -591,23 +756,49 @@ std::vector<FilteredData> ReaderBase::read_tiles(
   }
 
   uint64_t num_tiles_read{0};
+  uint64_t num_tile_cache_hits{0};
+  uint64_t num_tiles_mapped{0};
   std::vector<ThreadPool::Task> read_tasks;
   filtered_data.reserve(names.size());
+  const bool use_cache{use_tile_cache()};
 
   // Run all attributes independently.
   for (auto name : names) {
+    const bool var_sized{array_schema_.var_size(name)};
+    const bool nullable{array_schema_.is_nullable(name)};
+
+    // Filter-free, fixed-size tiles of mapped files can be used in place.
+    const bool use_in_place{
+        !var_sized && !nullable && array_schema_.filters(name).empty() &&
+        array_->get_encryption_key().encryption_type() ==
+            EncryptionType::NO_ENCRYPTION};
+
+    // Initialize the tiles found in the tile cache and only read the others.
+    std::vector<ResultTile*> uncached_tiles;
+    if (use_cache) {
+      uncached_tiles.reserve(result_tiles.size());
+      for (auto tile : result_tiles) {
+        if (skip_field(tile->frag_idx(), name)) {
+          continue;
+        }
+
+        if (load_tile_from_cache(name, var_sized, nullable, tile)) {
+          num_tile_cache_hits++;
+        } else {
+          uncached_tiles.emplace_back(tile);
+        }
+      }
+    }
+    const auto& tiles_to_read{use_cache ? uncached_tiles : result_tiles};
+
     // Create the filtered data blocks. This will also kick off the read for the
     // data blocks right after the memory is allocated so that we can optimize
     // read and memory allocations.
-    const bool var_sized{array_schema_.var_size(name)};
-    const bool nullable{array_schema_.is_nullable(name)};
     filtered_data.emplace_back(
         *this,
-        min_batch_size_,
         max_batch_size_,
-        min_batch_gap_,
         fragment_metadata_,
-        result_tiles,
+        tiles_to_read,
         name,
         var_sized,
         nullable,
@@ -615,10 +806,8 @@ std::vector<FilteredData> ReaderBase::read_tiles(
         read_tasks);
 
     // Go through each tiles and create the attribute tiles.
-    for (auto tile : result_tiles) {
+    for (auto tile : tiles_to_read) {
       auto const fragment{fragment_metadata_[tile->frag_idx()]};
-      const auto& array_schema{fragment->array_schema()};
-
       if (skip_field(tile->frag_idx(), name)) {
         continue;
       }
@@ -645,25 +834,23 @@ std::vector<FilteredData> ReaderBase::read_tiles(
           filtered_data.back().nullable_filtered_data(fragment.get(), tile)};
 
       // Initialize the tile(s)
-      const format_version_t format_version{fragment->format_version()};
-      const auto is_dim{array_schema->is_dim(name)};
-      if (is_dim) {
-        const uint64_t dim_num{array_schema->dim_num()};
-        for (uint64_t d = 0; d < dim_num; ++d) {
-          if (array_schema->dimension_ptr(d)->name() == name) {
-            tile->init_coord_tile(
-                format_version, array_schema_, name, tile_sizes, tile_data, d);
-            break;
-          }
-        }
-      } else {
-        tile->init_attr_tile(
-            format_version, array_schema_, name, tile_sizes, tile_data);
+      init_tile(name, tile, tile_sizes, tile_data);
+
+      auto& mapped_data{filtered_data.back().fixed_mapped_data()};
+      if (use_in_place && mapped_data != nullptr &&
+          map_unfiltered_tile(name, tile, mapped_data)) {
+        num_tiles_mapped++;
       }
     }
   }
 
   stats_->add_counter("num_tiles_read", num_tiles_read);
+  if (num_tiles_mapped > 0) {
+    stats_->add_counter("num_tiles_mapped", num_tiles_mapped);
+  }
+  if (use_cache) {
+    stats_->add_counter("num_tile_cache_hits", num_tile_cache_hits);
+  }
 
   // Wait for the read tasks to finish.
   auto statuses{storage_manager_->io_tp()->wait_all_status(read_tasks)};
@@ -674,6 +861,145 @@ std::vector<FilteredData> ReaderBase::read_tiles(
   return filtered_data;
 }
 
+void ReaderBase::init_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const ResultTile::TileSizes tile_sizes,
+    const ResultTile::TileData tile_data) const {
+  auto const fragment{fragment_metadata_[tile->frag_idx()]};
+  const auto& array_schema{fragment->array_schema()};
+  const format_version_t format_version{fragment->format_version()};
+  if (array_schema->is_dim(name)) {
+    const uint64_t dim_num{array_schema->dim_num()};
+    for (uint64_t d = 0; d < dim_num; ++d) {
+      if (array_schema->dimension_ptr(d)->name() == name) {
+        tile->init_coord_tile(
+            format_version, array_schema_, name, tile_sizes, tile_data, d);
+        break;
+      }
+    }
+  } else {
+    tile->init_attr_tile(
+        format_version, array_schema_, name, tile_sizes, tile_data);
+  }
+}
+
+bool ReaderBase::use_tile_cache() const {
+  return storage_manager_->resources().tile_cache().enabled() &&
+         array_->get_encryption_key().encryption_type() ==
+             EncryptionType::NO_ENCRYPTION;
+}
+
+bool ReaderBase::load_tile_from_cache(
+    const std::string& name,
+    const bool var_size,
+    const bool nullable,
+    ResultTile* const tile) const {
+  auto& tile_cache{storage_manager_->resources().tile_cache()};
+  const auto& fragment{fragment_metadata_[tile->frag_idx()]};
+  auto cached{tile_cache.read(
+      {fragment->fragment_uri().to_string(), name, tile->tile_idx()})};
+  if (cached == nullptr) {
+    return false;
+  }
+
+  // The tiles are created without filtered data, which makes the unfiltering
+  // and post-processing steps skip them.
+  ResultTile::TileSizes tile_sizes{
+      cached->fixed_.size(),
+      0,
+      var_size ? std::optional<uint64_t>(cached->var_.size()) : std::nullopt,
+      var_size ? std::optional<uint64_t>(0) : std::nullopt,
+      nullable ? std::optional<uint64_t>(cached->validity_.size()) :
+                 std::nullopt,
+      nullable ? std::optional<uint64_t>(0) : std::nullopt};
+  init_tile(name, tile, tile_sizes, {nullptr, nullptr, nullptr});
+
+  // The tiles are views of the cached data, which they keep alive. The
+  // cached data is already post-processed and readers don't modify
+  // unfiltered tiles, so it is shared rather than copied.
+  auto tile_tuple{tile->tile_tuple(name)};
+  auto owner{std::const_pointer_cast<CachedTile>(cached)};
+  auto use_cached = [&owner](std::vector<char>& data, Tile& t) {
+    if (!data.empty()) {
+      t.set_data_view(data.data(), owner);
+    }
+  };
+  use_cached(owner->fixed_, tile_tuple->fixed_tile());
+  if (var_size) {
+    use_cached(owner->var_, tile_tuple->var_tile());
+  }
+  if (nullable) {
+    use_cached(owner->validity_, tile_tuple->validity_tile());
+  }
+
+  return true;
+}
+
+bool ReaderBase::map_unfiltered_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const shared_ptr<char>& mapped_data) const {
+  auto& t{tile->tile_tuple(name)->fixed_tile()};
+  if (t.stores_coords() || t.size() == 0) {
+    return false;
+  }
+
+  // Without filters, a tile stored as a single chunk without metadata holds
+  // the unfiltered data contiguously, right after the chunk header.
+  constexpr uint64_t header_size{sizeof(uint64_t) + 3 * sizeof(uint32_t)};
+  if (t.filtered_size() != header_size + t.size()) {
+    return false;
+  }
+
+  uint64_t num_chunks;
+  uint32_t chunk_sizes[3];
+  std::memcpy(&num_chunks, t.filtered_data(), sizeof(uint64_t));
+  std::memcpy(
+      chunk_sizes, t.filtered_data() + sizeof(uint64_t), sizeof(chunk_sizes));
+  if (num_chunks != 1 || chunk_sizes[0] != t.size() ||
+      chunk_sizes[1] != t.size() || chunk_sizes[2] != 0) {
+    return false;
+  }
+
+  // The data is accessed through typed pointers, it must be aligned.
+  char* data{t.filtered_data() + header_size};
+  if (reinterpret_cast<uintptr_t>(data) % datatype_size(t.type()) != 0) {
+    return false;
+  }
+
+  // The tile is now unfiltered, which makes the unfiltering and
+  // post-processing steps skip it.
+  t.set_data_view(data, mapped_data);
+  t.clear_filtered_buffer();
+  return true;
+}
+
+void ReaderBase::cache_unfiltered_tile(
+    const std::string& name,
+    ResultTile* const tile,
+    const bool var_size,
+    const bool nullable) const {
+  auto tile_tuple{tile->tile_tuple(name)};
+  auto copy_unfiltered = [](const Tile& t, std::vector<char>& data) {
+    data.assign(t.data_as<char>(), t.data_as<char>() + t.size());
+  };
+
+  CachedTile cached;
+  copy_unfiltered(tile_tuple->fixed_tile(), cached.fixed_);
+  if (var_size) {
+    copy_unfiltered(tile_tuple->var_tile(), cached.var_);
+  }
+  if (nullable) {
+    copy_unfiltered(tile_tuple->validity_tile(), cached.validity_);
+  }
+
+  const auto& fragment{fragment_metadata_[tile->frag_idx()]};
+  storage_manager_->resources().tile_cache().insert(
+      {fragment->fragment_uri().to_string(), name, tile->tile_idx()},
+      std::move(cached));
+}
+
 tuple<Status, optional<uint64_t>, optional<uint64_t>, optional<uint64_t>>
 ReaderBase::load_tile_chunk_data(
     const std::string& name,
@@ -844,6 +1170,11 @@ Status ReaderBase::post_process_unfiltered_tile(
     throw_if_not_ok(zip_tile_coordinates(name, &t_validity));
   }
 
+  // Keep a copy of the unfiltered tile for subsequent reads.
+  if (use_tile_cache()) {
+    cache_unfiltered_tile(name, tile, var_size, nullable);
+  }
+
   return Status::Ok();
 }
 
@@ -1225,6 +1556,7 @@ uint64_t ReaderBase::get_attribute_tile_size(
 
   if (array_schema_.var_size(name)) {
     tile_size += fragment_metadata_[f]->tile_var_size(name, t);
+    tile_size += get_encoded_strings_size(name, f, t);
   }
 
   if (array_schema_.is_nullable(name)) {
@@ -1235,6 +1567,21 @@ uint64_t ReaderBase::get_attribute_tile_size(
   return tile_size;
 }
 
+uint64_t ReaderBase::get_encoded_strings_size(
+    const std::string& name, unsigned f, uint64_t t) const {
+  // The compression filter keeps the encoded form on the offsets tile of
+  // RLE or dictionary encoded strings, see `EncodedStrings`.
+  if (!array_schema_.var_size(name) ||
+      !array_schema_.filters(name).skip_offsets_filtering(
+          array_schema_.type(name), array_schema_.version())) {
+    return 0;
+  }
+
+  return EncodedStrings::max_size(
+      fragment_metadata_[f]->tile_var_size(name, t),
+      fragment_metadata_[f]->cell_num(t));
+}
+
 template <class T>
 void ReaderBase::compute_result_space_tiles(
     const Subarray& subarray,
@@ -41,6 +41,7 @@
 #include "tiledb/sm/fragment/fragment_metadata.h"
 #include "tiledb/sm/misc/types.h"
 #include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/readers/aggregator.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
 #include "tiledb/sm/query/readers/result_space_tile.h"
 #include "tiledb/sm/query/writers/domain_buffer.h"
@@ -117,7 +118,8 @@ class ReaderBase : public StrategyBase {
       std::unordered_map<std::string, QueryBuffer>& buffers,
       Subarray& subarray,
       Layout layout,
-      QueryCondition& condition);
+      QueryCondition& condition,
+      std::vector<shared_ptr<Aggregator>> aggregates = {});
 
   /** Destructor. */
   ~ReaderBase() = default;
@@ -175,6 +177,9 @@ class ReaderBase : public StrategyBase {
   /** The query condition. */
   QueryCondition& condition_;
 
+  /** The aggregates computed by the query, empty for regular reads. */
+  std::vector<shared_ptr<Aggregator>> aggregates_;
+
   /**
    * The delete and update conditions.
    *
@@ -230,15 +235,9 @@ class ReaderBase : public StrategyBase {
   /** Have we loaded the initial data. */
   bool initial_data_loaded_;
 
-  /** The maximum number of bytes in a batched read operation. */
+  /** The maximum number of bytes in a data block. */
   uint64_t max_batch_size_;
 
-  /** The minimum number of bytes between two read batches. */
-  uint64_t min_batch_gap_;
-
-  /** The minimum number of bytes in a batched read operation. */
-  uint64_t min_batch_size_;
-
   /* ********************************* */
   /*         PROTECTED METHODS         */
   /* ********************************* */
@@ -346,6 +345,75 @@ class ReaderBase : public StrategyBase {
       const RelevantFragments& relevant_fragments,
       const std::vector<std::string>& names);
 
+  /**
+   * Returns the names of the fields for which tiles need to be loaded to
+   * compute the aggregates in-engine.
+   */
+  std::vector<std::string> aggregate_field_names() const;
+
+  /**
+   * Returns the aggregates computed from the tiles of a field. An empty name
+   * returns the aggregates that don't need tiles.
+   *
+   * @param name The field name.
+   * @return The aggregates.
+   */
+  std::vector<shared_ptr<Aggregator>> field_aggregates(
+      const std::string& name) const;
+
+  /**
+   * Loads the tile metadata used to compute the aggregates for the relevant
+   * fragments that can use it.
+   *
+   * @param relevant_fragments List of relevant fragments.
+   * @return Status
+   */
+  Status load_aggregate_tile_metadata(
+      const RelevantFragments& relevant_fragments);
+
+  /**
+   * Returns true if all the cells of the tiles of a fragment are results, so
+   * that the aggregates can be computed from the fragment tile metadata. This
+   * is not the case when there is a query condition, deletes, or cells
+   * filtered by timestamps. The readers still need to check that a tile is
+   * fully covered by the subarray and not overwritten by other fragments.
+   *
+   * @param f Fragment index.
+   * @return True if the tile metadata of the fragment can be used.
+   */
+  bool fragment_tile_metadata_usable(const unsigned f) const;
+
+  /**
+   * Computes all the aggregates of a tile from its tile metadata, if the
+   * metadata is available for every aggregate.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return True if the tile was aggregated, false if its cells need to be
+   *     processed.
+   */
+  bool aggregate_tile_metadata(const unsigned f, const uint64_t t);
+
+  /**
+   * Loads the tile min/max metadata used to skip the tiles that can't pass
+   * the query condition for the relevant fragments.
+   *
+   * @param relevant_fragments List of relevant fragments.
+   * @return Status
+   */
+  Status load_condition_tile_metadata(
+      const RelevantFragments& relevant_fragments);
+
+  /**
+   * Returns true if the tile min/max metadata shows that no cell of a tile
+   * can pass the query condition, so that the tile doesn't need to be read.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return True if the tile can be skipped.
+   */
+  bool tile_excluded_by_condition(const unsigned f, const uint64_t t) const;
+
   /**
    * Checks if at least one fragment overlaps partially with the
    * time at which the read is taking place.
@@ -459,6 +527,75 @@ class ReaderBase : public StrategyBase {
       const std::vector<std::string>& names,
       const std::vector<ResultTile*>& result_tiles) const;
 
+  /**
+   * Initializes the tile tuple of an attribute or dimension inside of a
+   * result tile.
+   *
+   * @param name The attribute/dimension name.
+   * @param tile The result tile.
+   * @param tile_sizes The in memory and on disk sizes of the tiles.
+   * @param tile_data The filtered data pointers of the tiles.
+   */
+  void init_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const ResultTile::TileSizes tile_sizes,
+      const ResultTile::TileData tile_data) const;
+
+  /**
+   * Returns `true` if the tiles of the array go through the tile cache. The
+   * tiles of encrypted arrays are never cached, so that they cannot be served
+   * without the key once the array is closed.
+   */
+  bool use_tile_cache() const;
+
+  /**
+   * Initializes the tile tuple of an attribute or dimension from the tile
+   * cache, if the cache holds it. Tiles loaded this way do not need to be
+   * read or unfiltered.
+   *
+   * @param name The attribute/dimension name.
+   * @param var_size Is the attribute/dimension var sized?
+   * @param nullable Is the attribute/dimension nullable?
+   * @param tile The result tile.
+   * @return `true` if the tile was found in the cache.
+   */
+  bool load_tile_from_cache(
+      const std::string& name,
+      const bool var_size,
+      const bool nullable,
+      ResultTile* const tile) const;
+
+  /**
+   * Uses the memory-mapped on-disk data of a filter-free, fixed-size tile as
+   * its unfiltered data, if the tile is stored as a single chunk suitably
+   * aligned for its datatype. Tiles used in place do not need to be
+   * unfiltered.
+   *
+   * @param name The attribute/dimension name.
+   * @param tile The result tile.
+   * @param mapped_data The memory mapping holding the filtered data.
+   * @return `true` if the tile data is used in place.
+   */
+  bool map_unfiltered_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const shared_ptr<char>& mapped_data) const;
+
+  /**
+   * Inserts a copy of an unfiltered tile into the tile cache.
+   *
+   * @param name The attribute/dimension name.
+   * @param tile The result tile.
+   * @param var_size Is the attribute/dimension var sized?
+   * @param nullable Is the attribute/dimension nullable?
+   */
+  void cache_unfiltered_tile(
+      const std::string& name,
+      ResultTile* const tile,
+      const bool var_size,
+      const bool nullable) const;
+
   /**
    * Filters the tiles on a particular attribute/dimension from all input
    * fragments based on the tile info in `result_tiles`.
@@ -570,6 +707,18 @@ class ReaderBase : public StrategyBase {
    */
   uint64_t offsets_bytesize() const;
 
+  /**
+   * Get the size of the encoded form kept next to an unfiltered var-sized
+   * string tile, or zero if the field is not RLE or dictionary encoded.
+   *
+   * @param name The attribute/dimension name.
+   * @param f The fragment idx.
+   * @param t The tile idx.
+   * @return Upper bound of the encoded form size.
+   */
+  uint64_t get_encoded_strings_size(
+      const std::string& name, unsigned f, uint64_t t) const;
+
   /**
    * Get the size of an attribute tile.
    *
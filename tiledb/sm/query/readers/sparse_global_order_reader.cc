@@ -78,6 +78,7 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
     Subarray& subarray,
     Layout layout,
     QueryCondition& condition,
+    std::vector<shared_ptr<Aggregator>> aggregates,
     bool consolidation_with_timestamps,
     bool skip_checks_serialization)
     : SparseIndexReaderBase(
@@ -89,7 +90,8 @@ SparseGlobalOrderReader<BitmapType>::SparseGlobalOrderReader(
           buffers,
           subarray,
           layout,
-          condition)
+          condition,
+          std::move(aggregates))
     , result_tiles_(array->fragment_metadata().size())
     , memory_used_for_coords_(array->fragment_metadata().size())
     , memory_used_for_qc_tiles_(array->fragment_metadata().size())
@@ -266,8 +268,10 @@ Status SparseGlobalOrderReader<BitmapType>::dowork() {
 
     // No more tiles to process, done.
     if (result_cell_slabs.has_value() && !result_cell_slabs->empty()) {
-      // Copy cell slabs.
-      if (offsets_bitsize_ == 64) {
+      // Compute aggregates or copy cell slabs.
+      if (!aggregates_.empty()) {
+        RETURN_NOT_OK(process_aggregates(*result_cell_slabs));
+      } else if (offsets_bitsize_ == 64) {
         RETURN_NOT_OK(process_slabs<uint64_t>(names, *result_cell_slabs));
       } else {
         RETURN_NOT_OK(process_slabs<uint32_t>(names, *result_cell_slabs));
@@ -358,7 +362,36 @@ bool SparseGlobalOrderReader<BitmapType>::add_result_tile(
     const unsigned f,
     const uint64_t t,
     const FragmentMetadata& frag_md) {
-  if (ignored_tiles_.count(IgnoredTile(f, t))) {
+  {
+    std::unique_lock<std::mutex> lck(ignored_tiles_mutex_);
+    if (ignored_tiles_.count(IgnoredTile(f, t))) {
+      return false;
+    }
+  }
+
+  // Skip the tiles with no cells passing the query condition according to
+  // their min/max metadata. Without duplicates, the cells of a tile can hide
+  // cells of other fragments, or of other tiles of fragments consolidated
+  // with timestamps, so it needs to not overlap them.
+  const bool may_hide_cells =
+      !array_schema_.allows_dups() && frag_md.has_timestamps();
+  if (!may_hide_cells && tile_excluded_by_condition(f, t) &&
+      !tile_overlaps_other_fragments(f, t)) {
+    stats_->add_counter("tiles_skipped_by_condition", 1);
+    std::unique_lock<std::mutex> lck(ignored_tiles_mutex_);
+    ignored_tiles_.emplace(f, t);
+    return false;
+  }
+
+  // Tiles fully covered by the subarray, with no overlapping ranges and no
+  // possible duplicates, can be aggregated from their tile metadata without
+  // being loaded.
+  if (fragment_tile_metadata_usable(f) &&
+      std::is_same<BitmapType, uint8_t>::value &&
+      tile_covered_by_subarray(f, t) && !tile_overlaps_other_fragments(f, t) &&
+      aggregate_tile_metadata(f, t)) {
+    std::unique_lock<std::mutex> lck(ignored_tiles_mutex_);
+    ignored_tiles_.emplace(f, t);
     return false;
   }
 
@@ -378,6 +411,12 @@ bool SparseGlobalOrderReader<BitmapType>::add_result_tile(
     return true;
   }
 
+  // Don't load more tiles than the context budget.
+  if (!memory_tracker_.take_memory(
+          tiles_size + tiles_size_qc, MemoryTracker::MemoryType::TILES)) {
+    return true;
+  }
+
   // Adjust total memory used.
   {
     std::unique_lock<std::mutex> lck(mem_budget_mtx_);
@@ -742,7 +781,7 @@ template <class CompType>
 bool SparseGlobalOrderReader<BitmapType>::add_all_dups_to_queue(
     GlobalOrderResultCoords<BitmapType>& rc,
     std::vector<TileListIt>& result_tiles_it,
-    TileMinHeap<CompType>& tile_queue) {
+    TileMergeTree<CompType>& tile_queue) {
   auto frag_idx = rc.tile_->frag_idx();
   auto dups = array_schema_.allows_dups();
   uint64_t last_cell_pos;
@@ -757,7 +796,7 @@ bool SparseGlobalOrderReader<BitmapType>::add_all_dups_to_queue(
     // Construct a new result coords that specifies it has no next cell.
     // A cell will be added after this one so we don't want to process it
     // twice.
-    tile_queue.emplace(rc.tile_, rc.pos_, false);
+    tile_queue.emplace(frag_idx, rc.tile_, rc.pos_, false);
     rc.advance_to_next_cell();
 
     // For arrays with no duplicates, we cannot use the last cell of a
@@ -771,7 +810,7 @@ bool SparseGlobalOrderReader<BitmapType>::add_all_dups_to_queue(
       auto next_tile = result_tiles_it[frag_idx];
       next_tile++;
       if (next_tile != result_tiles_[frag_idx].end()) {
-        tile_queue.emplace(rc.tile_, rc.pos_, false);
+        tile_queue.emplace(frag_idx, rc.tile_, rc.pos_, false);
         GlobalOrderResultCoords rc2(&*next_tile, 0);
 
         // All tiles should at least have one cell available.
@@ -804,19 +843,33 @@ template <class CompType>
 bool SparseGlobalOrderReader<BitmapType>::add_next_cell_to_queue(
     GlobalOrderResultCoords<BitmapType>& rc,
     std::vector<TileListIt>& result_tiles_it,
-    TileMinHeap<CompType>& tile_queue) {
+    TileMergeTree<CompType>& tile_queue,
+    bool replace_top) {
   auto frag_idx = rc.tile_->frag_idx();
   auto dups = array_schema_.allows_dups();
 
+  // Pops `rc` when it is still the top of the queue and is not replaced.
+  auto pop_rc = [&]() {
+    if (replace_top) {
+      std::unique_lock<std::mutex> ul(tile_queue_mutex_);
+      tile_queue.pop();
+      replace_top = false;
+    }
+  };
+
   // Exit early if the result coords specifies it has no next cell to process.
   // This would be because a cell after this one in the fragment was added to
   // the queue as it had the same coordinates as this one.
   if (!rc.has_next_) {
+    pop_rc();
     return false;
   }
 
   // Try the next cell in the same tile.
   if (!rc.advance_to_next_cell()) {
+    // The tile of `rc` might be removed below, pop it from the queue first.
+    pop_rc();
+
     // Save the potential tile to delete and increment the tile iterator.
     auto to_delete = result_tiles_it[frag_idx];
     result_tiles_it[frag_idx]++;
@@ -860,19 +913,30 @@ bool SparseGlobalOrderReader<BitmapType>::add_next_cell_to_queue(
     // For arrays with no duplicates, we cannot use the last cell of a fragment
     //  with timestamps if not all tiles are loaded.
     if (!dups && last_in_memory_cell_of_consolidated_fragment(frag_idx, rc)) {
+      pop_rc();
       return true;
     }
-    std::unique_lock<std::mutex> ul(tile_queue_mutex_);
 
     // Add all the cells in this tile with the same coordinates as this cell
-    // for purge deletes with no dups mode.
-    if (purge_deletes_no_dups_mode_ &&
-        fragment_metadata_[frag_idx]->has_timestamps()) {
-      if (add_all_dups_to_queue(rc, result_tiles_it, tile_queue)) {
-        return true;
-      }
+    // for purge deletes with no dups mode. They take several values of the
+    // slot, so `rc` is popped rather than replaced.
+    const bool add_all_dups = purge_deletes_no_dups_mode_ &&
+                              fragment_metadata_[frag_idx]->has_timestamps();
+    if (add_all_dups) {
+      pop_rc();
+    }
+
+    std::unique_lock<std::mutex> ul(tile_queue_mutex_);
+    if (add_all_dups &&
+        add_all_dups_to_queue(rc, result_tiles_it, tile_queue)) {
+      return true;
+    }
+
+    if (replace_top) {
+      tile_queue.replace_top(std::move(rc));
+    } else {
+      tile_queue.emplace(frag_idx, std::move(rc));
     }
-    tile_queue.emplace(std::move(rc));
   }
 
   // We don't need more tiles as a tile was found.
@@ -941,25 +1005,28 @@ template <class CompType>
 tuple<Status, optional<std::vector<ResultCellSlab>>>
 SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
     uint64_t num_cells) {
+  if (can_merge_in_parallel(num_cells)) {
+    return parallel_merge_result_cell_slabs<CompType>(num_cells);
+  }
+
   auto timer_se = stats_->start_timer("merge_result_cell_slabs");
   std::vector<ResultCellSlab> result_cell_slabs;
   CompType cmp_max_slab_length(
       array_schema_.domain(), false, &fragment_metadata_);
 
-  // TODO Parallelize.
+  // Sequential merge, used when `can_merge_in_parallel` is false.
 
   // For easy reference.
   const bool return_all_dups =
       array_schema_.allows_dups() || consolidation_with_timestamps_;
 
-  // A tile min heap, contains one GlobalOrderResultCoords per fragment.
-  std::vector<GlobalOrderResultCoords<BitmapType>> container;
-  container.reserve(result_tiles_.size());
+  // A tile merge tree, contains one GlobalOrderResultCoords per fragment
+  // (or all the duplicates of a cell, for purge deletes with no dups mode).
   CompType cmp(
       array_schema_.domain(),
       !array_schema_.allows_dups(),
       &fragment_metadata_);
-  TileMinHeap<CompType> tile_queue(cmp, std::move(container));
+  TileMergeTree<CompType> tile_queue(result_tiles_.size(), cmp);
 
   // If any fragments needs to load more tiles.
   bool need_more_tiles = false;
@@ -998,14 +1065,37 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   while (!tile_queue.empty() && !need_more_tiles && num_cells > 0) {
     auto to_process = tile_queue.top();
     auto tile = to_process.tile_;
-    tile_queue.pop();
+
+    // Leave the cell at the top of the queue when it is the only one of its
+    // fragment, so that the next cell of the fragment replaces it with a
+    // single replay of the tree.
+    bool to_process_queued =
+        tile_queue.slot_size(tile_queue.top_slot()) == 1;
+    if (!to_process_queued) {
+      tile_queue.pop();
+    }
+
+    // Returns the cell that follows `to_process` in the queue, if any.
+    auto next_in_queue = [&]() -> const GlobalOrderResultCoords<BitmapType>* {
+      if (to_process_queued) {
+        return tile_queue.runner_up();
+      }
+      return tile_queue.empty() ? nullptr : &tile_queue.top();
+    };
 
     // Used only for purge delete condolidation.
     bool stop_creating_slabs = false;
 
     // Process all cells with the same coordinates at once.
-    while (!tile_queue.empty() && to_process.same_coords(tile_queue.top()) &&
-           num_cells > 0) {
+    const GlobalOrderResultCoords<BitmapType>* next;
+    while ((next = next_in_queue()) != nullptr &&
+           to_process.same_coords(*next) && num_cells > 0) {
+      // The duplicates are processed from the top of the queue.
+      if (to_process_queued) {
+        tile_queue.pop();
+        to_process_queued = false;
+      }
+
       // For consolidation with deletes, check if the cell was deleted and
       // stop copying if it is. All cells after this in the queue have a
       // smaller timestamp so they should be deleted.
@@ -1048,10 +1138,10 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
       if (!return_all_dups) {
         auto to_remove = tile_queue.top();
         update_frag_idx(to_remove.tile_, to_remove.pos_ + 1);
-        tile_queue.pop();
 
-        // Put the next cell from the processed tile in the queue.
-        need_more_tiles = add_next_cell_to_queue(to_remove, rt_it, tile_queue);
+        // Replace the removed cell by the next cell from its tile.
+        need_more_tiles =
+            add_next_cell_to_queue(to_remove, rt_it, tile_queue, true);
       } else {
         update_frag_idx(tile, to_process.pos_ + 1);
 
@@ -1086,11 +1176,11 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
       // Compute the length of the cell slab.
       uint64_t length = 1;
       if (to_process.has_next_ || single_cell_only) {
-        if (tile_queue.empty()) {
+        next = next_in_queue();
+        if (next == nullptr) {
           length = to_process.max_slab_length();
         } else {
-          length =
-              to_process.max_slab_length(tile_queue.top(), cmp_max_slab_length);
+          length = to_process.max_slab_length(*next, cmp_max_slab_length);
         }
       }
 
@@ -1135,7 +1225,8 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
     }
 
     // Put the next cell in the queue.
-    need_more_tiles = add_next_cell_to_queue(to_process, rt_it, tile_queue);
+    need_more_tiles = add_next_cell_to_queue(
+        to_process, rt_it, tile_queue, to_process_queued);
   }
 
   buffers_full_ = num_cells == 0;
@@ -1148,6 +1239,286 @@ SparseGlobalOrderReader<BitmapType>::merge_result_cell_slabs(
   return {Status::Ok(), std::move(result_cell_slabs)};
 };  // namespace sm
 
+template <class BitmapType>
+bool SparseGlobalOrderReader<BitmapType>::can_merge_in_parallel(
+    uint64_t num_cells) {
+  // Overlapping ranges and consolidation with timestamps or purge deletes
+  // need the sequential merge.
+  if (!std::is_same<BitmapType, uint8_t>::value ||
+      consolidation_with_timestamps_ || purge_deletes_no_dups_mode_ ||
+      storage_manager_->compute_tp()->concurrency_level() < 2) {
+    return false;
+  }
+
+  // The sequential merge stops as soon as a fragment needs more tiles, so
+  // all the tiles must be loaded. Also, as the partitions are merged in
+  // full, all the results must fit in the user buffers.
+  uint64_t fragment_num = 0;
+  uint64_t cell_num = 0;
+  for (uint64_t f = 0; f < result_tiles_.size(); f++) {
+    if (result_tiles_[f].empty()) {
+      continue;
+    }
+
+    if (!all_tiles_loaded_[f]) {
+      return false;
+    }
+
+    fragment_num++;
+    for (auto& tile : result_tiles_[f]) {
+      cell_num += tile.result_num();
+    }
+  }
+
+  return fragment_num > 1 && cell_num <= num_cells;
+}
+
+template <class BitmapType>
+template <class CompType>
+tuple<Status, optional<std::vector<ResultCellSlab>>>
+SparseGlobalOrderReader<BitmapType>::parallel_merge_result_cell_slabs(
+    uint64_t num_cells) {
+  auto timer_se = stats_->start_timer("parallel_merge_result_cell_slabs");
+  using ResultCoords = GlobalOrderResultCoords<BitmapType>;
+  using Position = std::pair<uint64_t, uint64_t>;
+
+  // For easy reference.
+  const auto fragment_num = result_tiles_.size();
+  const bool dups = array_schema_.allows_dups();
+  CompType cmp(array_schema_.domain(), !dups, &fragment_metadata_);
+  CompType cmp_coords(array_schema_.domain(), false, &fragment_metadata_);
+  auto precedes = [&](const ResultCoords& a, const ResultCoords& b) {
+    return !cmp_coords(a, b);
+  };
+
+  // Index the result tiles, and sample the first cell of every tile.
+  std::vector<std::vector<GlobalOrderResultTile<BitmapType>*>> tiles(
+      fragment_num);
+  std::vector<uint64_t> start_cell(fragment_num, 0);
+  std::vector<ResultCoords> samples;
+  for (uint64_t f = 0; f < fragment_num; f++) {
+    for (auto& tile : result_tiles_[f]) {
+      tiles[f].emplace_back(&tile);
+      ResultCoords rc(&tile, 0);
+      if (rc.advance_to_next_cell()) {
+        samples.emplace_back(rc);
+      }
+    }
+
+    if (!tiles[f].empty() &&
+        read_state_.frag_idx_[f].tile_idx_ == tiles[f][0]->tile_idx()) {
+      start_cell[f] = read_state_.frag_idx_[f].cell_idx_;
+    }
+  }
+
+  // Pick the splitters, evenly spaced in the sorted samples.
+  const uint64_t thread_num =
+      storage_manager_->compute_tp()->concurrency_level();
+  const uint64_t sample_num = samples.size();
+  std::sort(samples.begin(), samples.end(), precedes);
+  std::vector<ResultCoords> splitters;
+  for (uint64_t p = 1; p < std::min(thread_num, sample_num); p++) {
+    auto& sample = samples[p * sample_num / std::min(thread_num, sample_num)];
+    if (splitters.empty() || precedes(splitters.back(), sample)) {
+      splitters.emplace_back(sample);
+    }
+  }
+  const uint64_t partition_num = splitters.size() + 1;
+
+  // Compute the bounds of the partitions in every fragment, as the position
+  // (tile index, cell position) of the first cell that does not precede the
+  // splitter. The cells are in global order in the tiles of a fragment,
+  // including the ones outside of the tile bitmaps, which are skipped over.
+  std::vector<std::vector<Position>> bounds(fragment_num);
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, fragment_num, [&](uint64_t f) {
+        auto& frag_tiles = tiles[f];
+        const Position start{0, start_cell[f]};
+        const Position end{frag_tiles.size(), 0};
+
+        // Returns if the first cell at or after `pos` in the bitmap of tile
+        // `t` precedes the splitter.
+        auto cell_precedes = [&](const ResultCoords& splitter,
+                                 uint64_t t,
+                                 uint64_t pos) {
+          ResultCoords rc(frag_tiles[t], pos);
+          return rc.advance_to_next_cell() && precedes(rc, splitter);
+        };
+
+        auto& frag_bounds = bounds[f];
+        frag_bounds.reserve(partition_num + 1);
+        frag_bounds.emplace_back(start);
+        for (const auto& splitter : splitters) {
+          // Find the first tile whose first cell does not precede the
+          // splitter, the bound is in the tile before it.
+          uint64_t lo = 0, hi = frag_tiles.size();
+          while (lo < hi) {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (cell_precedes(splitter, mid, 0)) {
+              lo = mid + 1;
+            } else {
+              hi = mid;
+            }
+          }
+
+          Position bound{0, 0};
+          if (lo > 0) {
+            const uint64_t t = lo - 1;
+            const uint64_t cell_num = frag_tiles[t]->cell_num();
+            uint64_t cell_lo = 0, cell_hi = cell_num;
+            while (cell_lo < cell_hi) {
+              uint64_t mid = cell_lo + (cell_hi - cell_lo) / 2;
+              if (cell_precedes(splitter, t, mid)) {
+                cell_lo = mid + 1;
+              } else {
+                cell_hi = mid;
+              }
+            }
+            bound =
+                cell_lo == cell_num ? Position{lo, 0} : Position{t, cell_lo};
+          }
+
+          frag_bounds.emplace_back(std::max(bound, start));
+        }
+        frag_bounds.emplace_back(end);
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE_TUPLE(
+      status, logger_->status_no_return_value(status), nullopt);
+
+  // Merge the partitions. A slab of length zero marks a dropped duplicate.
+  std::vector<std::vector<ResultCellSlab>> partition_slabs(partition_num);
+  status = parallel_for(
+      storage_manager_->compute_tp(), 0, partition_num, [&](uint64_t p) {
+        auto& slabs = partition_slabs[p];
+        TileMergeTree<CompType> tile_queue(fragment_num, cmp);
+        std::vector<uint64_t> tile_idx(fragment_num);
+
+        // Queues the cell at or after the position of a result coords in
+        // the bitmap, if it is in the partition.
+        auto queue_cell = [&](ResultCoords& rc, uint64_t f) {
+          if (!rc.advance_to_next_cell()) {
+            if (++tile_idx[f] >= tiles[f].size()) {
+              return;
+            }
+
+            // All tiles should at least have one cell available.
+            rc = ResultCoords(tiles[f][tile_idx[f]], 0);
+            if (!rc.advance_to_next_cell()) {
+              throw std::logic_error(
+                  "All tiles should have at least one cell.");
+            }
+          }
+
+          if (Position{tile_idx[f], rc.pos_} < bounds[f][p + 1]) {
+            tile_queue.emplace(f, rc);
+          }
+        };
+
+        for (uint64_t f = 0; f < fragment_num; f++) {
+          tile_idx[f] = bounds[f][p].first;
+          if (tile_idx[f] < tiles[f].size()) {
+            ResultCoords rc(tiles[f][tile_idx[f]], bounds[f][p].second);
+            queue_cell(rc, f);
+          }
+        }
+
+        while (!tile_queue.empty()) {
+          auto to_process = tile_queue.top();
+          auto tile = to_process.tile_;
+          const auto f = tile->frag_idx();
+          tile_queue.pop();
+
+          // For no dups, the cell with the greater timestamp comes first,
+          // drop the other cells with the same coordinates.
+          while (!dups && !tile_queue.empty() &&
+                 to_process.same_coords(tile_queue.top())) {
+            auto to_remove = tile_queue.top();
+            tile_queue.pop();
+            slabs.emplace_back(to_remove.tile_, to_remove.pos_, 0);
+            queue_cell(to_remove, to_remove.tile_->frag_idx());
+          }
+
+          // Compute the length of the cell slab, within the partition.
+          uint64_t length =
+              tile_queue.empty() ?
+                  to_process.max_slab_length() :
+                  to_process.max_slab_length(tile_queue.top(), cmp_coords);
+          const auto& bound = bounds[f][p + 1];
+          if (tile_idx[f] == bound.first) {
+            length = std::min(length, bound.second - to_process.pos_);
+          }
+
+          if (length != 0) {
+            slabs.emplace_back(tile, to_process.pos_, length);
+            to_process.pos_ += length - 1;
+          }
+
+          // Put the next cell in the queue.
+          queue_cell(to_process, f);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE_TUPLE(
+      status, logger_->status_no_return_value(status), nullopt);
+
+  // Concatenate the partitions, updating the tiles and fragment indexes.
+  std::vector<ResultCellSlab> result_cell_slabs;
+  bool all_merged = true;
+  for (auto& slabs : partition_slabs) {
+    for (auto& slab : slabs) {
+      if (num_cells == 0) {
+        all_merged = false;
+        break;
+      }
+
+      auto tile = static_cast<GlobalOrderResultTile<BitmapType>*>(slab.tile_);
+      if (slab.length_ == 0) {
+        update_frag_idx(tile, slab.start_ + 1);
+        continue;
+      }
+
+      const auto length = std::min(slab.length_, num_cells);
+      tile->set_used();
+      result_cell_slabs.emplace_back(tile, slab.start_, length);
+      update_frag_idx(tile, slab.start_ + length);
+      num_cells -= length;
+    }
+  }
+
+  // All fragments are done, remove the tiles that weren't used at all and
+  // move the fragments past their last tile.
+  if (all_merged) {
+    for (uint64_t f = 0; f < fragment_num; f++) {
+      for (auto it = result_tiles_[f].begin(); it != result_tiles_[f].end();) {
+        auto to_delete = it++;
+        if (!to_delete->used()) {
+          ignored_tiles_.emplace(f, to_delete->tile_idx());
+          throw_if_not_ok(remove_result_tile(f, to_delete));
+        }
+      }
+
+      if (!result_tiles_[f].empty()) {
+        read_state_.frag_idx_[f].tile_idx_++;
+        read_state_.frag_idx_[f].cell_idx_ = 0;
+      }
+    }
+  }
+
+  buffers_full_ = num_cells == 0;
+
+  logger_->debug(
+      "Done merging result cell slabs in {0} partitions, num slabs {1}, "
+      "buffers full {2}",
+      partition_num,
+      result_cell_slabs.size(),
+      buffers_full_);
+
+  return {Status::Ok(), std::move(result_cell_slabs)};
+}
+
 template <class BitmapType>
 tuple<uint64_t, uint64_t, uint64_t, bool>
 SparseGlobalOrderReader<BitmapType>::compute_parallelization_parameters(
@@ -2014,6 +2385,120 @@ Status SparseGlobalOrderReader<BitmapType>::process_slabs(
   return Status::Ok();
 }
 
+template <class BitmapType>
+bool SparseGlobalOrderReader<BitmapType>::tile_overlaps_other_fragments(
+    const unsigned f, const uint64_t t) const {
+  // Duplicates are not removed for arrays that allow them.
+  if (array_schema_.allows_dups()) {
+    return false;
+  }
+
+  const auto& mbr = fragment_metadata_[f]->mbr(t);
+  for (unsigned other = 0; other < fragment_metadata_.size(); other++) {
+    if (other != f &&
+        array_schema_.domain().overlap(
+            mbr, fragment_metadata_[other]->non_empty_domain())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+template <class BitmapType>
+Status SparseGlobalOrderReader<BitmapType>::process_aggregates(
+    std::vector<ResultCellSlab>& result_cell_slabs) {
+  auto timer_se = stats_->start_timer("process_aggregates");
+
+  // Making sure we respect the memory budget for loading the tiles.
+  auto names = aggregate_field_names();
+  uint64_t memory_budget = memory_budget_ - memory_used_qc_tiles_total_ -
+                           memory_used_for_coords_total_ -
+                           memory_used_result_tile_ranges_ -
+                           array_memory_tracker_->get_memory_usage();
+  auto&& [st, mem_usage_per_attr] =
+      respect_copy_memory_budget(names, memory_budget, result_cell_slabs);
+  RETURN_NOT_OK(st);
+
+  // Compute the aggregates that don't need tiles.
+  RETURN_NOT_OK(aggregate_slabs(field_aggregates(""), result_cell_slabs));
+
+  // Make a list of unique result tiles.
+  std::vector<ResultTile*> result_tiles;
+  {
+    std::unordered_set<ResultTile*> found_tiles;
+    for (auto& rcs : result_cell_slabs) {
+      if (found_tiles.count(rcs.tile_) == 0) {
+        found_tiles.emplace(rcs.tile_);
+        result_tiles.emplace_back(rcs.tile_);
+      }
+    }
+  }
+  std::sort(result_tiles.begin(), result_tiles.end(), result_tile_cmp);
+
+  // Read a few attributes a a time.
+  uint64_t buffer_idx = 0;
+  while (buffer_idx < names.size()) {
+    // Read and unfilter as many attributes as can fit in the budget.
+    auto&& [st, index_to_copy] = read_and_unfilter_attributes(
+        memory_budget, names, *mem_usage_per_attr, &buffer_idx, result_tiles);
+    RETURN_NOT_OK(st);
+
+    for (const auto& idx : *index_to_copy) {
+      const auto& name = names[idx];
+      RETURN_NOT_OK(aggregate_slabs(field_aggregates(name), result_cell_slabs));
+
+      // Clear tiles from memory.
+      if (qc_loaded_attr_names_set_.count(name) == 0) {
+        clear_tiles(name, result_tiles);
+      }
+    }
+  }
+
+  logger_->debug("Done computing aggregates");
+  return Status::Ok();
+}
+
+template <class BitmapType>
+Status SparseGlobalOrderReader<BitmapType>::aggregate_slabs(
+    const std::vector<shared_ptr<Aggregator>>& aggregates,
+    const std::vector<ResultCellSlab>& result_cell_slabs) {
+  if (aggregates.empty() || result_cell_slabs.empty()) {
+    return Status::Ok();
+  }
+
+  // Process the slabs in contiguous partitions, one partial result per
+  // partition and aggregate.
+  const uint64_t num_partitions = std::min<uint64_t>(
+      storage_manager_->compute_tp()->concurrency_level(),
+      result_cell_slabs.size());
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, num_partitions, [&](uint64_t p) {
+        const uint64_t start = result_cell_slabs.size() * p / num_partitions;
+        const uint64_t end =
+            result_cell_slabs.size() * (p + 1) / num_partitions;
+        for (const auto& aggregate : aggregates) {
+          auto state = aggregate->new_state();
+          for (uint64_t i = start; i < end; i++) {
+            const auto& rcs = result_cell_slabs[i];
+            aggregate->aggregate_cells<uint8_t>(
+                state,
+                rcs.tile_->tile_tuple(aggregate->field_name()),
+                rcs.start_,
+                1,
+                rcs.length_,
+                nullptr);
+          }
+          aggregate->merge(state);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status_no_return_value(status));
+
+  return Status::Ok();
+}
+
 template <class BitmapType>
 Status SparseGlobalOrderReader<BitmapType>::remove_result_tile(
     const unsigned frag_idx, TileListIt rt) {
@@ -2040,6 +2525,8 @@ Status SparseGlobalOrderReader<BitmapType>::remove_result_tile(
     memory_used_for_coords_total_ -= tiles_size;
     memory_used_qc_tiles_total_ -= tiles_size_qc;
   }
+  memory_tracker_.release_memory(
+      tiles_size + tiles_size_qc, MemoryTracker::MemoryType::TILES);
 
   // Delete the tile.
   result_tiles_[frag_idx].erase(rt);
@@ -2077,6 +2564,7 @@ Status SparseGlobalOrderReader<BitmapType>::end_iteration() {
   }
 
   logger_->debug("Done with iteration, num result tiles {0}", num_rt);
+  memory_tracker_.export_stats(*stats_);
 
   array_memory_tracker_->set_budget(std::numeric_limits<uint64_t>::max());
   return Status::Ok();
@@ -2093,6 +2581,7 @@ template SparseGlobalOrderReader<uint8_t>::SparseGlobalOrderReader(
     Subarray&,
     Layout,
     QueryCondition&,
+    std::vector<shared_ptr<Aggregator>>,
     bool,
     bool);
 template SparseGlobalOrderReader<uint64_t>::SparseGlobalOrderReader(
@@ -2105,6 +2594,7 @@ template SparseGlobalOrderReader<uint64_t>::SparseGlobalOrderReader(
     Subarray&,
     Layout,
     QueryCondition&,
+    std::vector<shared_ptr<Aggregator>>,
     bool,
     bool);
 
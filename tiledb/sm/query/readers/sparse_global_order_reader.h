@@ -39,6 +39,7 @@
 #include "tiledb/common/logger_public.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/misc/tournament_tree.h"
 #include "tiledb/sm/query/iquery_strategy.h"
 #include "tiledb/sm/query/query_buffer.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -76,6 +77,7 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
       Subarray& subarray,
       Layout layout,
       QueryCondition& condition,
+      std::vector<shared_ptr<Aggregator>> aggregates,
       bool consolidation_with_timestamps,
       bool skip_checks_serialization = false);
 
@@ -158,6 +160,9 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /** Mutex to protect the tile queue. */
   std::mutex tile_queue_mutex_;
 
+  /** Mutex to protect the ignored tiles while creating result tiles. */
+  std::mutex ignored_tiles_mutex_;
+
   /** Stores last cell for fragments consolidated with timestamps. */
   std::vector<FragIdx> last_cells_;
 
@@ -184,12 +189,10 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   /*       PRIVATE DECLARATIONS        */
   /* ********************************* */
 
-  /** Tile min heap. */
+  /** Tile merge tree, with one slot per fragment. */
   template <typename CompType>
-  using TileMinHeap = std::priority_queue<
-      GlobalOrderResultCoords<BitmapType>,
-      std::vector<GlobalOrderResultCoords<BitmapType>>,
-      CompType>;
+  using TileMergeTree =
+      TournamentTree<GlobalOrderResultCoords<BitmapType>, CompType>;
 
   /** Tile list iterator. */
   using TileListIt =
@@ -291,7 +294,7 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
    *
    * @param rc Current result coords for the fragment.
    * @param result_tiles_it Iterator, per frag, in the list of retult tiles.
-   * @param tile_queue Queue of one result coords, per fragment, sorted.
+   * @param tile_queue Merge tree of result coords, slotted per fragment.
    *
    * @return If more tiles are needed.
    */
@@ -299,7 +302,7 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   bool add_all_dups_to_queue(
       GlobalOrderResultCoords<BitmapType>& rc,
       std::vector<TileListIt>& result_tiles_it,
-      TileMinHeap<CompType>& tile_queue);
+      TileMergeTree<CompType>& tile_queue);
 
   /**
    * Add a cell (for a specific fragment) to the queue of cells currently being
@@ -307,7 +310,9 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
    *
    * @param rc Current result coords for the fragment.
    * @param result_tiles_it Iterator, per frag, in the list of retult tiles.
-   * @param tile_queue Queue of one result coords, per fragment, sorted.
+   * @param tile_queue Merge tree of result coords, slotted per fragment.
+   * @param replace_top If `rc` is still the top of the queue. Its next cell
+   *     then replaces it, or it is popped if there is none.
    *
    * @return If more tiles are needed.
    */
@@ -315,7 +320,8 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   bool add_next_cell_to_queue(
       GlobalOrderResultCoords<BitmapType>& rc,
       std::vector<TileListIt>& result_tiles_it,
-      TileMinHeap<CompType>& tile_queue);
+      TileMergeTree<CompType>& tile_queue,
+      bool replace_top = false);
 
   /**
    * Computes a tile's Hilbert values for a tile.
@@ -346,6 +352,32 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
   tuple<Status, optional<std::vector<ResultCellSlab>>> merge_result_cell_slabs(
       uint64_t num_cells);
 
+  /**
+   * Returns true if the result cell slabs can be merged in parallel. This
+   * requires non overlapping ranges, no consolidation with timestamps or
+   * purge deletes, all the tiles of the fragments with results to be loaded
+   * and the results to fit in the user buffers, as the partitions are merged
+   * in full.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   */
+  bool can_merge_in_parallel(uint64_t num_cells);
+
+  /**
+   * Compute the result cell slabs once tiles are loaded, in parallel. The
+   * key space is partitioned with splitter coordinates sampled from the
+   * first cell of every result tile, and every partition is merged by a
+   * thread of its own. The result cell slabs of the partitions are then
+   * concatenated in order.
+   *
+   * @param num_cells Number of cells that can be copied in the user buffer.
+   *
+   * @return Status, result_cell_slabs.
+   */
+  template <class CompType>
+  tuple<Status, optional<std::vector<ResultCellSlab>>>
+  parallel_merge_result_cell_slabs(uint64_t num_cells);
+
   /**
    * Compute parallelization parameters for a tile copy operation.
    *
@@ -517,6 +549,41 @@ class SparseGlobalOrderReader : public SparseIndexReaderBase,
       std::vector<std::string>& names,
       std::vector<ResultCellSlab>& result_cell_slabs);
 
+  /**
+   * Returns true if the MBR of a tile overlaps the non empty domain of
+   * another fragment, in which case some of its cells might be duplicates
+   * that get removed by the reader.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return True if the tile might contain duplicates.
+   */
+  bool tile_overlaps_other_fragments(const unsigned f, const uint64_t t) const;
+
+  /**
+   * Computes the aggregates over the cell slabs, without copying cells to the
+   * user buffers.
+   *
+   * @param result_cell_slabs The result cell slabs to process, might be
+   *     truncated to respect the memory budget.
+   *
+   * @return Status.
+   */
+  Status process_aggregates(std::vector<ResultCellSlab>& result_cell_slabs);
+
+  /**
+   * Computes aggregates over the cell slabs. The tiles of the aggregated
+   * field need to be loaded.
+   *
+   * @param aggregates The aggregates to compute.
+   * @param result_cell_slabs The result cell slabs to process.
+   *
+   * @return Status.
+   */
+  Status aggregate_slabs(
+      const std::vector<shared_ptr<Aggregator>>& aggregates,
+      const std::vector<ResultCellSlab>& result_cell_slabs);
+
   /**
    * Remove a result tile from memory
    *
@@ -72,7 +72,8 @@ SparseIndexReaderBase::SparseIndexReaderBase(
     std::unordered_map<std::string, QueryBuffer>& buffers,
     Subarray& subarray,
     Layout layout,
-    QueryCondition& condition)
+    QueryCondition& condition,
+    std::vector<shared_ptr<Aggregator>> aggregates)
     : ReaderBase(
           stats,
           logger,
@@ -82,9 +83,11 @@ SparseIndexReaderBase::SparseIndexReaderBase(
           buffers,
           subarray,
           layout,
-          condition)
+          condition,
+          std::move(aggregates))
     , memory_budget_(0)
     , array_memory_tracker_(array->memory_tracker())
+    , memory_tracker_(&storage_manager->resources().memory_tracker())
     , memory_used_for_coords_total_(0)
     , memory_used_qc_tiles_total_(0)
     , memory_used_result_tile_ranges_(0)
@@ -119,7 +122,7 @@ void SparseIndexReaderBase::init(bool skip_checks_serialization) {
         "set");
   }
 
-  if (!skip_checks_serialization && buffers_.empty()) {
+  if (!skip_checks_serialization && buffers_.empty() && aggregates_.empty()) {
     throw SparseIndexReaderBaseStatusException(
         "Cannot initialize sparse global order reader; Buffers not set");
   }
@@ -168,6 +171,7 @@ std::vector<uint64_t> SparseIndexReaderBase::tile_offset_sizes() {
   // For easy reference.
   std::vector<uint64_t> ret(fragment_metadata_.size());
   const auto dim_num = array_schema_.dim_num();
+  const auto aggregate_names = aggregate_field_names();
 
   // Compute the size of tile offsets per fragments.
   const auto relevant_fragments = subarray_.relevant_fragments();
@@ -245,6 +249,25 @@ std::vector<uint64_t> SparseIndexReaderBase::tile_offset_sizes() {
           num += attr->nullable();
         }
 
+        // Process everything loaded for aggregates.
+        for (auto& name : aggregate_names) {
+          if (!schema->is_field(name) ||
+              qc_loaded_attr_names_set_.count(name) != 0 ||
+              buffers_.count(name) != 0) {
+            continue;
+          }
+
+          // Fixed tile (offsets or fixed data).
+          num++;
+
+          // If var size, we load var offsets and var tile sizes.
+          const auto attr = schema->attribute(name);
+          num += 2 * attr->var_size();
+
+          // If nullable, we load nullable offsets.
+          num += attr->nullable();
+        }
+
         // Add timestamps if required.
         if (!timestamps_not_present(constants::timestamps, frag_idx)) {
           num++;
@@ -271,8 +294,40 @@ bool SparseIndexReaderBase::has_post_deduplication_conditions(
           !deletes_consolidation_no_purge_);
 }
 
+bool SparseIndexReaderBase::tile_covered_by_subarray(
+    const unsigned f, const uint64_t t) const {
+  if (!subarray_.is_set()) {
+    return true;
+  }
+
+  // Each dimension of the MBR needs to be within a single range.
+  const auto& mbr = fragment_metadata_[f]->mbr(t);
+  for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+    const auto dim = array_schema_.dimension_ptr(d);
+    const auto& ranges = subarray_.ranges_for_dim(d);
+    bool covered = false;
+    for (const auto& range : ranges) {
+      if (dim->covered(mbr[d], range)) {
+        covered = true;
+        break;
+      }
+    }
+
+    if (!covered) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 uint64_t SparseIndexReaderBase::cells_copied(
     const std::vector<std::string>& names) {
+  // Aggregate queries don't copy cells.
+  if (names.empty()) {
+    return 0;
+  }
+
   auto& last_name = names.back();
   auto buffer_size = *buffers_[last_name].buffer_size_;
   if (array_schema_.var_size(last_name)) {
@@ -297,6 +352,7 @@ std::pair<uint64_t, uint64_t> SparseIndexReaderBase::get_coord_tiles_size(
 
       if (is_dim_var_size_[d]) {
         tiles_size += fragment_metadata_[f]->tile_var_size(dim_names_[d], t);
+        tiles_size += get_encoded_strings_size(dim_names_[d], f, t);
       }
     }
   }
@@ -442,6 +498,20 @@ Status SparseIndexReaderBase::load_initial_data() {
     }
   }
 
+  // Add the fields loaded to compute aggregates in-engine.
+  for (auto& name : aggregate_field_names()) {
+    if (qc_loaded_attr_names_set_.count(name) != 0 ||
+        buffers_.count(name) != 0) {
+      continue;
+    }
+
+    attr_tile_offsets_to_load_.emplace_back(name);
+
+    if (array_schema_.var_size(name)) {
+      var_size_to_load_.emplace_back(name);
+    }
+  }
+
   const bool partial_consol_fragment_overlap =
       partial_consolidated_fragment_overlap(subarray_);
   use_timestamps_ = partial_consol_fragment_overlap ||
@@ -518,6 +588,12 @@ void SparseIndexReaderBase::load_tile_offsets_for_fragments(
   throw_if_not_ok(load_tile_var_sizes(relevant_fragments, var_size_to_load_));
   throw_if_not_ok(
       load_tile_offsets(relevant_fragments, attr_tile_offsets_to_load_));
+
+  // Load the tile metadata used to compute aggregates.
+  throw_if_not_ok(load_aggregate_tile_metadata(relevant_fragments));
+
+  // Load the tile metadata used to skip tiles with the query condition.
+  throw_if_not_ok(load_condition_tile_metadata(relevant_fragments));
 }
 
 Status SparseIndexReaderBase::read_and_unfilter_coords(
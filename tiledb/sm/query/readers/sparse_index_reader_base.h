@@ -36,6 +36,7 @@
 #include <queue>
 #include "reader_base.h"
 #include "tiledb/common/common.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/status.h"
 #include "tiledb/sm/array_schema/dimension.h"
 #include "tiledb/sm/query/query_condition.h"
@@ -47,7 +48,6 @@ namespace sm {
 
 class Array;
 class ArraySchema;
-class MemoryTracker;
 class Subarray;
 
 class FragIdx {
@@ -198,7 +198,8 @@ class SparseIndexReaderBase : public ReaderBase {
       std::unordered_map<std::string, QueryBuffer>& buffers,
       Subarray& subarray,
       Layout layout,
-      QueryCondition& condition);
+      QueryCondition& condition,
+      std::vector<shared_ptr<Aggregator>> aggregates);
 
   /** Destructor. */
   ~SparseIndexReaderBase() = default;
@@ -273,6 +274,13 @@ class SparseIndexReaderBase : public ReaderBase {
   /** Memory tracker object for the array. */
   MemoryTracker* array_memory_tracker_;
 
+  /**
+   * Memory tracker of this reader, for the coordinate and query condition
+   * tiles it holds. Its parent is the context's tracker, as the array tracker
+   * is budgeted for array data only.
+   */
+  MemoryTracker memory_tracker_;
+
   /** Memory used for coordinates tiles. */
   uint64_t memory_used_for_coords_total_;
 
@@ -344,6 +352,16 @@ class SparseIndexReaderBase : public ReaderBase {
    */
   bool has_post_deduplication_conditions(FragmentMetadata& frag_meta);
 
+  /**
+   * Returns true if all the cells of a tile are in the subarray, using the
+   * tile MBR.
+   *
+   * @param f Fragment index.
+   * @param t Tile index.
+   * @return True if the tile is fully covered by the subarray.
+   */
+  bool tile_covered_by_subarray(const unsigned f, const uint64_t t) const;
+
   /**
    * Return how many cells were copied to the users buffers so far.
    *
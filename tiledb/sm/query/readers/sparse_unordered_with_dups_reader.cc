@@ -76,6 +76,7 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
     Subarray& subarray,
     Layout layout,
     QueryCondition& condition,
+    std::vector<shared_ptr<Aggregator>> aggregates,
     bool skip_checks_serialization)
     : SparseIndexReaderBase(
           stats,
@@ -86,7 +87,8 @@ SparseUnorderedWithDupsReader<BitmapType>::SparseUnorderedWithDupsReader(
           buffers,
           subarray,
           layout,
-          condition)
+          condition,
+          std::move(aggregates))
     , tile_offsets_min_frag_idx_(std::numeric_limits<unsigned>::max())
     , tile_offsets_max_frag_idx_(0) {
   include_coords_ = false;
@@ -282,8 +284,10 @@ Status SparseUnorderedWithDupsReader<BitmapType>::dowork() {
       continue;
     }
 
-    // Copy tiles.
-    if (offsets_bitsize_ == 64) {
+    // Compute aggregates or copy tiles.
+    if (!aggregates_.empty()) {
+      RETURN_NOT_OK(process_aggregates(result_tiles_loaded));
+    } else if (offsets_bitsize_ == 64) {
       RETURN_NOT_OK(process_tiles<uint64_t>(names, result_tiles_loaded));
     } else {
       RETURN_NOT_OK(process_tiles<uint32_t>(names, result_tiles_loaded));
@@ -432,6 +436,29 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
     const uint64_t t,
     const uint64_t last_t,
     const FragmentMetadata& frag_md) {
+  // Skip the tiles with no cells passing the query condition according to
+  // their min/max metadata.
+  bool skip = ignored_tiles_.count(IgnoredTile(f, t)) != 0;
+  if (!skip && tile_excluded_by_condition(f, t)) {
+    stats_->add_counter("tiles_skipped_by_condition", 1);
+    skip = true;
+  }
+
+  // Tiles fully covered by the subarray, with no overlapping ranges, can be
+  // aggregated from their tile metadata without being loaded.
+  skip = skip || (fragment_tile_metadata_usable(f) &&
+                  std::is_same<BitmapType, uint8_t>::value &&
+                  tile_covered_by_subarray(f, t) &&
+                  aggregate_tile_metadata(f, t));
+  if (skip) {
+    ignored_tiles_.emplace(f, t);
+    if (t == last_t) {
+      all_tiles_loaded_[f] = true;
+    }
+
+    return false;
+  }
+
   // Calculate memory consumption for this tile.
   auto tiles_sizes = get_coord_tiles_size(dim_num, f, t);
   auto tiles_size = tiles_sizes.first;
@@ -443,6 +470,12 @@ bool SparseUnorderedWithDupsReader<BitmapType>::add_result_tile(
     return true;
   }
 
+  // Don't load more tiles than the context budget.
+  if (!memory_tracker_.take_memory(
+          tiles_size + tiles_size_qc, MemoryTracker::MemoryType::TILES)) {
+    return true;
+  }
+
   // Adjust memory usage.
   memory_used_for_coords_total_ += tiles_size;
   memory_used_qc_tiles_total_ += tiles_size_qc;
@@ -1824,6 +1857,87 @@ Status SparseUnorderedWithDupsReader<BitmapType>::process_tiles(
   return Status::Ok();
 }
 
+template <class BitmapType>
+Status SparseUnorderedWithDupsReader<BitmapType>::process_aggregates(
+    std::vector<ResultTile*>& result_tiles) {
+  auto timer_se = stats_->start_timer("process_aggregates");
+
+  // Making sure we respect the memory budget for loading the tiles.
+  auto names = aggregate_field_names();
+  uint64_t memory_budget = memory_budget_ - memory_used_qc_tiles_total_ -
+                           memory_used_for_coords_total_ -
+                           memory_used_result_tile_ranges_ -
+                           array_memory_tracker_->get_memory_usage();
+  auto&& [st, mem_usage_per_attr] =
+      respect_copy_memory_budget(names, memory_budget, result_tiles);
+  RETURN_NOT_OK(st);
+
+  // Compute the aggregates that don't need tiles.
+  RETURN_NOT_OK(aggregate_tiles(field_aggregates(""), result_tiles));
+
+  // Read a few attributes a a time.
+  uint64_t buffer_idx = 0;
+  while (buffer_idx < names.size()) {
+    // Read and unfilter as many attributes as can fit in the budget.
+    auto&& [st, index_to_copy] = read_and_unfilter_attributes(
+        memory_budget, names, *mem_usage_per_attr, &buffer_idx, result_tiles);
+    RETURN_NOT_OK(st);
+
+    for (const auto& idx : *index_to_copy) {
+      const auto& name = names[idx];
+      RETURN_NOT_OK(aggregate_tiles(field_aggregates(name), result_tiles));
+
+      // Clear tiles from memory.
+      if (qc_loaded_attr_names_set_.count(name) == 0) {
+        clear_tiles(name, result_tiles);
+      }
+    }
+  }
+
+  // Adjust tile index, tiles are always fully processed.
+  for (auto rt : result_tiles) {
+    read_state_.frag_idx_[rt->frag_idx()] = FragIdx(rt->tile_idx() + 1, 0);
+  }
+
+  logger_->debug("Done computing aggregates");
+  return Status::Ok();
+}
+
+template <class BitmapType>
+Status SparseUnorderedWithDupsReader<BitmapType>::aggregate_tiles(
+    const std::vector<shared_ptr<Aggregator>>& aggregates,
+    std::vector<ResultTile*>& result_tiles) {
+  if (aggregates.empty()) {
+    return Status::Ok();
+  }
+
+  auto status = parallel_for(
+      storage_manager_->compute_tp(), 0, result_tiles.size(), [&](uint64_t i) {
+        auto rt = static_cast<UnorderedWithDupsResultTile<BitmapType>*>(
+            result_tiles[i]);
+
+        // An empty bitmap means all cells are results.
+        const BitmapType* counts =
+            rt->has_bmp() ? rt->bitmap().data() : nullptr;
+        for (const auto& aggregate : aggregates) {
+          auto state = aggregate->new_state();
+          aggregate->aggregate_cells(
+              state,
+              rt->tile_tuple(aggregate->field_name()),
+              0,
+              1,
+              rt->cell_num(),
+              counts);
+          aggregate->merge(state);
+        }
+
+        return Status::Ok();
+      });
+  RETURN_NOT_OK_ELSE(status, logger_->status_no_return_value(status));
+
+  return Status::Ok();
+}
+
 template <class BitmapType>
 Status SparseUnorderedWithDupsReader<BitmapType>::remove_result_tile(
     const unsigned frag_idx,
@@ -1840,6 +1954,8 @@ Status SparseUnorderedWithDupsReader<BitmapType>::remove_result_tile(
     memory_used_for_coords_total_ -= tiles_size;
     memory_used_qc_tiles_total_ -= tiles_size_qc;
   }
+  memory_tracker_.release_memory(
+      tiles_size + tiles_size_qc, MemoryTracker::MemoryType::TILES);
 
   // Delete the tile.
   result_tiles_.erase(rt);
@@ -1868,6 +1984,7 @@ Status SparseUnorderedWithDupsReader<BitmapType>::end_iteration() {
 
   logger_->debug(
       "Done with iteration, num result tiles {0}", result_tiles_.size());
+  memory_tracker_.export_stats(*stats_);
 
   const auto uint64_t_max = std::numeric_limits<uint64_t>::max();
   array_memory_tracker_->set_budget(uint64_t_max);
@@ -1885,6 +2002,7 @@ template SparseUnorderedWithDupsReader<uint8_t>::SparseUnorderedWithDupsReader(
     Subarray&,
     Layout,
     QueryCondition&,
+    std::vector<shared_ptr<Aggregator>>,
     bool);
 template SparseUnorderedWithDupsReader<uint64_t>::SparseUnorderedWithDupsReader(
     stats::Stats*,
@@ -1896,6 +2014,7 @@ template SparseUnorderedWithDupsReader<uint64_t>::SparseUnorderedWithDupsReader(
     Subarray&,
     Layout,
     QueryCondition&,
+    std::vector<shared_ptr<Aggregator>>,
     bool);
 
 }  // namespace sm
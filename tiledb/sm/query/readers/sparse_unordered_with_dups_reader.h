@@ -75,6 +75,7 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
       Subarray& subarray,
       Layout layout,
       QueryCondition& condition,
+      std::vector<shared_ptr<Aggregator>> aggregates,
       bool skip_checks_serialization = false);
 
   /** Destructor. */
@@ -447,6 +448,30 @@ class SparseUnorderedWithDupsReader : public SparseIndexReaderBase,
   Status process_tiles(
       std::vector<std::string>& names, std::vector<ResultTile*>& result_tiles);
 
+  /**
+   * Computes the aggregates over the result tiles, without copying cells to
+   * the user buffers.
+   *
+   * @param result_tiles The result tiles to process, might be truncated to
+   *     respect the memory budget.
+   *
+   * @return Status.
+   */
+  Status process_aggregates(std::vector<ResultTile*>& result_tiles);
+
+  /**
+   * Computes aggregates over the cells of the result tiles. The tiles of the
+   * aggregated field need to be loaded.
+   *
+   * @param aggregates The aggregates to compute.
+   * @param result_tiles The result tiles to process.
+   *
+   * @return Status.
+   */
+  Status aggregate_tiles(
+      const std::vector<shared_ptr<Aggregator>>& aggregates,
+      std::vector<ResultTile*>& result_tiles);
+
   /**
    * Remove a result tile from memory
    *
@@ -40,10 +40,13 @@
 #include "tiledb/sm/enums/query_condition_combination_op.h"
 #include "tiledb/sm/enums/query_condition_op.h"
 #include "tiledb/sm/query/query_condition.h"
+#include "tiledb/sm/query/query_condition_kernels.h"
 #include "tiledb/sm/query/readers/result_cell_slab.h"
+#include "tiledb/sm/tile/encoded_strings.h"
 
 #include <test/support/tdb_catch.h>
 #include <iostream>
+#include <limits>
 
 using namespace tiledb::sm;
 
@@ -4881,3 +4884,511 @@ TEST_CASE(
     }
   }
 }
+
+TEST_CASE(
+    "QueryCondition: Test encoded strings",
+    "[QueryCondition][encoded_strings]") {
+  const std::string field_name = "foo";
+  const uint64_t cells = 16;
+  const bool dictionary = GENERATE(true, false);
+  const bool dense = GENERATE(true, false);
+  QueryConditionOp op = GENERATE(
+      QueryConditionOp::LT,
+      QueryConditionOp::LE,
+      QueryConditionOp::GT,
+      QueryConditionOp::GE,
+      QueryConditionOp::EQ,
+      QueryConditionOp::NE);
+
+  // Initialize the array schema.
+  shared_ptr<ArraySchema> array_schema = make_shared<ArraySchema>(HERE());
+  Attribute attr(field_name, Datatype::STRING_ASCII);
+  attr.set_cell_val_num(constants::var_num);
+  REQUIRE(
+      array_schema->add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  REQUIRE(array_schema->set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // Runs of 4 cells of "aa", "bb", "c", "bb".
+  const std::vector<std::string> run_values{"aa", "bb", "c", "bb"};
+  std::vector<std::string> cell_values;
+  for (uint64_t i = 0; i < cells; ++i) {
+    cell_values.emplace_back(run_values[i / 4]);
+  }
+
+  // The decoded cells deliberately disagree with their encoded form, so that
+  // the results show that the condition is evaluated on the encoded form.
+  std::string values;
+  std::vector<uint64_t> offsets;
+  for (const auto& v : cell_values) {
+    offsets.emplace_back(values.size());
+    values += std::string(v.size(), 'z');
+  }
+
+  // Initialize the result tile.
+  ResultTile::TileSizes tile_sizes(
+      cells * constants::cell_var_offset_size,
+      0,
+      values.size(),
+      0,
+      std::nullopt,
+      std::nullopt);
+  ResultTile result_tile(0, 0, *array_schema);
+  ResultTile::TileData tile_data{nullptr, nullptr, nullptr};
+  result_tile.init_attr_tile(
+      constants::format_version,
+      *array_schema,
+      field_name,
+      tile_sizes,
+      tile_data);
+
+  ResultTile::TileTuple* const tile_tuple = result_tile.tile_tuple(field_name);
+  Tile* const tile = &tile_tuple->var_tile();
+  REQUIRE(tile->write(values.data(), 0, values.size()).ok());
+  Tile* const tile_offsets = &tile_tuple->fixed_tile();
+  REQUIRE(
+      tile_offsets->write(offsets.data(), 0, cells * sizeof(uint64_t)).ok());
+
+  // Attach the encoded form of the cells to the offsets tile.
+  if (dictionary) {
+    std::vector<uint32_t> ids;
+    for (uint64_t i = 0; i < cells; ++i) {
+      ids.emplace_back(i / 4 == 3 ? 1 : static_cast<uint32_t>(i / 4));
+    }
+    tile_offsets->set_encoded_strings(make_shared<EncodedStrings>(
+        HERE(),
+        EncodedStrings::from_dictionary({"aa", "bb", "c"}, std::move(ids))));
+  } else {
+    tile_offsets->set_encoded_strings(make_shared<EncodedStrings>(
+        HERE(),
+        EncodedStrings::from_runs(
+            std::vector<std::string>(run_values), {4, 8, 12, 16})));
+  }
+
+  const std::string cmp_value = "bb";
+  QueryCondition query_condition;
+  REQUIRE(query_condition
+              .init(
+                  std::string(field_name),
+                  cmp_value.data(),
+                  cmp_value.size(),
+                  op)
+              .ok());
+  REQUIRE(query_condition.check(*array_schema).ok());
+
+  // Apply the query condition.
+  std::vector<uint8_t> result_bitmap(cells, 1);
+  if (dense) {
+    REQUIRE(query_condition
+                .apply_dense(
+                    *array_schema,
+                    &result_tile,
+                    0,
+                    cells,
+                    0,
+                    1,
+                    nullptr,
+                    result_bitmap.data())
+                .ok());
+  } else {
+    REQUIRE(query_condition
+                .apply_sparse<uint8_t>(
+                    *array_schema, result_tile, result_bitmap)
+                .ok());
+  }
+
+  // Verify the result bitmap against a per-cell comparison of the encoded
+  // values.
+  for (uint64_t i = 0; i < cells; ++i) {
+    bool expected = false;
+    switch (op) {
+      case QueryConditionOp::LT:
+        expected = cell_values[i] < cmp_value;
+        break;
+      case QueryConditionOp::LE:
+        expected = cell_values[i] <= cmp_value;
+        break;
+      case QueryConditionOp::GT:
+        expected = cell_values[i] > cmp_value;
+        break;
+      case QueryConditionOp::GE:
+        expected = cell_values[i] >= cmp_value;
+        break;
+      case QueryConditionOp::EQ:
+        expected = cell_values[i] == cmp_value;
+        break;
+      case QueryConditionOp::NE:
+        expected = cell_values[i] != cmp_value;
+        break;
+      default:
+        REQUIRE(false);
+    }
+    CHECK(result_bitmap[i] == expected);
+  }
+}
+
+/**
+ * @brief Creates a set membership query condition over the input values.
+ *
+ * @param field_name The field name.
+ * @param values The set members.
+ * @param op The set membership operator.
+ * @return The query condition.
+ */
+template <typename T>
+QueryCondition set_membership_qc(
+    const std::string& field_name,
+    const std::vector<T>& values,
+    QueryConditionOp op) {
+  std::vector<uint64_t> offsets(values.size());
+  for (uint64_t i = 0; i < values.size(); ++i) {
+    offsets[i] = i * sizeof(T);
+  }
+
+  QueryCondition qc;
+  REQUIRE(qc.init(
+                std::string(field_name),
+                values.data(),
+                values.size() * sizeof(T),
+                offsets.data(),
+                offsets.size() * sizeof(uint64_t),
+                op)
+              .ok());
+  return qc;
+}
+
+TEST_CASE(
+    "QueryCondition: Test set membership",
+    "[QueryCondition][set_membership]") {
+  const std::string field_name = "foo";
+  const uint64_t cells = 10;
+  const bool nullable = GENERATE(true, false);
+
+  // Initialize the array schema.
+  shared_ptr<ArraySchema> array_schema = make_shared<ArraySchema>(HERE());
+  Attribute attr(field_name, Datatype::INT32);
+  attr.set_nullable(nullable);
+  REQUIRE(
+      array_schema->add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  REQUIRE(array_schema->set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // Initialize the result tile.
+  ResultTile::TileSizes tile_sizes(
+      cells * sizeof(int32_t),
+      0,
+      std::nullopt,
+      std::nullopt,
+      nullable ? std::optional(cells * constants::cell_validity_size) :
+                 std::nullopt,
+      nullable ? std::optional(0) : std::nullopt);
+  ResultTile result_tile(0, 0, *array_schema);
+  ResultTile::TileData tile_data{nullptr, nullptr, nullptr};
+  result_tile.init_attr_tile(
+      constants::format_version,
+      *array_schema,
+      field_name,
+      tile_sizes,
+      tile_data);
+  ResultTile::TileTuple* const tile_tuple = result_tile.tile_tuple(field_name);
+
+  // Populate the data tile with {0, 1, ..., 9}, and every other cell null
+  // for nullable attributes.
+  std::vector<int32_t> values(cells);
+  for (uint64_t i = 0; i < cells; ++i) {
+    values[i] = static_cast<int32_t>(i);
+  }
+  REQUIRE(tile_tuple->fixed_tile()
+              .write(values.data(), 0, cells * sizeof(int32_t))
+              .ok());
+  if (nullable) {
+    std::vector<uint8_t> validity(cells);
+    for (uint64_t i = 0; i < cells; ++i) {
+      validity[i] = i % 2;
+    }
+    REQUIRE(tile_tuple->validity_tile()
+                .write(validity.data(), 0, cells * sizeof(uint8_t))
+                .ok());
+  }
+
+  // Sets below and above the size at which lookups go through a hash set.
+  std::vector<int32_t> members;
+  std::vector<uint8_t> expected(cells, 0);
+  SECTION("Small set") {
+    members = {7, 42, 1, 3, 7};
+    expected = {0, 1, 0, 1, 0, 0, 0, 1, 0, 0};
+  }
+
+  SECTION("Large set") {
+    for (int32_t i = 0; i < 40; ++i) {
+      members.push_back(i % 4 == 0 ? i : -i);
+    }
+    expected = {1, 0, 0, 0, 1, 0, 0, 0, 1, 0};
+  }
+
+  // Null cells satisfy neither IN nor NOT_IN.
+  std::vector<uint8_t> neg_expected(cells);
+  for (uint64_t i = 0; i < cells; ++i) {
+    const bool null_cell = nullable && i % 2 == 0;
+    neg_expected[i] = !null_cell && !expected[i];
+    expected[i] = !null_cell && expected[i];
+  }
+
+  auto qc = set_membership_qc(field_name, members, QueryConditionOp::IN);
+  REQUIRE(qc.check(*array_schema).ok());
+  TestParams tp(&result_tile, qc, expected, neg_expected);
+  validate_qc_apply(tp, cells, array_schema, result_tile);
+  validate_qc_apply_sparse(tp, cells, array_schema, result_tile);
+  validate_qc_apply_dense(tp, cells, array_schema, result_tile);
+
+  // Combine with a regular comparison.
+  int32_t cmp_value = 5;
+  QueryCondition lt;
+  REQUIRE(lt.init(
+                std::string(field_name),
+                &cmp_value,
+                sizeof(int32_t),
+                QueryConditionOp::LT)
+              .ok());
+  QueryCondition combined;
+  REQUIRE(qc.combine(lt, QueryConditionCombinationOp::AND, &combined).ok());
+  std::vector<uint8_t> combined_expected(cells);
+  for (uint64_t i = 0; i < cells; ++i) {
+    combined_expected[i] = expected[i] && i < 5;
+  }
+  std::vector<uint8_t> result_bitmap(cells, 1);
+  REQUIRE(combined
+              .apply_sparse<uint8_t>(*array_schema, result_tile, result_bitmap)
+              .ok());
+  CHECK(result_bitmap == combined_expected);
+}
+
+TEST_CASE(
+    "QueryCondition: Test set membership on strings",
+    "[QueryCondition][set_membership][string]") {
+  const std::string field_name = "foo";
+  const uint64_t cells = 10;
+
+  // Initialize the array schema.
+  shared_ptr<ArraySchema> array_schema = make_shared<ArraySchema>(HERE());
+  Attribute attr(field_name, Datatype::STRING_ASCII);
+  attr.set_cell_val_num(constants::var_num);
+  REQUIRE(
+      array_schema->add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  Domain domain;
+  Dimension dim("dim1", Datatype::UINT32);
+  uint32_t bounds[2] = {1, cells};
+  Range range(bounds, 2 * sizeof(uint32_t));
+  REQUIRE(dim.set_domain(range).ok());
+  REQUIRE(domain.add_dimension(make_shared<Dimension>(HERE(), &dim)).ok());
+  REQUIRE(array_schema->set_domain(make_shared<Domain>(HERE(), &domain)).ok());
+
+  // Cell i holds i + 1 copies of the letter 'a' + i.
+  std::string data;
+  std::vector<uint64_t> offsets(cells);
+  for (uint64_t i = 0; i < cells; ++i) {
+    offsets[i] = data.size();
+    data += std::string(i + 1, static_cast<char>('a' + i));
+  }
+
+  // Initialize the result tile.
+  ResultTile::TileSizes tile_sizes(
+      cells * constants::cell_var_offset_size,
+      0,
+      data.size(),
+      0,
+      std::nullopt,
+      std::nullopt);
+  ResultTile result_tile(0, 0, *array_schema);
+  ResultTile::TileData tile_data{nullptr, nullptr, nullptr};
+  result_tile.init_attr_tile(
+      constants::format_version,
+      *array_schema,
+      field_name,
+      tile_sizes,
+      tile_data);
+  ResultTile::TileTuple* const tile_tuple = result_tile.tile_tuple(field_name);
+  REQUIRE(tile_tuple->var_tile().write(data.data(), 0, data.size()).ok());
+  REQUIRE(tile_tuple->fixed_tile()
+              .write(offsets.data(), 0, cells * sizeof(uint64_t))
+              .ok());
+
+  // Prefixes of cell values are not members.
+  std::string members = "bbddddcc";
+  std::vector<uint64_t> member_offsets = {0, 2, 6};
+  QueryCondition qc;
+  REQUIRE(qc.init(
+                std::string(field_name),
+                members.data(),
+                members.size(),
+                member_offsets.data(),
+                member_offsets.size() * sizeof(uint64_t),
+                QueryConditionOp::IN)
+              .ok());
+  REQUIRE(qc.check(*array_schema).ok());
+
+  std::vector<uint8_t> expected = {0, 1, 0, 1, 0, 0, 0, 0, 0, 0};
+  TestParams tp(&result_tile, qc, expected);
+  validate_qc_apply(tp, cells, array_schema, result_tile);
+  validate_qc_apply_sparse(tp, cells, array_schema, result_tile);
+  validate_qc_apply_dense(tp, cells, array_schema, result_tile);
+}
+
+TEST_CASE(
+    "QueryCondition: Test set membership errors",
+    "[QueryCondition][set_membership]") {
+  const std::string field_name = "foo";
+  int32_t value = 5;
+  uint64_t offset = 0;
+
+  // Set membership operators require a set and vice versa.
+  QueryCondition qc1;
+  CHECK(!qc1.init(
+                std::string(field_name),
+                &value,
+                sizeof(value),
+                QueryConditionOp::IN)
+             .ok());
+  QueryCondition qc2;
+  CHECK(!qc2.init(
+                std::string(field_name),
+                &value,
+                sizeof(value),
+                &offset,
+                sizeof(offset),
+                QueryConditionOp::EQ)
+             .ok());
+
+  // Offsets must be in bounds.
+  uint64_t bad_offset = sizeof(value) + 1;
+  QueryCondition qc3;
+  CHECK(!qc3.init(
+                std::string(field_name),
+                &value,
+                sizeof(value),
+                &bad_offset,
+                sizeof(bad_offset),
+                QueryConditionOp::IN)
+             .ok());
+
+  // Members must have the size of the attribute values.
+  shared_ptr<ArraySchema> array_schema = make_shared<ArraySchema>(HERE());
+  Attribute attr(field_name, Datatype::INT64);
+  REQUIRE(
+      array_schema->add_attribute(make_shared<Attribute>(HERE(), &attr)).ok());
+  QueryCondition qc4;
+  REQUIRE(qc4.init(
+                 std::string(field_name),
+                 &value,
+                 sizeof(value),
+                 &offset,
+                 sizeof(offset),
+                 QueryConditionOp::NOT_IN)
+              .ok());
+  CHECK(!qc4.check(*array_schema).ok());
+}
+
+/**
+ * @brief Checks the vectorized comparison kernel against scalar comparisons
+ * for all operators, on lengths that exercise the vector and scalar loops.
+ */
+template <typename T, QueryConditionOp Op>
+void check_qc_kernel(const std::vector<T>& values) {
+  for (uint64_t num = 0; num <= values.size(); num += 7) {
+    for (uint64_t r = 0; r < values.size(); r += 13) {
+      const T rhs = values[r];
+      // Run every kernel this CPU supports, not just the widest one.
+      std::vector<std::vector<uint8_t>> cmp_levels;
+      for (auto level :
+           {filter_kernels::SimdLevel::SCALAR,
+            filter_kernels::SimdLevel::SSE2,
+            filter_kernels::SimdLevel::AVX2,
+            filter_kernels::SimdLevel::AVX512}) {
+        cmp_levels.emplace_back(num);
+        qc_compare<T, Op>(
+            values.data(), num, rhs, cmp_levels.back().data(), level);
+      }
+
+      std::vector<uint8_t> validity(num);
+      std::vector<uint64_t> result_and(num, 2);
+      std::vector<uint64_t> result_or(num, 0);
+      for (uint64_t i = 0; i < num; ++i) {
+        validity[i] = i % 3 != 0;
+      }
+      qc_compare_combine<T, Op>(
+          values.data(),
+          num,
+          rhs,
+          validity.data(),
+          std::multiplies<uint64_t>(),
+          result_and.data());
+      qc_compare_combine<T, Op>(
+          values.data(),
+          num,
+          rhs,
+          nullptr,
+          std::logical_or<uint64_t>(),
+          result_or.data());
+
+      for (uint64_t i = 0; i < num; ++i) {
+        const bool expected = qc_scalar_cmp<Op>(values[i], rhs);
+        for (const auto& cmp : cmp_levels) {
+          CHECK(cmp[i] == expected);
+        }
+        CHECK(result_and[i] == (expected && validity[i] ? 2 : 0));
+        CHECK(result_or[i] == expected);
+      }
+    }
+  }
+}
+
+template <typename T>
+void check_qc_kernels() {
+  // Include the type limits so that unsigned comparisons cross the sign bit.
+  std::vector<T> values;
+  for (int i = 0; i < 300; ++i) {
+    if (i % 11 == 0) {
+      values.push_back(std::numeric_limits<T>::max());
+    } else if (i % 17 == 0) {
+      values.push_back(std::numeric_limits<T>::lowest());
+    } else {
+      values.push_back(static_cast<T>((i * 37) % 101 - 50));
+    }
+  }
+  if constexpr (std::is_floating_point_v<T>) {
+    values[5] = std::numeric_limits<T>::quiet_NaN();
+    values[6] = -0.0;
+  }
+
+  check_qc_kernel<T, QueryConditionOp::LT>(values);
+  check_qc_kernel<T, QueryConditionOp::LE>(values);
+  check_qc_kernel<T, QueryConditionOp::GT>(values);
+  check_qc_kernel<T, QueryConditionOp::GE>(values);
+  check_qc_kernel<T, QueryConditionOp::EQ>(values);
+  check_qc_kernel<T, QueryConditionOp::NE>(values);
+}
+
+TEST_CASE(
+    "QueryCondition: Test comparison kernels", "[QueryCondition][kernels]") {
+  check_qc_kernels<int8_t>();
+  check_qc_kernels<uint8_t>();
+  check_qc_kernels<int16_t>();
+  check_qc_kernels<uint16_t>();
+  check_qc_kernels<int32_t>();
+  check_qc_kernels<uint32_t>();
+  check_qc_kernels<int64_t>();
+  check_qc_kernels<uint64_t>();
+  check_qc_kernels<float>();
+  check_qc_kernels<double>();
+  check_qc_kernels<char>();
+}
@@ -85,6 +85,7 @@ GlobalOrderWriter::GlobalOrderWriter(
     std::vector<WrittenFragmentInfo>& written_fragment_info,
     bool disable_checks_consolidation,
     std::vector<std::string>& processed_conditions,
+    bool defer_commit,
     Query::CoordsInfo& coords_info,
     bool remote_query,
     optional<std::string> fragment_name,
@@ -105,6 +106,7 @@ GlobalOrderWriter::GlobalOrderWriter(
           fragment_name,
           skip_checks_serialization)
     , processed_conditions_(processed_conditions)
+    , defer_commit_(defer_commit)
     , fragment_size_(fragment_size)
     , current_fragment_size_(0) {
   // Check the layout is global order.
@@ -177,6 +179,12 @@ void GlobalOrderWriter::reset() {
   }
 }
 
+std::vector<URI> GlobalOrderWriter::created_fragment_uris() const {
+  auto uris = frag_uris_to_commit_;
+  uris.emplace_back(fragment_uri_);
+  return uris;
+}
+
 Status GlobalOrderWriter::alloc_global_write_state() {
   // Create global array state object
   if (global_write_state_ != nullptr)
@@ -709,6 +717,12 @@ Status GlobalOrderWriter::finalize_global_write_state() {
   }
   RETURN_NOT_OK(add_written_fragment_info(uri));
 
+  // The caller makes the written fragments visible.
+  if (defer_commit_) {
+    global_write_state_.reset(nullptr);
+    return st;
+  }
+
   // The following will make the fragment visible
   URI commit_uri = array_->array_directory().get_commit_uri(uri);
 
@@ -787,7 +801,20 @@ Status GlobalOrderWriter::global_write() {
   // Compute tile metadata.
   RETURN_CANCEL_OR_ERROR(compute_tiles_metadata(tile_num, tiles));
 
-  // Filter all tiles
+  // Without a fragment size limit all the tiles go to the current fragment,
+  // so filtering can overlap with writing.
+  if (fragment_size_ == std::numeric_limits<uint64_t>::max()) {
+    auto frag_meta = global_write_state_->frag_meta_;
+    auto new_num_tiles = frag_meta->tile_index_base() + tile_num;
+    throw_if_not_ok(frag_meta->set_num_tiles(new_num_tiles));
+    set_coords_metadata(0, tile_num, tiles, mbrs, frag_meta);
+    RETURN_CANCEL_OR_ERROR(
+        filter_and_write_tiles(0, tile_num, frag_meta, &tiles));
+    frag_meta->set_tile_index_base(new_num_tiles);
+    return Status::Ok();
+  }
+
+  // Filter all tiles, as their filtered sizes determine the fragment splits
   RETURN_CANCEL_OR_ERROR(filter_tiles(&tiles));
 
   uint64_t idx = 0;
@@ -118,6 +118,7 @@ class GlobalOrderWriter : public WriterBase {
       std::vector<WrittenFragmentInfo>& written_fragment_info,
       bool disable_checks_consolidation,
       std::vector<std::string>& processed_conditions,
+      bool defer_commit,
       Query::CoordsInfo& coords_info_,
       bool remote_query,
       optional<std::string> fragment_name = nullopt,
@@ -151,6 +152,12 @@ class GlobalOrderWriter : public WriterBase {
   /** Returns a bare pointer to the global state. */
   GlobalWriteState* get_global_state();
 
+  /**
+   * Returns the URIs of all the fragments this writer created so far,
+   * including the one being written, whether they are committed or not.
+   */
+  std::vector<URI> created_fragment_uris() const;
+
   /**
    * Used in serialization to share the multipart upload state
    * among cloud executors
@@ -197,6 +204,12 @@ class GlobalOrderWriter : public WriterBase {
    */
   std::vector<URI> frag_uris_to_commit_;
 
+  /**
+   * If `true`, the written fragments are not committed upon finalization,
+   * and the caller commits them.
+   */
+  bool defer_commit_;
+
   /**
    * The desired fragment size, in bytes. The writer will create a new fragment
    * once this size has been reached.
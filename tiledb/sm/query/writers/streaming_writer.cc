@@ -0,0 +1,443 @@
+/**
+ * @file   streaming_writer.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class StreamingWriter.
+ */
+
+#include "tiledb/sm/query/writers/streaming_writer.h"
+#include "tiledb/common/common.h"
+#include "tiledb/common/logger.h"
+#include "tiledb/sm/array/array.h"
+#include "tiledb/sm/array_schema/array_schema.h"
+#include "tiledb/sm/array_schema/dimension.h"
+#include "tiledb/sm/crypto/encryption_key.h"
+#include "tiledb/sm/enums/datatype.h"
+#include "tiledb/sm/misc/tdb_math.h"
+#include "tiledb/sm/misc/tdb_time.h"
+#include "tiledb/sm/query/writers/unordered_writer.h"
+#include "tiledb/sm/stats/global_stats.h"
+#include "tiledb/sm/storage_manager/storage_manager.h"
+#include "tiledb/storage_format/uri/generate_uri.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace tiledb;
+using namespace tiledb::common;
+using namespace tiledb::sm::stats;
+
+namespace tiledb {
+namespace sm {
+
+class StreamingWriterStatusException : public StatusException {
+ public:
+  explicit StreamingWriterStatusException(const std::string& message)
+      : StatusException("StreamingWriter", message) {
+  }
+};
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+StreamingWriter::StreamingWriter(
+    stats::Stats* stats,
+    shared_ptr<Logger> logger,
+    StorageManager* storage_manager,
+    Array* array,
+    Config& config,
+    std::unordered_map<std::string, QueryBuffer>& buffers,
+    Subarray& subarray,
+    Layout layout,
+    std::vector<WrittenFragmentInfo>& written_fragment_info,
+    Query::CoordsInfo& coords_info,
+    bool remote_query,
+    optional<std::string> fragment_name,
+    bool skip_checks_serialization)
+    : WriterBase(
+          stats,
+          logger,
+          storage_manager,
+          array,
+          config,
+          buffers,
+          subarray,
+          layout,
+          written_fragment_info,
+          false,
+          coords_info,
+          remote_query,
+          fragment_name,
+          skip_checks_serialization)
+    , run_array_(array)
+    , run_budget_(0)
+    , merge_runs_(false)
+    , run_(make_shared<Run>(HERE()))
+    , flush_task_(nullopt)
+    , last_timestamp_(0)
+    , run_stats_(stats_->create_child("Run")) {
+  // Check the layout is unordered.
+  if (layout != Layout::UNORDERED) {
+    throw StreamingWriterStatusException(
+        "Failed to initialize StreamingWriter; The streaming writer does not "
+        "support layout " +
+        layout_str(layout));
+  }
+
+  // Check the array is sparse.
+  if (array_schema_.dense()) {
+    throw StreamingWriterStatusException(
+        "Failed to initialize StreamingWriter; The streaming writer does not "
+        "support dense arrays.");
+  }
+
+  // Check no ordered attributes.
+  if (array_schema_.has_ordered_attributes()) {
+    throw StreamingWriterStatusException(
+        "Failed to initialize StreamingWriter; The streaming writer does not "
+        "support ordered attributes.");
+  }
+
+  // Runs are written locally, so remote arrays are not supported.
+  if (array_->is_remote() || remote_query) {
+    throw StreamingWriterStatusException(
+        "Failed to initialize StreamingWriter; The streaming writer does not "
+        "support remote arrays.");
+  }
+
+  // Each run is written in one pass, so all buffers are needed at once.
+  bool found = false;
+  bool allow_separate_attribute_writes = false;
+  throw_if_not_ok(config_.get<bool>(
+      "sm.allow_separate_attribute_writes",
+      &allow_separate_attribute_writes,
+      &found));
+  assert(found);
+  if (allow_separate_attribute_writes) {
+    throw StreamingWriterStatusException(
+        "Failed to initialize StreamingWriter; The streaming writer does not "
+        "support separate attribute writes.");
+  }
+
+  // A run takes a quarter of the memory budget, so that the run being filled
+  // and the run being written, sorted and filtered fit within the budget.
+  uint64_t memory_budget = 0;
+  throw_if_not_ok(
+      config_.get<uint64_t>("sm.mem.total_budget", &memory_budget, &found));
+  assert(found);
+  run_budget_ = std::max<uint64_t>(memory_budget / 4, 1);
+
+  throw_if_not_ok(config_.get<bool>(
+      "sm.query.sparse_unordered.merge_runs", &merge_runs_, &found));
+  assert(found);
+
+  for (unsigned d = 0; d < array_schema_.dim_num(); d++) {
+    names_.emplace_back(array_schema_.dimension_ptr(d)->name());
+  }
+  for (const auto& attr : array_schema_.attributes()) {
+    names_.emplace_back(attr->name());
+  }
+}
+
+StreamingWriter::~StreamingWriter() {
+  // The run being written references this object.
+  if (flush_task_.has_value() && flush_task_->valid()) {
+    flush_task_->wait();
+  }
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+Status StreamingWriter::dowork() {
+  get_dim_attr_stats();
+
+  auto timer_se = stats_->start_timer("dowork");
+
+  // In case the user has provided a coordinates buffer
+  RETURN_NOT_OK(split_coords_buffer());
+
+  if (check_coord_oob_) {
+    RETURN_NOT_OK(check_coord_oob());
+  }
+
+  // Estimate the average size of a buffered cell, counting var-sized
+  // offsets as they are stored in the run.
+  const uint64_t cell_num = coords_info_.coords_num_;
+  uint64_t size = 0;
+  for (const auto& name : names_) {
+    auto it = buffers_.find(name);
+    if (it == buffers_.end()) {
+      throw StreamingWriterStatusException(
+          "Cannot write; Buffer " + name + " is not set");
+    }
+
+    const auto& buff = it->second;
+    if (array_schema_.var_size(name)) {
+      size += cell_num * constants::cell_var_offset_size;
+      size += *buff.buffer_var_size_;
+    } else {
+      size += *buff.buffer_size_;
+    }
+    if (array_schema_.is_nullable(name)) {
+      size += cell_num;
+    }
+  }
+  const uint64_t cell_size = std::max<uint64_t>(
+      cell_num == 0 ? 1 : utils::math::ceil(size, cell_num), 1);
+
+  // Buffer the cells, writing every run as soon as it is full.
+  for (uint64_t cell = 0; cell < cell_num;) {
+    const uint64_t n = cells_to_append(cell, cell_num, cell_size);
+    append_cells(cell, cell + n);
+    cell += n;
+
+    if (run_->size_ >= run_budget_) {
+      RETURN_NOT_OK(flush_run());
+    }
+  }
+
+  stats_->add_counter("cell_num", cell_num);
+
+  return Status::Ok();
+}
+
+Status StreamingWriter::finalize() {
+  auto timer_se = stats_->start_timer("finalize");
+
+  RETURN_NOT_OK(flush_run());
+  RETURN_NOT_OK(wait_for_flush());
+
+  // The generated run timestamps may run ahead of the clock when runs are
+  // written within the same millisecond. Wait for the clock to pass them, so
+  // that the runs are visible to the arrays opened after finalizing.
+  while (utils::time::timestamp_now_ms() < last_timestamp_) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  if (!merge_runs_ || run_fragment_names_.size() < 2) {
+    return Status::Ok();
+  }
+
+  auto timer_merge = stats_->start_timer("merge_runs");
+  const auto& encryption_key = array_->get_encryption_key();
+  auto key = encryption_key.key();
+  return storage_manager_->fragments_consolidate(
+      array_->array_uri().c_str(),
+      encryption_key.encryption_type(),
+      key.data(),
+      static_cast<uint32_t>(key.size()),
+      run_fragment_names_,
+      config_);
+}
+
+void StreamingWriter::reset() {
+}
+
+/* ****************************** */
+/*        PRIVATE METHODS         */
+/* ****************************** */
+
+uint64_t StreamingWriter::cells_to_append(
+    uint64_t cell, uint64_t cell_num, uint64_t cell_size) const {
+  const uint64_t available =
+      run_budget_ > run_->size_ ? run_budget_ - run_->size_ : 0;
+  return std::clamp<uint64_t>(available / cell_size, 1, cell_num - cell);
+}
+
+void StreamingWriter::append_cells(uint64_t start, uint64_t end) {
+  const uint64_t cell_num = coords_info_.coords_num_;
+  const uint64_t n = end - start;
+  for (const auto& name : names_) {
+    const auto& buff = buffers_.at(name);
+    auto& field = run_->fields_[name];
+    const uint64_t field_size =
+        field.fixed_.size() + field.var_.size() + field.validity_.size();
+
+    if (array_schema_.var_size(name)) {
+      // Rebase the offsets of the cells on the end of the buffered values.
+      const uint64_t datasize = datatype_size(array_schema_.type(name));
+      auto offset = [&](uint64_t c) {
+        return c < cell_num ? prepare_buffer_offset(buff.buffer_, c, datasize) :
+                              *buff.buffer_var_size_;
+      };
+      const uint64_t var_start = offset(start);
+      const uint64_t var_end = offset(end);
+      const uint64_t base = field.var_.size();
+
+      const uint64_t offsets_size = field.fixed_.size();
+      field.fixed_.resize(offsets_size + n * constants::cell_var_offset_size);
+      auto offsets = reinterpret_cast<uint64_t*>(&field.fixed_[offsets_size]);
+      for (uint64_t i = 0; i < n; i++) {
+        offsets[i] = base + offset(start + i) - var_start;
+      }
+
+      auto var = static_cast<const uint8_t*>(buff.buffer_var_);
+      field.var_.insert(field.var_.end(), var + var_start, var + var_end);
+    } else {
+      const uint64_t cell_size = array_schema_.cell_size(name);
+      auto fixed = static_cast<const uint8_t*>(buff.buffer_);
+      field.fixed_.insert(
+          field.fixed_.end(),
+          fixed + start * cell_size,
+          fixed + end * cell_size);
+    }
+
+    if (array_schema_.is_nullable(name)) {
+      auto validity = buff.validity_vector_.buffer();
+      field.validity_.insert(
+          field.validity_.end(), validity + start, validity + end);
+    }
+
+    run_->size_ += field.fixed_.size() + field.var_.size() +
+                   field.validity_.size() - field_size;
+  }
+
+  run_->cell_num_ += n;
+}
+
+Status StreamingWriter::flush_run() {
+  if (run_->cell_num_ == 0) {
+    return Status::Ok();
+  }
+
+  // Hold at most two runs in memory: this one and the one being written.
+  RETURN_NOT_OK(wait_for_flush());
+
+  // Give the runs strictly increasing timestamps, so that later cells win
+  // over earlier ones with the same coordinates.
+  optional<std::string> fragment_name = nullopt;
+  if (array_->timestamp_end_opened_at() == 0) {
+    last_timestamp_ =
+        std::max(utils::time::timestamp_now_ms(), last_timestamp_ + 1);
+    fragment_name = storage_format::generate_fragment_name(
+        last_timestamp_, array_->array_schema_latest().write_version());
+  }
+
+  auto run = std::move(run_);
+  run_ = make_shared<Run>(HERE());
+  stats_->add_counter("run_num", 1);
+
+  flush_task_ = storage_manager_->compute_tp()->execute(
+      [this, run, fragment_name]() { return write_run(*run, fragment_name); });
+
+  return Status::Ok();
+}
+
+Status StreamingWriter::wait_for_flush() {
+  if (!flush_task_.has_value()) {
+    return Status::Ok();
+  }
+
+  auto task = std::move(flush_task_.value());
+  flush_task_ = nullopt;
+  task.wait();
+  RETURN_NOT_OK(task.get());
+
+  for (auto& info : flushed_fragment_info_) {
+    run_fragment_names_.emplace_back(info.uri_.last_path_part());
+    written_fragment_info_.emplace_back(std::move(info));
+  }
+  flushed_fragment_info_.clear();
+
+  return Status::Ok();
+}
+
+Status StreamingWriter::write_run(
+    Run& run, optional<std::string> fragment_name) {
+  auto timer_se = run_stats_->start_timer("write_run");
+
+  // Point query buffers at the cells of the run.
+  std::unordered_map<std::string, QueryBuffer> buffers;
+  for (const auto& name : names_) {
+    auto& field = run.fields_[name];
+    field.fixed_size_ = field.fixed_.size();
+    field.var_size_ = field.var_.size();
+    field.validity_size_ = field.validity_.size();
+
+    const bool var_size = array_schema_.var_size(name);
+    void* buffer_var = var_size ? field.var_.data() : nullptr;
+    uint64_t* buffer_var_size = var_size ? &field.var_size_ : nullptr;
+    if (array_schema_.is_nullable(name)) {
+      buffers.emplace(
+          name,
+          QueryBuffer(
+              field.fixed_.data(),
+              buffer_var,
+              &field.fixed_size_,
+              buffer_var_size,
+              ValidityVector(field.validity_.data(), &field.validity_size_)));
+    } else {
+      buffers.emplace(
+          name,
+          QueryBuffer(
+              field.fixed_.data(),
+              buffer_var,
+              &field.fixed_size_,
+              buffer_var_size));
+    }
+  }
+
+  Query::CoordsInfo coords_info;
+  coords_info.has_coords_ = true;
+  coords_info.coords_buffer_ = nullptr;
+  coords_info.coords_buffer_size_ = nullptr;
+  coords_info.coords_num_ = run.cell_num_;
+
+  // The run stores byte offsets without an extra element, and its
+  // coordinates were already checked on submission.
+  Config config(config_);
+  throw_if_not_ok(config.set("sm.var_offsets.mode", "bytes"));
+  throw_if_not_ok(config.set("sm.var_offsets.bitsize", "64"));
+  throw_if_not_ok(config.set("sm.var_offsets.extra_element", "false"));
+  throw_if_not_ok(config.set("sm.check_coord_oob", "false"));
+
+  Subarray subarray(array_, Layout::UNORDERED, run_stats_, logger_);
+  std::unordered_set<std::string> written_buffers;
+  UnorderedWriter writer(
+      run_stats_,
+      logger_,
+      storage_manager_,
+      run_array_,
+      config,
+      buffers,
+      subarray,
+      Layout::UNORDERED,
+      flushed_fragment_info_,
+      coords_info,
+      written_buffers,
+      false,
+      fragment_name);
+  return writer.dowork();
+}
+
+}  // namespace sm
+}  // namespace tiledb
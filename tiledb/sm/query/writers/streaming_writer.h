@@ -0,0 +1,226 @@
+/**
+ * @file   streaming_writer.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class StreamingWriter.
+ */
+
+#ifndef TILEDB_STREAMING_WRITER_H
+#define TILEDB_STREAMING_WRITER_H
+
+#include <optional>
+
+#include "tiledb/common/common.h"
+#include "tiledb/common/status.h"
+#include "tiledb/common/thread_pool.h"
+#include "tiledb/sm/query/writers/writer_base.h"
+
+using namespace tiledb::common;
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * Processes sparse unordered write queries whose cells arrive over many
+ * submissions. The submitted cells are copied into an in-memory run; once a
+ * run reaches its share of the memory budget it is sorted and written as a
+ * fragment in the background by an `UnorderedWriter`, while the next run is
+ * being filled. At most two runs are held in memory at any time.
+ *
+ * Cells with the same coordinates that land in different runs are kept in
+ * both fragments. If the array was opened without a timestamp the runs get
+ * strictly increasing fragment timestamps, so the later cells win on read;
+ * otherwise their order is undefined.
+ */
+class StreamingWriter : public WriterBase {
+ public:
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /** Constructor. */
+  StreamingWriter(
+      stats::Stats* stats,
+      shared_ptr<Logger> logger,
+      StorageManager* storage_manager,
+      Array* array,
+      Config& config,
+      std::unordered_map<std::string, QueryBuffer>& buffers,
+      Subarray& subarray,
+      Layout layout,
+      std::vector<WrittenFragmentInfo>& written_fragment_info,
+      Query::CoordsInfo& coords_info,
+      bool remote_query,
+      optional<std::string> fragment_name = nullopt,
+      bool skip_checks_serialization = false);
+
+  /** Destructor. Waits for the run being written, if any. */
+  ~StreamingWriter();
+
+  DISABLE_COPY_AND_COPY_ASSIGN(StreamingWriter);
+  DISABLE_MOVE_AND_MOVE_ASSIGN(StreamingWriter);
+
+  /* ********************************* */
+  /*                 API               */
+  /* ********************************* */
+
+  /**
+   * Buffers the cells of the user buffers, writing every run that fills up
+   * in the background.
+   */
+  Status dowork();
+
+  /**
+   * Writes the last run and waits for all runs to be written. If
+   * `sm.query.sparse_unordered.merge_runs` is set, the fragments of the runs
+   * are then consolidated into one.
+   */
+  Status finalize();
+
+  /** Resets the writer object, rendering it incomplete. */
+  void reset();
+
+ private:
+  /* ********************************* */
+  /*          PRIVATE DATATYPES        */
+  /* ********************************* */
+
+  /** The buffered cells of a dimension or attribute. */
+  struct RunField {
+    /**
+     * The fixed-sized values, or the `uint64_t` byte offsets of the
+     * var-sized values.
+     */
+    std::vector<uint8_t> fixed_;
+
+    /** The var-sized values. */
+    std::vector<uint8_t> var_;
+
+    /** The validity values. */
+    std::vector<uint8_t> validity_;
+
+    /** The sizes handed to the query buffers of the run writer. */
+    uint64_t fixed_size_ = 0;
+    uint64_t var_size_ = 0;
+    uint64_t validity_size_ = 0;
+  };
+
+  /** A run of buffered cells, written as one fragment. */
+  struct Run {
+    /** The buffered cells, per dimension and attribute name. */
+    std::unordered_map<std::string, RunField> fields_;
+
+    /** The number of buffered cells. */
+    uint64_t cell_num_ = 0;
+
+    /** The number of buffered bytes. */
+    uint64_t size_ = 0;
+  };
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** The array, as handed to the writers of the runs. */
+  Array* run_array_;
+
+  /** The names of the dimensions and attributes, in schema order. */
+  std::vector<std::string> names_;
+
+  /** The number of bytes at which a run is written. */
+  uint64_t run_budget_;
+
+  /** Whether to consolidate the fragments of the runs on finalize. */
+  bool merge_runs_;
+
+  /** The run being filled. */
+  shared_ptr<Run> run_;
+
+  /** The task writing the previous run, if any. */
+  std::optional<ThreadPool::Task> flush_task_;
+
+  /** The fragment info of the run written by `flush_task_`. */
+  std::vector<WrittenFragmentInfo> flushed_fragment_info_;
+
+  /** The fragment names of the runs written so far. */
+  std::vector<std::string> run_fragment_names_;
+
+  /** The timestamp of the last generated run fragment name, if any. */
+  uint64_t last_timestamp_;
+
+  /** The stats of the run writers. */
+  stats::Stats* run_stats_;
+
+  /* ********************************* */
+  /*           PRIVATE METHODS         */
+  /* ********************************* */
+
+  /**
+   * Returns the number of cells, starting at `cell`, that can be appended to
+   * the current run without exceeding the run budget. Always at least one.
+   *
+   * @param cell The first cell to append.
+   * @param cell_num The number of cells in the user buffers.
+   * @param cell_size The average size of a cell in the user buffers.
+   */
+  uint64_t cells_to_append(
+      uint64_t cell, uint64_t cell_num, uint64_t cell_size) const;
+
+  /**
+   * Copies cells `[start, end)` of the user buffers into the current run.
+   * Var-sized offsets are stored as `uint64_t` bytes offsets without an extra
+   * element, whatever the offsets configuration of the query.
+   */
+  void append_cells(uint64_t start, uint64_t end);
+
+  /**
+   * Waits for the previous run to be written, then starts writing the
+   * current run in the background and starts a new run. Does nothing if the
+   * current run is empty.
+   */
+  Status flush_run();
+
+  /**
+   * Waits for the run being written, if any, and records its fragment.
+   */
+  Status wait_for_flush();
+
+  /**
+   * Writes a run as one fragment with an `UnorderedWriter`. Runs on the
+   * compute thread pool.
+   *
+   * @param run The run to write.
+   * @param fragment_name The fragment name to use, if any.
+   */
+  Status write_run(Run& run, optional<std::string> fragment_name);
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_STREAMING_WRITER_H
@@ -68,6 +68,145 @@ class UnorderWriterStatusException : public StatusException {
   }
 };
 
+/* ****************************** */
+/*             HELPERS            */
+/* ****************************** */
+
+/**
+ * Calls `fn` with a default value of the C++ type of a dimension datatype
+ * that has integral values, and returns its result. Returns `false` for the
+ * other datatypes.
+ */
+template <class Fn>
+static bool apply_with_integral_type(const Datatype type, Fn&& fn) {
+  switch (type) {
+    case Datatype::INT8:
+      return fn(int8_t{});
+    case Datatype::UINT8:
+      return fn(uint8_t{});
+    case Datatype::INT16:
+      return fn(int16_t{});
+    case Datatype::UINT16:
+      return fn(uint16_t{});
+    case Datatype::INT32:
+      return fn(int32_t{});
+    case Datatype::UINT32:
+      return fn(uint32_t{});
+    case Datatype::INT64:
+      return fn(int64_t{});
+    case Datatype::UINT64:
+      return fn(uint64_t{});
+    case Datatype::DATETIME_YEAR:
+    case Datatype::DATETIME_MONTH:
+    case Datatype::DATETIME_WEEK:
+    case Datatype::DATETIME_DAY:
+    case Datatype::DATETIME_HR:
+    case Datatype::DATETIME_MIN:
+    case Datatype::DATETIME_SEC:
+    case Datatype::DATETIME_MS:
+    case Datatype::DATETIME_US:
+    case Datatype::DATETIME_NS:
+    case Datatype::DATETIME_PS:
+    case Datatype::DATETIME_FS:
+    case Datatype::DATETIME_AS:
+    case Datatype::TIME_HR:
+    case Datatype::TIME_MIN:
+    case Datatype::TIME_SEC:
+    case Datatype::TIME_MS:
+    case Datatype::TIME_US:
+    case Datatype::TIME_NS:
+    case Datatype::TIME_PS:
+    case Datatype::TIME_FS:
+    case Datatype::TIME_AS:
+      return fn(int64_t{});
+    default:
+      return false;
+  }
+}
+
+/** Returns the number of bits needed to represent `v`. */
+static unsigned bit_width(uint64_t v) {
+  unsigned bits = 0;
+  for (; v != 0; v >>= 1) {
+    ++bits;
+  }
+  return bits;
+}
+
+/**
+ * The bit widths of the tile index and of the in-tile offset of the
+ * coordinates of a dimension, within a global order key.
+ */
+struct GlobalOrderKeyWidths {
+  unsigned tile_bits_;
+  unsigned cell_bits_;
+};
+
+/** Returns the global order key widths of an integral dimension. */
+template <class T>
+static GlobalOrderKeyWidths global_order_key_widths(const Dimension& dim) {
+  typedef typename std::make_unsigned<T>::type unsigned_t;
+  auto domain = (const T*)dim.domain().data();
+  const uint64_t range = static_cast<unsigned_t>(
+      static_cast<unsigned_t>(domain[1]) -
+      static_cast<unsigned_t>(domain[0]));
+  if (!dim.tile_extent()) {
+    return {0, bit_width(range)};
+  }
+
+  const uint64_t extent =
+      static_cast<unsigned_t>(*(const T*)dim.tile_extent().data());
+  return {bit_width(range / extent), bit_width(std::min(extent - 1, range))};
+}
+
+/**
+ * Adds the tile index and the in-tile offset of the coordinates of an
+ * integral dimension to the global order keys of all cells.
+ *
+ * @return `false` if a coordinate is out of the domain.
+ */
+template <class T>
+static bool add_global_order_key_parts(
+    ThreadPool* const tp,
+    const Dimension& dim,
+    const QueryBuffer& buffer,
+    const GlobalOrderKeyWidths& widths,
+    const unsigned tile_shift,
+    const unsigned cell_shift,
+    std::vector<uint64_t>& keys) {
+  typedef typename std::make_unsigned<T>::type unsigned_t;
+  auto coords = static_cast<const T*>(buffer.buffer_);
+  auto domain = (const T*)dim.domain().data();
+  const uint64_t extent =
+      dim.tile_extent() ?
+          static_cast<unsigned_t>(*(const T*)dim.tile_extent().data()) :
+          0;
+  std::atomic<bool> in_domain = true;
+  throw_if_not_ok(parallel_for(tp, 0, keys.size(), [&](uint64_t c) {
+    if (coords[c] < domain[0] || coords[c] > domain[1]) {
+      in_domain = false;
+      return Status::Ok();
+    }
+
+    uint64_t offset = static_cast<unsigned_t>(
+        static_cast<unsigned_t>(coords[c]) -
+        static_cast<unsigned_t>(domain[0]));
+    if (extent != 0) {
+      if (widths.tile_bits_ != 0) {
+        keys[c] |= (offset / extent) << tile_shift;
+      }
+      offset %= extent;
+    }
+    if (widths.cell_bits_ != 0) {
+      keys[c] |= offset << cell_shift;
+    }
+
+    return Status::Ok();
+  }));
+
+  return in_domain;
+}
+
 /* ****************************** */
 /*   CONSTRUCTORS & DESTRUCTORS   */
 /* ****************************** */
@@ -602,6 +741,75 @@ Status UnorderedWriter::prepare_tiles_var(
   return Status::Ok();
 }
 
+bool UnorderedWriter::compute_global_order_keys(
+    const DomainBuffersView& domain_buffers,
+    std::vector<uint64_t>& keys,
+    unsigned& key_bits) const {
+  const Domain& domain = array_schema_.domain();
+  const unsigned dim_num = domain.dim_num();
+
+  // Compute the key widths of every dimension.
+  std::vector<GlobalOrderKeyWidths> widths(dim_num);
+  unsigned total_bits = 0;
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{domain.dimension_ptr(d)};
+    if (dim->var_size()) {
+      return false;
+    }
+
+    auto integral = apply_with_integral_type(dim->type(), [&](auto t) {
+      using T = decltype(t);
+      widths[d] = global_order_key_widths<T>(*dim);
+      return true;
+    });
+    if (!integral) {
+      return false;
+    }
+    total_bits += widths[d].tile_bits_ + widths[d].cell_bits_;
+  }
+  if (total_bits > 64) {
+    return false;
+  }
+
+  // Lay out the key from its least significant bits: the in-tile offsets in
+  // cell order, then the tile indices in tile order.
+  std::vector<unsigned> tile_shifts(dim_num);
+  std::vector<unsigned> cell_shifts(dim_num);
+  key_bits = 0;
+  for (unsigned i = 0; i < dim_num; ++i) {
+    auto d = domain.cell_order() == Layout::ROW_MAJOR ? dim_num - 1 - i : i;
+    cell_shifts[d] = key_bits;
+    key_bits += widths[d].cell_bits_;
+  }
+  for (unsigned i = 0; i < dim_num; ++i) {
+    auto d = domain.tile_order() == Layout::ROW_MAJOR ? dim_num - 1 - i : i;
+    tile_shifts[d] = key_bits;
+    key_bits += widths[d].tile_bits_;
+  }
+
+  // Compute the keys.
+  keys.assign(coords_info_.coords_num_, 0);
+  for (unsigned d = 0; d < dim_num; ++d) {
+    auto dim{domain.dimension_ptr(d)};
+    auto in_domain = apply_with_integral_type(dim->type(), [&](auto t) {
+      using T = decltype(t);
+      return add_global_order_key_parts<T>(
+          storage_manager_->compute_tp(),
+          *dim,
+          *domain_buffers[d],
+          widths[d],
+          tile_shifts[d],
+          cell_shifts[d],
+          keys);
+    });
+    if (!in_domain) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 Status UnorderedWriter::sort_coords() {
   auto timer_se = stats_->start_timer("sort_coords");
 
@@ -610,24 +818,48 @@ Status UnorderedWriter::sort_coords() {
   for (uint64_t i = 0; i < coords_info_.coords_num_; ++i)
     cell_pos_[i] = i;
 
-  // Sort the coordinates in global order
+  // Sort the coordinates in global order. Whenever the coordinates can be
+  // mapped to integer keys that preserve the order, radix sort the keys
+  // instead of comparing the coordinates.
   auto cell_order = array_schema_.cell_order();
   const Domain& domain = array_schema_.domain();
   DomainBuffersView domain_buffs{array_schema_, buffers_};
+  std::vector<uint64_t> keys;
+  unsigned key_bits = 0;
   if (cell_order != Layout::HILBERT) {  // Row- or col-major
-    parallel_sort(
-        storage_manager_->compute_tp(),
-        cell_pos_.begin(),
-        cell_pos_.end(),
-        GlobalCmpQB(domain, domain_buffs));
+    if (compute_global_order_keys(domain_buffs, keys, key_bits)) {
+      parallel_radix_sort(
+          storage_manager_->compute_tp(), keys, cell_pos_, key_bits);
+    } else {
+      parallel_sort(
+          storage_manager_->compute_tp(),
+          cell_pos_.begin(),
+          cell_pos_.end(),
+          GlobalCmpQB(domain, domain_buffs));
+    }
   } else {  // Hilbert order
     std::vector<uint64_t> hilbert_values(coords_info_.coords_num_);
     RETURN_NOT_OK(calculate_hilbert_values(domain_buffs, hilbert_values));
-    parallel_sort(
-        storage_manager_->compute_tp(),
-        cell_pos_.begin(),
-        cell_pos_.end(),
-        HilbertCmpQB(domain, domain_buffs, hilbert_values));
+    HilbertCmpQB cmp(domain, domain_buffs, hilbert_values);
+
+    // Sort on the Hilbert values, then order the cells that share a Hilbert
+    // value on their coordinates.
+    keys = hilbert_values;
+    Hilbert h(array_schema_.dim_num());
+    key_bits = h.bits() * array_schema_.dim_num();
+    parallel_radix_sort(
+        storage_manager_->compute_tp(), keys, cell_pos_, key_bits);
+    uint64_t start = 0;
+    while (start < keys.size()) {
+      uint64_t end = start + 1;
+      while (end < keys.size() && keys[end] == keys[start]) {
+        ++end;
+      }
+      if (end - start > 1) {
+        std::sort(cell_pos_.begin() + start, cell_pos_.begin() + end, cmp);
+      }
+      start = end;
+    }
   }
 
   return Status::Ok();
@@ -701,11 +933,9 @@ Status UnorderedWriter::unordered_write() {
   // Compute tile metadata.
   RETURN_CANCEL_OR_ERROR(compute_tiles_metadata(tile_num, tiles));
 
-  // Filter all tiles
-  RETURN_CANCEL_OR_ERROR(filter_tiles(&tiles));
-
-  // Write tiles for all attributes and coordinates
-  RETURN_CANCEL_OR_ERROR(write_tiles(0, tile_num, frag_meta_, &tiles));
+  // Filter and write tiles for all attributes and coordinates
+  RETURN_CANCEL_OR_ERROR(
+      filter_and_write_tiles(0, tile_num, frag_meta_, &tiles));
 
   // Add the written buffers to the list.
   for (const auto& it : buffers_) {
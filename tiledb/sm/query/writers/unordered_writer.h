@@ -190,6 +190,22 @@ class UnorderedWriter : public WriterBase {
   Status prepare_tiles_var(
       const std::string& name, WriterTileTupleVector* tiles) const;
 
+  /**
+   * Computes a key for every cell whose integer order is the global order
+   * of the coordinates. This is possible when all dimensions are integral
+   * and their tile indices and in-tile offsets fit together in 64 bits.
+   *
+   * @param domain_buffers The coordinate buffers.
+   * @param keys Set to the key of every cell.
+   * @param key_bits Set to the number of low-order bits used by the keys.
+   * @return `false` if the coordinates cannot be keyed, in which case they
+   *     must be sorted with the global order comparator.
+   */
+  bool compute_global_order_keys(
+      const DomainBuffersView& domain_buffers,
+      std::vector<uint64_t>& keys,
+      unsigned& key_bits) const;
+
   /**
    * Sorts the coordinates of the user buffers, creating a vector with
    * the sorted positions.
@@ -178,6 +178,16 @@ WriterBase::WriterBase(
   }
   assert(found);
 
+  if (!config_
+           .get<bool>(
+               "sm.single_chunk_unfiltered_tiles",
+               &single_chunk_unfiltered_tiles_,
+               &found)
+           .ok()) {
+    throw WriterBaseStatusException("Cannot get setting");
+  }
+  assert(found);
+
   if (offsets_bitsize_ != 32 && offsets_bitsize_ != 64) {
     throw WriterBaseStatusException(
         "Cannot initialize writer; Unsupported offsets bitsize in "
@@ -830,8 +840,8 @@ Status WriterBase::filter_tiles(
       storage_manager_->compute_tp(), 0, tiles->size(), [&](uint64_t i) {
         auto tiles_it = tiles->begin();
         std::advance(tiles_it, i);
-        RETURN_CANCEL_OR_ERROR(
-            filter_tiles(tiles_it->first, &tiles_it->second));
+        RETURN_CANCEL_OR_ERROR(filter_tiles(
+            tiles_it->first, &tiles_it->second, 0, tiles_it->second.size()));
         return Status::Ok();
       });
 
@@ -840,17 +850,21 @@ Status WriterBase::filter_tiles(
 }
 
 Status WriterBase::filter_tiles(
-    const std::string& name, WriterTileTupleVector* tiles) {
+    const std::string& name,
+    WriterTileTupleVector* tiles,
+    const uint64_t start_tile_idx,
+    const uint64_t end_tile_idx) {
   const bool var_size = array_schema_.var_size(name);
   const bool nullable = array_schema_.is_nullable(name);
 
-  // Filter all tiles
-  auto tile_num = tiles->size();
+  // Filter all tiles in the range
+  auto tile_num = end_tile_idx - start_tile_idx;
 
   // Process all tiles, minus offsets, they get processed separately.
   std::vector<std::tuple<WriterTile*, WriterTile*, bool, bool>> args;
   args.reserve(tile_num * (1 + nullable));
-  for (auto& tile : *tiles) {
+  for (uint64_t t = start_tile_idx; t < end_tile_idx; t++) {
+    auto& tile = (*tiles)[t];
     if (var_size) {
       args.emplace_back(&tile.var_tile(), &tile.offset_tile(), false, false);
     } else {
@@ -876,8 +890,8 @@ Status WriterBase::filter_tiles(
   // Process offsets for var size.
   if (var_size) {
     auto status = parallel_for(
-        storage_manager_->compute_tp(), 0, tiles->size(), [&](uint64_t i) {
-          auto& tile = (*tiles)[i];
+        storage_manager_->compute_tp(), 0, tile_num, [&](uint64_t i) {
+          auto& tile = (*tiles)[start_tile_idx + i];
           RETURN_NOT_OK(
               filter_tile(name, &tile.offset_tile(), nullptr, true, false));
           return Status::Ok();
@@ -927,6 +941,14 @@ Status WriterBase::filter_tile(
   bool use_chunking = filters.use_tile_chunking(
       array_schema_.var_size(name), array_schema_.version(), tile->type());
 
+  // Store filter-free fixed-size tiles as a single chunk when requested, so
+  // that readers mapping the fragment files can use them in place.
+  if (single_chunk_unfiltered_tiles_ && filters.empty() &&
+      !array_schema_.var_size(name) &&
+      tile->size() <= std::numeric_limits<uint32_t>::max()) {
+    use_chunking = false;
+  }
+
   assert(!tile->filtered());
   RETURN_NOT_OK(filters.run_forward(
       stats_,
@@ -1099,6 +1121,168 @@ Status WriterBase::write_tiles(
   return Status::Ok();
 }
 
+Status WriterBase::filter_and_write_tiles(
+    const uint64_t start_tile_idx,
+    const uint64_t end_tile_idx,
+    shared_ptr<FragmentMetadata> frag_meta,
+    std::unordered_map<std::string, WriterTileTupleVector>* const tiles) {
+  auto timer_se = stats_->start_timer("filter_and_write_tiles");
+
+  assert(!tiles->empty());
+
+  // Two batches are in flight at a time, one being filtered and one being
+  // written, so each gets half of the memory budget.
+  bool found = false;
+  uint64_t memory_budget = 0;
+  throw_if_not_ok(
+      config_.get<uint64_t>("sm.mem.total_budget", &memory_budget, &found));
+  assert(found);
+  const uint64_t batch_budget = memory_budget / 2;
+  const uint64_t thread_num = std::max<uint64_t>(
+      storage_manager_->compute_tp()->concurrency_level(), 1);
+
+  // Returns the unfiltered size of the tiles of all fields at an index.
+  auto tile_size = [&](uint64_t idx) {
+    uint64_t size = 0;
+    for (auto& it : *tiles) {
+      auto& tile = it.second[idx];
+      if (tile.var_size()) {
+        size += tile.offset_tile().size() + tile.var_tile().size();
+      } else {
+        size += tile.fixed_tile().size();
+      }
+      if (tile.nullable()) {
+        size += tile.validity_tile().size();
+      }
+    }
+    return size;
+  };
+
+  std::optional<ThreadPool::Task> write_task = nullopt;
+  auto wait_for_write = [&]() {
+    if (!write_task.has_value()) {
+      return Status::Ok();
+    }
+    write_task->wait();
+    auto st = write_task->get();
+    write_task = nullopt;
+    return st;
+  };
+
+  uint64_t batch_start = start_tile_idx;
+  while (batch_start < end_tile_idx) {
+    // Compute the tiles of the batch.
+    uint64_t batch_end = batch_start;
+    uint64_t batch_size = 0;
+    do {
+      batch_size += tile_size(batch_end++);
+    } while (batch_end < end_tile_idx &&
+             batch_end - batch_start < thread_num &&
+             batch_size < batch_budget);
+
+    // Filter the batch while the previous one is being written.
+    Status st;
+    try {
+      auto timer_filter = stats_->start_timer("filter_tiles");
+      st = parallel_for(
+          storage_manager_->compute_tp(), 0, tiles->size(), [&](uint64_t i) {
+            auto tiles_it = tiles->begin();
+            std::advance(tiles_it, i);
+            RETURN_CANCEL_OR_ERROR(filter_tiles(
+                tiles_it->first, &tiles_it->second, batch_start, batch_end));
+            return Status::Ok();
+          });
+    } catch (...) {
+      // The batch being written references the tiles.
+      if (write_task.has_value()) {
+        write_task->wait();
+      }
+      throw;
+    }
+
+    // The tiles of a field are appended to its files in order, so the
+    // previous batch must be written before this one.
+    auto write_st = wait_for_write();
+    RETURN_NOT_OK(st);
+    RETURN_NOT_OK(write_st);
+
+    write_task = storage_manager_->io_tp()->execute(
+        [&, batch_start, batch_end]() {
+          return write_tile_batch(
+              start_tile_idx,
+              end_tile_idx,
+              batch_start,
+              batch_end,
+              frag_meta,
+              tiles);
+        });
+    batch_start = batch_end;
+  }
+
+  return wait_for_write();
+}
+
+Status WriterBase::write_tile_batch(
+    const uint64_t start_tile_idx,
+    const uint64_t end_tile_idx,
+    const uint64_t batch_start,
+    const uint64_t batch_end,
+    shared_ptr<FragmentMetadata> frag_meta,
+    std::unordered_map<std::string, WriterTileTupleVector>* const tiles) {
+  const bool last_batch = batch_end == end_tile_idx;
+
+  std::vector<ThreadPool::Task> tasks;
+  for (auto& it : *tiles) {
+    tasks.push_back(storage_manager_->io_tp()->execute([&, this]() {
+      auto& attr = it.first;
+      auto& tiles = it.second;
+      RETURN_CANCEL_OR_ERROR(write_tiles(
+          batch_start,
+          batch_end,
+          attr,
+          frag_meta,
+          batch_start - start_tile_idx,
+          &tiles,
+          last_batch));
+
+      // Free the filtered buffers of the batch.
+      for (uint64_t idx = batch_start; idx < batch_end; idx++) {
+        auto& tile = tiles[idx];
+        if (tile.var_size()) {
+          tile.offset_tile().clear_filtered_buffer();
+          tile.var_tile().clear_filtered_buffer();
+        } else {
+          tile.fixed_tile().clear_filtered_buffer();
+        }
+        if (tile.nullable()) {
+          tile.validity_tile().clear_filtered_buffer();
+        }
+      }
+
+      // Fix var size attributes metadata once all the tiles are written.
+      const auto var_size = array_schema_.var_size(attr);
+      if (last_batch && has_min_max_metadata(attr, var_size) && var_size) {
+        frag_meta->convert_tile_min_max_var_sizes_to_offsets(attr);
+
+        for (uint64_t idx = start_tile_idx; idx < end_tile_idx; idx++) {
+          frag_meta->set_tile_min_var(
+              attr, idx - start_tile_idx, tiles[idx].min());
+          frag_meta->set_tile_max_var(
+              attr, idx - start_tile_idx, tiles[idx].max());
+        }
+      }
+      return Status::Ok();
+    }));
+  }
+
+  // Wait for writes and check all statuses
+  auto statuses = storage_manager_->io_tp()->wait_all_status(tasks);
+  for (auto& st : statuses)
+    RETURN_NOT_OK(st);
+
+  return Status::Ok();
+}
+
 Status WriterBase::write_tiles(
     const uint64_t start_tile_idx,
     const uint64_t end_tile_idx,
@@ -177,6 +177,12 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
    */
   bool dedup_coords_;
 
+  /**
+   * If `true`, fixed-size tiles without filters are written as a single
+   * chunk, so that readers mapping the fragment files can use them in place.
+   */
+  bool single_chunk_unfiltered_tiles_;
+
   /** The name of the new fragment to be created. */
   URI fragment_uri_;
 
@@ -310,14 +316,65 @@ class WriterBase : public StrategyBase, public IQueryStrategy {
       std::unordered_map<std::string, WriterTileTupleVector>* tiles);
 
   /**
-   * Runs the input tiles for the input attribute through the filter pipeline.
-   * The tile buffers are modified to contain the output of the pipeline.
+   * Runs a range of the input tiles for the input attribute through the
+   * filter pipeline. The tile buffers are modified to contain the output of
+   * the pipeline.
    *
    * @param name The attribute/dimension the tiles belong to.
    * @param tile The tiles to be filtered.
+   * @param start_tile_idx Index of the first tile to filter.
+   * @param end_tile_idx Index one past the last tile to filter.
+   * @return Status
+   */
+  Status filter_tiles(
+      const std::string& name,
+      WriterTileTupleVector* tiles,
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx);
+
+  /**
+   * Filters and writes a number of the input tiles for all
+   * dimensions/attributes, overlapping filtering with I/O. The tiles are
+   * processed in batches: a batch is written on the IO thread pool while
+   * the next one is filtered on the compute thread pool, and the filtered
+   * buffers of a batch are freed once written. A batch holds at most as
+   * many tiles as there are compute threads, and at most half of
+   * `sm.mem.total_budget` of unfiltered data, so that the two batches in
+   * flight stay within the memory budget.
+   *
+   * @param start_tile_idx Index of the first tile to write.
+   * @param end_tile_idx Index of the last tile to write.
+   * @param frag_meta Current fragment metadata.
+   * @param tiles Attribute/Coordinate tiles to be written, one element per
+   *     attribute or dimension.
    * @return Status
    */
-  Status filter_tiles(const std::string& name, WriterTileTupleVector* tiles);
+  Status filter_and_write_tiles(
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx,
+      shared_ptr<FragmentMetadata> frag_meta,
+      std::unordered_map<std::string, WriterTileTupleVector>* tiles);
+
+  /**
+   * Writes a batch of filtered tiles for all dimensions/attributes, then
+   * frees their filtered buffers. Used by `filter_and_write_tiles`.
+   *
+   * @param start_tile_idx Index of the first tile of the write.
+   * @param end_tile_idx Index of the last tile of the write.
+   * @param batch_start Index of the first tile of the batch.
+   * @param batch_end Index one past the last tile of the batch.
+   * @param frag_meta Current fragment metadata.
+   * @param tiles Attribute/Coordinate tiles to be written, one element per
+   *     attribute or dimension.
+   * @return Status
+   */
+  Status write_tile_batch(
+      uint64_t start_tile_idx,
+      uint64_t end_tile_idx,
+      uint64_t batch_start,
+      uint64_t batch_end,
+      shared_ptr<FragmentMetadata> frag_meta,
+      std::unordered_map<std::string, WriterTileTupleVector>* tiles);
 
   /**
    * Runs the input tile for the input attribute/dimension through the filter
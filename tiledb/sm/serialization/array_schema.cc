@@ -50,6 +50,7 @@
 #include "tiledb/sm/enums/filter_type.h"
 #include "tiledb/sm/enums/layout.h"
 #include "tiledb/sm/enums/serialization_type.h"
+#include "tiledb/sm/filter/adaptive_compression_filter.h"
 #include "tiledb/sm/filter/bit_width_reduction_filter.h"
 #include "tiledb/sm/filter/bitshuffle_filter.h"
 #include "tiledb/sm/filter/byteshuffle_filter.h"
@@ -60,6 +61,7 @@
 #include "tiledb/sm/filter/filter_create.h"
 #include "tiledb/sm/filter/float_scaling_filter.h"
 #include "tiledb/sm/filter/noop_filter.h"
+#include "tiledb/sm/filter/pfor_filter.h"
 #include "tiledb/sm/filter/positive_delta_filter.h"
 #include "tiledb/sm/filter/webp_filter.h"
 #include "tiledb/sm/filter/xor_filter.h"
@@ -127,6 +129,14 @@ Status filter_to_capnp(
       config.setByteWidth(byte_width);
       break;
     }
+    case FilterType::FILTER_ADAPTIVE_COMPRESSION: {
+      double weight;
+      RETURN_NOT_OK(filter->get_option(
+          FilterOption::ADAPTIVE_DECODE_COST_WEIGHT, &weight));
+      auto data = filter_builder->initData();
+      data.setFloat64(weight);
+      break;
+    }
     case FilterType::FILTER_NONE:
     case FilterType::FILTER_BITSHUFFLE:
     case FilterType::FILTER_BYTESHUFFLE:
@@ -136,6 +146,7 @@ Status filter_to_capnp(
     case FilterType::FILTER_XOR:
     case FilterType::FILTER_DEPRECATED:
     case FilterType::FILTER_WEBP:
+    case FilterType::FILTER_PFOR:
       break;
   }
 
@@ -248,6 +259,19 @@ tuple<Status, optional<shared_ptr<Filter>>> filter_from_capnp(
         throw WebpNotPresentError();
       }
     }
+    case FilterType::FILTER_ADAPTIVE_COMPRESSION: {
+      auto data = filter_reader.getData();
+      double weight = data.isFloat64() ?
+                          data.getFloat64() :
+                          AdaptiveCompressionFilter::default_decode_cost_weight;
+      return {
+          Status::Ok(),
+          tiledb::common::make_shared<AdaptiveCompressionFilter>(
+              HERE(), weight)};
+    }
+    case FilterType::FILTER_PFOR: {
+      return {Status::Ok(), tiledb::common::make_shared<PFORFilter>(HERE())};
+    }
     default: {
       throw std::logic_error(
           "Invalid data received from filter pipeline capnp reader, unknown "
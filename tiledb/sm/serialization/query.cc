@@ -667,6 +667,13 @@ static Status condition_ast_to_capnp(
     // Store the boolean expression tag.
     ast_builder->setIsExpression(false);
 
+    // Set membership conditions have no capnp representation yet.
+    if (is_set_membership_op(node->get_op())) {
+      return Status_SerializationError(
+          "Cannot serialize query condition; Set membership operators are "
+          "not supported");
+    }
+
     // Validate and store the field name.
     const std::string field_name = node->get_field_name();
     ensure_qc_field_name_is_valid(field_name);
@@ -714,6 +721,13 @@ static Status condition_ast_to_capnp(
 static void clause_to_capnp(
     const tdb_unique_ptr<ASTNode>& node,
     capnp::ConditionClause::Builder* clause_builder) {
+  // Set membership conditions have no capnp representation yet.
+  if (is_set_membership_op(node->get_op())) {
+    throw std::runtime_error(
+        "Cannot serialize query condition; Set membership operators are not "
+        "supported");
+  }
+
   // Validate and store the field name.
   std::string field_name = node->get_field_name();
   ensure_qc_field_name_is_valid(field_name);
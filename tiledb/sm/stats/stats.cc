@@ -187,6 +187,17 @@ void Stats::add_counter(const std::string& stat, uint64_t count) {
   }
 }
 
+void Stats::set_max_counter(const std::string& stat, uint64_t value) {
+  if (!enabled_) {
+    return;
+  }
+
+  std::string new_stat = prefix_ + stat;
+  std::unique_lock<std::mutex> lck(mtx_);
+  auto& counter = counters_[new_stat];
+  counter = std::max(counter, value);
+}
+
 DurationInstrument<Stats> Stats::start_timer(const std::string& stat) {
   return DurationInstrument<Stats>(*this, stat);
 }
@@ -231,6 +242,9 @@ void Stats::report_duration(
 void Stats::add_counter(const std::string&, uint64_t) {
 }
 
+void Stats::set_max_counter(const std::string&, uint64_t) {
+}
+
 int Stats::start_timer(const std::string&) {
   return 0;
 }
@@ -92,6 +92,9 @@ class Stats {
   /** Adds `count` to the input counter stat. */
   void add_counter(const std::string& stat, uint64_t count);
 
+  /** Raises the input counter stat to `value` if it is lower. */
+  void set_max_counter(const std::string& stat, uint64_t value);
+
   /** Returns true if statistics are currently enabled. */
   bool enabled() const;
 
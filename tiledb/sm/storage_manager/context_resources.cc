@@ -58,7 +58,15 @@ ContextResources::ContextResources(
     , compute_tp_(compute_thread_count)
     , io_tp_(io_thread_count)
     , stats_(make_shared<stats::Stats>(HERE(), stats_name))
-    , vfs_(stats_.get(), &compute_tp_, &io_tp_, config) {
+    , vfs_(stats_.get(), &compute_tp_, &io_tp_, config)
+    , memory_tracker_()
+    , tile_cache_(
+          config.get<uint64_t>("sm.tile_cache_size", Config::must_find),
+          &memory_tracker_)
+    , fragment_metadata_cache_(config.get<uint64_t>(
+          "sm.fragment_metadata_cache_size", Config::must_find))
+    , array_schema_cache_(config.get<uint64_t>(
+          "sm.array_schema_cache_size", Config::must_find)) {
   /*
    * Explicitly register our `stats` object with the global.
    */
@@ -68,6 +76,12 @@ ContextResources::ContextResources(
     throw std::logic_error("Logger must not be nullptr");
   }
 
+  auto context_budget =
+      config.get<uint64_t>("sm.mem.context_budget", Config::must_find);
+  if (context_budget != 0) {
+    memory_tracker_.set_budget(context_budget);
+  }
+
   if constexpr (TILEDB_SERIALIZATION_ENABLED) {
     auto server_address = config_.get<std::string>("rest.server_address");
     if (server_address) {
@@ -35,7 +35,11 @@
 
 #include "tiledb/common/exception/exception.h"
 #include "tiledb/common/logger_public.h"
+#include "tiledb/common/memory_tracker.h"
 #include "tiledb/common/thread_pool/thread_pool.h"
+#include "tiledb/sm/cache/array_schema_cache.h"
+#include "tiledb/sm/cache/fragment_metadata_cache.h"
+#include "tiledb/sm/cache/tile_cache.h"
 #include "tiledb/sm/config/config.h"
 #include "tiledb/sm/filesystem/vfs.h"
 #include "tiledb/sm/stats/global_stats.h"
@@ -109,6 +113,29 @@ class ContextResources {
     return rest_client_;
   }
 
+  /** Returns the cache of unfiltered tiles shared by all readers. */
+  [[nodiscard]] inline TileCache& tile_cache() const {
+    return tile_cache_;
+  }
+
+  /** Returns the cache of fragment metadata components shared by arrays. */
+  [[nodiscard]] inline FragmentMetadataCache& fragment_metadata_cache() const {
+    return fragment_metadata_cache_;
+  }
+
+  /** Returns the cache of array schemas shared by arrays. */
+  [[nodiscard]] inline ArraySchemaCache& array_schema_cache() const {
+    return array_schema_cache_;
+  }
+
+  /**
+   * Returns the root memory tracker of the context, budgeted by
+   * `sm.mem.context_budget`.
+   */
+  [[nodiscard]] inline MemoryTracker& memory_tracker() const {
+    return memory_tracker_;
+  }
+
  private:
   /* ********************************* */
   /*         PRIVATE ATTRIBUTES        */
@@ -137,6 +164,24 @@ class ContextResources {
 
   /** The rest client (may be null if none was configured). */
   shared_ptr<RestClient> rest_client_;
+
+  /**
+   * The root memory tracker. Arrays and readers track memory under it. It is
+   * declared before the caches charged to it so that it outlives them.
+   */
+  mutable MemoryTracker memory_tracker_;
+
+  /** The cache of unfiltered tiles, sized by `sm.tile_cache_size`. */
+  mutable TileCache tile_cache_;
+
+  /**
+   * The cache of fragment metadata components, sized by
+   * `sm.fragment_metadata_cache_size`.
+   */
+  mutable FragmentMetadataCache fragment_metadata_cache_;
+
+  /** The cache of array schemas, sized by `sm.array_schema_cache_size`. */
+  mutable ArraySchemaCache array_schema_cache_;
 };
 
 }  // namespace tiledb::sm
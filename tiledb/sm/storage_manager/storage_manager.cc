@@ -1332,6 +1332,20 @@ StorageManagerCanonical::load_array_schema_from_uri(
     const URI& schema_uri, const EncryptionKey& encryption_key) {
   auto timer_se = stats()->start_timer("sm_load_array_schema_from_uri");
 
+  // Serve the schema from the cache if possible. Decrypted schemas are never
+  // cached, so that they cannot be served without the key.
+  auto& cache{resources_.array_schema_cache()};
+  const bool use_cache =
+      cache.enabled() &&
+      encryption_key.encryption_type() == EncryptionType::NO_ENCRYPTION;
+  if (use_cache) {
+    auto cached{cache.read(schema_uri.to_string())};
+    if (cached != nullptr) {
+      stats()->add_counter("num_array_schema_cache_hits", 1);
+      return {Status::Ok(), cached};
+    }
+  }
+
   auto&& [st, tile_opt] =
       load_data_from_generic_tile(schema_uri, 0, encryption_key);
   RETURN_NOT_OK_TUPLE(st, nullopt);
@@ -1343,10 +1357,12 @@ StorageManagerCanonical::load_array_schema_from_uri(
   Deserializer deserializer(tile.data(), tile.size());
 
   try {
-    return {
-        Status::Ok(),
-        make_shared<ArraySchema>(
-            HERE(), ArraySchema::deserialize(deserializer, schema_uri))};
+    auto array_schema = make_shared<ArraySchema>(
+        HERE(), ArraySchema::deserialize(deserializer, schema_uri));
+    if (use_cache) {
+      cache.insert(schema_uri.to_string(), *array_schema, tile.size());
+    }
+    return {Status::Ok(), array_schema};
   } catch (const StatusException& e) {
     return {Status_StorageManagerError(e.what()), nullopt};
   }
@@ -0,0 +1,91 @@
+/**
+ * @file   encoded_strings.cc
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file implements class EncodedStrings.
+ */
+
+#include "tiledb/sm/tile/encoded_strings.h"
+
+#include <algorithm>
+
+namespace tiledb {
+namespace sm {
+
+/* ****************************** */
+/*   CONSTRUCTORS & DESTRUCTORS   */
+/* ****************************** */
+
+EncodedStrings::EncodedStrings(
+    bool dictionary,
+    std::vector<std::string>&& values,
+    std::vector<uint32_t>&& ids,
+    std::vector<uint64_t>&& run_ends)
+    : dictionary_(dictionary)
+    , values_(std::move(values))
+    , ids_(std::move(ids))
+    , run_ends_(std::move(run_ends)) {
+}
+
+EncodedStrings EncodedStrings::from_dictionary(
+    std::vector<std::string>&& dictionary, std::vector<uint32_t>&& ids) {
+  return EncodedStrings(true, std::move(dictionary), std::move(ids), {});
+}
+
+EncodedStrings EncodedStrings::from_runs(
+    std::vector<std::string>&& values, std::vector<uint64_t>&& run_ends) {
+  return EncodedStrings(false, std::move(values), {}, std::move(run_ends));
+}
+
+/* ****************************** */
+/*               API              */
+/* ****************************** */
+
+uint64_t EncodedStrings::value_index(uint64_t cell, uint64_t& run) const {
+  if (dictionary_) {
+    return ids_[cell];
+  }
+
+  // Move forward a few runs, then fall back to a binary search.
+  const uint64_t start = run < run_ends_.size() ? run : 0;
+  if (start > 0 && run_ends_[start - 1] > cell) {
+    run = std::upper_bound(run_ends_.begin(), run_ends_.begin() + start, cell) -
+          run_ends_.begin();
+    return run;
+  }
+  for (run = start; run < run_ends_.size() && run < start + 8; run++) {
+    if (run_ends_[run] > cell)
+      return run;
+  }
+  run = std::upper_bound(run_ends_.begin() + run, run_ends_.end(), cell) -
+        run_ends_.begin();
+  return run;
+}
+
+}  // namespace sm
+}  // namespace tiledb
@@ -0,0 +1,153 @@
+/**
+ * @file   encoded_strings.h
+ *
+ * @section LICENSE
+ *
+ * The MIT License
+ *
+ * @copyright Copyright (c) 2023 TileDB, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * @section DESCRIPTION
+ *
+ * This file defines class EncodedStrings.
+ */
+
+#ifndef TILEDB_ENCODED_STRINGS_H
+#define TILEDB_ENCODED_STRINGS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tiledb {
+namespace sm {
+
+/**
+ * The dictionary- or run-length-encoded form of the cells of a var-sized
+ * string tile. It is kept next to the decoded cells so that predicates can
+ * be evaluated once per distinct value or run, and then mapped over the
+ * cells.
+ */
+class EncodedStrings {
+ public:
+  /**
+   * The minimum average number of cells per value for which keeping the
+   * encoded form pays off.
+   */
+  static constexpr uint64_t min_cells_per_value = 4;
+
+  /* ********************************* */
+  /*     CONSTRUCTORS & DESTRUCTORS    */
+  /* ********************************* */
+
+  /**
+   * Creates dictionary-encoded strings.
+   *
+   * @param dictionary The distinct values.
+   * @param ids The index in `dictionary` of the value of every cell.
+   */
+  static EncodedStrings from_dictionary(
+      std::vector<std::string>&& dictionary, std::vector<uint32_t>&& ids);
+
+  /**
+   * Creates run-length-encoded strings.
+   *
+   * @param values The value of every run.
+   * @param run_ends The number of cells up to and including every run.
+   */
+  static EncodedStrings from_runs(
+      std::vector<std::string>&& values, std::vector<uint64_t>&& run_ends);
+
+  /* ********************************* */
+  /*                API                */
+  /* ********************************* */
+
+  /**
+   * Returns whether keeping the encoded form of `cell_num` cells with
+   * `value_num` values pays off.
+   */
+  static bool worth_keeping(uint64_t value_num, uint64_t cell_num) {
+    return value_num * min_cells_per_value <= cell_num;
+  }
+
+  /**
+   * Returns an upper bound of the memory held by the encoded form of
+   * `cell_num` cells totalling `var_size` bytes, used to charge it to the
+   * reader memory budgets before the tile is unfiltered.
+   */
+  static uint64_t max_size(uint64_t var_size, uint64_t cell_num) {
+    return var_size + cell_num * sizeof(uint32_t) +
+           cell_num / min_cells_per_value * sizeof(std::string);
+  }
+
+  /** Returns the number of cells. */
+  uint64_t cell_num() const {
+    return dictionary_ ? ids_.size() :
+                         (run_ends_.empty() ? 0 : run_ends_.back());
+  }
+
+  /** Returns the distinct values or the values of the runs. */
+  const std::vector<std::string>& values() const {
+    return values_;
+  }
+
+  /**
+   * Returns the index in values() of the value of a cell.
+   *
+   * @param cell The cell index.
+   * @param run The run to start looking from. Updated to the run of the cell,
+   *     so that visiting cells in increasing order is amortized constant time.
+   */
+  uint64_t value_index(uint64_t cell, uint64_t& run) const;
+
+ private:
+  /* ********************************* */
+  /*     PRIVATE CONSTRUCTORS          */
+  /* ********************************* */
+
+  /** Constructor. */
+  EncodedStrings(
+      bool dictionary,
+      std::vector<std::string>&& values,
+      std::vector<uint32_t>&& ids,
+      std::vector<uint64_t>&& run_ends);
+
+  /* ********************************* */
+  /*         PRIVATE ATTRIBUTES        */
+  /* ********************************* */
+
+  /** Whether the strings are dictionary-encoded, or else run-length-encoded. */
+  bool dictionary_;
+
+  /** The distinct values, or the value of every run. */
+  std::vector<std::string> values_;
+
+  /** Dictionary encoding: the index in `values_` of every cell. */
+  std::vector<uint32_t> ids_;
+
+  /** Run-length encoding: the number of cells up to and including a run. */
+  std::vector<uint64_t> run_ends_;
+};
+
+}  // namespace sm
+}  // namespace tiledb
+
+#endif  // TILEDB_ENCODED_STRINGS_H
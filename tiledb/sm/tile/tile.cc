@@ -146,7 +146,9 @@ Tile::Tile(Tile&& tile)
     : TileBase(std::move(tile))
     , zipped_coords_dim_num_(std::move(tile.zipped_coords_dim_num_))
     , filtered_data_(std::move(tile.filtered_data_))
-    , filtered_size_(std::move(tile.filtered_size_)) {
+    , filtered_size_(std::move(tile.filtered_size_))
+    , data_owner_(std::move(tile.data_owner_))
+    , encoded_strings_(std::move(tile.encoded_strings_)) {
 }
 
 Tile& Tile::operator=(Tile&& tile) {
@@ -280,6 +282,15 @@ void Tile::swap(Tile& tile) {
   std::swap(filtered_data_, tile.filtered_data_);
   std::swap(filtered_size_, tile.filtered_size_);
   std::swap(zipped_coords_dim_num_, tile.zipped_coords_dim_num_);
+  std::swap(data_owner_, tile.data_owner_);
+  std::swap(encoded_strings_, tile.encoded_strings_);
+}
+
+void Tile::set_data_view(void* data, shared_ptr<void> owner) {
+  // The view is not freed by the tile, its memory is released with the owner.
+  data_ = std::unique_ptr<char, void (*)(void*)>(
+      static_cast<char*>(data), [](void*) {});
+  data_owner_ = std::move(owner);
 }
 
 void WriterTile::clear_data() {
@@ -45,6 +45,8 @@ using namespace tiledb::common;
 namespace tiledb {
 namespace sm {
 
+class EncodedStrings;
+
 /**
  * Base class for common code between Tile and WriterTile objects.
  */
@@ -255,6 +257,31 @@ class Tile : public TileBase {
     return filtered_size_;
   }
 
+  /**
+   * Makes the tile data a view of external memory holding the unfiltered
+   * data, instead of a buffer owned by the tile. The previous buffer is freed.
+   *
+   * @param data The unfiltered data, of at least `size()` bytes.
+   * @param owner Keeps the external memory alive as long as the tile uses it.
+   */
+  void set_data_view(void* data, shared_ptr<void> owner);
+
+  /**
+   * Returns the encoded form of the var-sized string cells whose offsets this
+   * tile stores, if it was kept while unfiltering, or nullptr.
+   */
+  inline const EncodedStrings* encoded_strings() const {
+    return encoded_strings_.get();
+  }
+
+  /**
+   * Keeps the encoded form of the var-sized string cells whose offsets this
+   * tile stores.
+   */
+  void set_encoded_strings(shared_ptr<const EncodedStrings> encoded_strings) {
+    encoded_strings_ = std::move(encoded_strings);
+  }
+
   /**
    * Zips the coordinate values such that a cell's coordinates across
    * all dimensions appear contiguously in the buffer.
@@ -313,6 +340,12 @@ class Tile : public TileBase {
 
   /** The size of the filtered data. */
   uint64_t filtered_size_;
+
+  /** Keeps the external memory alive when the tile data is a view. */
+  shared_ptr<void> data_owner_;
+
+  /** The encoded form of the string cells, see `encoded_strings()`. */
+  shared_ptr<const EncodedStrings> encoded_strings_;
 };
 
 /**
@@ -393,6 +426,12 @@ class WriterTile : public TileBase {
     return filtered_buffer_;
   }
 
+  /** Frees the filtered buffer, once the tile has been written. */
+  inline void clear_filtered_buffer() {
+    FilteredBuffer empty(0);
+    filtered_buffer_.swap(empty);
+  }
+
   /**
    * Write method used for var data. Resizes the internal buffer if needed.
    *